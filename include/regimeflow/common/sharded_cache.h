@@ -0,0 +1,368 @@
+/**
+ * @file sharded_cache.h
+ * @brief RegimeFlow regimeflow sharded concurrent cache declarations.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace regimeflow
+{
+    /**
+     * @brief Eviction policy of a ShardedCache.
+     */
+    enum class CacheEviction {
+        /**
+         * @brief Evict the least recently used entry; hits reorder a list.
+         */
+        Lru,
+        /**
+         * @brief Second-chance CLOCK; hits only set a reference bit, so
+         * they run under a shared lock.
+         */
+        Clock
+    };
+
+    /**
+     * @brief Parse an eviction policy name (lru, clock).
+     * @param name Policy name.
+     * @param fallback Value returned for unknown names.
+     */
+    inline CacheEviction parse_cache_eviction(const std::string_view name,
+                                              const CacheEviction fallback = CacheEviction::Lru) {
+        if (name == "lru") {
+            return CacheEviction::Lru;
+        }
+        if (name == "clock") {
+            return CacheEviction::Clock;
+        }
+        return fallback;
+    }
+
+    /**
+     * @brief ShardedCache limits and policy.
+     */
+    struct ShardedCacheOptions {
+        /**
+         * @brief Maximum number of entries (0 = no entry limit).
+         */
+        size_t max_entries = 0;
+        /**
+         * @brief Maximum total weight (0 = no weight limit).
+         */
+        size_t max_weight = 0;
+        /**
+         * @brief Number of shards (at least 1; at most either non-zero limit).
+         */
+        size_t shards = 16;
+        /**
+         * @brief Eviction policy.
+         */
+        CacheEviction eviction = CacheEviction::Lru;
+    };
+
+    /**
+     * @brief ShardedCache hit, miss and eviction counts.
+     */
+    struct ShardedCacheStats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+    };
+
+    /**
+     * @brief Thread-safe cache split into independently locked shards, with
+     * an entry limit and a weight (byte) budget.
+     *
+     * @details Keys hash to a shard, and each shard owns an equal part of
+     * both limits, so one hot shard can evict while others still have room.
+     * The weigher reports an entry's cost (for example its heap bytes); without
+     * one every entry weighs 1. An entry heavier than its shard's whole
+     * budget is not cached. Values are returned by copy, so cache
+     * `shared_ptr`s to large objects.
+     * @tparam Key Key type (must be hashable).
+     * @tparam Value Value type.
+     * @tparam Hash Hash functor for Key.
+     */
+    template <typename Key, typename Value, typename Hash = std::hash<Key>>
+    class ShardedCache {
+    public:
+        /**
+         * @brief Entry cost function.
+         */
+        using Weigher = std::function<size_t(const Key&, const Value&)>;
+
+        /**
+         * @brief Cache limits and policy.
+         */
+        using Options = ShardedCacheOptions;
+        /**
+         * @brief Counters summed over all shards.
+         */
+        using Stats = ShardedCacheStats;
+
+        /**
+         * @brief Construct a cache. With both limits 0 the cache stores nothing.
+         * @param options Limits and policy.
+         * @param weigher Entry cost function (empty = 1 per entry).
+         */
+        explicit ShardedCache(const Options& options, Weigher weigher = {})
+            : options_(options), weigher_(std::move(weigher)) {
+            size_t count = std::max<size_t>(options_.shards, 1);
+            if (options_.max_entries > 0) {
+                count = std::min(count, options_.max_entries);
+            }
+            if (options_.max_weight > 0) {
+                count = std::min(count, options_.max_weight);
+            }
+            shards_.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                auto shard = std::make_unique<Shard>();
+                shard->max_entries = split(options_.max_entries, count, i);
+                shard->max_weight = split(options_.max_weight, count, i);
+                shard->hand = shard->nodes.end();
+                shards_.push_back(std::move(shard));
+            }
+        }
+
+        ShardedCache(const ShardedCache&) = delete;
+        ShardedCache& operator=(const ShardedCache&) = delete;
+
+        /**
+         * @brief True if the cache can hold anything.
+         */
+        [[nodiscard]] bool enabled() const { return options_.max_entries > 0 || options_.max_weight > 0; }
+        /**
+         * @brief Limits and policy.
+         */
+        [[nodiscard]] const Options& options() const { return options_; }
+
+        /**
+         * @brief Fetch a value and mark it as recently used.
+         * @param key Key to lookup.
+         * @return Optional value, empty if missing.
+         */
+        std::optional<Value> get(const Key& key) {
+            auto& shard = shard_for(key);
+            if (options_.eviction == CacheEviction::Clock) {
+                std::shared_lock lock(shard.mutex);
+                const auto it = shard.index.find(key);
+                if (it == shard.index.end()) {
+                    shard.misses.fetch_add(1, std::memory_order_relaxed);
+                    return std::nullopt;
+                }
+                it->second->referenced.store(true, std::memory_order_relaxed);
+                shard.hits.fetch_add(1, std::memory_order_relaxed);
+                return it->second->value;
+            }
+            std::unique_lock lock(shard.mutex);
+            const auto it = shard.index.find(key);
+            if (it == shard.index.end()) {
+                shard.misses.fetch_add(1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+            shard.nodes.splice(shard.nodes.begin(), shard.nodes, it->second);
+            shard.hits.fetch_add(1, std::memory_order_relaxed);
+            return it->second->value;
+        }
+
+        /**
+         * @brief Insert or update a value, evicting as needed.
+         * @param key Key to insert.
+         * @param value Value to store.
+         */
+        void put(const Key& key, Value value) {
+            if (!enabled()) {
+                return;
+            }
+            const size_t weight = weigher_ ? weigher_(key, value) : 1;
+            auto& shard = shard_for(key);
+            std::unique_lock lock(shard.mutex);
+            if (const auto it = shard.index.find(key); it != shard.index.end()) {
+                auto& node = *it->second;
+                shard.weight = shard.weight - node.weight + weight;
+                node.value = std::move(value);
+                node.weight = weight;
+                touch(shard, it->second);
+                while (over_limit(shard, 0, 0)) {
+                    evict_one(shard);
+                }
+                return;
+            }
+            if (shard.max_weight > 0 && weight > shard.max_weight) {
+                return;
+            }
+            while (!shard.nodes.empty() && over_limit(shard, 1, weight)) {
+                evict_one(shard);
+            }
+            // CLOCK inserts just behind the hand, so new entries are examined last.
+            const auto pos = options_.eviction == CacheEviction::Clock ? shard.hand : shard.nodes.begin();
+            const auto node = shard.nodes.emplace(pos, key, std::move(value), weight);
+            shard.index.emplace(key, node);
+            shard.weight += weight;
+        }
+
+        /**
+         * @brief Remove one entry.
+         * @return True if the key was present.
+         */
+        bool erase(const Key& key) {
+            auto& shard = shard_for(key);
+            std::unique_lock lock(shard.mutex);
+            const auto it = shard.index.find(key);
+            if (it == shard.index.end()) {
+                return false;
+            }
+            remove(shard, it->second);
+            return true;
+        }
+
+        /**
+         * @brief Clear all entries from the cache.
+         */
+        void clear() {
+            for (auto& shard : shards_) {
+                std::unique_lock lock(shard->mutex);
+                shard->index.clear();
+                shard->nodes.clear();
+                shard->hand = shard->nodes.end();
+                shard->weight = 0;
+            }
+        }
+
+        /**
+         * @brief Current number of entries.
+         */
+        [[nodiscard]] size_t size() const {
+            size_t total = 0;
+            for (const auto& shard : shards_) {
+                std::shared_lock lock(shard->mutex);
+                total += shard->index.size();
+            }
+            return total;
+        }
+
+        /**
+         * @brief Current total weight.
+         */
+        [[nodiscard]] size_t weight() const {
+            size_t total = 0;
+            for (const auto& shard : shards_) {
+                std::shared_lock lock(shard->mutex);
+                total += shard->weight;
+            }
+            return total;
+        }
+
+        /**
+         * @brief Hit, miss and eviction counts.
+         */
+        [[nodiscard]] Stats stats() const {
+            Stats total;
+            for (const auto& shard : shards_) {
+                total.hits += shard->hits.load(std::memory_order_relaxed);
+                total.misses += shard->misses.load(std::memory_order_relaxed);
+                total.evictions += shard->evictions.load(std::memory_order_relaxed);
+            }
+            return total;
+        }
+
+    private:
+        struct Node {
+            Node(const Key& k, Value v, const size_t w) : key(k), value(std::move(v)), weight(w) {}
+
+            Key key;
+            Value value;
+            size_t weight = 0;
+            std::atomic<bool> referenced{false};
+        };
+
+        using NodeIt = typename std::list<Node>::iterator;
+
+        struct alignas(64) Shard {
+            mutable std::shared_mutex mutex;
+            std::list<Node> nodes;
+            std::unordered_map<Key, NodeIt, Hash> index;
+            NodeIt hand;
+            size_t weight = 0;
+            size_t max_entries = 0;
+            size_t max_weight = 0;
+            std::atomic<uint64_t> hits{0};
+            std::atomic<uint64_t> misses{0};
+            std::atomic<uint64_t> evictions{0};
+        };
+
+        // Share `total` out over `count` shards, spreading the remainder.
+        static size_t split(const size_t total, const size_t count, const size_t i) {
+            return total / count + (i < total % count ? 1 : 0);
+        }
+
+        Shard& shard_for(const Key& key) const {
+            const auto h = static_cast<uint64_t>(Hash{}(key));
+            const auto mixed = static_cast<size_t>((h * 0x9E3779B97F4A7C15ULL) >> 32);
+            return *shards_[mixed % shards_.size()];
+        }
+
+        void touch(Shard& shard, const NodeIt node) const {
+            if (options_.eviction == CacheEviction::Clock) {
+                node->referenced.store(true, std::memory_order_relaxed);
+            } else {
+                shard.nodes.splice(shard.nodes.begin(), shard.nodes, node);
+            }
+        }
+
+        void remove(Shard& shard, const NodeIt node) const {
+            if (shard.hand == node) {
+                ++shard.hand;
+            }
+            shard.weight -= node->weight;
+            shard.index.erase(node->key);
+            shard.nodes.erase(node);
+        }
+
+        // True if the shard would exceed a limit after adding `entries` and `weight`.
+        [[nodiscard]] static bool over_limit(const Shard& shard, const size_t entries, const size_t weight) {
+            return (shard.max_entries > 0 && shard.nodes.size() + entries > shard.max_entries) ||
+                   (shard.max_weight > 0 && shard.weight + weight > shard.max_weight);
+        }
+
+        void evict_one(Shard& shard) const {
+            NodeIt victim;
+            if (options_.eviction == CacheEviction::Clock) {
+                // Referenced entries get a second chance; at most one full sweep.
+                while (true) {
+                    if (shard.hand == shard.nodes.end()) {
+                        shard.hand = shard.nodes.begin();
+                    }
+                    if (!shard.hand->referenced.exchange(false, std::memory_order_relaxed)) {
+                        break;
+                    }
+                    ++shard.hand;
+                }
+                victim = shard.hand;
+            } else {
+                victim = std::prev(shard.nodes.end());
+            }
+            remove(shard, victim);
+            shard.evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Options options_;
+        Weigher weigher_;
+        std::vector<std::unique_ptr<Shard>> shards_;
+    };
+}  // namespace regimeflow
@@ -0,0 +1,286 @@
+/**
+ * @file symbol_table.h
+ * @brief RegimeFlow regimeflow dense SymbolId-indexed containers.
+ */
+
+#pragma once
+
+#include "regimeflow/common/types.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace regimeflow
+{
+    /**
+     * @brief Dense presence bitmap keyed by SymbolId.
+     *
+     * @details SymbolRegistry hands out small sequential ids, so membership is a
+     * single bit test instead of a hash lookup. Storage grows to the largest id
+     * inserted.
+     */
+    class SymbolSet {
+    public:
+        /**
+         * @brief Check membership.
+         * @param symbol Symbol ID.
+         */
+        [[nodiscard]] bool contains(const SymbolId symbol) const {
+            const size_t word = symbol >> 6;
+            return word < bits_.size() && (bits_[word] >> (symbol & 63) & 1u) != 0;
+        }
+
+        /**
+         * @brief Add a symbol.
+         * @param symbol Symbol ID.
+         * @return True if newly inserted.
+         */
+        bool insert(const SymbolId symbol) {
+            const size_t word = symbol >> 6;
+            if (word >= bits_.size()) {
+                bits_.resize(word + 1, 0);
+            }
+            const uint64_t mask = uint64_t{1} << (symbol & 63);
+            if ((bits_[word] & mask) != 0) {
+                return false;
+            }
+            bits_[word] |= mask;
+            ++size_;
+            return true;
+        }
+
+        /**
+         * @brief Add a symbol (set-compatible alias of insert).
+         * @param symbol Symbol ID.
+         * @return True if newly inserted.
+         */
+        bool emplace(const SymbolId symbol) { return insert(symbol); }
+
+        /**
+         * @brief Remove a symbol.
+         * @param symbol Symbol ID.
+         * @return Number of removed entries (0 or 1).
+         */
+        size_t erase(const SymbolId symbol) {
+            const size_t word = symbol >> 6;
+            const uint64_t mask = uint64_t{1} << (symbol & 63);
+            if (word >= bits_.size() || (bits_[word] & mask) == 0) {
+                return 0;
+            }
+            bits_[word] &= ~mask;
+            --size_;
+            return 1;
+        }
+
+        /**
+         * @brief Number of members.
+         */
+        [[nodiscard]] size_t size() const { return size_; }
+        /**
+         * @brief Check if the set is empty.
+         */
+        [[nodiscard]] bool empty() const { return size_ == 0; }
+        /**
+         * @brief Remove all members, keeping capacity.
+         */
+        void clear() {
+            std::fill(bits_.begin(), bits_.end(), 0);
+            size_ = 0;
+        }
+
+        /**
+         * @brief Smallest member id >= from, scanning a word at a time.
+         * @param from First id to consider.
+         * @param limit Value returned when no member is found.
+         */
+        [[nodiscard]] size_t next(const size_t from, const size_t limit) const {
+            size_t word = from >> 6;
+            if (word >= bits_.size()) {
+                return limit;
+            }
+            uint64_t bits = bits_[word] & (~uint64_t{0} << (from & 63));
+            while (bits == 0) {
+                if (++word == bits_.size()) {
+                    return limit;
+                }
+                bits = bits_[word];
+            }
+            return std::min(word * 64 + static_cast<size_t>(std::countr_zero(bits)), limit);
+        }
+
+        /**
+         * @brief Invoke fn(symbol) for each member in ascending id order.
+         * @param fn Callback.
+         */
+        template<typename Fn>
+        void for_each(Fn&& fn) const {
+            for (size_t word = 0; word < bits_.size(); ++word) {
+                uint64_t bits = bits_[word];
+                while (bits != 0) {
+                    const auto bit = static_cast<size_t>(std::countr_zero(bits));
+                    fn(static_cast<SymbolId>(word * 64 + bit));
+                    bits &= bits - 1;
+                }
+            }
+        }
+
+    private:
+        std::vector<uint64_t> bits_;
+        size_t size_ = 0;
+    };
+
+    /**
+     * @brief Flat SymbolId-indexed table with a presence bitmap.
+     *
+     * @details Replaces std::unordered_map<SymbolId, T> on hot per-symbol paths:
+     * lookups are an index plus a bit test, and values for neighbouring symbols
+     * share cache lines. Iteration visits present entries in ascending id order
+     * and yields map-like {first, second} entries so existing loops keep working.
+     * T must be default constructible; erased slots are reset to T{}.
+     */
+    template<typename T>
+    class SymbolTable {
+    public:
+        /**
+         * @brief Map-like view of one present entry.
+         */
+        template<typename V>
+        struct EntryRef {
+            SymbolId first;
+            V& second;
+        };
+
+        /**
+         * @brief Forward iterator over present entries.
+         */
+        template<typename Table, typename V>
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = EntryRef<V>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = EntryRef<V>;
+
+            Iterator() = default;
+            Iterator(Table* table, const size_t index) : table_(table), index_(index) { skip(); }
+
+            reference operator*() const {
+                return {static_cast<SymbolId>(index_), table_->values_[index_]};
+            }
+            Iterator& operator++() {
+                ++index_;
+                skip();
+                return *this;
+            }
+            Iterator operator++(int) {
+                Iterator copy = *this;
+                ++*this;
+                return copy;
+            }
+            bool operator==(const Iterator& other) const { return index_ == other.index_; }
+
+        private:
+            void skip() {
+                index_ = table_->present_.next(index_, table_->values_.size());
+            }
+
+            Table* table_ = nullptr;
+            size_t index_ = 0;
+        };
+
+        using iterator = Iterator<SymbolTable, T>;
+        using const_iterator = Iterator<const SymbolTable, const T>;
+
+        /**
+         * @brief Check whether a symbol has a value.
+         * @param symbol Symbol ID.
+         */
+        [[nodiscard]] bool contains(const SymbolId symbol) const { return present_.contains(symbol); }
+
+        /**
+         * @brief Find a value.
+         * @param symbol Symbol ID.
+         * @return Pointer to the value, or nullptr if absent.
+         */
+        [[nodiscard]] T* find(const SymbolId symbol) {
+            return present_.contains(symbol) ? &values_[symbol] : nullptr;
+        }
+        /**
+         * @brief Find a value.
+         * @param symbol Symbol ID.
+         * @return Pointer to the value, or nullptr if absent.
+         */
+        [[nodiscard]] const T* find(const SymbolId symbol) const {
+            return present_.contains(symbol) ? &values_[symbol] : nullptr;
+        }
+
+        /**
+         * @brief Access a value, default-inserting it if absent.
+         * @param symbol Symbol ID.
+         * @return Reference to the value.
+         */
+        T& operator[](const SymbolId symbol) {
+            if (symbol >= values_.size()) {
+                values_.resize(static_cast<size_t>(symbol) + 1);
+            }
+            present_.insert(symbol);
+            return values_[symbol];
+        }
+
+        /**
+         * @brief Insert or replace a value.
+         * @param symbol Symbol ID.
+         * @param value Value to store.
+         * @return Reference to the stored value.
+         */
+        T& insert_or_assign(const SymbolId symbol, T value) {
+            T& slot = (*this)[symbol];
+            slot = std::move(value);
+            return slot;
+        }
+
+        /**
+         * @brief Remove a value.
+         * @param symbol Symbol ID.
+         * @return Number of removed entries (0 or 1).
+         */
+        size_t erase(const SymbolId symbol) {
+            if (present_.erase(symbol) == 0) {
+                return 0;
+            }
+            values_[symbol] = T{};
+            return 1;
+        }
+
+        /**
+         * @brief Number of present entries.
+         */
+        [[nodiscard]] size_t size() const { return present_.size(); }
+        /**
+         * @brief Check if the table is empty.
+         */
+        [[nodiscard]] bool empty() const { return present_.empty(); }
+        /**
+         * @brief Remove all entries, keeping capacity.
+         */
+        void clear() {
+            present_.for_each([this](const SymbolId symbol) { values_[symbol] = T{}; });
+            present_.clear();
+        }
+
+        iterator begin() { return iterator(this, 0); }
+        iterator end() { return iterator(this, values_.size()); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, values_.size()); }
+
+    private:
+        std::vector<T> values_;
+        SymbolSet present_;
+    };
+}  // namespace regimeflow
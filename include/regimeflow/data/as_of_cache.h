@@ -0,0 +1,211 @@
+/**
+ * @file as_of_cache.h
+ * @brief RegimeFlow regimeflow as-of lookup helpers.
+ */
+
+#pragma once
+
+#include "regimeflow/common/types.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace regimeflow::data
+{
+    /**
+     * @brief UTC calendar date of a timestamp as YYYYMMDD.
+     *
+     * @details Matches Timestamp::to_string("%Y%m%d"), which the mmap
+     * writers use for their date index, without formatting a string.
+     * @param us Microseconds since the epoch.
+     */
+    inline int32_t utc_yyyymmdd(const int64_t us) {
+        // Civil-from-days (H. Hinnant), on the truncated seconds gmtime sees.
+        const int64_t seconds = us / 1'000'000;
+        int64_t days = seconds / 86'400;
+        if (seconds % 86'400 < 0) {
+            --days;
+        }
+        days += 719'468;
+        const int64_t era = (days >= 0 ? days : days - 146'096) / 146'097;
+        const int64_t doe = days - era * 146'097;
+        const int64_t yoe = (doe - doe / 1460 + doe / 36'524 - doe / 146'096) / 365;
+        const int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const int64_t mp = (5 * doy + 2) / 153;
+        const int64_t day = doy - (153 * mp + 2) / 5 + 1;
+        const int64_t month = mp < 10 ? mp + 3 : mp - 9;
+        const int64_t year = yoe + era * 400 + (month <= 2 ? 1 : 0);
+        return static_cast<int32_t>(year * 10'000 + month * 100 + day);
+    }
+
+    /**
+     * @brief Index of the last row with timestamp <= ts.
+     *
+     * @details When a date index is given, the search is first narrowed to
+     * the rows of the last indexed date on or before ts, so only the small
+     * index and one day of the timestamp column are touched. An index that
+     * does not fit the column is ignored.
+     * @tparam DateIndexEntry Entry with `date_yyyymmdd` and row `offset`.
+     * @param timestamps Sorted timestamp column.
+     * @param index Date index (may be empty).
+     * @param ts Lookup time in microseconds.
+     * @return Row index, or empty if every row is after ts.
+     */
+    template <typename DateIndexEntry>
+    std::optional<size_t> find_as_of_row(const std::span<const int64_t> timestamps,
+                                         const std::span<const DateIndexEntry> index,
+                                         const int64_t ts) {
+        const size_t count = timestamps.size();
+        if (count == 0 || timestamps.front() > ts) {
+            return std::nullopt;
+        }
+        size_t lo = 0;
+        size_t hi = count;
+        if (!index.empty()) {
+            const int32_t date = utc_yyyymmdd(ts);
+            const auto it = std::upper_bound(index.begin(), index.end(), date,
+                                             [](const int32_t d, const DateIndexEntry& entry) {
+                                                 return d < entry.date_yyyymmdd;
+                                             });
+            if (it != index.begin()) {
+                const auto first = static_cast<size_t>((it - 1)->offset);
+                const size_t last = it == index.end() ? count : static_cast<size_t>(it->offset);
+                if (first < last && last <= count) {
+                    lo = first;
+                    hi = last;
+                }
+            }
+        }
+        const auto begin = timestamps.begin();
+        const auto pos = static_cast<size_t>(std::upper_bound(begin + static_cast<std::ptrdiff_t>(lo),
+                                                              begin + static_cast<std::ptrdiff_t>(hi), ts) - begin);
+        // Rows before the narrowed window are on earlier dates, hence <= ts.
+        return pos == 0 ? std::nullopt : std::optional<size_t>(pos - 1);
+    }
+
+    /**
+     * @brief Index of the last row with timestamp <= ts in a sorted column.
+     */
+    inline std::optional<size_t> find_as_of_row(const std::span<const int64_t> timestamps, const int64_t ts) {
+        const auto pos = static_cast<size_t>(std::ranges::upper_bound(timestamps, ts) - timestamps.begin());
+        return pos == 0 ? std::nullopt : std::optional<size_t>(pos - 1);
+    }
+
+    /**
+     * @brief Small direct-mapped cache of as-of results, one slot per key.
+     *
+     * @details Each entry stores a lookup result together with the time
+     * interval [from, until) over which that result does not change, usually
+     * from the row's timestamp to the next row's. Any later lookup inside
+     * the interval is answered without touching the data. Keys hash to a
+     * fixed number of slots and a colliding key simply replaces the entry,
+     * so memory is bounded and lookups never allocate. The optional owner
+     * keeps the backing storage (a mapped file, a column buffer) alive and
+     * lets a miss on the same key reuse it. Like the sources that hold it,
+     * the cache is not synchronized.
+     * @tparam Row Result type.
+     * @tparam Owner Storage type kept alive by an entry.
+     */
+    template <typename Row, typename Owner = void>
+    class AsOfCache {
+    public:
+        /**
+         * @brief Cached result for one key.
+         */
+        struct Entry {
+            uint64_t key = 0;
+            bool used = false;
+            int64_t from = 0;
+            int64_t until = 0;
+            std::optional<Row> row;
+            std::shared_ptr<const Owner> owner;
+
+            /**
+             * @brief True if the result holds at ts.
+             */
+            [[nodiscard]] bool covers(const int64_t ts) const { return from <= ts && ts < until; }
+        };
+
+        /**
+         * @brief Construct with a slot count (rounded up to a power of two).
+         */
+        explicit AsOfCache(const size_t slots = 256)
+            : slots_(std::bit_ceil(std::max<size_t>(slots, 1))), mask_(slots_.size() - 1) {}
+
+        /**
+         * @brief Key for a symbol and a small discriminator (e.g. bar type).
+         */
+        static uint64_t make_key(const SymbolId symbol, const uint8_t kind = 0) {
+            return (static_cast<uint64_t>(symbol) << 8) | kind;
+        }
+
+        /**
+         * @brief Entry currently holding a key, or null.
+         */
+        [[nodiscard]] const Entry* find(const uint64_t key) const {
+            const auto& entry = slots_[slot(key)];
+            return entry.used && entry.key == key ? &entry : nullptr;
+        }
+
+        /**
+         * @brief Cached result at ts, if the key's entry covers it.
+         * @return Null on a miss; otherwise the entry (whose row may be empty).
+         */
+        [[nodiscard]] const Entry* lookup(const uint64_t key, const int64_t ts) const {
+            const auto* entry = find(key);
+            return entry && entry->covers(ts) ? entry : nullptr;
+        }
+
+        /**
+         * @brief Store a result valid over [from, until).
+         */
+        void store(const uint64_t key, const int64_t from, const int64_t until, std::optional<Row> row,
+                   std::shared_ptr<const Owner> owner = nullptr) {
+            auto& entry = slots_[slot(key)];
+            entry.key = key;
+            entry.used = true;
+            entry.from = from;
+            entry.until = until;
+            entry.row = std::move(row);
+            entry.owner = std::move(owner);
+        }
+
+        /**
+         * @brief Store the result of a lookup at row `row` (or none) of a
+         * sorted timestamp column.
+         */
+        void store_row(const uint64_t key, const std::span<const int64_t> timestamps,
+                       const std::optional<size_t> row, std::optional<Row> value,
+                       std::shared_ptr<const Owner> owner = nullptr) {
+            constexpr int64_t lowest = std::numeric_limits<int64_t>::min();
+            constexpr int64_t highest = std::numeric_limits<int64_t>::max();
+            const size_t next = row ? *row + 1 : 0;
+            const int64_t from = row ? timestamps[*row] : lowest;
+            const int64_t until = next < timestamps.size() ? timestamps[next] : highest;
+            store(key, from, until, std::move(value), std::move(owner));
+        }
+
+        /**
+         * @brief Drop every entry.
+         */
+        void clear() {
+            for (auto& entry : slots_) {
+                entry = Entry{};
+            }
+        }
+
+    private:
+        [[nodiscard]] size_t slot(const uint64_t key) const {
+            return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) & mask_;
+        }
+
+        std::vector<Entry> slots_;
+        size_t mask_ = 0;
+    };
+}  // namespace regimeflow::data
@@ -0,0 +1,109 @@
+/**
+ * @file column_codec.h
+ * @brief RegimeFlow regimeflow column codec declarations.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace regimeflow::data
+{
+    /**
+     * @brief Encoding used for one compressed column block.
+     */
+    enum class ColumnCodec : uint8_t {
+        /**
+         * @brief Zigzag varints of the first value, first delta and deltas-of-deltas.
+         */
+        DeltaOfDelta = 1,
+        /**
+         * @brief Values scaled by 10^scale to integers, stored as zigzag varint deltas.
+         */
+        ScaledDecimal = 2,
+        /**
+         * @brief Byte-aligned XOR of consecutive IEEE-754 bit patterns.
+         */
+        XorFloat = 3,
+        /**
+         * @brief Plain unsigned varints.
+         */
+        Varint = 4
+    };
+
+    /**
+     * @brief Codec and parameters of an encoded column.
+     */
+    struct ColumnEncoding {
+        ColumnCodec codec = ColumnCodec::Varint;
+        /**
+         * @brief Decimal digits for ScaledDecimal; unused otherwise.
+         */
+        uint8_t scale = 0;
+    };
+
+    /**
+     * @brief Encode a timestamp column with delta-of-delta varints.
+     * @param values Column values.
+     * @param out Buffer the encoded bytes are appended to.
+     * @return Encoding used.
+     */
+    ColumnEncoding encode_timestamp_column(std::span<const int64_t> values, std::vector<uint8_t>& out);
+
+    /**
+     * @brief Encode a floating-point column.
+     *
+     * @details Uses ScaledDecimal when every value round-trips exactly
+     * through an integer at some scale up to 10^8 (typical for prices on a
+     * tick grid and for share quantities), and XorFloat otherwise.
+     * Decoding is bit-exact in both cases.
+     * @param values Column values.
+     * @param out Buffer the encoded bytes are appended to.
+     * @return Encoding used.
+     */
+    ColumnEncoding encode_price_column(std::span<const double> values, std::vector<uint8_t>& out);
+
+    /**
+     * @brief Encode an unsigned column with plain varints.
+     * @param values Column values.
+     * @param out Buffer the encoded bytes are appended to.
+     * @return Encoding used.
+     */
+    ColumnEncoding encode_varint_column(std::span<const uint64_t> values, std::vector<uint8_t>& out);
+
+    /**
+     * @brief Decoder for encoded column blocks.
+     *
+     * @details Varints are unpacked into a reusable scratch buffer with an
+     * eight-byte fast path for runs of single-byte values. Zigzag, prefix
+     * sum and scaling then run as separate flat loops the compiler can
+     * vectorize. Keep one decoder per thread and reuse it across blocks.
+     */
+    class ColumnDecoder {
+    public:
+        /**
+         * @brief Decode a timestamp column.
+         * @param in Encoded bytes.
+         * @param encoding Column encoding.
+         * @param out Destination; its size is the row count.
+         * @return False if the bytes are malformed or the codec does not match.
+         */
+        bool decode(std::span<const uint8_t> in, ColumnEncoding encoding, std::span<int64_t> out);
+        /**
+         * @brief Decode a floating-point column.
+         */
+        bool decode(std::span<const uint8_t> in, ColumnEncoding encoding, std::span<double> out);
+        /**
+         * @brief Decode an unsigned column.
+         */
+        bool decode(std::span<const uint8_t> in, ColumnEncoding encoding, std::span<uint64_t> out);
+
+    private:
+        bool unpack(std::span<const uint8_t> in, size_t count);
+
+        std::vector<uint64_t> scratch_;
+    };
+}  // namespace regimeflow::data
@@ -0,0 +1,85 @@
+/**
+ * @file column_spill.h
+ * @brief RegimeFlow regimeflow column spill file declarations.
+ */
+
+#pragma once
+
+#include "regimeflow/common/result.h"
+#include "regimeflow/common/sha256.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace regimeflow::data
+{
+    /**
+     * @brief Default rows buffered per column by streaming mmap writers.
+     */
+    inline constexpr size_t kDefaultStreamRows = 65'536;
+
+    /**
+     * @brief Temporary store for columns written before their final offset is known.
+     *
+     * @details Streaming mmap writers buffer a fixed number of rows per
+     * column. When the buffers fill, each column's rows are appended to this
+     * file as one block. At finalize the blocks are read back one column at a
+     * time, so the output keeps its column-major layout while memory use
+     * stays at one block. The file is created on the first block and removed
+     * by the destructor.
+     */
+    class ColumnSpill {
+    public:
+        /**
+         * @brief Construct a spill for fixed-width columns.
+         * @param path Temporary file path.
+         * @param widths Bytes per row for each column.
+         */
+        ColumnSpill(std::string path, std::vector<size_t> widths);
+        ~ColumnSpill();
+
+        ColumnSpill(const ColumnSpill&) = delete;
+        ColumnSpill& operator=(const ColumnSpill&) = delete;
+
+        /**
+         * @brief True until the first block is added.
+         */
+        [[nodiscard]] bool empty() const { return blocks_.empty(); }
+
+        /**
+         * @brief Append one block of rows.
+         * @param rows Rows in the block.
+         * @param columns One pointer per column to `rows` values.
+         * @return Ok on success, IoError otherwise.
+         */
+        Result<void> add_block(size_t rows, std::span<const void* const> columns);
+
+        /**
+         * @brief Copy every block of one column to an output stream.
+         * @param column Column index.
+         * @param out Destination stream.
+         * @param sha Checksum updated with the copied bytes.
+         * @return Ok on success, IoError otherwise.
+         */
+        Result<void> copy_column(size_t column, std::ofstream& out, Sha256& sha);
+
+    private:
+        struct Block {
+            uint64_t offset = 0;
+            size_t rows = 0;
+        };
+
+        std::string path_;
+        std::vector<size_t> widths_;
+        size_t row_bytes_ = 0;
+        std::fstream file_;
+        bool created_ = false;
+        std::vector<Block> blocks_;
+        uint64_t size_ = 0;
+        std::vector<char> buffer_;
+    };
+}  // namespace regimeflow::data
@@ -0,0 +1,107 @@
+/**
+ * @file column_validation.h
+ * @brief RegimeFlow regimeflow column validation declarations.
+ */
+
+#pragma once
+
+#include "regimeflow/common/types.h"
+#include "regimeflow/data/data_validation.h"
+#include "regimeflow/data/validation_config.h"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace regimeflow::data
+{
+    struct BarColumns;
+    struct TickColumns;
+    class MemoryMappedDataFile;
+
+    /**
+     * @brief Borrowed OHLCV columns of one symbol.
+     *
+     * @details All spans must have the same length. The view does not own
+     * the data; the columns must outlive validation.
+     */
+    struct BarColumnsView {
+        SymbolId symbol = 0;
+        std::span<const int64_t> timestamps;
+        std::span<const double> opens;
+        std::span<const double> highs;
+        std::span<const double> lows;
+        std::span<const double> closes;
+        std::span<const uint64_t> volumes;
+
+        /**
+         * @brief View over in-memory columns.
+         */
+        static BarColumnsView of(const BarColumns& columns);
+        /**
+         * @brief View over a mapped bar file.
+         */
+        static BarColumnsView of(const MemoryMappedDataFile& file);
+        /**
+         * @brief Number of rows.
+         */
+        [[nodiscard]] size_t size() const { return timestamps.size(); }
+    };
+
+    /**
+     * @brief Borrowed tick columns of one symbol.
+     */
+    struct TickColumnsView {
+        SymbolId symbol = 0;
+        std::span<const int64_t> timestamps;
+        std::span<const double> prices;
+        std::span<const double> quantities;
+
+        /**
+         * @brief View over in-memory columns.
+         */
+        static TickColumnsView of(const TickColumns& columns);
+        /**
+         * @brief Number of rows.
+         */
+        [[nodiscard]] size_t size() const { return timestamps.size(); }
+    };
+
+    /**
+     * @brief Validate bar columns without materializing bars.
+     *
+     * @details Produces the same report as validate_bars with
+     * collect_report set and no gap filling: the row-independent checks
+     * (price bounds, volume, future timestamps, trading hours) run as
+     * branch-free passes over whole columns, and only the checks that
+     * depend on the last accepted row (monotonic timestamps, gaps, jumps,
+     * outliers) walk the rows in order. Rows are numbered from 1.
+     * @param columns Columns to validate.
+     * @param config Validation configuration.
+     * @return Validation report.
+     */
+    ValidationReport validate_bar_columns(const BarColumnsView& columns, const ValidationConfig& config);
+
+    /**
+     * @brief Validate tick columns; same report as validate_ticks.
+     * @param columns Columns to validate.
+     * @param config Validation configuration.
+     * @return Validation report.
+     */
+    ValidationReport validate_tick_columns(const TickColumnsView& columns, const ValidationConfig& config);
+
+    /**
+     * @brief Validate many symbols in parallel.
+     *
+     * @details Symbols are handed out to workers one at a time, so uneven
+     * series lengths balance across threads. Reports are returned in
+     * input order.
+     * @param universe Per-symbol columns.
+     * @param config Validation configuration.
+     * @param threads Worker count (0 = hardware concurrency).
+     * @return One report per input entry.
+     */
+    std::vector<ValidationReport> validate_bar_universe(std::span<const BarColumnsView> universe,
+                                                        const ValidationConfig& config,
+                                                        size_t threads = 0);
+}  // namespace regimeflow::data
@@ -0,0 +1,399 @@
+/**
+ * @file compressed_mmap.h
+ * @brief RegimeFlow regimeflow compressed columnar mmap declarations.
+ */
+
+#pragma once
+
+#include "regimeflow/common/result.h"
+#include "regimeflow/common/time.h"
+#include "regimeflow/common/types.h"
+#include "regimeflow/data/bar.h"
+#include "regimeflow/data/column_codec.h"
+#include "regimeflow/data/corporate_actions.h"
+#include "regimeflow/data/data_source.h"
+#include "regimeflow/data/tick.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace regimeflow::data
+{
+#pragma pack(push, 1)
+    /**
+     * @brief Header for compressed bar (.rfbz) and tick (.rftz) files.
+     *
+     * @details File layout:
+     * - header (256 bytes)
+     * - blocks of up to block_rows rows; each starts with one
+     *   CompressedColumnEntry per column followed by the encoded columns
+     * - block index: block_count CompressedBlockEntry records
+     *
+     * Bar blocks hold timestamp, open, high, low, close and volume columns;
+     * tick blocks hold timestamp, price, quantity and flags. The checksum
+     * covers every byte after the header.
+     */
+    struct CompressedFileHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t flags;
+        char symbol[32];
+        uint32_t bar_type;
+        uint32_t bar_size_ms;
+        int64_t start_timestamp;
+        int64_t end_timestamp;
+        uint64_t row_count;
+        uint32_t block_rows;
+        uint32_t block_count;
+        uint64_t index_offset;
+        unsigned char checksum[32];
+        unsigned char reserved[128];
+    };
+
+    /**
+     * @brief Block index entry.
+     */
+    struct CompressedBlockEntry {
+        int64_t first_timestamp;
+        int64_t last_timestamp;
+        uint64_t row_begin;
+        uint64_t offset;
+        uint32_t size;
+        uint32_t row_count;
+    };
+
+    /**
+     * @brief Per-column descriptor at the start of a block.
+     */
+    struct CompressedColumnEntry {
+        uint32_t size;
+        uint8_t codec;
+        uint8_t scale;
+        uint16_t reserved;
+    };
+#pragma pack(pop)
+
+    static_assert(sizeof(CompressedFileHeader) == 256, "CompressedFileHeader must be 256 bytes");
+    static_assert(sizeof(CompressedBlockEntry) == 40, "CompressedBlockEntry must be 40 bytes");
+    static_assert(sizeof(CompressedColumnEntry) == 8, "CompressedColumnEntry must be 8 bytes");
+
+    /**
+     * @brief Memory-mapped compressed columnar file.
+     *
+     * @details Shared by the bar and tick variants. Blocks are located
+     * through the block index and decoded on demand.
+     */
+    class CompressedMmapFile {
+    public:
+        virtual ~CompressedMmapFile();
+
+        CompressedMmapFile(const CompressedMmapFile&) = delete;
+        CompressedMmapFile& operator=(const CompressedMmapFile&) = delete;
+        CompressedMmapFile(CompressedMmapFile&&) = delete;
+        CompressedMmapFile& operator=(CompressedMmapFile&&) = delete;
+
+        /**
+         * @brief File header.
+         */
+        [[nodiscard]] const CompressedFileHeader& header() const { return *header_; }
+        /**
+         * @brief Symbol string from header.
+         */
+        [[nodiscard]] const std::string& symbol() const { return symbol_; }
+        /**
+         * @brief Symbol ID derived from registry.
+         */
+        [[nodiscard]] SymbolId symbol_id() const { return symbol_id_; }
+        /**
+         * @brief Time range covered by this file.
+         */
+        [[nodiscard]] TimeRange time_range() const;
+        /**
+         * @brief Number of rows in the file.
+         */
+        [[nodiscard]] size_t row_count() const { return static_cast<size_t>(header_->row_count); }
+        /**
+         * @brief Size of the mapped file in bytes.
+         */
+        [[nodiscard]] size_t file_size() const { return file_size_; }
+        /**
+         * @brief Block index.
+         */
+        [[nodiscard]] std::span<const CompressedBlockEntry> blocks() const { return blocks_; }
+
+        /**
+         * @brief Find the [begin, end) blocks overlapping a time range.
+         * @param range Requested range; an empty range selects everything.
+         */
+        [[nodiscard]] std::pair<size_t, size_t> find_blocks(TimeRange range) const;
+        /**
+         * @brief Find a [start, end) row range for a time range.
+         *
+         * @details Uses the block index and decodes at most the two boundary
+         * blocks' timestamps.
+         * @param range Requested time range.
+         * @return Pair of row indices.
+         */
+        [[nodiscard]] std::pair<size_t, size_t> find_range(TimeRange range) const;
+
+    protected:
+        /**
+         * @brief Map a file and validate its header and block index.
+         * @param path File path.
+         * @param magic Expected magic.
+         * @param columns Column count per block.
+         */
+        CompressedMmapFile(const std::string& path, const char* magic, size_t columns);
+
+        /**
+         * @brief Encoded bytes and encoding of one column in a block.
+         */
+        [[nodiscard]] std::span<const uint8_t> column(size_t block, size_t column,
+                                                      ColumnEncoding& encoding) const;
+        /**
+         * @brief Decode a block's timestamp column.
+         */
+        void decode_timestamps(size_t block, ColumnDecoder& decoder, std::vector<int64_t>& out) const;
+
+    private:
+        void map_file(const std::string& path);
+        void unmap_file();
+
+        void* mapping_ = nullptr;
+        size_t file_size_ = 0;
+#if defined(_WIN32)
+        void* file_handle_ = nullptr;
+        void* mapping_handle_ = nullptr;
+#endif
+        int fd_ = -1;
+
+        const CompressedFileHeader* header_ = nullptr;
+        std::span<const CompressedBlockEntry> blocks_;
+        size_t columns_ = 0;
+        std::string symbol_;
+        SymbolId symbol_id_ = 0;
+    };
+
+    /**
+     * @brief Compressed bar file (.rfbz).
+     */
+    class CompressedBarFile final : public CompressedMmapFile {
+    public:
+        /**
+         * @brief Decoded columns of one block.
+         */
+        struct Block {
+            std::vector<int64_t> timestamps;
+            std::vector<double> opens;
+            std::vector<double> highs;
+            std::vector<double> lows;
+            std::vector<double> closes;
+            std::vector<uint64_t> volumes;
+            /**
+             * @brief Scratch reused across blocks.
+             */
+            ColumnDecoder decoder;
+
+            [[nodiscard]] size_t size() const { return timestamps.size(); }
+        };
+
+        /**
+         * @brief Map a compressed bar file.
+         * @param path File path.
+         */
+        explicit CompressedBarFile(const std::string& path);
+
+        /**
+         * @brief Bar type stored in the file.
+         */
+        [[nodiscard]] BarType bar_type() const { return static_cast<BarType>(header().bar_type); }
+        /**
+         * @brief Number of bars in the file.
+         */
+        [[nodiscard]] size_t bar_count() const { return row_count(); }
+        /**
+         * @brief Decode one block.
+         * @param block Block index.
+         * @param out Destination; buffers are reused.
+         */
+        void decode_block(size_t block, Block& out) const;
+    };
+
+    /**
+     * @brief Compressed tick file (.rftz).
+     */
+    class CompressedTickFile final : public CompressedMmapFile {
+    public:
+        /**
+         * @brief Decoded columns of one block.
+         */
+        struct Block {
+            std::vector<int64_t> timestamps;
+            std::vector<double> prices;
+            std::vector<double> quantities;
+            std::vector<uint64_t> flags;
+            /**
+             * @brief Scratch reused across blocks.
+             */
+            ColumnDecoder decoder;
+
+            [[nodiscard]] size_t size() const { return timestamps.size(); }
+        };
+
+        /**
+         * @brief Map a compressed tick file.
+         * @param path File path.
+         */
+        explicit CompressedTickFile(const std::string& path);
+
+        /**
+         * @brief Number of ticks in the file.
+         */
+        [[nodiscard]] size_t tick_count() const { return row_count(); }
+        /**
+         * @brief Decode one block.
+         * @param block Block index.
+         * @param out Destination; buffers are reused.
+         */
+        void decode_block(size_t block, Block& out) const;
+    };
+
+    /**
+     * @brief Writer for compressed bar and tick files.
+     */
+    class CompressedMmapWriter {
+    public:
+        /**
+         * @brief Default rows per block.
+         */
+        static constexpr uint32_t kDefaultBlockRows = 4096;
+
+        /**
+         * @brief Construct with a block size.
+         * @param block_rows Rows per block (at least 1).
+         */
+        explicit CompressedMmapWriter(uint32_t block_rows = kDefaultBlockRows);
+
+        /**
+         * @brief Write bars to a compressed file.
+         * @param path Output path.
+         * @param symbol Symbol string.
+         * @param bar_type Bar type.
+         * @param bars Bars to write.
+         * @return Ok on success, error otherwise.
+         */
+        Result<void> write_bars(const std::string& path,
+                                const std::string& symbol,
+                                BarType bar_type,
+                                std::vector<Bar> bars) const;
+        /**
+         * @brief Write ticks to a compressed file.
+         * @param path Output path.
+         * @param symbol Symbol string.
+         * @param ticks Ticks to write.
+         * @return Ok on success, error otherwise.
+         */
+        Result<void> write_ticks(const std::string& path,
+                                 const std::string& symbol,
+                                 std::vector<Tick> ticks) const;
+
+    private:
+        uint32_t block_rows_;
+    };
+
+    /**
+     * @brief Bar iterator decoding a compressed file one block at a time.
+     */
+    class CompressedBarIterator final : public DataIterator {
+    public:
+        /**
+         * @brief Construct over a compressed bar file.
+         * @param file Mapped file (nullptr yields an empty iterator).
+         * @param range Time range to iterate.
+         * @param actions Corporate actions applied on the fly.
+         */
+        CompressedBarIterator(std::shared_ptr<const CompressedBarFile> file,
+                              TimeRange range,
+                              std::vector<CorporateAction> actions = {});
+
+        /**
+         * @brief True if more bars exist.
+         */
+        [[nodiscard]] bool has_next() const override;
+        /**
+         * @brief Get next bar.
+         */
+        Bar next() override;
+        /**
+         * @brief Fill a buffer from the decoded blocks.
+         */
+        size_t next_batch(std::span<Bar> out) override;
+        /**
+         * @brief Reset iterator to the start of the range.
+         */
+        void reset() override;
+
+    private:
+        void load_block(size_t block);
+        [[nodiscard]] Bar read(size_t index) const;
+
+        std::shared_ptr<const CompressedBarFile> file_;
+        size_t row_begin_ = 0;
+        size_t row_end_ = 0;
+        size_t row_ = 0;
+        size_t block_ = 0;
+        size_t block_row_begin_ = 0;
+        CompressedBarFile::Block decoded_;
+        SymbolId symbol_ = 0;
+        CorporateActionAdjuster adjuster_;
+        bool adjust_ = false;
+    };
+
+    /**
+     * @brief Tick iterator decoding a compressed file one block at a time.
+     */
+    class CompressedTickIterator final : public TickIterator {
+    public:
+        /**
+         * @brief Construct over a compressed tick file.
+         * @param file Mapped file (nullptr yields an empty iterator).
+         * @param range Time range to iterate.
+         */
+        CompressedTickIterator(std::shared_ptr<const CompressedTickFile> file, TimeRange range);
+
+        /**
+         * @brief True if more ticks exist.
+         */
+        [[nodiscard]] bool has_next() const override;
+        /**
+         * @brief Get next tick.
+         */
+        Tick next() override;
+        /**
+         * @brief Fill a buffer from the decoded blocks.
+         */
+        size_t next_batch(std::span<Tick> out) override;
+        /**
+         * @brief Reset iterator to the start of the range.
+         */
+        void reset() override;
+
+    private:
+        void load_block(size_t block);
+        [[nodiscard]] Tick read(size_t index) const;
+
+        std::shared_ptr<const CompressedTickFile> file_;
+        size_t row_begin_ = 0;
+        size_t row_end_ = 0;
+        size_t row_ = 0;
+        size_t block_ = 0;
+        size_t block_row_begin_ = 0;
+        CompressedTickFile::Block decoded_;
+        SymbolId symbol_ = 0;
+    };
+}  // namespace regimeflow::data
@@ -8,7 +8,9 @@
 #include "regimeflow/common/types.h"
 #include "regimeflow/data/bar.h"
 
+#include <cstdint>
 #include <map>
+#include <span>
 #include <vector>
 
 namespace regimeflow::data
@@ -35,6 +37,14 @@ namespace regimeflow::data
 
     /**
      * @brief Applies corporate actions to market data and symbol mappings.
+     *
+     * @details add_actions() precomputes a per-symbol step table. Actions
+     * split time into segments at their effective dates. Each segment has
+     * a cumulative split divisor, dividend multiplier and volume factor for
+     * all later actions, plus the symbol in effect. A bar's segment is found
+     * by binary search, or by a forward cursor in the batch paths.
+     * Dividends given only as a cash amount depend on the adjusted close at
+     * that point, so they stay as explicit steps between the cumulative runs.
      */
     class CorporateActionAdjuster {
     public:
@@ -52,6 +62,41 @@ namespace regimeflow::data
          * @return Adjusted bar.
          */
         [[nodiscard]] Bar adjust_bar(SymbolId symbol, const Bar& bar) const;
+        /**
+         * @brief Adjust bars in place.
+         *
+         * @details Walks the step table with a cursor, so bars sorted by
+         * time cost O(1) each; unsorted bars fall back to binary search.
+         * @param symbol Symbol ID.
+         * @param bars Bars to adjust.
+         */
+        void adjust_bars(SymbolId symbol, std::span<Bar> bars) const;
+        /**
+         * @brief Adjust OHLCV columns in place.
+         *
+         * @details Timestamps must be sorted. Each segment's rows are
+         * scaled in a tight loop per column. Symbol changes do not apply,
+         * since columns carry no symbol.
+         * @param symbol Symbol ID.
+         * @param timestamps Row timestamps in microseconds.
+         * @param opens Open column.
+         * @param highs High column.
+         * @param lows Low column.
+         * @param closes Close column.
+         * @param volumes Volume column (may be empty).
+         */
+        void adjust_columns(SymbolId symbol,
+                            std::span<const int64_t> timestamps,
+                            std::span<double> opens,
+                            std::span<double> highs,
+                            std::span<double> lows,
+                            std::span<double> closes,
+                            std::span<uint64_t> volumes) const;
+        /**
+         * @brief True if any action is registered for a symbol.
+         * @param symbol Symbol ID.
+         */
+        [[nodiscard]] bool has_actions(SymbolId symbol) const;
         /**
          * @brief Resolve the latest symbol after symbol changes.
          * @param symbol Symbol ID.
@@ -71,8 +116,34 @@ namespace regimeflow::data
          * @return Vector of alias IDs.
          */
         [[nodiscard]] std::vector<SymbolId> aliases_for(SymbolId symbol) const;
+        /**
+         * @brief Get the actions registered for a symbol.
+         * @param symbol Symbol ID.
+         * @return Actions sorted by effective date.
+         */
+        [[nodiscard]] std::vector<CorporateAction> actions_for(SymbolId symbol) const;
 
     private:
+        /**
+         * @brief Cumulative adjustments per segment; entry k covers times
+         * in [effective[k-1], effective[k]) and has size effective.size()+1.
+         */
+        struct StepTable {
+            std::vector<int64_t> effective;
+            std::vector<double> split_divisor;
+            std::vector<double> dividend_factor;
+            std::vector<double> volume_factor;
+            std::vector<uint32_t> next_cash_dividend;
+            std::vector<double> cash_amount;
+            std::vector<SymbolId> symbol;
+        };
+
+        static StepTable build_table(const std::vector<CorporateAction>& actions);
+        static void adjust_prices(const StepTable& table, size_t segment,
+                                  double& open, double& high, double& low, double& close);
+        static void apply_segment(const StepTable& table, size_t segment, Bar& bar);
+
         std::map<SymbolId, std::vector<CorporateAction>> actions_;
+        std::map<SymbolId, StepTable> tables_;
     };
 }  // namespace regimeflow::data
@@ -0,0 +1,93 @@
+/**
+ * @file csv_cache.h
+ * @brief RegimeFlow regimeflow binary cache for parsed csv data declarations.
+ */
+
+#pragma once
+
+#include "regimeflow/common/time.h"
+#include "regimeflow/common/types.h"
+#include "regimeflow/data/bar.h"
+#include "regimeflow/data/tick.h"
+#include "regimeflow/data/validation_config.h"
+
+#include <string>
+#include <vector>
+
+namespace regimeflow::data
+{
+    /**
+     * @brief On-disk cache of parsed CSV files as mmap bar/tick files.
+     *
+     * @details Each entry holds the rows of one CSV file after validation
+     * and before range filtering or corporate-action adjustment. Entries
+     * are named `<csv stem>-<key>.rfb` (bars) or `.rft` (ticks). The key
+     * hashes the source path, size and modification time plus a parse
+     * fingerprint, so any change to the file or its parse settings misses
+     * the old entry. Stale entries are left in place.
+     */
+    class CsvCache {
+    public:
+        /**
+         * @brief Construct over a cache directory.
+         * @param directory Cache directory (empty disables the cache).
+         */
+        explicit CsvCache(std::string directory);
+
+        /**
+         * @brief True when a cache directory is configured.
+         */
+        [[nodiscard]] bool enabled() const { return !directory_.empty(); }
+
+        /**
+         * @brief Entry path for a source file.
+         * @param source CSV path.
+         * @param fingerprint Parse settings the cached rows depend on.
+         * @param extension Entry extension (".rfb" or ".rft").
+         * @return Entry path, or empty when disabled or the source is missing.
+         */
+        [[nodiscard]] std::string entry_path(const std::string& source,
+                                             const std::string& fingerprint,
+                                             const std::string& extension) const;
+
+        /**
+         * @brief Load cached bars within a range.
+         * @param entry Entry path.
+         * @param symbol Symbol assigned to the loaded bars.
+         * @param range Time range (empty loads everything).
+         * @param bars Receives the bars.
+         * @return False when the entry is missing or unreadable.
+         */
+        static bool load_bars(const std::string& entry, SymbolId symbol, TimeRange range,
+                              std::vector<Bar>& bars);
+        /**
+         * @brief Store bars as an entry.
+         *
+         * @details Skipped when the rows are not in timestamp order or the
+         * mmap writer rejects them; the entry is written to a temporary
+         * file and renamed so concurrent readers never see it half written.
+         * @return True if the entry was written.
+         */
+        static bool store_bars(const std::string& entry, const std::vector<Bar>& bars);
+
+        /**
+         * @brief Load cached ticks within a range.
+         */
+        static bool load_ticks(const std::string& entry, SymbolId symbol, TimeRange range,
+                               std::vector<Tick>& ticks);
+        /**
+         * @brief Store ticks as an entry.
+         */
+        static bool store_ticks(const std::string& entry, const std::vector<Tick>& ticks);
+
+    private:
+        std::string directory_;
+    };
+
+    /**
+     * @brief Append the validation settings to a cache fingerprint.
+     * @param out Fingerprint being built.
+     * @param config Validation configuration.
+     */
+    void append_cache_fingerprint(std::string& out, const ValidationConfig& config);
+}  // namespace regimeflow::data
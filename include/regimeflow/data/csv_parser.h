@@ -0,0 +1,308 @@
+/**
+ * @file csv_parser.h
+ * @brief RegimeFlow regimeflow fast csv parsing declarations.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace regimeflow::data
+{
+    /**
+     * @brief Read-only memory mapping of a text file.
+     */
+    class MappedTextFile {
+    public:
+        /**
+         * @brief Map a file; check is_open() for success.
+         * @param path File path.
+         */
+        explicit MappedTextFile(const std::string& path);
+        /**
+         * @brief Unmap and close the file.
+         */
+        ~MappedTextFile();
+
+        MappedTextFile(const MappedTextFile&) = delete;
+        MappedTextFile& operator=(const MappedTextFile&) = delete;
+        MappedTextFile(MappedTextFile&&) = delete;
+        MappedTextFile& operator=(MappedTextFile&&) = delete;
+
+        /**
+         * @brief True if the file was opened (empty files are open).
+         */
+        [[nodiscard]] bool is_open() const { return open_; }
+        /**
+         * @brief File contents.
+         */
+        [[nodiscard]] std::string_view text() const {
+            return {static_cast<const char*>(mapping_), file_size_};
+        }
+
+    private:
+        void* mapping_ = nullptr;
+        size_t file_size_ = 0;
+        bool open_ = false;
+#if defined(_WIN32)
+        void* file_handle_ = nullptr;
+        void* mapping_handle_ = nullptr;
+#endif
+        int fd_ = -1;
+    };
+
+    /**
+     * @brief Fixed-width timestamp parser compiled from a strftime format.
+     *
+     * @details Handles formats built from %Y, %m, %d, %H, %M, %S, %F, %T
+     * and literal characters, with every field at its full width. Anything
+     * else reports Unsupported so callers can fall back to
+     * Timestamp::from_string, which accepts a superset of these inputs and
+     * yields the same value whenever this parser succeeds.
+     */
+    class FixedTimestampFormat {
+    public:
+        /**
+         * @brief Parse outcome.
+         */
+        enum class Status {
+            /**
+             * @brief Value parsed.
+             */
+            Parsed,
+            /**
+             * @brief Value ended before a remaining field; the format cannot match.
+             */
+            Truncated,
+            /**
+             * @brief Value needs the general parser.
+             */
+            Unsupported
+        };
+
+        /**
+         * @brief Compile a format.
+         * @param format strftime-style format.
+         */
+        explicit FixedTimestampFormat(const std::string& format);
+
+        /**
+         * @brief True if the format compiled to the fixed-width fast path.
+         */
+        [[nodiscard]] bool compiled() const { return compiled_; }
+        /**
+         * @brief Parse a value as UTC.
+         * @param value Text to parse; trailing characters are ignored.
+         * @param microseconds Receives microseconds since epoch on success.
+         */
+        Status parse(std::string_view value, int64_t& microseconds) const;
+
+    private:
+        std::string items_;
+        bool compiled_ = true;
+    };
+
+    /**
+     * @brief Trim spaces, tabs and line endings from a field.
+     */
+    std::string_view trim_csv_field(std::string_view field);
+
+    /**
+     * @brief Parse a double with std::stod semantics.
+     *
+     * @details Uses std::from_chars and defers to std::stod for inputs it
+     * does not accept, so errors and their messages are unchanged.
+     */
+    double parse_csv_double(std::string_view field);
+
+    /**
+     * @brief Parse an unsigned integer with std::stoull semantics.
+     */
+    uint64_t parse_csv_uint64(std::string_view field);
+
+    /**
+     * @brief Split a line into fields without copying.
+     * @param line Line without its newline.
+     * @param delimiter Field delimiter.
+     * @param fields Receives views into line.
+     * @param keep_trailing_empty Keep an empty field after a trailing
+     * delimiter (std::getline splitting drops it).
+     */
+    void split_csv_line(std::string_view line, char delimiter, std::vector<std::string_view>& fields,
+                        bool keep_trailing_empty = true);
+
+    /**
+     * @brief Split text into up to max_chunks pieces ending at line boundaries.
+     * @param text Input text.
+     * @param max_chunks Upper bound on pieces.
+     * @param min_chunk_bytes Smallest piece worth a separate worker.
+     */
+    std::vector<std::string_view> split_csv_chunks(std::string_view text, size_t max_chunks,
+                                                   size_t min_chunk_bytes);
+
+    /**
+     * @brief Worker count for a requested thread setting (0 = hardware concurrency).
+     *
+     * @details Readers default to 1: a source may already run on one of
+     * many run_parallel workers, so parsing threads are opt-in.
+     */
+    size_t csv_parse_threads(int requested);
+
+    /**
+     * @brief Smallest chunk handed to a separate parse worker.
+     */
+    inline constexpr size_t kMinCsvChunkBytes = 1u << 20;
+
+    /**
+     * @brief Invoke fn for every line, as std::getline would produce them.
+     */
+    template <typename Fn>
+    void for_each_csv_line(std::string_view text, Fn&& fn) {
+        const char* pos = text.data();
+        const char* end = pos + text.size();
+        while (pos < end) {
+            const auto* newline = static_cast<const char*>(std::memchr(pos, '\n', static_cast<size_t>(end - pos)));
+            const char* line_end = newline ? newline : end;
+            fn(std::string_view(pos, static_cast<size_t>(line_end - pos)));
+            pos = newline ? newline + 1 : end;
+        }
+    }
+
+    /**
+     * @brief Bytes of text parsed per worker before its rows are consumed.
+     */
+    inline constexpr size_t kCsvWindowBytesPerThread = 4u << 20;
+
+    /**
+     * @brief Parse every line of text into per-chunk rows, in parallel chunks.
+     *
+     * @details Concatenating the parts gives one row per line in file
+     * order. parse_line is called as parse_line(line, scratch_fields) and
+     * must be safe to run concurrently.
+     * @param text Input text (without header).
+     * @param threads Worker count.
+     * @param parse_line Line parser.
+     */
+    template <typename Row, typename ParseLine>
+    std::vector<std::vector<Row>> parse_csv_parts(const std::string_view text, const size_t threads,
+                                                  const ParseLine& parse_line) {
+        const auto chunks = split_csv_chunks(text, threads, kMinCsvChunkBytes);
+        std::vector<std::vector<Row>> parts(chunks.size());
+        auto parse_chunk = [&](const size_t i) {
+            std::vector<std::string_view> fields;
+            parts[i].reserve(chunks[i].size() / 48);
+            for_each_csv_line(chunks[i], [&](const std::string_view line) {
+                parts[i].push_back(parse_line(line, fields));
+            });
+        };
+        if (chunks.size() <= 1) {
+            if (!chunks.empty()) {
+                parse_chunk(0);
+            }
+            return parts;
+        }
+
+        std::vector<std::exception_ptr> failures(chunks.size());
+        std::vector<std::thread> workers;
+        workers.reserve(chunks.size() - 1);
+        for (size_t i = 1; i < chunks.size(); ++i) {
+            workers.emplace_back([&, i] {
+                try {
+                    parse_chunk(i);
+                } catch (...) {
+                    failures[i] = std::current_exception();
+                }
+            });
+        }
+        try {
+            parse_chunk(0);
+        } catch (...) {
+            failures[0] = std::current_exception();
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        for (const auto& failure : failures) {
+            if (failure) {
+                std::rethrow_exception(failure);
+            }
+        }
+        return parts;
+    }
+
+    /**
+     * @brief Parse every line of text into a row, in parallel chunks.
+     *
+     * @details Rows come back in file order, one per line, so row i is
+     * line i of text. Holds every row at once; prefer
+     * for_each_parsed_csv_row for large inputs.
+     * @param text Input text (without header).
+     * @param threads Worker count.
+     * @param parse_line Line parser (see parse_csv_parts).
+     */
+    template <typename Row, typename ParseLine>
+    std::vector<Row> parse_csv_lines(const std::string_view text, const size_t threads,
+                                     const ParseLine& parse_line) {
+        auto parts = parse_csv_parts<Row>(text, threads, parse_line);
+        if (parts.empty()) {
+            return {};
+        }
+        size_t total = 0;
+        for (const auto& part : parts) {
+            total += part.size();
+        }
+        std::vector<Row> rows = std::move(parts[0]);
+        rows.reserve(total);
+        for (size_t i = 1; i < parts.size(); ++i) {
+            rows.insert(rows.end(), std::make_move_iterator(parts[i].begin()),
+                        std::make_move_iterator(parts[i].end()));
+        }
+        return rows;
+    }
+
+    /**
+     * @brief Parse every line of text and hand the rows to consume in file order.
+     *
+     * @details The text is cut at line boundaries into windows of about
+     * `threads * window_bytes_per_thread` bytes. Each window is parsed with
+     * parse_csv_parts, consumed and released before the next, so only one
+     * window of parsed rows is alive at a time. consume(row) runs on the
+     * calling thread.
+     * @param text Input text (without header).
+     * @param threads Worker count.
+     * @param parse_line Line parser (see parse_csv_parts).
+     * @param consume Row consumer, called as consume(Row&).
+     * @param window_bytes_per_thread Text bytes per worker and window.
+     */
+    template <typename Row, typename ParseLine, typename Consume>
+    void for_each_parsed_csv_row(const std::string_view text, const size_t threads,
+                                 const ParseLine& parse_line, Consume&& consume,
+                                 const size_t window_bytes_per_thread = kCsvWindowBytesPerThread) {
+        const size_t window = std::max<size_t>(threads, 1) * std::max<size_t>(window_bytes_per_thread, 1);
+        size_t start = 0;
+        while (start < text.size()) {
+            size_t end = start + window;
+            if (end >= text.size()) {
+                end = text.size();
+            } else {
+                const auto newline = text.find('\n', end - 1);
+                end = newline == std::string_view::npos ? text.size() : newline + 1;
+            }
+            for (auto& part : parse_csv_parts<Row>(text.substr(start, end - start), threads, parse_line)) {
+                for (auto& row : part) {
+                    consume(row);
+                }
+            }
+            start = end;
+        }
+    }
+}  // namespace regimeflow::data
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "regimeflow/data/csv_cache.h"
 #include "regimeflow/data/data_source.h"
 #include "regimeflow/data/data_validation.h"
 #include "regimeflow/data/validation_config.h"
@@ -97,6 +98,14 @@ namespace regimeflow::data
              * @brief Fill missing bars if possible.
              */
             bool fill_missing_bars = false;
+            /**
+             * @brief Worker threads for parsing large files (0 = hardware concurrency).
+             */
+            int parse_threads = 1;
+            /**
+             * @brief Directory for binary parse caches (empty disables caching).
+             */
+            std::string cache_directory;
         };
 
         /**
@@ -152,10 +161,14 @@ namespace regimeflow::data
         std::string resolve_path(SymbolId symbol) const;
         std::vector<Bar> parse_bars(SymbolId symbol, const std::string& path, TimeRange range,
                                     BarType bar_type) const;
+        std::vector<Bar> read_bars(SymbolId symbol, const std::string& path, bool& fill_on_gap) const;
+        std::string cache_entry(const std::string& path) const;
         std::map<std::string, int> resolve_mapping(const std::string& header) const;
         void ensure_actions_loaded(SymbolId symbol) const;
 
         Config config_;
+        CsvCache cache_;
+        std::string cache_fingerprint_;
         std::unordered_map<SymbolId, std::string> symbol_to_path_;
         mutable ValidationReport last_report_;
         mutable CorporateActionAdjuster adjuster_;
@@ -11,7 +11,10 @@
 #include "regimeflow/data/order_book.h"
 #include "regimeflow/data/tick.h"
 
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -49,6 +52,21 @@ namespace regimeflow::data
          * @return Next bar.
          */
         virtual Bar next() = 0;
+        /**
+         * @brief Retrieve up to out.size() bars in one call.
+         *
+         * @details The default forwards to has_next()/next(); implementations
+         * backed by contiguous storage override it to copy whole runs.
+         * @param out Destination buffer.
+         * @return Number of bars written; 0 once exhausted.
+         */
+        virtual size_t next_batch(std::span<Bar> out) {
+            size_t count = 0;
+            while (count < out.size() && has_next()) {
+                out[count++] = next();
+            }
+            return count;
+        }
         /**
          * @brief Reset the iterator to the beginning.
          */
@@ -70,6 +88,21 @@ namespace regimeflow::data
          * @return Next tick.
          */
         virtual Tick next() = 0;
+        /**
+         * @brief Retrieve up to out.size() ticks in one call.
+         *
+         * @details The default forwards to has_next()/next(); implementations
+         * backed by contiguous storage override it to copy whole runs.
+         * @param out Destination buffer.
+         * @return Number of ticks written; 0 once exhausted.
+         */
+        virtual size_t next_batch(std::span<Tick> out) {
+            size_t count = 0;
+            while (count < out.size() && has_next()) {
+                out[count++] = next();
+            }
+            return count;
+        }
         /**
          * @brief Reset the iterator to the beginning.
          */
@@ -91,6 +124,21 @@ namespace regimeflow::data
          * @return Next order book.
          */
         virtual OrderBook next() = 0;
+        /**
+         * @brief Retrieve up to out.size() order books in one call.
+         *
+         * @details The default forwards to has_next()/next(); implementations
+         * backed by contiguous storage override it to copy whole runs.
+         * @param out Destination buffer.
+         * @return Number of order books written; 0 once exhausted.
+         */
+        virtual size_t next_batch(std::span<OrderBook> out) {
+            size_t count = 0;
+            while (count < out.size() && has_next()) {
+                out[count++] = next();
+            }
+            return count;
+        }
         /**
          * @brief Reset the iterator to the beginning.
          */
@@ -130,6 +178,52 @@ namespace regimeflow::data
             return {};
         }
 
+        /**
+         * @brief Latest bar at or before a timestamp.
+         *
+         * @details The default fetches the history up to ts and keeps the
+         * last bar. Sources with sorted storage override this with a binary
+         * search and a per-symbol result cache.
+         * @param symbol Symbol ID.
+         * @param ts Lookup time.
+         * @param bar_type Bar type.
+         * @return Bar, or empty if none exists at or before ts.
+         */
+        virtual std::optional<Bar> get_bar_as_of(const SymbolId symbol, const Timestamp ts,
+                                                 const BarType bar_type = BarType::Time_1Day) {
+            auto bars = get_bars(symbol, TimeRange{Timestamp(0), ts}, bar_type);
+            if (bars.empty()) {
+                return std::nullopt;
+            }
+            return bars.back();
+        }
+        /**
+         * @brief Latest tick at or before a timestamp.
+         * @param symbol Symbol ID.
+         * @param ts Lookup time.
+         * @return Tick, or empty if none exists at or before ts.
+         */
+        virtual std::optional<Tick> get_tick_as_of(const SymbolId symbol, const Timestamp ts) {
+            auto ticks = get_ticks(symbol, TimeRange{Timestamp(0), ts});
+            if (ticks.empty()) {
+                return std::nullopt;
+            }
+            return ticks.back();
+        }
+        /**
+         * @brief Latest order book at or before a timestamp.
+         * @param symbol Symbol ID.
+         * @param ts Lookup time.
+         * @return Order book, or empty if none exists at or before ts.
+         */
+        virtual std::optional<OrderBook> get_order_book_as_of(const SymbolId symbol, const Timestamp ts) {
+            auto books = get_order_books(symbol, TimeRange{Timestamp(0), ts});
+            if (books.empty()) {
+                return std::nullopt;
+            }
+            return books.back();
+        }
+
         /**
          * @brief Create a bar iterator for multiple symbols.
          */
@@ -14,6 +14,7 @@
 #include "regimeflow/data/order_book_mmap_data_source.h"
 #include "regimeflow/data/tick_mmap_data_source.h"
 #include "regimeflow/data/tick_csv_reader.h"
+#include "regimeflow/data/universe_mmap_data_source.h"
 
 #include <memory>
 #include <string>
@@ -12,6 +12,7 @@
 #include "regimeflow/data/tick.h"
 
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
@@ -58,6 +59,41 @@ namespace regimeflow::data
          * @brief Query order book snapshots for a symbol.
          */
         virtual std::vector<OrderBook> query_order_books(SymbolId symbol, TimeRange range) = 0;
+
+        /**
+         * @brief Query the latest bar at or before a timestamp.
+         *
+         * @details The default queries the history up to ts and keeps the
+         * last bar; clients override it with a single indexed lookup.
+         */
+        virtual std::optional<Bar> query_bar_as_of(const SymbolId symbol, const Timestamp ts,
+                                                   const BarType bar_type) {
+            auto bars = query_bars(symbol, TimeRange{Timestamp(0), ts}, bar_type);
+            if (bars.empty()) {
+                return std::nullopt;
+            }
+            return bars.back();
+        }
+        /**
+         * @brief Query the latest tick at or before a timestamp.
+         */
+        virtual std::optional<Tick> query_tick_as_of(const SymbolId symbol, const Timestamp ts) {
+            auto ticks = query_ticks(symbol, TimeRange{Timestamp(0), ts});
+            if (ticks.empty()) {
+                return std::nullopt;
+            }
+            return ticks.back();
+        }
+        /**
+         * @brief Query the latest order book at or before a timestamp.
+         */
+        virtual std::optional<OrderBook> query_order_book_as_of(const SymbolId symbol, const Timestamp ts) {
+            auto books = query_order_books(symbol, TimeRange{Timestamp(0), ts});
+            if (books.empty()) {
+                return std::nullopt;
+            }
+            return books.back();
+        }
     };
 
     /**
@@ -112,6 +148,19 @@ namespace regimeflow::data
          */
         std::vector<OrderBook> query_order_books(SymbolId symbol, TimeRange range) override;
 
+        /**
+         * @brief Latest bar at or before a timestamp (binary search).
+         */
+        std::optional<Bar> query_bar_as_of(SymbolId symbol, Timestamp ts, BarType bar_type) override;
+        /**
+         * @brief Latest tick at or before a timestamp (binary search).
+         */
+        std::optional<Tick> query_tick_as_of(SymbolId symbol, Timestamp ts) override;
+        /**
+         * @brief Latest order book at or before a timestamp (binary search).
+         */
+        std::optional<OrderBook> query_order_book_as_of(SymbolId symbol, Timestamp ts) override;
+
     private:
         std::unordered_map<SymbolId, std::vector<Bar>> bars_;
         std::unordered_map<SymbolId, std::vector<Tick>> ticks_;
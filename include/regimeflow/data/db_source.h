@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "regimeflow/data/as_of_cache.h"
 #include "regimeflow/data/data_source.h"
 #include "regimeflow/data/data_validation.h"
 #include "regimeflow/data/db_client.h"
@@ -107,6 +108,28 @@ namespace regimeflow::data
          */
         std::vector<OrderBook> get_order_books(SymbolId symbol, TimeRange range) override;
 
+        /**
+         * @brief Latest bar at or before a timestamp.
+         *
+         * @details Asks the client for the single row and validates it
+         * alone when the validation settings cannot drop or fill a row
+         * because of the rows before it; otherwise, or if the row is
+         * rejected, the whole history up to ts is validated as before.
+         * Answers are cached per symbol for lookups between the row's time
+         * and the probed time, so the cache assumes rows at or before a
+         * probed time do not change; set_client() clears it.
+         */
+        std::optional<Bar> get_bar_as_of(SymbolId symbol, Timestamp ts,
+                                         BarType bar_type = BarType::Time_1Day) override;
+        /**
+         * @brief Latest tick at or before a timestamp; see get_bar_as_of().
+         */
+        std::optional<Tick> get_tick_as_of(SymbolId symbol, Timestamp ts) override;
+        /**
+         * @brief Latest order book at or before a timestamp; see get_bar_as_of().
+         */
+        std::optional<OrderBook> get_order_book_as_of(SymbolId symbol, Timestamp ts) override;
+
         /**
          * @brief Create a bar iterator for multiple symbols.
          */
@@ -137,9 +160,14 @@ namespace regimeflow::data
         const ValidationReport& last_report() const { return last_report_; }
 
     private:
+        void clear_as_of_caches();
+
         Config config_;
         std::shared_ptr<DbClient> client_;
         CorporateActionAdjuster adjuster_;
         mutable ValidationReport last_report_;
+        AsOfCache<Bar> bar_as_of_;
+        AsOfCache<Tick> tick_as_of_;
+        AsOfCache<OrderBook> book_as_of_;
     };
 }  // namespace regimeflow::data
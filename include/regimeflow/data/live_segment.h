@@ -0,0 +1,274 @@
+/**
+ * @file live_segment.h
+ * @brief RegimeFlow regimeflow append-only live segment declarations.
+ */
+
+#pragma once
+
+#include "regimeflow/common/result.h"
+#include "regimeflow/common/time.h"
+#include "regimeflow/data/bar.h"
+#include "regimeflow/data/order_book.h"
+#include "regimeflow/data/tick.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace regimeflow::data
+{
+    /**
+     * @brief Record type stored in a live segment.
+     */
+    enum class LiveRecordKind : uint32_t {
+        Tick = 1,
+        Quote = 2,
+        Bar = 3,
+        Book = 4
+    };
+
+#pragma pack(push, 1)
+    /**
+     * @brief One commit slot of a live segment header.
+     *
+     * @details The header holds two slots written alternately. A slot is
+     * trusted only if its checksum matches, and readers take the valid slot
+     * with the higher sequence. A torn header write therefore falls back
+     * to the previous commit.
+     */
+    struct LiveSegmentCommit {
+        uint64_t sequence;
+        uint64_t record_count;
+        int64_t start_timestamp;
+        int64_t end_timestamp;
+        uint64_t checksum;
+        unsigned char reserved[24];
+    };
+
+    /**
+     * @brief Header for append-only live segment files.
+     */
+    struct LiveSegmentHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t kind;
+        char symbol[32];
+        int32_t date_yyyymmdd;
+        uint32_t record_size;
+        uint32_t bar_type;
+        unsigned char reserved[68];
+        LiveSegmentCommit commits[2];
+    };
+#pragma pack(pop)
+
+    static_assert(sizeof(LiveSegmentCommit) == 64, "LiveSegmentCommit must be 64 bytes");
+    static_assert(sizeof(LiveSegmentHeader) == 256, "LiveSegmentHeader must be 256 bytes");
+
+    /**
+     * @brief Appends records of one kind for one symbol and day to a live segment.
+     *
+     * @details Records are fixed-size rows after a 256-byte header, so the
+     * file can grow while readers tail it. commit() syncs the rows to disk
+     * and then writes the next header slot, so a committed count never
+     * covers rows that are not durable. Reopening an existing segment
+     * truncates rows past the last commit and resumes appending.
+     */
+    class LiveSegmentWriter {
+    public:
+        LiveSegmentWriter() = default;
+        ~LiveSegmentWriter();
+
+        LiveSegmentWriter(const LiveSegmentWriter&) = delete;
+        LiveSegmentWriter& operator=(const LiveSegmentWriter&) = delete;
+
+        /**
+         * @brief Create or resume a segment.
+         * @param path Segment path.
+         * @param kind Record kind.
+         * @param symbol Symbol string.
+         * @param date_yyyymmdd UTC trading date of the segment.
+         * @param bar_type Bar type of bar segments.
+         * @return Ok on success, error if the file belongs to another stream.
+         */
+        Result<void> open(const std::string& path, LiveRecordKind kind, const std::string& symbol,
+                          int32_t date_yyyymmdd, BarType bar_type = BarType::Time_1Min);
+
+        /**
+         * @brief Append a tick.
+         * @return Error on kind mismatch, out-of-order or invalid rows.
+         */
+        Result<void> append(const Tick& tick);
+        /**
+         * @brief Append a quote.
+         */
+        Result<void> append(const Quote& quote);
+        /**
+         * @brief Append a bar.
+         */
+        Result<void> append(const Bar& bar);
+        /**
+         * @brief Append an order book snapshot.
+         */
+        Result<void> append(const OrderBook& book);
+
+        /**
+         * @brief Make appended rows durable and visible to readers.
+         * @return Ok on success, IoError otherwise.
+         */
+        Result<void> commit();
+        /**
+         * @brief First half of commit(): flush appended rows and capture
+         * the commit that covers them.
+         *
+         * @details Must not run concurrently with append(). The returned
+         * commit is passed to finish_commit(), which does the syncs and the
+         * header write and may run while later rows are appended. On Windows,
+         * where a stdio handle has no positional write, the whole commit runs
+         * here and finish_commit() only records it.
+         * @return Commit to finish, or IoError.
+         */
+        Result<LiveSegmentCommit> prepare_commit();
+        /**
+         * @brief Second half of commit(): sync the rows, then write and sync
+         * the header slot.
+         *
+         * @details May run concurrently with append(), but not with another
+         * commit or with close().
+         * @param commit Commit returned by prepare_commit().
+         * @return Ok on success, IoError otherwise.
+         */
+        Result<void> finish_commit(const LiveSegmentCommit& commit);
+        /**
+         * @brief Commit and close the file.
+         */
+        Result<void> close();
+
+        /**
+         * @brief True while a segment is open.
+         */
+        [[nodiscard]] bool is_open() const { return file_ != nullptr; }
+        /**
+         * @brief Rows appended, including uncommitted ones.
+         */
+        [[nodiscard]] uint64_t record_count() const { return count_; }
+        /**
+         * @brief Rows covered by the last commit.
+         */
+        [[nodiscard]] uint64_t committed_count() const { return committed_; }
+        /**
+         * @brief Segment path.
+         */
+        [[nodiscard]] const std::string& path() const { return path_; }
+
+    private:
+        Result<void> check_next(LiveRecordKind kind, Timestamp timestamp) const;
+        Result<void> write_record(const void* record, Timestamp timestamp);
+
+        std::string path_;
+        std::FILE* file_ = nullptr;
+        LiveSegmentHeader header_{};
+        uint64_t count_ = 0;
+        uint64_t committed_ = 0;
+        uint64_t sequence_ = 0;
+        int64_t start_timestamp_ = 0;
+        int64_t last_timestamp_ = 0;
+    };
+
+    /**
+     * @brief Reads committed rows of a live segment, including one still being written.
+     *
+     * @details refresh() re-reads the header and picks up new commits;
+     * read() returns committed rows past the reader's cursor. Rows written
+     * after the last commit are never returned.
+     */
+    class LiveSegmentReader {
+    public:
+        /**
+         * @brief Open a segment for reading.
+         * @param path Segment path.
+         * @return Ok on success, error if the file is not a live segment.
+         */
+        Result<void> open(const std::string& path);
+
+        /**
+         * @brief Re-read the header.
+         * @return Committed row count.
+         */
+        uint64_t refresh();
+
+        /**
+         * @brief Read committed ticks past the cursor.
+         * @param out Receives the ticks (appended).
+         * @param max_records Maximum rows to read.
+         * @return Rows read, or an error on kind mismatch or short read.
+         */
+        Result<size_t> read(std::vector<Tick>& out, size_t max_records = std::numeric_limits<size_t>::max());
+        /**
+         * @brief Read committed quotes past the cursor.
+         */
+        Result<size_t> read(std::vector<Quote>& out, size_t max_records = std::numeric_limits<size_t>::max());
+        /**
+         * @brief Read committed bars past the cursor.
+         */
+        Result<size_t> read(std::vector<Bar>& out, size_t max_records = std::numeric_limits<size_t>::max());
+        /**
+         * @brief Read committed order books past the cursor.
+         */
+        Result<size_t> read(std::vector<OrderBook>& out,
+                            size_t max_records = std::numeric_limits<size_t>::max());
+
+        /**
+         * @brief Record kind.
+         */
+        [[nodiscard]] LiveRecordKind kind() const { return static_cast<LiveRecordKind>(header_.kind); }
+        /**
+         * @brief Symbol string.
+         */
+        [[nodiscard]] std::string symbol() const;
+        /**
+         * @brief UTC trading date.
+         */
+        [[nodiscard]] int32_t date() const { return header_.date_yyyymmdd; }
+        /**
+         * @brief Bar type of bar segments.
+         */
+        [[nodiscard]] BarType bar_type() const { return static_cast<BarType>(header_.bar_type); }
+        /**
+         * @brief Rows covered by the last commit seen by refresh().
+         */
+        [[nodiscard]] uint64_t committed_count() const { return committed_; }
+        /**
+         * @brief Rows already returned by read().
+         */
+        [[nodiscard]] uint64_t position() const { return cursor_; }
+
+    private:
+        template <typename Row, typename Record, typename Decode>
+        Result<size_t> read_rows(LiveRecordKind kind, std::vector<Row>& out, size_t max_records,
+                                 Decode&& decode);
+
+        std::ifstream in_;
+        LiveSegmentHeader header_{};
+        uint64_t committed_ = 0;
+        uint64_t cursor_ = 0;
+        SymbolId symbol_id_ = 0;
+    };
+
+    /**
+     * @brief Convert a tick, bar or book segment to the matching mmap file.
+     *
+     * @details Writes `<SYMBOL>.rft`, `<SYMBOL>_<bar_type>.rfb` or
+     * `<SYMBOL>.rfob` into `output_directory` with the streaming mmap
+     * writers, so the mmap data sources can load a recorded day directly.
+     * Quote segments have no mmap format and are rejected.
+     * @param segment_path Segment path.
+     * @param output_directory Directory for the mmap file.
+     * @return Path of the written file, or an error.
+     */
+    Result<std::string> seal_live_segment(const std::string& segment_path,
+                                          const std::string& output_directory);
+}  // namespace regimeflow::data
@@ -5,12 +5,15 @@
 
 #pragma once
 
+#include "regimeflow/data/as_of_cache.h"
 #include "regimeflow/data/data_source.h"
 #include "regimeflow/data/corporate_actions.h"
 
 #include <algorithm>
 #include <map>
+#include <memory>
 #include <utility>
+#include <vector>
 
 namespace regimeflow::data
 {
@@ -33,6 +36,10 @@ namespace regimeflow::data
          * @brief Get next bar.
          */
         Bar next() override;
+        /**
+         * @brief Copy the next run of bars into a buffer.
+         */
+        size_t next_batch(std::span<Bar> out) override;
         /**
          * @brief Reset iterator to beginning.
          */
@@ -62,6 +69,10 @@ namespace regimeflow::data
          * @brief Get next order book.
          */
         OrderBook next() override;
+        /**
+         * @brief Copy the next run of order books into a buffer.
+         */
+        size_t next_batch(std::span<OrderBook> out) override;
         /**
          * @brief Reset iterator to beginning.
          */
@@ -91,6 +102,10 @@ namespace regimeflow::data
          * @brief Get next tick.
          */
         Tick next() override;
+        /**
+         * @brief Copy the next run of ticks into a buffer.
+         */
+        size_t next_batch(std::span<Tick> out) override;
         /**
          * @brief Reset iterator to beginning.
          */
@@ -101,8 +116,200 @@ namespace regimeflow::data
         size_t index_ = 0;
     };
 
+    /**
+     * @brief Immutable columnar bar series of one symbol, sorted by time.
+     */
+    struct BarColumns {
+        SymbolId symbol = 0;
+        std::vector<int64_t> timestamps;
+        std::vector<double> opens;
+        std::vector<double> highs;
+        std::vector<double> lows;
+        std::vector<double> closes;
+        std::vector<uint64_t> volumes;
+        std::vector<uint64_t> trade_counts;
+        std::vector<double> vwaps;
+
+        /**
+         * @brief Build columns from bars sorted by timestamp.
+         */
+        static std::shared_ptr<const BarColumns> from_bars(SymbolId symbol, const std::vector<Bar>& bars);
+        /**
+         * @brief Number of rows.
+         */
+        [[nodiscard]] size_t size() const { return timestamps.size(); }
+        /**
+         * @brief Materialize one row.
+         */
+        [[nodiscard]] Bar bar(size_t index) const;
+        /**
+         * @brief Rows [begin,end) inside a time range (all rows for an empty range).
+         */
+        [[nodiscard]] std::pair<size_t, size_t> find_range(TimeRange range) const;
+    };
+
+    /**
+     * @brief Immutable columnar tick series of one symbol, sorted by time.
+     */
+    struct TickColumns {
+        SymbolId symbol = 0;
+        std::vector<int64_t> timestamps;
+        std::vector<double> prices;
+        std::vector<double> quantities;
+        std::vector<uint8_t> flags;
+
+        /**
+         * @brief Build columns from ticks sorted by timestamp.
+         */
+        static std::shared_ptr<const TickColumns> from_ticks(SymbolId symbol, const std::vector<Tick>& ticks);
+        /**
+         * @brief Number of rows.
+         */
+        [[nodiscard]] size_t size() const { return timestamps.size(); }
+        /**
+         * @brief Materialize one row.
+         */
+        [[nodiscard]] Tick tick(size_t index) const;
+        /**
+         * @brief Rows [begin,end) inside a time range (all rows for an empty range).
+         */
+        [[nodiscard]] std::pair<size_t, size_t> find_range(TimeRange range) const;
+    };
+
+    /**
+     * @brief Immutable order book series of one symbol with a timestamp column.
+     */
+    struct OrderBookSeries {
+        std::vector<int64_t> timestamps;
+        std::vector<OrderBook> books;
+
+        /**
+         * @brief Build a series from books sorted by timestamp.
+         */
+        static std::shared_ptr<const OrderBookSeries> from_books(std::vector<OrderBook> books);
+        /**
+         * @brief Number of rows.
+         */
+        [[nodiscard]] size_t size() const { return timestamps.size(); }
+        /**
+         * @brief Rows [begin,end) inside a time range (all rows for an empty range).
+         */
+        [[nodiscard]] std::pair<size_t, size_t> find_range(TimeRange range) const;
+    };
+
+    /**
+     * @brief Zero-copy bar iterator over a window of shared columns.
+     */
+    class BarColumnsIterator final : public DataIterator {
+    public:
+        /**
+         * @brief Iterate rows [begin,end) of a series.
+         */
+        BarColumnsIterator(std::shared_ptr<const BarColumns> columns, size_t begin, size_t end);
+
+        /**
+         * @brief True if more bars exist.
+         */
+        [[nodiscard]] bool has_next() const override;
+        /**
+         * @brief Get next bar.
+         */
+        Bar next() override;
+        /**
+         * @brief Copy the next run of bars into a buffer.
+         */
+        size_t next_batch(std::span<Bar> out) override;
+        /**
+         * @brief Reset iterator to the start of the window.
+         */
+        void reset() override;
+
+    private:
+        std::shared_ptr<const BarColumns> columns_;
+        size_t begin_ = 0;
+        size_t end_ = 0;
+        size_t index_ = 0;
+    };
+
+    /**
+     * @brief Zero-copy tick iterator over a window of shared columns.
+     */
+    class TickColumnsIterator final : public TickIterator {
+    public:
+        /**
+         * @brief Iterate rows [begin,end) of a series.
+         */
+        TickColumnsIterator(std::shared_ptr<const TickColumns> columns, size_t begin, size_t end);
+
+        /**
+         * @brief True if more ticks exist.
+         */
+        [[nodiscard]] bool has_next() const override;
+        /**
+         * @brief Get next tick.
+         */
+        Tick next() override;
+        /**
+         * @brief Copy the next run of ticks into a buffer.
+         */
+        size_t next_batch(std::span<Tick> out) override;
+        /**
+         * @brief Reset iterator to the start of the window.
+         */
+        void reset() override;
+
+    private:
+        std::shared_ptr<const TickColumns> columns_;
+        size_t begin_ = 0;
+        size_t end_ = 0;
+        size_t index_ = 0;
+    };
+
+    /**
+     * @brief Zero-copy order book iterator over a window of a shared series.
+     */
+    class OrderBookSeriesIterator final : public OrderBookIterator {
+    public:
+        /**
+         * @brief Iterate rows [begin,end) of a series.
+         */
+        OrderBookSeriesIterator(std::shared_ptr<const OrderBookSeries> series, size_t begin, size_t end);
+
+        /**
+         * @brief True if more order books exist.
+         */
+        [[nodiscard]] bool has_next() const override;
+        /**
+         * @brief Get next order book.
+         */
+        OrderBook next() override;
+        /**
+         * @brief Copy the next run of order books into a buffer.
+         */
+        size_t next_batch(std::span<OrderBook> out) override;
+        /**
+         * @brief Reset iterator to the start of the window.
+         */
+        void reset() override;
+
+    private:
+        std::shared_ptr<const OrderBookSeries> series_;
+        size_t begin_ = 0;
+        size_t end_ = 0;
+        size_t index_ = 0;
+    };
+
     /**
      * @brief In-memory data source for tests or ad-hoc data.
+     *
+     * @details Each symbol's series is an immutable, time-sorted buffer held
+     * by shared_ptr. Adding data builds a new buffer, so iterators created
+     * earlier keep the series they started with. Range queries use binary
+     * search, and iterators reference the shared buffers instead of copying
+     * them. Copies of the source share the buffers, so parallel workers can
+     * each take a copy without duplicating the data. As-of lookups
+     * binary-search the timestamp column and remember each symbol's last
+     * answer; adding data or corporate actions clears those caches.
      */
     class MemoryDataSource final : public DataSource {
     public:
@@ -110,10 +317,25 @@ namespace regimeflow::data
          * @brief Add bars for a symbol.
          */
         void add_bars(SymbolId symbol, std::vector<Bar> bars);
+        /**
+         * @brief Replace a symbol's bars with a prebuilt column buffer.
+         *
+         * @details The buffer must be sorted by timestamp. It is shared, not
+         * copied.
+         */
+        void set_bar_columns(SymbolId symbol, std::shared_ptr<const BarColumns> columns);
+        /**
+         * @brief Shared bar columns for a symbol (null if none).
+         */
+        [[nodiscard]] std::shared_ptr<const BarColumns> bar_columns(SymbolId symbol) const;
         /**
          * @brief Add ticks for a symbol.
          */
         void add_ticks(SymbolId symbol, std::vector<Tick> ticks);
+        /**
+         * @brief Shared tick columns for a symbol (null if none).
+         */
+        [[nodiscard]] std::shared_ptr<const TickColumns> tick_columns(SymbolId symbol) const;
         /**
          * @brief Add order books for a symbol.
          */
@@ -150,6 +372,20 @@ namespace regimeflow::data
          */
         std::vector<OrderBook> get_order_books(SymbolId symbol, TimeRange range) override;
 
+        /**
+         * @brief Latest bar at or before a timestamp (binary search).
+         */
+        std::optional<Bar> get_bar_as_of(SymbolId symbol, Timestamp ts,
+                                         BarType bar_type = BarType::Time_1Day) override;
+        /**
+         * @brief Latest tick at or before a timestamp (binary search).
+         */
+        std::optional<Tick> get_tick_as_of(SymbolId symbol, Timestamp ts) override;
+        /**
+         * @brief Latest order book at or before a timestamp (binary search).
+         */
+        std::optional<OrderBook> get_order_book_as_of(SymbolId symbol, Timestamp ts) override;
+
         /**
          * @brief Create a bar iterator for multiple symbols.
          */
@@ -177,12 +413,15 @@ namespace regimeflow::data
                                                            TimeRange range) override;
 
     private:
-        static bool in_range(const Timestamp& ts, TimeRange range);
+        void clear_as_of_caches();
 
-        std::map<SymbolId, std::vector<Bar>> bars_;
-        std::map<SymbolId, std::vector<Tick>> ticks_;
-        std::map<SymbolId, std::vector<OrderBook>> books_;
+        std::map<SymbolId, std::shared_ptr<const BarColumns>> bars_;
+        std::map<SymbolId, std::shared_ptr<const TickColumns>> ticks_;
+        std::map<SymbolId, std::shared_ptr<const OrderBookSeries>> books_;
         std::map<SymbolId, SymbolInfo> symbols_;
         CorporateActionAdjuster adjuster_;
+        AsOfCache<Bar> bar_as_of_;
+        AsOfCache<Tick> tick_as_of_;
+        AsOfCache<OrderBook> book_as_of_;
     };
 }  // namespace regimeflow::data
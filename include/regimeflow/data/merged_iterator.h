@@ -7,61 +7,220 @@
 
 #include "regimeflow/data/data_source.h"
 
+#include <cstddef>
 #include <memory>
-#include <queue>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace regimeflow::data
 {
     /**
-     * @brief Merge multiple bar iterators into a time-ordered stream.
+     * @brief Tournament (loser) tree merge of time-ordered iterators.
+     *
+     * @details Each source is drained through next_batch() into a small
+     * per-source buffer, so sources see one virtual call per batch instead of
+     * a has_next()/next() pair per element. The tree stores source indices
+     * only: internal node n holds the loser of the match played there and
+     * node 0 holds the overall winner. Advancing the winner replays a single
+     * leaf-to-root path, i.e. ceil(log2(k)) comparisons and no element copies;
+     * head keys are mirrored in a dense array so matches never touch the lane
+     * buffers.
+     * Ties on (timestamp, symbol) go to the lower source index.
+     * @tparam T Element type with timestamp and symbol members.
+     * @tparam Source Iterator interface providing next_batch()/reset().
      */
-    class MergedBarIterator final : public DataIterator {
+    template <typename T, typename Source>
+    class LoserTreeMerger {
     public:
         /**
-         * @brief Construct from a list of iterators.
-         * @param iterators Bar iterators.
+         * @brief Construct over a set of sources.
+         * @param sources Source iterators (null entries are treated as empty).
+         * @param batch_size Elements buffered per source.
          */
-        explicit MergedBarIterator(std::vector<std::unique_ptr<DataIterator>> iterators);
+        LoserTreeMerger(std::vector<std::unique_ptr<Source>> sources, const size_t batch_size)
+            : sources_(std::move(sources)),
+              lanes_(sources_.size()),
+              keys_(sources_.size()),
+              tree_(sources_.size(), 0) {
+            for (auto& lane : lanes_) {
+                lane.buffer.resize(batch_size == 0 ? 1 : batch_size);
+            }
+            build();
+        }
 
         /**
-         * @brief True if more bars exist.
+         * @brief True once every source is exhausted.
          */
-        [[nodiscard]] bool has_next() const override;
+        [[nodiscard]] bool empty() const { return tree_.empty() || exhausted(tree_[0]); }
+
         /**
-         * @brief Get the next merged bar.
+         * @brief Remove and return the smallest element.
          */
-        Bar next() override;
+        T pop() {
+            const size_t winner = tree_[0];
+            auto& lane = lanes_[winner];
+            T value = std::move(lane.buffer[lane.pos]);
+            advance(winner);
+            return value;
+        }
+
         /**
-         * @brief Reset all iterators and heap.
+         * @brief Move up to out.size() elements in merge order into a buffer.
+         * @param out Destination.
+         * @return Number of elements written.
          */
-        void reset() override;
+        size_t pop_batch(const std::span<T> out) {
+            size_t count = 0;
+            while (count < out.size() && !empty()) {
+                const size_t winner = tree_[0];
+                auto& lane = lanes_[winner];
+                out[count++] = std::move(lane.buffer[lane.pos]);
+                advance(winner);
+            }
+            return count;
+        }
+
+        /**
+         * @brief Reset every source and rebuild the tree.
+         */
+        void reset() {
+            for (auto& source : sources_) {
+                if (source) {
+                    source->reset();
+                }
+            }
+            build();
+        }
 
     private:
         /**
-         * @brief Heap entry for bar merge.
+         * @brief Buffered window of one source.
          */
-        struct HeapEntry {
-            Bar bar;
-            size_t iterator_index = 0;
+        struct Lane {
+            std::vector<T> buffer;
+            size_t pos = 0;
+            size_t size = 0;
         };
 
         /**
-         * @brief Heap comparator for bars.
+         * @brief Sort key of a lane's head, kept in a dense array so matches
+         * do not touch the lane buffers.
          */
-        struct HeapCompare {
-            bool operator()(const HeapEntry& lhs, const HeapEntry& rhs) const {
-                if (lhs.bar.timestamp != rhs.bar.timestamp) {
-                    return lhs.bar.timestamp > rhs.bar.timestamp;
+        struct HeadKey {
+            Timestamp timestamp;
+            SymbolId symbol = 0;
+            bool live = false;
+        };
+
+        [[nodiscard]] bool exhausted(const size_t lane) const { return !keys_[lane].live; }
+
+        [[nodiscard]] bool beats(const size_t a, const size_t b) const {
+            const HeadKey& lhs = keys_[a];
+            const HeadKey& rhs = keys_[b];
+            if (lhs.live != rhs.live) {
+                return lhs.live;
+            }
+            if (lhs.timestamp != rhs.timestamp) {
+                return lhs.timestamp < rhs.timestamp;
+            }
+            if (lhs.symbol != rhs.symbol) {
+                return lhs.symbol < rhs.symbol;
+            }
+            return a < b;
+        }
+
+        void load_key(const size_t lane) {
+            const auto& entry = lanes_[lane];
+            auto& key = keys_[lane];
+            key.live = entry.pos < entry.size;
+            if (key.live) {
+                key.timestamp = entry.buffer[entry.pos].timestamp;
+                key.symbol = entry.buffer[entry.pos].symbol;
+            }
+        }
+
+        void refill(const size_t lane) {
+            auto& entry = lanes_[lane];
+            entry.pos = 0;
+            entry.size = sources_[lane] ? sources_[lane]->next_batch(entry.buffer) : 0;
+        }
+
+        void advance(size_t lane) {
+            if (++lanes_[lane].pos >= lanes_[lane].size) {
+                refill(lane);
+            }
+            load_key(lane);
+            const size_t k = lanes_.size();
+            for (size_t node = (lane + k) / 2; node > 0; node /= 2) {
+                if (beats(tree_[node], lane)) {
+                    std::swap(tree_[node], lane);
                 }
-                return lhs.bar.symbol > rhs.bar.symbol;
             }
-        };
+            tree_[0] = lane;
+        }
 
-        void initialize_heap();
+        void build() {
+            const size_t k = lanes_.size();
+            for (size_t i = 0; i < k; ++i) {
+                refill(i);
+                load_key(i);
+            }
+            if (k == 0) {
+                return;
+            }
+            // Leaves live at k..2k-1; play every match bottom-up, keeping
+            // the winner in `winners` and the loser in the tree.
+            std::vector<size_t> winners(2 * k);
+            for (size_t i = 0; i < k; ++i) {
+                winners[k + i] = i;
+            }
+            for (size_t node = k - 1; node > 0; --node) {
+                const size_t left = winners[2 * node];
+                const size_t right = winners[2 * node + 1];
+                const bool left_wins = beats(left, right);
+                winners[node] = left_wins ? left : right;
+                tree_[node] = left_wins ? right : left;
+            }
+            tree_[0] = k == 1 ? 0 : winners[1];
+        }
 
-        std::vector<std::unique_ptr<DataIterator>> iterators_;
-        std::priority_queue<HeapEntry, std::vector<HeapEntry>, HeapCompare> heap_;
+        std::vector<std::unique_ptr<Source>> sources_;
+        std::vector<Lane> lanes_;
+        std::vector<HeadKey> keys_;
+        std::vector<size_t> tree_;
+    };
+
+    /**
+     * @brief Merge multiple bar iterators into a time-ordered stream.
+     */
+    class MergedBarIterator final : public DataIterator {
+    public:
+        /**
+         * @brief Construct from a list of iterators.
+         * @param iterators Bar iterators.
+         */
+        explicit MergedBarIterator(std::vector<std::unique_ptr<DataIterator>> iterators);
+
+        /**
+         * @brief True if more bars exist.
+         */
+        [[nodiscard]] bool has_next() const override;
+        /**
+         * @brief Get the next merged bar.
+         */
+        Bar next() override;
+        /**
+         * @brief Fill a buffer with the next merged bars.
+         */
+        size_t next_batch(std::span<Bar> out) override;
+        /**
+         * @brief Reset all iterators and the merge tree.
+         */
+        void reset() override;
+
+    private:
+        LoserTreeMerger<Bar, DataIterator> merger_;
     };
 
     /**
@@ -84,35 +243,16 @@ namespace regimeflow::data
          */
         Tick next() override;
         /**
-         * @brief Reset all iterators and heap.
-         */
-        void reset() override;
-
-    private:
-        /**
-         * @brief Heap entry for tick merge.
+         * @brief Fill a buffer with the next merged ticks.
          */
-        struct HeapEntry {
-            Tick tick;
-            size_t iterator_index = 0;
-        };
-
+        size_t next_batch(std::span<Tick> out) override;
         /**
-         * @brief Heap comparator for ticks.
+         * @brief Reset all iterators and the merge tree.
          */
-        struct HeapCompare {
-            bool operator()(const HeapEntry& lhs, const HeapEntry& rhs) const {
-                if (lhs.tick.timestamp != rhs.tick.timestamp) {
-                    return lhs.tick.timestamp > rhs.tick.timestamp;
-                }
-                return lhs.tick.symbol > rhs.tick.symbol;
-            }
-        };
-
-        void initialize_heap();
+        void reset() override;
 
-        std::vector<std::unique_ptr<TickIterator>> iterators_;
-        std::priority_queue<HeapEntry, std::vector<HeapEntry>, HeapCompare> heap_;
+    private:
+        LoserTreeMerger<Tick, TickIterator> merger_;
     };
 
     /**
@@ -135,34 +275,15 @@ namespace regimeflow::data
          */
         OrderBook next() override;
         /**
-         * @brief Reset all iterators and heap.
-         */
-        void reset() override;
-
-    private:
-        /**
-         * @brief Heap entry for order book merge.
+         * @brief Fill a buffer with the next merged order books.
          */
-        struct HeapEntry {
-            OrderBook book;
-            size_t iterator_index = 0;
-        };
-
+        size_t next_batch(std::span<OrderBook> out) override;
         /**
-         * @brief Heap comparator for order books.
+         * @brief Reset all iterators and the merge tree.
          */
-        struct HeapCompare {
-            bool operator()(const HeapEntry& lhs, const HeapEntry& rhs) const {
-                if (lhs.book.timestamp != rhs.book.timestamp) {
-                    return lhs.book.timestamp > rhs.book.timestamp;
-                }
-                return lhs.book.symbol > rhs.book.symbol;
-            }
-        };
-
-        void initialize_heap();
+        void reset() override;
 
-        std::vector<std::unique_ptr<OrderBookIterator>> iterators_;
-        std::priority_queue<HeapEntry, std::vector<HeapEntry>, HeapCompare> heap_;
+    private:
+        LoserTreeMerger<OrderBook, OrderBookIterator> merger_;
     };
 }  // namespace regimeflow::data
@@ -49,6 +49,19 @@ namespace regimeflow::data
          * @brief Fetch order books for a symbol and range.
          */
         std::vector<OrderBook> get_order_books(SymbolId symbol, TimeRange range) override;
+        /**
+         * @brief Latest bar at or before a timestamp.
+         */
+        std::optional<Bar> get_bar_as_of(SymbolId symbol, Timestamp ts,
+                                         BarType bar_type = BarType::Time_1Day) override;
+        /**
+         * @brief Latest tick at or before a timestamp.
+         */
+        std::optional<Tick> get_tick_as_of(SymbolId symbol, Timestamp ts) override;
+        /**
+         * @brief Latest order book at or before a timestamp.
+         */
+        std::optional<OrderBook> get_order_book_as_of(SymbolId symbol, Timestamp ts) override;
 
         /**
          * @brief Create a bar iterator for multiple symbols.
@@ -0,0 +1,179 @@
+/**
+ * @file mmap_access.h
+ * @brief RegimeFlow regimeflow mmap access policy declarations.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace regimeflow::data
+{
+    /**
+     * @brief Kernel paging hint for a mapped data file.
+     */
+    enum class MmapAccessPolicy {
+        /**
+         * @brief Leave the kernel's default readahead in place.
+         */
+        Default,
+        /**
+         * @brief The active window is scanned front to back (MADV_SEQUENTIAL).
+         */
+        Sequential,
+        /**
+         * @brief Point lookups; disable readahead for the window (MADV_RANDOM).
+         */
+        Random,
+        /**
+         * @brief Sequential scan whose window is faulted in ahead of use
+         * (MADV_SEQUENTIAL plus MADV_WILLNEED).
+         */
+        PrefetchRange
+    };
+
+    /**
+     * @brief Parse a policy name (default, sequential, random, prefetch_range).
+     * @param name Policy name.
+     * @param fallback Value returned for unknown names.
+     */
+    MmapAccessPolicy parse_mmap_access_policy(std::string_view name,
+                                              MmapAccessPolicy fallback = MmapAccessPolicy::Default);
+
+    /**
+     * @brief One column of a mapped file: row 0 address and bytes per row.
+     */
+    struct MmapColumn {
+        const void* base = nullptr;
+        size_t row_bytes = 0;
+    };
+
+    /**
+     * @brief Apply a policy to the rows [begin,end) of each column.
+     *
+     * @details Ranges are widened to page boundaries and clamped to the
+     * mapping. Only the window is advised, since one mapping can be shared
+     * by several readers through the file cache.
+     * Advice is a hint: failures are ignored, and Windows has no
+     * equivalent, so there only MmapPrefetcher applies.
+     * @param mapping Start of the mapping (page aligned).
+     * @param mapping_size Mapping length in bytes.
+     * @param columns Column layout.
+     * @param begin First row.
+     * @param end One past the last row.
+     * @param policy Access policy.
+     */
+    void advise_mmap_rows(const void* mapping, size_t mapping_size,
+                          const std::vector<MmapColumn>& columns,
+                          size_t begin, size_t end, MmapAccessPolicy policy);
+
+    /**
+     * @brief Ask for transparent huge pages on a mapping (MADV_HUGEPAGE).
+     *
+     * @details File-backed mappings only get huge pages on kernels with
+     * read-only file THP; elsewhere this is a no-op.
+     */
+    void advise_mmap_huge_pages(const void* mapping, size_t mapping_size);
+
+    class MmapPrefetcher;
+
+    /**
+     * @brief Background thread that serves many MmapPrefetchers.
+     *
+     * @details Prefetchers that fall behind their cursor are queued, and
+     * the thread faults in a short step of one, then requeues it behind the
+     * others, so one thread keeps every open cursor of a source warm. Each
+     * prefetcher holds a reference, so the worker outlives them.
+     */
+    class MmapPrefetchWorker {
+    public:
+        /**
+         * @brief Start the thread.
+         */
+        MmapPrefetchWorker();
+        /**
+         * @brief Stop and join the thread.
+         */
+        ~MmapPrefetchWorker();
+
+        MmapPrefetchWorker(const MmapPrefetchWorker&) = delete;
+        MmapPrefetchWorker& operator=(const MmapPrefetchWorker&) = delete;
+
+    private:
+        friend class MmapPrefetcher;
+
+        void schedule(MmapPrefetcher* prefetcher);
+        void remove(MmapPrefetcher* prefetcher);
+        void run();
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::condition_variable idle_cv_;
+        std::deque<MmapPrefetcher*> queue_;
+        MmapPrefetcher* busy_ = nullptr;
+        bool stop_ = false;
+        std::thread thread_;
+    };
+
+    /**
+     * @brief Pre-faults column pages ahead of a cursor on a prefetch worker.
+     *
+     * @details The owner reports its row with advance(); the worker keeps
+     * the next `ahead_rows` rows of every column resident by touching one
+     * byte per page, so a cold scan stalls on the prefetcher instead of on
+     * its own page faults. The mapping must outlive the prefetcher.
+     */
+    class MmapPrefetcher {
+    public:
+        /**
+         * @brief Start prefetching rows [begin,end).
+         * @param columns Column layout.
+         * @param begin First row of the window.
+         * @param end One past the last row of the window.
+         * @param ahead_rows Rows kept resident ahead of the cursor.
+         * @param worker Shared worker (null = a private one).
+         */
+        MmapPrefetcher(std::vector<MmapColumn> columns, size_t begin, size_t end, size_t ahead_rows,
+                       std::shared_ptr<MmapPrefetchWorker> worker = nullptr);
+        /**
+         * @brief Leave the worker's queue, waiting out a step in progress.
+         */
+        ~MmapPrefetcher();
+
+        MmapPrefetcher(const MmapPrefetcher&) = delete;
+        MmapPrefetcher& operator=(const MmapPrefetcher&) = delete;
+
+        /**
+         * @brief Report the owner's current row.
+         */
+        void advance(size_t row);
+        /**
+         * @brief One past the last row faulted in so far.
+         */
+        [[nodiscard]] size_t prefetched() const { return done_.load(std::memory_order_acquire); }
+
+    private:
+        friend class MmapPrefetchWorker;
+
+        // Fault in one step; true if the cursor still wants more.
+        bool step();
+        void touch(size_t begin, size_t end);
+
+        std::vector<MmapColumn> columns_;
+        size_t end_ = 0;
+        size_t ahead_ = 0;
+        std::atomic<size_t> cursor_{0};
+        std::atomic<size_t> done_{0};
+        // In the worker's queue; written under the worker's mutex.
+        std::atomic<bool> queued_{false};
+        std::shared_ptr<MmapPrefetchWorker> worker_;
+    };
+}  // namespace regimeflow::data
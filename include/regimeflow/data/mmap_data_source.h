@@ -5,22 +5,95 @@
 
 #pragma once
 
-#include "regimeflow/common/lru_cache.h"
+#include "regimeflow/data/as_of_cache.h"
+#include "regimeflow/data/compressed_mmap.h"
 #include "regimeflow/data/data_source.h"
 #include "regimeflow/data/corporate_actions.h"
 #include "regimeflow/data/memory_data_source.h"
 #include "regimeflow/data/mmap_reader.h"
+#include "regimeflow/data/mmap_source_cache.h"
 
 #include <memory>
+#include <span>
 #include <string>
 
 namespace regimeflow::data
 {
+    /**
+     * @brief Zero-copy bar iterator over the columns of a mapped file.
+     *
+     * @details Walks the timestamp/OHLCV column spans of a
+     * MemoryMappedDataFile over a find_range window and materializes one Bar
+     * per next() call, applying corporate-action adjustments on the fly. The
+     * iterator keeps the file mapping alive, so resident memory is bounded by
+     * the page cache rather than by the size of the range. An access policy
+     * is applied to the window up front, and with `prefetch_rows` an
+     * MmapPrefetcher faults pages in ahead of the cursor on the source's
+     * shared prefetch worker.
+     */
+    class MemoryMappedBarIterator final : public DataIterator {
+    public:
+        /**
+         * @brief Construct over a mapped file.
+         * @param file Mapped bar file.
+         * @param range Time range to iterate.
+         * @param actions Corporate actions for the file's symbol.
+         * @param policy Paging hint for the window.
+         * @param prefetch_rows Rows pre-faulted ahead of the cursor (0 disables).
+         * @param prefetch_worker Worker shared by iterators (null = a private one).
+         */
+        MemoryMappedBarIterator(std::shared_ptr<const MemoryMappedDataFile> file,
+                                TimeRange range,
+                                std::vector<CorporateAction> actions = {},
+                                MmapAccessPolicy policy = MmapAccessPolicy::Default,
+                                size_t prefetch_rows = 0,
+                                std::shared_ptr<MmapPrefetchWorker> prefetch_worker = nullptr);
+
+        /**
+         * @brief True if more bars exist.
+         */
+        [[nodiscard]] bool has_next() const override;
+        /**
+         * @brief Get next bar.
+         */
+        Bar next() override;
+        /**
+         * @brief Fill a buffer straight from the column spans.
+         */
+        size_t next_batch(std::span<Bar> out) override;
+        /**
+         * @brief Reset iterator to the start of the window.
+         */
+        void reset() override;
+
+    private:
+        [[nodiscard]] Bar read(size_t index) const;
+
+        std::shared_ptr<const MemoryMappedDataFile> file_;
+        std::span<const int64_t> timestamps_;
+        std::span<const double> opens_;
+        std::span<const double> highs_;
+        std::span<const double> lows_;
+        std::span<const double> closes_;
+        std::span<const uint64_t> volumes_;
+        SymbolId symbol_ = 0;
+        size_t begin_ = 0;
+        size_t index_ = 0;
+        CorporateActionAdjuster adjuster_;
+        bool adjust_ = false;
+        std::unique_ptr<MmapPrefetcher> prefetcher_;
+    };
+
     /**
      * @brief Memory-mapped data source for efficient historical access.
      */
     class MemoryMappedDataSource : public DataSource {
     public:
+        /**
+         * @brief File, packed-file and range caches of this source.
+         */
+        using Caches = MmapSourceCaches<MemoryMappedDataFile, CompressedBarFile, Bar>;
+
         /**
          * @brief Memory-mapped data source configuration.
          */
@@ -34,13 +107,42 @@ namespace regimeflow::data
              */
             bool preload_index = true;
             /**
-             * @brief Maximum cached files in LRU.
+             * @brief Maximum cached open files.
              */
             size_t max_cached_files = 100;
             /**
-             * @brief Maximum cached ranges in LRU (0 disables).
+             * @brief Maximum cached ranges (0 = no entry limit; the range cache is
+             * off unless this or max_cached_range_bytes is set).
              */
             size_t max_cached_ranges = 0;
+            /**
+             * @brief Paging hint applied to each queried window.
+             */
+            MmapAccessPolicy access_policy = MmapAccessPolicy::Default;
+            /**
+             * @brief Rows pre-faulted ahead of iterator cursors (0 disables).
+             */
+            size_t prefetch_rows = 0;
+            /**
+             * @brief Request transparent huge pages for mapped files.
+             */
+            bool huge_pages = false;
+            /**
+             * @brief Byte budget of the range cache (0 = entry limit only).
+             */
+            size_t max_cached_range_bytes = 0;
+            /**
+             * @brief Eviction policy of the file and range caches.
+             */
+            CacheEviction cache_eviction = CacheEviction::Lru;
+            /**
+             * @brief Lock shards per cache.
+             */
+            size_t cache_shards = 16;
+            /**
+             * @brief Caches shared with other sources (null = private caches).
+             */
+            std::shared_ptr<Caches> shared_caches;
         };
 
         /**
@@ -68,8 +170,21 @@ namespace regimeflow::data
          */
         std::vector<Tick> get_ticks(SymbolId symbol, TimeRange range) override;
 
+        /**
+         * @brief Latest bar at or before a timestamp.
+         *
+         * @details Uses the file's date index and a binary search, and
+         * remembers the answer per symbol and bar type until ts moves past
+         * the next bar. Compressed files use the default path.
+         */
+        std::optional<Bar> get_bar_as_of(SymbolId symbol, Timestamp ts,
+                                         BarType bar_type = BarType::Time_1Day) override;
+
         /**
          * @brief Create a bar iterator for multiple symbols.
+         *
+         * @details Each symbol is read through a MemoryMappedBarIterator, so
+         * no bars are copied up front and the range cache is bypassed.
          */
         std::unique_ptr<DataIterator> create_iterator(
             const std::vector<SymbolId>& symbols,
@@ -88,11 +203,16 @@ namespace regimeflow::data
 
     private:
         std::shared_ptr<MemoryMappedDataFile> get_file(SymbolId symbol, BarType bar_type) const;
+        std::shared_ptr<CompressedBarFile> get_compressed_file(SymbolId symbol, BarType bar_type) const;
         static std::string bar_type_suffix(BarType type);
 
         Config config_;
-        mutable LRUCache<std::string, std::shared_ptr<MemoryMappedDataFile>> file_cache_;
-        mutable LRUCache<std::string, std::shared_ptr<std::vector<Bar>>> range_cache_;
+        std::shared_ptr<Caches> caches_;
+        // Distinguishes this source's adjusted ranges in a shared range cache.
+        uint64_t range_tag_ = 0;
+        // One thread prefetches for all of this source's iterators.
+        std::shared_ptr<MmapPrefetchWorker> prefetch_worker_;
         CorporateActionAdjuster adjuster_;
+        AsOfCache<Bar, MemoryMappedDataFile> bar_as_of_;
     };
 }  // namespace regimeflow::data
@@ -8,12 +8,15 @@
 #include "regimeflow/common/time.h"
 #include "regimeflow/common/types.h"
 #include "regimeflow/data/bar.h"
+#include "regimeflow/data/mmap_access.h"
 
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <span>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace regimeflow::data
 {
@@ -171,6 +174,15 @@ namespace regimeflow::data
          * @return Pair of indices.
          */
         [[nodiscard]] std::pair<size_t, size_t> find_range(TimeRange range) const;
+        /**
+         * @brief Row of the latest bar at or before a timestamp.
+         *
+         * @details Narrows the search with the date index, then
+         * binary-searches one day of the timestamp column.
+         * @param ts Lookup time.
+         * @return Row index, or empty if every bar is after ts.
+         */
+        [[nodiscard]] std::optional<size_t> find_as_of(Timestamp ts) const;
 
         /**
          * @brief Column views for zero-copy access.
@@ -189,6 +201,21 @@ namespace regimeflow::data
          * @brief Preload the date index into memory.
          */
         void preload_index() const;
+        /**
+         * @brief Column layout of the data section, for access advice.
+         */
+        [[nodiscard]] std::vector<MmapColumn> columns() const;
+        /**
+         * @brief Apply an access policy to the rows [begin,end).
+         * @param policy Access policy.
+         * @param begin First row.
+         * @param end One past the last row.
+         */
+        void advise(MmapAccessPolicy policy, size_t begin, size_t end) const;
+        /**
+         * @brief Request transparent huge pages for the mapping.
+         */
+        void advise_huge_pages() const;
 
     private:
         void map_file(const std::string& path);
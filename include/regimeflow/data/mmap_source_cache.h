@@ -0,0 +1,74 @@
+/**
+ * @file mmap_source_cache.h
+ * @brief RegimeFlow regimeflow mmap source cache declarations.
+ */
+
+#pragma once
+
+#include "regimeflow/common/sharded_cache.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace regimeflow::data
+{
+    /**
+     * @brief Caches behind one memory-mapped data source.
+     *
+     * @details Holds the open raw files, the open packed (compressed or
+     * delta) files and the materialized query ranges, all keyed by string.
+     * The caches are thread-safe, so one instance can be handed to several
+     * sources through their Config (for example one per run_parallel
+     * worker) and each file is then mapped once. File caches are limited by
+     * entry count; the range cache by entry count and/or by an estimate of
+     * its heap bytes.
+     * @tparam File Raw mapped file type.
+     * @tparam Packed Compressed or delta file type.
+     * @tparam Row Row type of cached ranges.
+     */
+    template <typename File, typename Packed, typename Row>
+    struct MmapSourceCaches {
+        using FileCache = ShardedCache<std::string, std::shared_ptr<File>>;
+        using PackedCache = ShardedCache<std::string, std::shared_ptr<Packed>>;
+        using RangeCache = ShardedCache<std::string, std::shared_ptr<std::vector<Row>>>;
+
+        FileCache files;
+        PackedCache packed;
+        RangeCache ranges;
+
+        MmapSourceCaches(const ShardedCacheOptions& file_options, const ShardedCacheOptions& range_options)
+            : files(file_options), packed(file_options), ranges(range_options, &range_bytes) {}
+
+        /**
+         * @brief Approximate heap bytes of a cached range and its key.
+         */
+        static size_t range_bytes(const std::string& key, const std::shared_ptr<std::vector<Row>>& rows) {
+            size_t bytes = sizeof(std::string) + key.capacity() + sizeof(std::vector<Row>);
+            if (rows) {
+                bytes += rows->capacity() * sizeof(Row);
+            }
+            return bytes;
+        }
+
+        /**
+         * @brief Build caches from a source Config.
+         *
+         * @details Reads `max_cached_files`, `max_cached_ranges`,
+         * `max_cached_range_bytes`, `cache_shards` and `cache_eviction`.
+         */
+        template <typename Config>
+        static std::shared_ptr<MmapSourceCaches> create(const Config& config) {
+            ShardedCacheOptions file_options;
+            file_options.max_entries = config.max_cached_files;
+            file_options.shards = config.cache_shards;
+            file_options.eviction = config.cache_eviction;
+            ShardedCacheOptions range_options;
+            range_options.max_entries = config.max_cached_ranges;
+            range_options.max_weight = config.max_cached_range_bytes;
+            range_options.shards = config.cache_shards;
+            range_options.eviction = config.cache_eviction;
+            return std::make_shared<MmapSourceCaches>(file_options, range_options);
+        }
+    };
+}  // namespace regimeflow::data
@@ -7,8 +7,11 @@
 
 #include "regimeflow/common/result.h"
 #include "regimeflow/data/bar.h"
+#include "regimeflow/data/column_spill.h"
 #include "regimeflow/data/mmap_reader.h"
 
+#include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -19,6 +22,11 @@ namespace regimeflow::data
      */
     class MmapWriter {
     public:
+        MmapWriter();
+        ~MmapWriter();
+        MmapWriter(MmapWriter&&) noexcept;
+        MmapWriter& operator=(MmapWriter&&) noexcept;
+
         /**
          * @brief Write bars to a memory-mapped file.
          * @param path Output file path.
@@ -32,9 +40,59 @@ namespace regimeflow::data
                                 BarType bar_type,
                                 std::vector<Bar> bars);
 
-    private:
+        /**
+         * @brief Check that bars are sorted, positive and finite.
+         * @param bars Bars sorted by timestamp.
+         * @return Ok when the bars can be written.
+         */
         [[nodiscard]] static Result<void> validate_bars(const std::vector<Bar>& bars);
+        /**
+         * @brief Nominal bar duration in milliseconds (0 for activity bars).
+         * @param type Bar type.
+         */
         static uint32_t bar_size_ms(BarType type);
+
+        /**
+         * @brief Start streaming bars to a memory-mapped file.
+         *
+         * @details Bars are added with append() in timestamp order and the
+         * file is completed by finalize(); the result matches write_bars().
+         * At most `buffer_rows` bars are held in memory. The timestamp
+         * column goes straight to the file, the price and volume columns
+         * spill to `<path>.spill` until finalize() copies them into place.
+         * On any error the partial output is removed and the writer is
+         * closed.
+         * @param path Output file path.
+         * @param symbol Symbol string.
+         * @param bar_type Bar type.
+         * @param buffer_rows Bars buffered per column.
+         * @return Ok on success, error otherwise.
+         */
+        Result<void> open(const std::string& path, const std::string& symbol, BarType bar_type,
+                          size_t buffer_rows = kDefaultStreamRows);
+        /**
+         * @brief Append bars to the open stream.
+         * @param bars Bars sorted by timestamp, after any appended earlier.
+         * @return Ok on success, error otherwise.
+         */
+        Result<void> append(std::span<const Bar> bars);
+        /**
+         * @brief Write the remaining columns, date index and checksum.
+         * @return Ok on success, error otherwise.
+         */
+        Result<void> finalize();
+        /**
+         * @brief True between open() and finalize().
+         */
+        [[nodiscard]] bool is_open() const { return stream_ != nullptr; }
+
+    private:
+        struct Stream;
+
         static std::vector<DateIndex> build_date_index(const std::vector<Bar>& bars);
+        Result<void> flush_stream();
+        Result<void> fail_stream(Result<void> error);
+
+        std::unique_ptr<Stream> stream_;
     };
 }  // namespace regimeflow::data
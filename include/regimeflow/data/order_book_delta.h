@@ -0,0 +1,257 @@
+/**
+ * @file order_book_delta.h
+ * @brief RegimeFlow regimeflow incremental order book storage declarations.
+ */
+
+#pragma once
+
+#include "regimeflow/common/result.h"
+#include "regimeflow/common/time.h"
+#include "regimeflow/common/types.h"
+#include "regimeflow/data/data_source.h"
+#include "regimeflow/data/order_book.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace regimeflow::data
+{
+#pragma pack(push, 1)
+    /**
+     * @brief Header for incremental order book files (.rfobd).
+     *
+     * @details File layout:
+     * - header (256 bytes)
+     * - record stream: one record per book update, holding the timestamp
+     *   delta and only the levels that changed since the previous book;
+     *   every keyframe_interval records a keyframe restates the whole book
+     * - keyframe index: keyframe_count BookKeyframeEntry records
+     *
+     * The checksum covers every byte after the header.
+     */
+    struct BookDeltaFileHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t flags;
+        char symbol[32];
+        uint32_t level_count;
+        uint32_t keyframe_interval;
+        int64_t start_timestamp;
+        int64_t end_timestamp;
+        uint64_t book_count;
+        uint64_t keyframe_count;
+        uint64_t data_offset;
+        uint64_t index_offset;
+        unsigned char checksum[32];
+        unsigned char reserved[120];
+    };
+
+    /**
+     * @brief Keyframe index entry.
+     */
+    struct BookKeyframeEntry {
+        int64_t timestamp;
+        uint64_t book_index;
+        uint64_t offset;
+    };
+#pragma pack(pop)
+
+    static_assert(sizeof(BookDeltaFileHeader) == 256, "BookDeltaFileHeader must be 256 bytes");
+    static_assert(sizeof(BookKeyframeEntry) == 24, "BookKeyframeEntry must be 24 bytes");
+
+    /**
+     * @brief Memory-mapped incremental order book file.
+     */
+    class OrderBookDeltaFile {
+    public:
+        /**
+         * @brief Replays records into a running book.
+         *
+         * @details Start at a keyframe with seek(), then call advance() once
+         * per update. Only the levels named in each record are touched.
+         */
+        class Cursor {
+        public:
+            /**
+             * @brief Construct positioned at the first keyframe.
+             * @param file Mapped file; must outlive the cursor.
+             */
+            explicit Cursor(const OrderBookDeltaFile& file);
+
+            /**
+             * @brief Position before a keyframe's record.
+             * @param keyframe Keyframe index.
+             */
+            void seek(size_t keyframe);
+            /**
+             * @brief Apply the next record.
+             * @return False when no records remain.
+             */
+            bool advance();
+
+            /**
+             * @brief Book after the last applied record.
+             */
+            [[nodiscard]] const OrderBook& book() const { return book_; }
+            /**
+             * @brief Index of the next record advance() will apply.
+             */
+            [[nodiscard]] size_t next_index() const { return next_index_; }
+
+        private:
+            const OrderBookDeltaFile* file_ = nullptr;
+            const uint8_t* pos_ = nullptr;
+            const uint8_t* end_ = nullptr;
+            size_t next_index_ = 0;
+            OrderBook book_{};
+        };
+
+        /**
+         * @brief Map a delta file into memory.
+         * @param path File path.
+         */
+        explicit OrderBookDeltaFile(const std::string& path);
+        /**
+         * @brief Unmap and close the file.
+         */
+        ~OrderBookDeltaFile();
+
+        OrderBookDeltaFile(const OrderBookDeltaFile&) = delete;
+        OrderBookDeltaFile& operator=(const OrderBookDeltaFile&) = delete;
+        OrderBookDeltaFile(OrderBookDeltaFile&&) = delete;
+        OrderBookDeltaFile& operator=(OrderBookDeltaFile&&) = delete;
+
+        /**
+         * @brief File header.
+         */
+        [[nodiscard]] const BookDeltaFileHeader& header() const { return *header_; }
+        /**
+         * @brief Symbol string from header.
+         */
+        [[nodiscard]] const std::string& symbol() const { return symbol_; }
+        /**
+         * @brief Symbol ID derived from registry.
+         */
+        [[nodiscard]] SymbolId symbol_id() const { return symbol_id_; }
+        /**
+         * @brief Time range covered by this file.
+         */
+        [[nodiscard]] TimeRange time_range() const;
+        /**
+         * @brief Number of book updates.
+         */
+        [[nodiscard]] size_t book_count() const { return static_cast<size_t>(header_->book_count); }
+        /**
+         * @brief Size of the mapped file in bytes.
+         */
+        [[nodiscard]] size_t file_size() const { return file_size_; }
+        /**
+         * @brief Keyframe index.
+         */
+        [[nodiscard]] std::span<const BookKeyframeEntry> keyframes() const { return keyframes_; }
+
+        /**
+         * @brief Keyframe to start from to reach a book index.
+         * @param index Book index.
+         */
+        [[nodiscard]] size_t keyframe_for(size_t index) const;
+        /**
+         * @brief Find a [start,end) book index range for a time range.
+         *
+         * @details Locates keyframes by timestamp and replays at most one
+         * keyframe interval per boundary.
+         * @param range Requested time range.
+         * @return Pair of indices.
+         */
+        [[nodiscard]] std::pair<size_t, size_t> find_range(TimeRange range) const;
+
+    private:
+        void map_file(const std::string& path);
+        void unmap_file();
+        [[nodiscard]] size_t first_at_or_after(int64_t timestamp, bool inclusive) const;
+
+        void* mapping_ = nullptr;
+        size_t file_size_ = 0;
+#if defined(_WIN32)
+        void* file_handle_ = nullptr;
+        void* mapping_handle_ = nullptr;
+#endif
+        int fd_ = -1;
+
+        const BookDeltaFileHeader* header_ = nullptr;
+        const uint8_t* data_ = nullptr;
+        const uint8_t* data_end_ = nullptr;
+        std::span<const BookKeyframeEntry> keyframes_;
+        std::string symbol_;
+        SymbolId symbol_id_ = 0;
+    };
+
+    /**
+     * @brief Writer for incremental order book files.
+     */
+    class OrderBookDeltaWriter {
+    public:
+        /**
+         * @brief Default updates between keyframes.
+         */
+        static constexpr uint32_t kDefaultKeyframeInterval = 256;
+
+        /**
+         * @brief Construct with a keyframe interval.
+         * @param keyframe_interval Updates between keyframes (at least 1).
+         */
+        explicit OrderBookDeltaWriter(uint32_t keyframe_interval = kDefaultKeyframeInterval);
+
+        /**
+         * @brief Write order book updates to a delta file.
+         * @param path Output path.
+         * @param symbol Symbol string.
+         * @param books Order book snapshots.
+         * @return Ok on success, error otherwise.
+         */
+        Result<void> write_books(const std::string& path,
+                                 const std::string& symbol,
+                                 std::vector<OrderBook> books) const;
+
+    private:
+        uint32_t keyframe_interval_;
+    };
+
+    /**
+     * @brief Order book iterator that maintains the book incrementally.
+     */
+    class OrderBookDeltaIterator final : public OrderBookIterator {
+    public:
+        /**
+         * @brief Construct over a delta file.
+         * @param file Mapped file (nullptr yields an empty iterator).
+         * @param range Time range to iterate.
+         */
+        OrderBookDeltaIterator(std::shared_ptr<const OrderBookDeltaFile> file, TimeRange range);
+
+        /**
+         * @brief True if more books exist.
+         */
+        [[nodiscard]] bool has_next() const override;
+        /**
+         * @brief Get next book.
+         */
+        OrderBook next() override;
+        /**
+         * @brief Reset iterator to the start of the range.
+         */
+        void reset() override;
+
+    private:
+        std::shared_ptr<const OrderBookDeltaFile> file_;
+        std::unique_ptr<OrderBookDeltaFile::Cursor> cursor_;
+        size_t begin_ = 0;
+        size_t end_ = 0;
+        size_t index_ = 0;
+    };
+}  // namespace regimeflow::data
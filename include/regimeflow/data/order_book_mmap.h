@@ -8,10 +8,14 @@
 #include "regimeflow/common/result.h"
 #include "regimeflow/common/time.h"
 #include "regimeflow/common/types.h"
+#include "regimeflow/data/column_spill.h"
+#include "regimeflow/data/mmap_access.h"
 #include "regimeflow/data/order_book.h"
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <optional>
 #include <span>
 #include <string>
 #include <utility>
@@ -90,6 +94,10 @@ namespace regimeflow::data
          * @brief Number of order book snapshots.
          */
         [[nodiscard]] size_t book_count() const;
+        /**
+         * @brief Timestamp column for zero-copy access.
+         */
+        [[nodiscard]] std::span<const int64_t> timestamps() const;
 
         /**
          * @brief Read an order book at an index.
@@ -104,6 +112,30 @@ namespace regimeflow::data
          * @return Pair of indices.
          */
         [[nodiscard]] std::pair<size_t, size_t> find_range(TimeRange range) const;
+        /**
+         * @brief Row of the latest book at or before a timestamp.
+         *
+         * @details Narrows the search with the date index, then
+         * binary-searches one day of the timestamp column.
+         * @param ts Lookup time.
+         * @return Row index, or empty if every book is after ts.
+         */
+        [[nodiscard]] std::optional<size_t> find_as_of(Timestamp ts) const;
+        /**
+         * @brief Column layout of the data section, for access advice.
+         */
+        [[nodiscard]] std::vector<MmapColumn> columns() const;
+        /**
+         * @brief Apply an access policy to the rows [begin,end).
+         * @param policy Access policy.
+         * @param begin First row.
+         * @param end One past the last row.
+         */
+        void advise(MmapAccessPolicy policy, size_t begin, size_t end) const;
+        /**
+         * @brief Request transparent huge pages for the mapping.
+         */
+        void advise_huge_pages() const;
 
     private:
         void map_file(const std::string& path);
@@ -137,6 +169,11 @@ namespace regimeflow::data
      */
     class OrderBookMmapWriter {
     public:
+        OrderBookMmapWriter();
+        ~OrderBookMmapWriter();
+        OrderBookMmapWriter(OrderBookMmapWriter&&) noexcept;
+        OrderBookMmapWriter& operator=(OrderBookMmapWriter&&) noexcept;
+
         /**
          * @brief Write order book snapshots to a mmap file.
          * @param path Output path.
@@ -148,8 +185,52 @@ namespace regimeflow::data
                                  const std::string& symbol,
                                  std::vector<OrderBook> books);
 
+        /**
+         * @brief Check that books are sorted with positive timestamps.
+         * @param books Books sorted by timestamp.
+         * @return Ok when the books can be written.
+         */
+        [[nodiscard]] static Result<void> validate_books(const std::vector<OrderBook>& books);
+
+        /**
+         * @brief Start streaming order books to a mmap file.
+         *
+         * @details Books are added with append() in timestamp order and the
+         * file is completed by finalize(); the result matches write_books().
+         * At most `buffer_rows` books are held in memory. The timestamp
+         * column goes straight to the file, the per-level columns spill to
+         * `<path>.spill` until finalize() copies them into place. On any
+         * error the partial output is removed and the writer is closed.
+         * @param path Output path.
+         * @param symbol Symbol string.
+         * @param buffer_rows Books buffered per column.
+         * @return Ok on success, error otherwise.
+         */
+        Result<void> open(const std::string& path, const std::string& symbol,
+                          size_t buffer_rows = kDefaultStreamRows);
+        /**
+         * @brief Append books to the open stream.
+         * @param books Books sorted by timestamp, after any appended earlier.
+         * @return Ok on success, error otherwise.
+         */
+        Result<void> append(std::span<const OrderBook> books);
+        /**
+         * @brief Write the remaining columns, date index and checksum.
+         * @return Ok on success, error otherwise.
+         */
+        Result<void> finalize();
+        /**
+         * @brief True between open() and finalize().
+         */
+        [[nodiscard]] bool is_open() const { return stream_ != nullptr; }
+
     private:
-        [[nodiscard]] Result<void> validate_books(const std::vector<OrderBook>& books) const;
+        struct Stream;
+
         static std::vector<BookDateIndex> build_date_index(const std::vector<OrderBook>& books);
+        Result<void> flush_stream();
+        Result<void> fail_stream(Result<void> error);
+
+        std::unique_ptr<Stream> stream_;
     };
 }  // namespace regimeflow::data
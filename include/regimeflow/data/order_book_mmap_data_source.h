@@ -5,10 +5,12 @@
 
 #pragma once
 
-#include "regimeflow/common/lru_cache.h"
+#include "regimeflow/data/as_of_cache.h"
 #include "regimeflow/data/data_source.h"
 #include "regimeflow/data/corporate_actions.h"
 #include "regimeflow/data/memory_data_source.h"
+#include "regimeflow/data/mmap_source_cache.h"
+#include "regimeflow/data/order_book_delta.h"
 #include "regimeflow/data/order_book_mmap.h"
 
 #include <memory>
@@ -21,6 +23,11 @@ namespace regimeflow::data
      */
     class OrderBookMmapDataSource final : public DataSource {
     public:
+        /**
+         * @brief File, packed-file and range caches of this source.
+         */
+        using Caches = MmapSourceCaches<OrderBookMmapFile, OrderBookDeltaFile, OrderBook>;
+
         /**
          * @brief Configuration for order book mmap data source.
          */
@@ -30,13 +37,38 @@ namespace regimeflow::data
              */
             std::string data_directory;
             /**
-             * @brief Maximum cached files in LRU.
+             * @brief Maximum cached open files.
              */
             size_t max_cached_files = 100;
             /**
-             * @brief Maximum cached ranges in LRU (0 disables).
+             * @brief Maximum cached ranges (0 = no entry limit; the range cache is
+             * off unless this or max_cached_range_bytes is set).
              */
             size_t max_cached_ranges = 0;
+            /**
+             * @brief Paging hint applied to each queried window.
+             */
+            MmapAccessPolicy access_policy = MmapAccessPolicy::Default;
+            /**
+             * @brief Request transparent huge pages for mapped files.
+             */
+            bool huge_pages = false;
+            /**
+             * @brief Byte budget of the range cache (0 = entry limit only).
+             */
+            size_t max_cached_range_bytes = 0;
+            /**
+             * @brief Eviction policy of the file and range caches.
+             */
+            CacheEviction cache_eviction = CacheEviction::Lru;
+            /**
+             * @brief Lock shards per cache.
+             */
+            size_t cache_shards = 16;
+            /**
+             * @brief Caches shared with other sources (null = private caches).
+             */
+            std::shared_ptr<Caches> shared_caches;
         };
 
         /**
@@ -67,6 +99,14 @@ namespace regimeflow::data
          * @brief Load order books for a symbol and range.
          */
         std::vector<OrderBook> get_order_books(SymbolId symbol, TimeRange range) override;
+        /**
+         * @brief Latest order book at or before a timestamp.
+         *
+         * @details Uses the file's date index and a binary search, and
+         * remembers the answer per symbol until ts moves past the next
+         * snapshot. Delta-encoded files use the default path.
+         */
+        std::optional<OrderBook> get_order_book_as_of(SymbolId symbol, Timestamp ts) override;
 
         /**
          * @brief Bars are not supported; returns empty iterator.
@@ -100,10 +140,11 @@ namespace regimeflow::data
 
     private:
         std::shared_ptr<OrderBookMmapFile> get_file(SymbolId symbol) const;
+        std::shared_ptr<OrderBookDeltaFile> get_delta_file(SymbolId symbol) const;
 
         Config config_;
-        mutable LRUCache<std::string, std::shared_ptr<OrderBookMmapFile>> file_cache_;
-        mutable LRUCache<std::string, std::shared_ptr<std::vector<OrderBook>>> range_cache_;
+        std::shared_ptr<Caches> caches_;
         CorporateActionAdjuster adjuster_;
+        AsOfCache<OrderBook, OrderBookMmapFile> book_as_of_;
     };
 }  // namespace regimeflow::data
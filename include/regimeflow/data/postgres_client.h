@@ -12,6 +12,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <queue>
 #include <string>
 
@@ -134,10 +135,30 @@ namespace regimeflow::data
          */
         std::vector<OrderBook> query_order_books(SymbolId symbol, TimeRange range) override;
 
+        /**
+         * @brief Latest bar at or before a timestamp.
+         *
+         * @details Finds the row time with MAX(timestamp), which an index on
+         * (symbol, timestamp) answers with one descent, then fetches that
+         * row only.
+         */
+        std::optional<Bar> query_bar_as_of(SymbolId symbol, Timestamp ts, BarType bar_type) override;
+        /**
+         * @brief Latest tick at or before a timestamp.
+         */
+        std::optional<Tick> query_tick_as_of(SymbolId symbol, Timestamp ts) override;
+        /**
+         * @brief Latest order book (all levels) at or before a timestamp.
+         */
+        std::optional<OrderBook> query_order_book_as_of(SymbolId symbol, Timestamp ts) override;
+
     private:
         Config config_;
         ConnectionPool pool_;
 
+        std::optional<int64_t> latest_timestamp(const std::string& table, SymbolId symbol, Timestamp ts,
+                                                std::optional<BarType> bar_type);
+
         Result<void> execute_query(const std::string& sql,
                                    const std::vector<std::string>& params,
                                    std::function<void(void*)> row_handler);
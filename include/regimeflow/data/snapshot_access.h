@@ -14,6 +14,10 @@ namespace regimeflow::data
 {
     /**
      * @brief Access point-in-time snapshots from a data source.
+     *
+     * @details Each lookup returns the latest row at or before the given
+     * time through the source's as-of queries, so sources with indexed
+     * storage answer without materializing the history.
      */
     class SnapshotAccess {
     public:
@@ -55,6 +55,14 @@ namespace regimeflow::data
              * @brief UTC offset in seconds to apply to timestamps.
              */
             int utc_offset_seconds = 0;
+            /**
+             * @brief Worker threads for parsing large files (0 = hardware concurrency).
+             */
+            int parse_threads = 1;
+            /**
+             * @brief Directory for binary parse caches (empty disables caching).
+             */
+            std::string cache_directory;
         };
 
         /**
@@ -109,9 +117,13 @@ namespace regimeflow::data
     private:
         std::string resolve_path(SymbolId symbol) const;
         std::vector<Tick> parse_ticks(SymbolId symbol, const std::string& path, TimeRange range) const;
+        std::vector<Tick> read_ticks(SymbolId symbol, const std::string& path) const;
+        std::string cache_entry(const std::string& path) const;
         void scan_directory();
 
         Config config_;
+        CsvCache cache_;
+        std::string cache_fingerprint_;
         std::unordered_map<SymbolId, std::string> symbol_to_path_;
         mutable ValidationReport last_report_;
     };
@@ -8,10 +8,14 @@
 #include "regimeflow/common/time.h"
 #include "regimeflow/common/result.h"
 #include "regimeflow/common/types.h"
+#include "regimeflow/data/column_spill.h"
+#include "regimeflow/data/mmap_access.h"
 #include "regimeflow/data/tick.h"
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <optional>
 #include <span>
 #include <string>
 #include <utility>
@@ -139,6 +143,15 @@ namespace regimeflow::data
          * @return Pair of indices.
          */
         [[nodiscard]] std::pair<size_t, size_t> find_range(TimeRange range) const;
+        /**
+         * @brief Row of the latest tick at or before a timestamp.
+         *
+         * @details Narrows the search with the date index, then
+         * binary-searches one day of the timestamp column.
+         * @param ts Lookup time.
+         * @return Row index, or empty if every tick is after ts.
+         */
+        [[nodiscard]] std::optional<size_t> find_as_of(Timestamp ts) const;
 
         /**
          * @brief Column views for zero-copy access.
@@ -147,6 +160,21 @@ namespace regimeflow::data
         [[nodiscard]] std::span<const double> prices() const;
         [[nodiscard]] std::span<const double> quantities() const;
         [[nodiscard]] std::span<const uint32_t> flags() const;
+        /**
+         * @brief Column layout of the data section, for access advice.
+         */
+        [[nodiscard]] std::vector<MmapColumn> columns() const;
+        /**
+         * @brief Apply an access policy to the rows [begin,end).
+         * @param policy Access policy.
+         * @param begin First row.
+         * @param end One past the last row.
+         */
+        void advise(MmapAccessPolicy policy, size_t begin, size_t end) const;
+        /**
+         * @brief Request transparent huge pages for the mapping.
+         */
+        void advise_huge_pages() const;
 
     private:
         void map_file(const std::string& path);
@@ -176,6 +204,11 @@ namespace regimeflow::data
      */
     class TickMmapWriter {
     public:
+        TickMmapWriter();
+        ~TickMmapWriter();
+        TickMmapWriter(TickMmapWriter&&) noexcept;
+        TickMmapWriter& operator=(TickMmapWriter&&) noexcept;
+
         /**
          * @brief Write ticks to a mmap file.
          * @param path Output path.
@@ -187,8 +220,52 @@ namespace regimeflow::data
                                  const std::string& symbol,
                                  std::vector<Tick> ticks);
 
+        /**
+         * @brief Check that ticks are sorted, positive and finite.
+         * @param ticks Ticks sorted by timestamp.
+         * @return Ok when the ticks can be written.
+         */
+        [[nodiscard]] static Result<void> validate_ticks(const std::vector<Tick>& ticks);
+
+        /**
+         * @brief Start streaming ticks to a mmap file.
+         *
+         * @details Ticks are added with append() in timestamp order and the
+         * file is completed by finalize(); the result matches write_ticks().
+         * At most `buffer_rows` ticks are held in memory. The timestamp
+         * column goes straight to the file, the other columns spill to
+         * `<path>.spill` until finalize() copies them into place. On any
+         * error the partial output is removed and the writer is closed.
+         * @param path Output path.
+         * @param symbol Symbol string.
+         * @param buffer_rows Ticks buffered per column.
+         * @return Ok on success, error otherwise.
+         */
+        Result<void> open(const std::string& path, const std::string& symbol,
+                          size_t buffer_rows = kDefaultStreamRows);
+        /**
+         * @brief Append ticks to the open stream.
+         * @param ticks Ticks sorted by timestamp, after any appended earlier.
+         * @return Ok on success, error otherwise.
+         */
+        Result<void> append(std::span<const Tick> ticks);
+        /**
+         * @brief Write the remaining columns, date index and checksum.
+         * @return Ok on success, error otherwise.
+         */
+        Result<void> finalize();
+        /**
+         * @brief True between open() and finalize().
+         */
+        [[nodiscard]] bool is_open() const { return stream_ != nullptr; }
+
     private:
-        [[nodiscard]] Result<void> validate_ticks(const std::vector<Tick>& ticks) const;
+        struct Stream;
+
         static std::vector<TickDateIndex> build_date_index(const std::vector<Tick>& ticks);
+        Result<void> flush_stream();
+        Result<void> fail_stream(Result<void> error);
+
+        std::unique_ptr<Stream> stream_;
     };
 }  // namespace regimeflow::data
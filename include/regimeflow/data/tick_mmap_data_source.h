@@ -5,10 +5,12 @@
 
 #pragma once
 
-#include "regimeflow/common/lru_cache.h"
+#include "regimeflow/data/as_of_cache.h"
+#include "regimeflow/data/compressed_mmap.h"
 #include "regimeflow/data/data_source.h"
 #include "regimeflow/data/corporate_actions.h"
 #include "regimeflow/data/memory_data_source.h"
+#include "regimeflow/data/mmap_source_cache.h"
 #include "regimeflow/data/tick_mmap.h"
 
 #include <memory>
@@ -21,6 +23,11 @@ namespace regimeflow::data
      */
     class TickMmapDataSource final : public DataSource {
     public:
+        /**
+         * @brief File, packed-file and range caches of this source.
+         */
+        using Caches = MmapSourceCaches<TickMmapFile, CompressedTickFile, Tick>;
+
         /**
          * @brief Configuration for tick mmap data source.
          */
@@ -30,13 +37,38 @@ namespace regimeflow::data
              */
             std::string data_directory;
             /**
-             * @brief Maximum cached files in LRU.
+             * @brief Maximum cached open files.
              */
             size_t max_cached_files = 100;
             /**
-             * @brief Maximum cached ranges in LRU (0 disables).
+             * @brief Maximum cached ranges (0 = no entry limit; the range cache is
+             * off unless this or max_cached_range_bytes is set).
              */
             size_t max_cached_ranges = 0;
+            /**
+             * @brief Paging hint applied to each queried window.
+             */
+            MmapAccessPolicy access_policy = MmapAccessPolicy::Default;
+            /**
+             * @brief Request transparent huge pages for mapped files.
+             */
+            bool huge_pages = false;
+            /**
+             * @brief Byte budget of the range cache (0 = entry limit only).
+             */
+            size_t max_cached_range_bytes = 0;
+            /**
+             * @brief Eviction policy of the file and range caches.
+             */
+            CacheEviction cache_eviction = CacheEviction::Lru;
+            /**
+             * @brief Lock shards per cache.
+             */
+            size_t cache_shards = 16;
+            /**
+             * @brief Caches shared with other sources (null = private caches).
+             */
+            std::shared_ptr<Caches> shared_caches;
         };
 
         /**
@@ -63,6 +95,14 @@ namespace regimeflow::data
          * @brief Load ticks for a symbol and range.
          */
         std::vector<Tick> get_ticks(SymbolId symbol, TimeRange range) override;
+        /**
+         * @brief Latest tick at or before a timestamp.
+         *
+         * @details Uses the file's date index and a binary search, and
+         * remembers the answer per symbol until ts moves past the next tick.
+         * Compressed files use the default path.
+         */
+        std::optional<Tick> get_tick_as_of(SymbolId symbol, Timestamp ts) override;
 
         /**
          * @brief Bars not supported; returns empty iterator.
@@ -90,10 +130,11 @@ namespace regimeflow::data
 
     private:
         std::shared_ptr<TickMmapFile> get_file(SymbolId symbol) const;
+        std::shared_ptr<CompressedTickFile> get_compressed_file(SymbolId symbol) const;
 
         Config config_;
-        mutable LRUCache<std::string, std::shared_ptr<TickMmapFile>> file_cache_;
-        mutable LRUCache<std::string, std::shared_ptr<std::vector<Tick>>> range_cache_;
+        std::shared_ptr<Caches> caches_;
         CorporateActionAdjuster adjuster_;
+        AsOfCache<Tick, TickMmapFile> tick_as_of_;
     };
 }  // namespace regimeflow::data
@@ -8,6 +8,8 @@
 #include "regimeflow/data/data_source.h"
 
 #include <memory>
+#include <optional>
+#include <span>
 #include <vector>
 
 namespace regimeflow::data
@@ -36,6 +38,32 @@ namespace regimeflow::data
          */
         std::vector<OrderBook> order_books(SymbolId symbol, TimeRange range) const;
 
+        /**
+         * @brief Latest bar at or before a timestamp.
+         */
+        std::optional<Bar> bar_as_of(SymbolId symbol, Timestamp ts, BarType bar_type) const;
+        /**
+         * @brief Latest tick at or before a timestamp.
+         */
+        std::optional<Tick> tick_as_of(SymbolId symbol, Timestamp ts) const;
+        /**
+         * @brief Latest order book at or before a timestamp.
+         */
+        std::optional<OrderBook> order_book_as_of(SymbolId symbol, Timestamp ts) const;
+        /**
+         * @brief Sample a bar series at many timestamps.
+         *
+         * @details One as-of lookup per timestamp. Sorted timestamps that
+         * fall between the same pair of bars are answered from the source's
+         * as-of cache.
+         * @param symbol Symbol ID.
+         * @param times Sample times.
+         * @param bar_type Bar type.
+         * @return One entry per sample time, empty where no bar exists yet.
+         */
+        std::vector<std::optional<Bar>> bars_as_of(SymbolId symbol, std::span<const Timestamp> times,
+                                                   BarType bar_type) const;
+
     private:
         std::shared_ptr<DataSource> source_;
     };
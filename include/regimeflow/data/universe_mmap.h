@@ -0,0 +1,242 @@
+/**
+ * @file universe_mmap.h
+ * @brief RegimeFlow regimeflow multi-symbol universe mmap declarations.
+ */
+
+#pragma once
+
+#include "regimeflow/common/result.h"
+#include "regimeflow/common/time.h"
+#include "regimeflow/common/types.h"
+#include "regimeflow/data/bar.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace regimeflow::data
+{
+#pragma pack(push, 1)
+    /**
+     * @brief Header for universe container files (.rfu).
+     *
+     * @details File layout:
+     * - header (256 bytes)
+     * - symbol directory: symbol_count UniverseSymbolEntry records, sorted by name
+     * - partitions: one per UTC day, each holding the timestamp, open, high,
+     *   low, close and volume columns of every bar that day, grouped by symbol
+     * - footer: partition_count UniversePartitionEntry records sorted by day,
+     *   followed by slice_count UniverseSlice records
+     *
+     * The checksum covers every byte after the header.
+     */
+    struct UniverseFileHeader {
+        char magic[8];
+        uint32_t version;
+        uint32_t flags;
+        uint32_t bar_type;
+        uint32_t bar_size_ms;
+        uint32_t symbol_count;
+        uint32_t partition_count;
+        int64_t start_timestamp;
+        int64_t end_timestamp;
+        uint64_t bar_count;
+        uint64_t directory_offset;
+        uint64_t footer_offset;
+        uint64_t slice_count;
+        unsigned char checksum[32];
+        unsigned char reserved[144];
+    };
+
+    /**
+     * @brief Symbol directory entry.
+     */
+    struct UniverseSymbolEntry {
+        char symbol[32];
+        int64_t start_timestamp;
+        int64_t end_timestamp;
+        uint64_t bar_count;
+    };
+
+    /**
+     * @brief Footer index entry for one day partition.
+     */
+    struct UniversePartitionEntry {
+        int32_t day;
+        uint32_t slice_begin;
+        uint32_t slice_count;
+        uint32_t reserved;
+        uint64_t offset;
+        uint64_t bar_count;
+    };
+
+    /**
+     * @brief Contiguous run of one symbol's bars inside a partition.
+     */
+    struct UniverseSlice {
+        uint32_t symbol_index;
+        uint32_t begin;
+        uint32_t count;
+        uint32_t reserved;
+    };
+#pragma pack(pop)
+
+    static_assert(sizeof(UniverseFileHeader) == 256, "UniverseFileHeader must be 256 bytes");
+    static_assert(sizeof(UniverseSymbolEntry) == 56, "UniverseSymbolEntry must be 56 bytes");
+    static_assert(sizeof(UniversePartitionEntry) == 32, "UniversePartitionEntry must be 32 bytes");
+    static_assert(sizeof(UniverseSlice) == 16, "UniverseSlice must be 16 bytes");
+
+    /**
+     * @brief Memory-mapped view of a universe container file.
+     *
+     * @details The whole universe is mapped once, so any symbol subset is
+     * served from a single descriptor and mapping.
+     */
+    class UniverseMmapFile {
+    public:
+        /**
+         * @brief Column spans of one partition.
+         */
+        struct Columns {
+            std::span<const int64_t> timestamps;
+            std::span<const double> opens;
+            std::span<const double> highs;
+            std::span<const double> lows;
+            std::span<const double> closes;
+            std::span<const uint64_t> volumes;
+        };
+
+        /**
+         * @brief Map a universe file into memory.
+         * @param path File path.
+         */
+        explicit UniverseMmapFile(const std::string& path);
+        /**
+         * @brief Unmap and close the file.
+         */
+        ~UniverseMmapFile();
+
+        UniverseMmapFile(const UniverseMmapFile&) = delete;
+        UniverseMmapFile& operator=(const UniverseMmapFile&) = delete;
+        UniverseMmapFile(UniverseMmapFile&&) = delete;
+        UniverseMmapFile& operator=(UniverseMmapFile&&) = delete;
+
+        /**
+         * @brief File header.
+         */
+        [[nodiscard]] const UniverseFileHeader& header() const { return *header_; }
+        /**
+         * @brief Bar type stored in the file.
+         */
+        [[nodiscard]] BarType bar_type() const { return static_cast<BarType>(header_->bar_type); }
+        /**
+         * @brief Time range covered by the file.
+         */
+        [[nodiscard]] TimeRange time_range() const;
+
+        /**
+         * @brief Symbol directory.
+         */
+        [[nodiscard]] std::span<const UniverseSymbolEntry> symbols() const { return symbols_; }
+        /**
+         * @brief Registry IDs of the directory entries, in directory order.
+         */
+        [[nodiscard]] std::span<const SymbolId> symbol_ids() const { return symbol_ids_; }
+        /**
+         * @brief Directory index of a symbol.
+         * @param symbol Symbol ID.
+         * @return Index, or nullopt if the symbol is not in the file.
+         */
+        [[nodiscard]] std::optional<uint32_t> find_symbol(SymbolId symbol) const;
+
+        /**
+         * @brief Day partitions sorted by day.
+         */
+        [[nodiscard]] std::span<const UniversePartitionEntry> partitions() const { return partitions_; }
+        /**
+         * @brief Find the [begin, end) partitions overlapping a time range.
+         * @param range Requested range; an empty range selects everything.
+         */
+        [[nodiscard]] std::pair<size_t, size_t> find_partitions(TimeRange range) const;
+        /**
+         * @brief Symbol slices of a partition, sorted by symbol index.
+         * @param partition Partition index.
+         */
+        [[nodiscard]] std::span<const UniverseSlice> slices(size_t partition) const;
+        /**
+         * @brief Slice of one symbol inside a partition.
+         * @param partition Partition index.
+         * @param symbol_index Directory index.
+         * @return Slice, or nullopt if the symbol has no bars that day.
+         */
+        [[nodiscard]] std::optional<UniverseSlice> find_slice(size_t partition, uint32_t symbol_index) const;
+        /**
+         * @brief Column spans of a partition.
+         * @param partition Partition index.
+         */
+        [[nodiscard]] Columns columns(size_t partition) const;
+
+    private:
+        void map_file(const std::string& path);
+        void unmap_file();
+        void setup_sections();
+
+        void* mapping_ = nullptr;
+        size_t file_size_ = 0;
+#if defined(_WIN32)
+        void* file_handle_ = nullptr;
+        void* mapping_handle_ = nullptr;
+#endif
+        int fd_ = -1;
+
+        const UniverseFileHeader* header_ = nullptr;
+        std::span<const UniverseSymbolEntry> symbols_;
+        std::span<const UniversePartitionEntry> partitions_;
+        std::span<const UniverseSlice> slices_;
+        std::vector<SymbolId> symbol_ids_;
+        std::unordered_map<SymbolId, uint32_t> symbol_lookup_;
+    };
+
+    /**
+     * @brief Writer for universe container files.
+     *
+     * @details Symbols are added one at a time; write() regroups them into
+     * day partitions. Bars are validated with the same rules as MmapWriter.
+     */
+    class UniverseMmapWriter {
+    public:
+        /**
+         * @brief Construct for a bar type.
+         * @param bar_type Bar type stored in the file.
+         */
+        explicit UniverseMmapWriter(BarType bar_type);
+
+        /**
+         * @brief Add one symbol's bars.
+         * @param symbol Symbol string (at most 31 characters).
+         * @param bars Bars to add; sorted by timestamp before validation.
+         * @return Ok on success, error otherwise.
+         */
+        Result<void> add_bars(const std::string& symbol, std::vector<Bar> bars);
+        /**
+         * @brief Number of symbols added so far.
+         */
+        [[nodiscard]] size_t symbol_count() const { return series_.size(); }
+
+        /**
+         * @brief Write the universe file.
+         * @param path Output path.
+         * @return Ok on success, error otherwise.
+         */
+        Result<void> write(const std::string& path) const;
+
+    private:
+        BarType bar_type_;
+        std::vector<std::pair<std::string, std::vector<Bar>>> series_;
+    };
+}  // namespace regimeflow::data
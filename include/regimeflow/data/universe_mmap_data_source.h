@@ -0,0 +1,145 @@
+/**
+ * @file universe_mmap_data_source.h
+ * @brief RegimeFlow regimeflow universe mmap data source declarations.
+ */
+
+#pragma once
+
+#include "regimeflow/data/corporate_actions.h"
+#include "regimeflow/data/data_source.h"
+#include "regimeflow/data/universe_mmap.h"
+
+#include <memory>
+#include <span>
+#include <string>
+
+namespace regimeflow::data
+{
+    /**
+     * @brief Zero-copy iterator over one symbol of a universe file.
+     *
+     * @details Visits the day partitions overlapping the range and walks the
+     * symbol's slice in each. Corporate actions are applied on the fly.
+     */
+    class UniverseBarIterator final : public DataIterator {
+    public:
+        /**
+         * @brief Construct over one symbol of a mapped universe.
+         * @param file Mapped universe.
+         * @param symbol_index Directory index of the symbol.
+         * @param range Time range to iterate.
+         * @param actions Corporate actions for the symbol.
+         */
+        UniverseBarIterator(std::shared_ptr<const UniverseMmapFile> file,
+                            uint32_t symbol_index,
+                            TimeRange range,
+                            std::vector<CorporateAction> actions = {});
+
+        /**
+         * @brief True if more bars exist.
+         */
+        [[nodiscard]] bool has_next() const override;
+        /**
+         * @brief Get next bar.
+         */
+        Bar next() override;
+        /**
+         * @brief Fill a buffer from the current and following partitions.
+         */
+        size_t next_batch(std::span<Bar> out) override;
+        /**
+         * @brief Reset iterator to the start of the range.
+         */
+        void reset() override;
+
+    private:
+        void seek_partition();
+        [[nodiscard]] Bar read(size_t index) const;
+
+        std::shared_ptr<const UniverseMmapFile> file_;
+        uint32_t symbol_index_ = 0;
+        SymbolId symbol_ = 0;
+        int64_t start_us_ = 0;
+        int64_t end_us_ = 0;
+        bool bounded_ = false;
+        size_t first_partition_ = 0;
+        size_t last_partition_ = 0;
+        size_t partition_ = 0;
+        UniverseMmapFile::Columns columns_;
+        size_t pos_ = 0;
+        size_t end_ = 0;
+        CorporateActionAdjuster adjuster_;
+        bool adjust_ = false;
+    };
+
+    /**
+     * @brief Data source backed by a single universe container file.
+     *
+     * @details The file is mapped once at construction and every symbol
+     * subset is served from that mapping, so a large universe costs one file
+     * descriptor and one mapping instead of one per symbol.
+     */
+    class UniverseMmapDataSource final : public DataSource {
+    public:
+        /**
+         * @brief Universe data source configuration.
+         */
+        struct Config {
+            /**
+             * @brief Path to the .rfu universe file.
+             */
+            std::string path;
+        };
+
+        /**
+         * @brief Construct and map the universe file.
+         * @param config Configuration.
+         */
+        explicit UniverseMmapDataSource(const Config& config);
+
+        /**
+         * @brief List symbols in the universe directory.
+         */
+        std::vector<SymbolInfo> get_available_symbols() const override;
+        /**
+         * @brief Get available range for a symbol.
+         */
+        TimeRange get_available_range(SymbolId symbol) const override;
+
+        /**
+         * @brief Load bars for a symbol and range.
+         */
+        std::vector<Bar> get_bars(SymbolId symbol, TimeRange range,
+                                  BarType bar_type = BarType::Time_1Day) override;
+        /**
+         * @brief Universe files hold bars only; returns empty.
+         */
+        std::vector<Tick> get_ticks(SymbolId symbol, TimeRange range) override;
+
+        /**
+         * @brief Create a merged bar iterator for a symbol subset.
+         */
+        std::unique_ptr<DataIterator> create_iterator(
+            const std::vector<SymbolId>& symbols,
+            TimeRange range,
+            BarType bar_type) override;
+
+        /**
+         * @brief Fetch corporate actions for a symbol.
+         */
+        std::vector<CorporateAction> get_corporate_actions(SymbolId symbol,
+                                                           TimeRange range) override;
+        /**
+         * @brief Inject corporate actions programmatically.
+         */
+        void set_corporate_actions(SymbolId symbol, std::vector<CorporateAction> actions);
+
+    private:
+        std::unique_ptr<DataIterator> make_symbol_iterator(SymbolId symbol, TimeRange range,
+                                                           BarType bar_type) const;
+
+        Config config_;
+        std::shared_ptr<const UniverseMmapFile> file_;
+        CorporateActionAdjuster adjuster_;
+    };
+}  // namespace regimeflow::data
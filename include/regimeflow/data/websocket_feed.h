@@ -6,6 +6,7 @@
 #pragma once
 
 #include "regimeflow/common/result.h"
+#include "regimeflow/common/symbol_table.h"
 #include "regimeflow/data/live_feed.h"
 #include "regimeflow/data/validation_config.h"
 
@@ -234,9 +235,9 @@ namespace regimeflow::data
         Timestamp next_reconnect_attempt_;
 #endif
         std::string last_reconnect_error_;
-        std::unordered_map<SymbolId, StreamState> bar_state_;
-        std::unordered_map<SymbolId, StreamState> tick_state_;
-        std::unordered_map<SymbolId, Timestamp> book_last_ts_;
+        SymbolTable<StreamState> bar_state_;
+        SymbolTable<StreamState> tick_state_;
+        SymbolTable<Timestamp> book_last_ts_;
 
 #ifdef REGIMEFLOW_USE_BOOST_BEAST
         boost::asio::io_context ioc_;
@@ -14,6 +14,7 @@
 #include "regimeflow/engine/order_book_cache.h"
 #include "regimeflow/engine/execution_pipeline.h"
 #include "regimeflow/engine/regime_tracker.h"
+#include "regimeflow/engine/stage_profiler.h"
 #include "regimeflow/engine/backtest_results.h"
 #include "regimeflow/engine/timer_service.h"
 #include "regimeflow/execution/execution_factory.h"
@@ -32,6 +33,7 @@
 #include <optional>
 #include <map>
 #include <unordered_set>
+#include <vector>
 
 namespace regimeflow::engine
 {
@@ -137,6 +139,50 @@ namespace regimeflow::engine
          * @param event Event to enqueue.
          */
         void enqueue(events::Event event);
+        /**
+         * @brief Select the event queue implementation.
+         * @details SingleThreaded uses a lock-free, time-bucketed queue suited to
+         * backtests where all producers run on the engine thread. Queued events are kept.
+         * @param mode Queue implementation.
+         */
+        void set_event_queue_mode(events::EventQueue::Mode mode);
+        /**
+         * @brief Enable per-timestamp cross-sectional bar dispatch.
+         * @details Bars sharing a timestamp are gathered into one slice. Per-bar work
+         * (market data, execution, marks, stops, regime) still runs per symbol, while
+         * expiry/timer checks run once per slice and snapshots, account checks and
+         * metrics run once when the slice closes, followed by Strategy::on_bars().
+         * @param enabled True to enable slice dispatch.
+         */
+        void set_slice_dispatch(bool enabled);
+        /**
+         * @brief Enable per-stage latency profiling of the event handlers.
+         * @details Times hooks, execution tick replay, the execution pipeline, risk
+         * validation, the regime tracker, strategy callbacks, metrics and the audit
+         * journal. Results are reported in BacktestResults::stage_profile. Off by
+         * default; when off each instrumented stage costs one branch.
+         * @param enabled True to record stage timings.
+         */
+        void set_stage_profiling(bool enabled);
+        /**
+         * @brief Access the stage profiler.
+         */
+        [[nodiscard]] const StageProfiler& stage_profiler() const { return stage_profiler_; }
+        /**
+         * @brief Configure decimation of the portfolio and metrics equity stores.
+         * @details The metrics equity curve and drawdown still see every update; only
+         * stored portfolio snapshots are sampled.
+         * @param config Sampling configuration.
+         */
+        void set_equity_sampling(EquitySamplingConfig config);
+        /**
+         * @brief Configure how loaded iterators are turned into events.
+         * @details Applies to subsequent load_data() calls. With streaming enabled the
+         * iterators are merged lazily while the event loop runs instead of being
+         * materialized into the queue up front.
+         * @param config Event generator config.
+         */
+        void set_event_generator_config(EventGenerator::Config config);
         /**
          * @brief Load a single data iterator (bars or ticks).
          * @param iterator Data iterator.
@@ -342,6 +388,10 @@ namespace regimeflow::engine
         void replay_execution_ticks(const data::Bar& bar);
         std::string current_day_stamp_;
         void install_default_handlers();
+        [[nodiscard]] bool bar_slice_closed();
+        void flush_bar_slice();
+        void attach_event_generator();
+        bool has_pending_events();
 
         events::EventQueue event_queue_;
         events::EventDispatcher dispatcher_;
@@ -354,6 +404,7 @@ namespace regimeflow::engine
         ExecutionPipeline execution_pipeline_;
         RegimeTracker regime_tracker_{nullptr};
         std::unique_ptr<EventGenerator> event_generator_;
+        EventGenerator::Config event_generator_config_;
         std::unique_ptr<strategy::Strategy> strategy_;
         strategy::StrategyManager strategy_manager_;
         std::unique_ptr<strategy::StrategyContext> strategy_context_;
@@ -362,12 +413,16 @@ namespace regimeflow::engine
         metrics::MetricsTracker metrics_;
         plugins::HookSystem hooks_;
         plugins::HookManager hook_manager_;
+        StageProfiler stage_profiler_;
         std::function<void(double, const std::string&)> progress_callback_;
         size_t progress_total_estimate_ = 0;
         bool started_ = false;
         TickSimulationMode tick_simulation_mode_ = TickSimulationMode::SyntheticTicks;
         SyntheticTickProfile synthetic_tick_profile_ = SyntheticTickProfile::BarClose;
-        std::unordered_set<SymbolId> symbols_with_real_ticks_;
+        SymbolSet symbols_with_real_ticks_;
+        bool slice_dispatch_ = false;
+        EquitySamplingConfig equity_sampling_;
+        std::vector<data::Bar> bar_slice_;
         std::optional<Config> execution_config_;
         std::optional<Config> risk_config_;
         std::optional<Config> regime_config_;
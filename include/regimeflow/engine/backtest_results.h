@@ -84,6 +84,10 @@ namespace regimeflow::engine
          * @brief Tester journal events captured during the run.
          */
         std::vector<AuditEvent> journal_events;
+        /**
+         * @brief Per-stage handler timings; empty unless stage profiling was enabled.
+         */
+        std::vector<StageStats> stage_profile;
         /**
          * @brief Dedicated tester journal rows for UI/report surfaces.
          */
@@ -107,8 +111,8 @@ namespace regimeflow::engine
          * @brief Return the latest recorded account snapshot, if any.
          */
         [[nodiscard]] std::optional<engine::PortfolioSnapshot> latest_account_snapshot() const {
-            if (const auto& snapshots = metrics.portfolio_snapshots(); !snapshots.empty()) {
-                return snapshots.back();
+            if (const auto& store = metrics.portfolio_store(); !store.empty()) {
+                return store.snapshot(store.size() - 1);
             }
             return std::nullopt;
         }
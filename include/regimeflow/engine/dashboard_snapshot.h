@@ -7,6 +7,7 @@
 
 #include "regimeflow/engine/order.h"
 #include "regimeflow/engine/portfolio.h"
+#include "regimeflow/engine/stage_profiler.h"
 #include "regimeflow/regime/types.h"
 
 #include <cstddef>
@@ -129,6 +130,7 @@ namespace regimeflow::engine
         std::vector<Fill> recent_fills;
         std::vector<DashboardVenueSummary> venue_summary;
         std::vector<std::string> alerts;
+        std::vector<StageStats> stage_profile;
         double cpu_usage_pct = 0.0;
         double memory_mb = 0.0;
         double event_loop_latency_ms = 0.0;
@@ -26,6 +26,9 @@ namespace regimeflow::engine
          * @brief Create a configured BacktestEngine.
          * @param config Root configuration.
          * @return Engine instance.
+         * @throws std::invalid_argument if `engine.event_queue`,
+         * `engine.order_manager` or `engine.equity_sampling` is not a known
+         * mode.
          */
         static std::unique_ptr<BacktestEngine> create(const Config& config);
     };
@@ -0,0 +1,171 @@
+/**
+ * @file equity_curve_store.h
+ * @brief RegimeFlow regimeflow columnar equity curve storage declarations.
+ */
+
+#pragma once
+
+#include "regimeflow/common/symbol_table.h"
+#include "regimeflow/common/time.h"
+#include "regimeflow/common/types.h"
+#include "regimeflow/engine/portfolio_snapshot.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace regimeflow::engine
+{
+    /**
+     * @brief How often the equity store keeps a row.
+     */
+    enum class EquitySampling : uint8_t {
+        EveryEvent,
+        Interval,
+        EndOfDay
+    };
+
+    /**
+     * @brief Sampling configuration for equity stores.
+     */
+    struct EquitySamplingConfig {
+        EquitySampling mode = EquitySampling::EveryEvent;
+        Duration interval = Duration::minutes(1);
+
+        /**
+         * @brief Parse a sampling mode name ("every_event", "interval", "end_of_day").
+         * @param name Mode name.
+         * @return Parsed mode.
+         * @throws std::invalid_argument if the name is not a known mode.
+         */
+        [[nodiscard]] static EquitySampling parse_mode(const std::string& name);
+    };
+
+    /**
+     * @brief Columnar, decimated store of portfolio snapshots.
+     *
+     * @details Scalar snapshot fields live in one column each. Positions are
+     * delta-encoded: each row stores only the positions that changed (or were
+     * closed) since the previous row, with periodic keyframes so any row can be
+     * rebuilt into a full PortfolioSnapshot in bounded time. With Interval or
+     * EndOfDay sampling, records falling in the same bucket overwrite the last
+     * row so it always reflects the latest state of its bucket.
+     */
+    class EquityCurveStore {
+    public:
+        /**
+         * @brief Configure sampling. Applies to subsequent records.
+         * @param config Sampling configuration.
+         */
+        void set_sampling(EquitySamplingConfig config) { sampling_ = config; }
+        /**
+         * @brief Current sampling configuration.
+         */
+        [[nodiscard]] const EquitySamplingConfig& sampling() const { return sampling_; }
+
+        /**
+         * @brief Record a sample, subject to sampling.
+         * @param fields Snapshot scalars; its positions member is ignored.
+         * @param positions Current positions.
+         */
+        void record(const PortfolioSnapshot& fields,
+                    const SymbolTable<Position>& positions);
+        /**
+         * @brief Overwrite the most recent row regardless of sampling.
+         * @param fields Snapshot scalars; its positions member is ignored.
+         * @param positions Current positions.
+         */
+        void overwrite_last(const PortfolioSnapshot& fields,
+                            const SymbolTable<Position>& positions);
+
+        /**
+         * @brief Number of stored rows.
+         */
+        [[nodiscard]] size_t size() const { return timestamps_.size(); }
+        /**
+         * @brief Check whether the store is empty.
+         */
+        [[nodiscard]] bool empty() const { return timestamps_.empty(); }
+
+        /**
+         * @brief Timestamp column.
+         */
+        [[nodiscard]] const std::vector<Timestamp>& timestamps() const { return timestamps_; }
+        /**
+         * @brief Equity column.
+         */
+        [[nodiscard]] const std::vector<double>& equities() const { return equity_; }
+        /**
+         * @brief Cash column.
+         */
+        [[nodiscard]] const std::vector<double>& cash() const { return cash_; }
+        /**
+         * @brief Gross exposure column.
+         */
+        [[nodiscard]] const std::vector<double>& gross_exposures() const { return gross_exposure_; }
+        /**
+         * @brief Net exposure column.
+         */
+        [[nodiscard]] const std::vector<double>& net_exposures() const { return net_exposure_; }
+
+        /**
+         * @brief Rebuild the full snapshot at a row.
+         * @param index Row index (< size()).
+         * @return Snapshot including positions.
+         */
+        [[nodiscard]] PortfolioSnapshot snapshot(size_t index) const;
+        /**
+         * @brief Rebuild every row in order.
+         * @return Full snapshots.
+         */
+        [[nodiscard]] std::vector<PortfolioSnapshot> snapshots() const;
+
+        /**
+         * @brief Drop all rows.
+         */
+        void clear();
+
+    private:
+        /**
+         * @brief One position change; removed marks a closed position.
+         */
+        struct PositionDelta {
+            Position position;
+            bool removed = false;
+        };
+
+        static constexpr size_t kKeyframeInterval = 256;
+
+        [[nodiscard]] int64_t bucket_of(Timestamp timestamp) const;
+        void append_row(const PortfolioSnapshot& fields,
+                        const SymbolTable<Position>& positions);
+        void set_row(size_t index, const PortfolioSnapshot& fields);
+        void encode_deltas(const SymbolTable<Position>& positions);
+        template<typename State>
+        void apply_row(size_t index, State& state) const;
+        [[nodiscard]] PortfolioSnapshot build(size_t index,
+                                              std::unordered_map<SymbolId, Position> positions) const;
+
+        EquitySamplingConfig sampling_;
+
+        std::vector<Timestamp> timestamps_;
+        std::vector<double> equity_;
+        std::vector<double> cash_;
+        std::vector<double> gross_exposure_;
+        std::vector<double> net_exposure_;
+        std::vector<double> leverage_;
+        std::vector<double> initial_margin_;
+        std::vector<double> maintenance_margin_;
+        std::vector<double> available_funds_;
+        std::vector<double> margin_excess_;
+        std::vector<double> buying_power_;
+        std::vector<uint8_t> flags_;
+
+        std::vector<PositionDelta> deltas_;
+        std::vector<size_t> delta_offsets_;
+        std::vector<std::vector<Position>> keyframes_;
+        SymbolTable<Position> base_;
+        int64_t last_bucket_ = 0;
+    };
+}  // namespace regimeflow::engine
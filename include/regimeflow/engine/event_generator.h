@@ -10,6 +10,9 @@
 #include "regimeflow/events/event_queue.h"
 
 #include <memory>
+#include <optional>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace regimeflow::engine
@@ -39,6 +42,14 @@ namespace regimeflow::engine
              * @brief Interval between regime checks.
              */
             Duration regime_check_interval = Duration::minutes(5);
+            /**
+             * @brief Merge iterator heads lazily instead of materializing all events.
+             */
+            bool streaming = false;
+            /**
+             * @brief Minimum number of events enqueued per refill in streaming mode.
+             */
+            size_t stream_lookahead = 1024;
         };
 
         /**
@@ -87,11 +98,75 @@ namespace regimeflow::engine
          */
         void enqueue_all();
 
+        /**
+         * @brief Reset the iterators and prime the streaming merge heads.
+         */
+        void start_streaming();
+        /**
+         * @brief True while the streaming merge still has events to enqueue.
+         */
+        [[nodiscard]] bool has_pending() const;
+        /**
+         * @brief Enqueue streamed events so every event due before the queue head is queued.
+         *
+         * @details Does nothing while the queue head precedes the next streamed
+         * timestamp; otherwise enqueues whole timestamp groups until at least
+         * Config::stream_lookahead events have been pushed.
+         * @return Number of events pushed.
+         */
+        size_t feed();
+        /**
+         * @brief Access the generator configuration.
+         */
+        [[nodiscard]] const Config& config() const { return config_; }
+
     private:
+        /**
+         * @brief Read-ahead buffer filled through next_batch().
+         */
+        template <typename T>
+        struct Prefetch {
+            std::vector<T> buffer;
+            size_t pos = 0;
+            size_t size = 0;
+
+            void clear(const size_t capacity) {
+                buffer.resize(capacity);
+                pos = 0;
+                size = 0;
+            }
+
+            template <typename Iterator>
+            std::optional<T> pull(Iterator& iterator) {
+                if (pos >= size) {
+                    pos = 0;
+                    size = iterator.next_batch(buffer);
+                    if (size == 0) {
+                        return std::nullopt;
+                    }
+                }
+                return std::move(buffer[pos++]);
+            }
+        };
+
+        [[nodiscard]] Timestamp next_data_timestamp() const;
+        [[nodiscard]] Timestamp next_emit_timestamp() const;
+        size_t emit_next_group();
+
         std::unique_ptr<data::DataIterator> bar_iterator_;
         std::unique_ptr<data::TickIterator> tick_iterator_;
         std::unique_ptr<data::OrderBookIterator> book_iterator_;
         events::EventQueue* queue_ = nullptr;
         Config config_{};
+        std::optional<data::Bar> next_bar_;
+        std::optional<data::Tick> next_tick_;
+        std::optional<data::OrderBook> next_book_;
+        Prefetch<data::Bar> bar_prefetch_;
+        Prefetch<data::Tick> tick_prefetch_;
+        Prefetch<data::OrderBook> book_prefetch_;
+        bool streaming_started_ = false;
+        bool first_day_ = true;
+        std::string current_day_;
+        Timestamp next_regime_check_;
     };
 }  // namespace regimeflow::engine
@@ -27,6 +27,10 @@ namespace regimeflow::engine
          * @brief Progress callback for reporting processing counts.
          */
         using ProgressCallback = std::function<void(size_t processed, size_t remaining)>;
+        /**
+         * @brief Callback invoked before the queue head is inspected, used to stream data in.
+         */
+        using RefillCallback = std::function<void()>;
 
         /**
          * @brief Construct an event loop bound to a queue.
@@ -54,6 +58,11 @@ namespace regimeflow::engine
          * @param callback Progress callback.
          */
         void set_progress_callback(ProgressCallback callback);
+        /**
+         * @brief Register a callback that tops up the queue before each pop.
+         * @param callback Refill callback (empty to disable).
+         */
+        void set_refill_callback(RefillCallback callback);
 
         /**
          * @brief Run until the queue is exhausted or stop() is called.
@@ -86,6 +95,7 @@ namespace regimeflow::engine
         std::vector<Hook> pre_hooks_;
         std::vector<Hook> post_hooks_;
         ProgressCallback progress_callback_;
+        RefillCallback refill_callback_;
         Timestamp current_time_;
         bool running_ = false;
         size_t processed_ = 0;
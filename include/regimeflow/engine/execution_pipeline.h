@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "regimeflow/common/symbol_table.h"
 #include "regimeflow/execution/execution_model.h"
 #include "regimeflow/execution/basic_execution_model.h"
 #include "regimeflow/execution/order_book_execution_model.h"
@@ -19,9 +20,12 @@
 #include "regimeflow/events/event_queue.h"
 
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
+#include <vector>
 
 namespace regimeflow::engine
 {
@@ -77,11 +81,11 @@ namespace regimeflow::engine
             int open_auction_minutes = 1;
             int close_auction_minutes = 1;
             bool halt_all = false;
-            std::unordered_set<SymbolId> halted_symbols;
+            SymbolSet halted_symbols;
             std::unordered_set<int> allowed_weekdays;
             std::unordered_set<std::string> closed_dates;
             bool dynamic_halt_all = false;
-            std::unordered_set<SymbolId> dynamic_halted_symbols;
+            SymbolSet dynamic_halted_symbols;
         };
 
         /**
@@ -202,6 +206,64 @@ namespace regimeflow::engine
                                                                  bool is_maker = false) const;
 
     private:
+        /**
+         * @brief Price ladder a resting order is indexed under.
+         */
+        enum class TriggerSide : uint8_t {
+            Always,
+            BuyLimit,
+            SellLimit,
+            BuyStop,
+            SellStop
+        };
+        /**
+         * @brief Where a resting order sits in its symbol's trigger ladder.
+         */
+        struct LadderSlot {
+            TriggerSide side = TriggerSide::Always;
+            Price price = 0.0;
+
+            bool operator==(const LadderSlot&) const = default;
+        };
+        /**
+         * @brief Per-symbol resting orders keyed by the price that could activate them.
+         *
+         * @details Buy limits fill at or below their limit, sell limits at or above;
+         * buy stops trigger at or above their stop, sell stops at or below. Orders
+         * whose activity does not depend only on the side price (market-like,
+         * queue-modelled, venue-adjusted) sit in always and are evaluated on every
+         * update for the symbol.
+         */
+        struct TriggerLadder {
+            std::set<std::pair<Price, OrderId>> buy_limits;
+            std::set<std::pair<Price, OrderId>> sell_limits;
+            std::set<std::pair<Price, OrderId>> buy_stops;
+            std::set<std::pair<Price, OrderId>> sell_stops;
+            std::set<OrderId> always;
+
+            [[nodiscard]] bool empty() const {
+                return buy_limits.empty() && sell_limits.empty() && buy_stops.empty()
+                    && sell_stops.empty() && always.empty();
+            }
+            void insert(const LadderSlot& slot, const OrderId id) {
+                switch (slot.side) {
+                case TriggerSide::Always: always.insert(id); break;
+                case TriggerSide::BuyLimit: buy_limits.emplace(slot.price, id); break;
+                case TriggerSide::SellLimit: sell_limits.emplace(slot.price, id); break;
+                case TriggerSide::BuyStop: buy_stops.emplace(slot.price, id); break;
+                case TriggerSide::SellStop: sell_stops.emplace(slot.price, id); break;
+                }
+            }
+            void erase(const LadderSlot& slot, const OrderId id) {
+                switch (slot.side) {
+                case TriggerSide::Always: always.erase(id); break;
+                case TriggerSide::BuyLimit: buy_limits.erase({slot.price, id}); break;
+                case TriggerSide::SellLimit: sell_limits.erase({slot.price, id}); break;
+                case TriggerSide::BuyStop: buy_stops.erase({slot.price, id}); break;
+                case TriggerSide::SellStop: sell_stops.erase({slot.price, id}); break;
+                }
+            }
+        };
         struct RestingOrderState {
             Order order;
             TimeInForce effective_tif = TimeInForce::GTC;
@@ -213,6 +275,7 @@ namespace regimeflow::engine
             bool queue_initialized = false;
             Quantity queue_ahead = 0.0;
             Quantity last_visible_queue = 0.0;
+            LadderSlot ladder;
         };
         struct EvaluationContext {
             Price executable_price_override;
@@ -258,6 +321,11 @@ namespace regimeflow::engine
                                    EvaluationContext context = EvaluationContext());
         [[nodiscard]] Price reference_price(const Order& order,
                                             EvaluationContext context = EvaluationContext()) const;
+        void store_resting(const RestingOrderState& state);
+        void erase_resting(OrderId id);
+        [[nodiscard]] LadderSlot ladder_slot_for(const RestingOrderState& state) const;
+        [[nodiscard]] std::vector<OrderId> trigger_candidates(SymbolId symbol,
+                                                              EvaluationContext context = EvaluationContext()) const;
 
         MarketDataCache* market_data_ = nullptr;
         OrderBookCache* order_books_ = nullptr;
@@ -279,5 +347,6 @@ namespace regimeflow::engine
         BarSimulationMode bar_simulation_mode_ = BarSimulationMode::CloseOnly;
         SessionPolicy session_policy_;
         std::unordered_map<OrderId, RestingOrderState> resting_orders_;
+        SymbolTable<TriggerLadder> ladders_;
     };
 }  // namespace regimeflow::engine
@@ -5,17 +5,86 @@
 
 #pragma once
 
+#include "regimeflow/common/symbol_table.h"
 #include "regimeflow/data/bar.h"
 #include "regimeflow/data/tick.h"
 
+#include <algorithm>
 #include <optional>
-#include <unordered_map>
+#include <span>
 #include <vector>
 
 namespace regimeflow::engine
 {
+    /**
+     * @brief Read-only view over the most recent entries of a history ring.
+     *
+     * @details A ring that has wrapped exposes its tail as two contiguous spans;
+     * first holds the older entries and second the newer ones. Element 0 is the
+     * oldest entry in the view. The view borrows cache storage and is invalidated
+     * by the next update for the same symbol or by a history depth change.
+     */
+    template<typename T>
+    struct HistoryView {
+        std::span<const T> first;
+        std::span<const T> second;
+
+        /**
+         * @brief Number of entries in the view.
+         */
+        [[nodiscard]] size_t size() const { return first.size() + second.size(); }
+        /**
+         * @brief Check whether the view is empty.
+         */
+        [[nodiscard]] bool empty() const { return size() == 0; }
+        /**
+         * @brief Entry by position, oldest first.
+         * @param index Position (< size()).
+         */
+        const T& operator[](const size_t index) const {
+            return index < first.size() ? first[index] : second[index - first.size()];
+        }
+        /**
+         * @brief Oldest entry in the view.
+         */
+        [[nodiscard]] const T& front() const { return (*this)[0]; }
+        /**
+         * @brief Newest entry in the view.
+         */
+        [[nodiscard]] const T& back() const { return second.empty() ? first.back() : second.back(); }
+
+        /**
+         * @brief Invoke fn(entry) for each entry, oldest first.
+         * @param fn Callback.
+         */
+        template<typename Fn>
+        void for_each(Fn&& fn) const {
+            for (const auto& value : first) {
+                fn(value);
+            }
+            for (const auto& value : second) {
+                fn(value);
+            }
+        }
+
+        /**
+         * @brief Copy the view into a vector, oldest first.
+         */
+        [[nodiscard]] std::vector<T> to_vector() const {
+            std::vector<T> out;
+            out.reserve(size());
+            out.insert(out.end(), first.begin(), first.end());
+            out.insert(out.end(), second.begin(), second.end());
+            return out;
+        }
+    };
+
     /**
      * @brief In-memory cache of latest market data and short history.
+     *
+     * @details Bar history is a fixed-capacity ring per symbol that grows lazily
+     * up to the configured depth and then overwrites its oldest entry, with close
+     * and volume kept as parallel columns for allocation-free indicator views.
      */
     class MarketDataCache {
     public:
@@ -61,12 +130,69 @@ namespace regimeflow::engine
          * @return Vector of most recent bars (up to count).
          */
         std::vector<data::Bar> recent_bars(SymbolId symbol, size_t count) const;
+        /**
+         * @brief Zero-copy view of recent bars for a symbol.
+         * @param symbol Symbol ID.
+         * @param count Number of bars to view.
+         * @return View of the most recent bars (up to count), oldest first.
+         */
+        HistoryView<data::Bar> bar_history(SymbolId symbol, size_t count) const;
+        /**
+         * @brief Zero-copy view of recent close prices for a symbol.
+         * @param symbol Symbol ID.
+         * @param count Number of closes to view.
+         * @return View of the most recent closes (up to count), oldest first.
+         */
+        HistoryView<Price> close_history(SymbolId symbol, size_t count) const;
+        /**
+         * @brief Zero-copy view of recent bar volumes for a symbol.
+         * @param symbol Symbol ID.
+         * @param count Number of volumes to view.
+         * @return View of the most recent volumes (up to count), oldest first.
+         */
+        HistoryView<Volume> volume_history(SymbolId symbol, size_t count) const;
+
+        /**
+         * @brief Set the per-symbol bar history depth.
+         * @details Existing histories keep their most recent bars up to the new depth.
+         * @param depth Maximum bars retained per symbol (at least 1).
+         */
+        void set_history_depth(size_t depth);
+        /**
+         * @brief Per-symbol bar history depth.
+         */
+        [[nodiscard]] size_t history_depth() const { return history_depth_; }
 
     private:
-        std::unordered_map<SymbolId, data::Bar> latest_bars_;
-        std::unordered_map<SymbolId, data::Tick> latest_ticks_;
-        std::unordered_map<SymbolId, data::Quote> latest_quotes_;
-        std::unordered_map<SymbolId, std::vector<data::Bar>> bar_history_;
-        size_t max_history_ = 1024;
+        /**
+         * @brief Per-symbol bar ring with parallel close/volume columns.
+         */
+        struct BarRing {
+            std::vector<data::Bar> bars;
+            std::vector<Price> closes;
+            std::vector<Volume> volumes;
+            size_t head = 0;
+        };
+
+        template<typename T>
+        static HistoryView<T> tail(const std::vector<T>& column, const size_t head, size_t count) {
+            const size_t size = column.size();
+            count = std::min(count, size);
+            if (count == 0) {
+                return {};
+            }
+            const size_t start = (head + size - count) % size;
+            const size_t first = std::min(count, size - start);
+            return {std::span<const T>(column.data() + start, first),
+                    std::span<const T>(column.data(), count - first)};
+        }
+
+        static void resize_ring(BarRing& ring, size_t depth);
+
+        SymbolTable<data::Bar> latest_bars_;
+        SymbolTable<data::Tick> latest_ticks_;
+        SymbolTable<data::Quote> latest_quotes_;
+        SymbolTable<BarRing> bar_history_;
+        size_t history_depth_ = 1024;
     };
 }  // namespace regimeflow::engine
@@ -0,0 +1,143 @@
+/**
+ * @file order_archive.h
+ * @brief RegimeFlow regimeflow append-only terminal order archive declarations.
+ */
+
+#pragma once
+
+#include "regimeflow/common/types.h"
+#include "regimeflow/engine/order.h"
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace regimeflow::engine
+{
+    /**
+     * @brief Compact, append-only store of terminal orders and their fills.
+     *
+     * @details Orders are flattened into fixed-size records: strategy ids are
+     * interned, metadata is pooled into one shared key/value vector, and each
+     * order's fills sit contiguously in a single fill vector. Records are never
+     * rewritten; take() retires a record so the order can be revived by the
+     * caller, and a later append() for the same id supersedes it. Once retired
+     * records outnumber live ones (and pass a small floor), the pools are
+     * compacted, so memory and the collect_* scans track the live orders.
+     * Compaction invalidates spans returned by fills(). Not thread-safe; the
+     * owning OrderManager serializes access.
+     */
+    class OrderArchive {
+    public:
+        /**
+         * @brief Append a terminal order and its fills.
+         * @param order Order snapshot.
+         * @param fills Fills for the order.
+         */
+        void append(const Order& order, std::span<const Fill> fills);
+
+        /**
+         * @brief Check whether an order is archived.
+         * @param id Order ID.
+         */
+        [[nodiscard]] bool contains(OrderId id) const { return index_.contains(id); }
+        /**
+         * @brief Rebuild an archived order.
+         * @param id Order ID.
+         * @return Order, or nullopt if not archived.
+         */
+        [[nodiscard]] std::optional<Order> find(OrderId id) const;
+        /**
+         * @brief Fills of an archived order.
+         * @param id Order ID.
+         * @return Fill span, empty if not archived.
+         */
+        [[nodiscard]] std::span<const Fill> fills(OrderId id) const;
+        /**
+         * @brief Retire an archived order and hand it back.
+         * @param id Order ID.
+         * @param fills Receives the order's fills.
+         * @return Order, or nullopt if not archived.
+         */
+        std::optional<Order> take(OrderId id, std::vector<Fill>& fills);
+
+        /**
+         * @brief Append every archived order placed by a strategy.
+         * @param strategy_id Strategy identifier.
+         * @param out Destination.
+         */
+        void collect_by_strategy(const std::string& strategy_id, std::vector<Order>& out) const;
+        /**
+         * @brief Append archived fills for a symbol within a time range.
+         * @param symbol Symbol ID.
+         * @param range Time range filter.
+         * @param out Destination.
+         */
+        void collect_fills(SymbolId symbol, TimeRange range, std::vector<Fill>& out) const;
+
+        /**
+         * @brief Number of archived orders.
+         */
+        [[nodiscard]] size_t size() const { return index_.size(); }
+        /**
+         * @brief Number of stored records, including retired ones not yet compacted.
+         */
+        [[nodiscard]] size_t record_count() const { return records_.size(); }
+        /**
+         * @brief Number of archived fills.
+         */
+        [[nodiscard]] size_t fill_count() const { return fill_count_; }
+        /**
+         * @brief Drop all records.
+         */
+        void clear();
+
+    private:
+        /**
+         * @brief Flat order record; strings live in side pools.
+         */
+        struct Record {
+            OrderId id = 0;
+            OrderId parent_id = 0;
+            SymbolId symbol = 0;
+            uint32_t strategy = 0;
+            Quantity quantity = 0;
+            Quantity filled_quantity = 0;
+            Price limit_price = 0;
+            Price stop_price = 0;
+            Price avg_fill_price = 0;
+            Timestamp created_at;
+            Timestamp updated_at;
+            Timestamp expire_at;
+            uint32_t metadata_begin = 0;
+            uint32_t metadata_count = 0;
+            uint64_t fill_begin = 0;
+            uint32_t fill_count = 0;
+            OrderSide side = OrderSide::Buy;
+            OrderType type = OrderType::Market;
+            TimeInForce tif = TimeInForce::Day;
+            OrderStatus status = OrderStatus::Created;
+            bool has_expire = false;
+            bool is_parent = false;
+            bool live = true;
+        };
+
+        [[nodiscard]] Order materialize(const Record& record) const;
+        uint32_t intern_strategy(const std::string& strategy_id);
+        void retire(Record& record);
+        void compact();
+
+        std::vector<Record> records_;
+        std::unordered_map<OrderId, size_t> index_;
+        std::vector<Fill> fills_;
+        std::vector<std::pair<std::string, std::string>> metadata_;
+        std::vector<std::string> strategies_{std::string()};
+        std::unordered_map<std::string, uint32_t> strategy_ids_;
+        size_t fill_count_ = 0;
+        size_t retired_ = 0;
+    };
+}  // namespace regimeflow::engine
@@ -5,10 +5,10 @@
 
 #pragma once
 
+#include "regimeflow/common/symbol_table.h"
 #include "regimeflow/data/order_book.h"
 
 #include <optional>
-#include <unordered_map>
 
 namespace regimeflow::engine
 {
@@ -30,6 +30,6 @@ namespace regimeflow::engine
         std::optional<data::OrderBook> latest(SymbolId symbol) const;
 
     private:
-        std::unordered_map<SymbolId, data::OrderBook> books_;
+        SymbolTable<data::OrderBook> books_;
     };
 }  // namespace regimeflow::engine
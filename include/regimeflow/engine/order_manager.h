@@ -6,13 +6,17 @@
 #pragma once
 
 #include "regimeflow/common/result.h"
+#include "regimeflow/common/symbol_table.h"
 #include "regimeflow/common/types.h"
 #include "regimeflow/engine/order.h"
+#include "regimeflow/engine/order_archive.h"
 #include "regimeflow/engine/order_routing.h"
 
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <optional>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -47,11 +51,47 @@ namespace regimeflow::engine
 
     /**
      * @brief Tracks orders, status changes, and fills.
+     *
+     * @details Open orders form a hot set indexed by symbol and strategy. Once an
+     * order reaches a terminal status it moves, with its fills, into an
+     * append-only OrderArchive, so per-event work does not grow with the number
+     * of orders ever submitted. Terminal orders remain queryable by id, strategy
+     * and fill range.
      */
     class OrderManager {
     public:
         using RoutingContextProvider = std::function<RoutingContext(const Order&)>;
 
+        /**
+         * @brief Synchronization mode.
+         */
+        enum class Mode : uint8_t {
+            /**
+             * @brief Every call takes the internal mutex.
+             */
+            Concurrent,
+            /**
+             * @brief No locking; all calls must come from one thread.
+             */
+            SingleThreaded
+        };
+
+        /**
+         * @brief Construct an order manager.
+         * @param mode Synchronization mode.
+         */
+        explicit OrderManager(Mode mode = Mode::Concurrent);
+
+        /**
+         * @brief Change the synchronization mode. Call before concurrent use begins.
+         * @param mode Synchronization mode.
+         */
+        void set_mode(Mode mode) { mode_ = mode; }
+        /**
+         * @brief Current synchronization mode.
+         */
+        [[nodiscard]] Mode mode() const { return mode_; }
+
         /**
          * @brief Submit a new order.
          * @param order Order to submit.
@@ -96,6 +136,14 @@ namespace regimeflow::engine
          */
         std::vector<Order> get_orders_by_strategy(const std::string& strategy_id) const;
 
+        /**
+         * @brief Number of open (hot) orders.
+         */
+        [[nodiscard]] size_t open_order_count() const;
+        /**
+         * @brief Number of terminal orders moved to the archive.
+         */
+        [[nodiscard]] size_t archived_order_count() const;
         /**
          * @brief Get fills for a specific order.
          * @param id OrderId.
@@ -206,12 +254,37 @@ namespace regimeflow::engine
         Result<void> validate_order(const Order& order) const;
         bool is_open_status(OrderStatus status) const;
 
+        template<typename Fn>
+        using CallbackList = std::shared_ptr<const std::vector<Fn>>;
+        using OrderCallbacks = CallbackList<std::function<void(const Order&)>>;
+        using FillCallbacks = CallbackList<std::function<void(const Fill&)>>;
+        using PreSubmitCallbacks = CallbackList<std::function<Result<void>(Order&)>>;
+
+        template<typename Fn>
+        static void add_callback(CallbackList<Fn>& list, Fn callback) {
+            auto next = std::make_shared<std::vector<Fn>>(*list);
+            next->push_back(std::move(callback));
+            list = std::move(next);
+        }
+
+        [[nodiscard]] std::unique_lock<std::mutex> acquire() const;
+        [[nodiscard]] std::optional<Order> lookup(OrderId id) const;
+        Order* revive(OrderId id);
+        void insert_open(const Order& order);
+        void retire_if_terminal(OrderId id);
+        void index_open(const Order& order);
+        void unindex_open(const Order& order);
+
+        Mode mode_ = Mode::Concurrent;
         mutable std::mutex mutex_;
         std::unordered_map<OrderId, Order> orders_;
         std::unordered_map<OrderId, std::vector<Fill>> fills_;
-        std::vector<std::function<void(const Order&)>> order_callbacks_;
-        std::vector<std::function<void(const Fill&)>> fill_callbacks_;
-        std::vector<std::function<Result<void>(Order&)>> pre_submit_callbacks_;
+        SymbolTable<std::vector<OrderId>> open_by_symbol_;
+        std::unordered_map<std::string, std::vector<OrderId>> open_by_strategy_;
+        OrderArchive archive_;
+        OrderCallbacks order_callbacks_;
+        FillCallbacks fill_callbacks_;
+        PreSubmitCallbacks pre_submit_callbacks_;
 
         std::unique_ptr<OrderRouter> router_;
         RoutingContextProvider routing_context_provider_;
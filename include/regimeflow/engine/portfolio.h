@@ -6,8 +6,11 @@
 #pragma once
 
 #include "regimeflow/common/config.h"
+#include "regimeflow/common/symbol_table.h"
 #include "regimeflow/common/types.h"
+#include "regimeflow/engine/equity_curve_store.h"
 #include "regimeflow/engine/order.h"
+#include "regimeflow/engine/portfolio_snapshot.h"
 
 #include <functional>
 #include <optional>
@@ -57,55 +60,6 @@ namespace regimeflow::engine
         bool stop_out = false;
     };
 
-    /**
-     * @brief Position state for a single symbol.
-     */
-    struct Position {
-        SymbolId symbol = 0;
-        Quantity quantity = 0;
-        Price avg_cost = 0;
-        Price current_price = 0;
-        Timestamp last_update;
-
-        /**
-         * @brief Current market value of the position.
-         * @return Quantity * current_price.
-         */
-        [[nodiscard]] double market_value() const { return quantity * current_price; }
-        /**
-         * @brief Unrealized PnL in currency units.
-         * @return (current_price - avg_cost) * quantity.
-         */
-        [[nodiscard]] double unrealized_pnl() const { return quantity * (current_price - avg_cost); }
-        /**
-         * @brief Unrealized PnL as a fraction of avg cost.
-         * @return (current_price - avg_cost) / avg_cost or 0 if avg_cost is zero.
-         */
-        [[nodiscard]] double unrealized_pnl_pct() const {
-            return avg_cost != 0 ? (current_price - avg_cost) / avg_cost : 0;
-        }
-    };
-
-    /**
-     * @brief Portfolio state snapshot at a point in time.
-     */
-    struct PortfolioSnapshot {
-        Timestamp timestamp;
-        double cash = 0;
-        double equity = 0;
-        double gross_exposure = 0;
-        double net_exposure = 0;
-        double leverage = 0;
-        double initial_margin = 0;
-        double maintenance_margin = 0;
-        double available_funds = 0;
-        double margin_excess = 0;
-        double buying_power = 0;
-        bool margin_call = false;
-        bool stop_out = false;
-        std::unordered_map<SymbolId, Position> positions;
-    };
-
     /**
      * @brief Tracks positions, cash, and portfolio metrics.
      */
@@ -249,7 +203,22 @@ namespace regimeflow::engine
          * @brief Equity curve history.
          * @return Vector of snapshots.
          */
-        std::vector<PortfolioSnapshot> equity_curve() const { return snapshots_; }
+        std::vector<PortfolioSnapshot> equity_curve() const { return equity_store_.snapshots(); }
+        /**
+         * @brief Columnar equity store backing equity_curve().
+         */
+        [[nodiscard]] const EquityCurveStore& equity_store() const { return equity_store_; }
+        /**
+         * @brief Configure how often record_snapshot() keeps a row.
+         * @param config Sampling configuration.
+         */
+        void set_equity_sampling(EquitySamplingConfig config) { equity_store_.set_sampling(config); }
+        /**
+         * @brief Record the current state into an external equity store.
+         * @param store Destination store (sampling is the store's own).
+         * @param timestamp Snapshot time.
+         */
+        void append_snapshot(EquityCurveStore& store, Timestamp timestamp) const;
         /**
          * @brief Record a snapshot at a timestamp.
          * @param timestamp Snapshot time.
@@ -290,16 +259,17 @@ namespace regimeflow::engine
         [[nodiscard]] MarginSnapshot build_margin_snapshot(double equity_value,
                                                           double gross_exposure_value) const;
         void apply_snapshot_fields(PortfolioSnapshot& snapshot) const;
+        void apply_snapshot_scalars(PortfolioSnapshot& snapshot) const;
         void notify_position(const Position& position) const;
-        void notify_equity(double equity_value) const;
+        void notify_equity() const;
 
         double initial_capital_ = 0;
         double cash_ = 0;
         std::string currency_;
 
-        std::unordered_map<SymbolId, Position> positions_;
+        SymbolTable<Position> positions_;
         std::vector<Fill> all_fills_;
-        std::vector<PortfolioSnapshot> snapshots_;
+        EquityCurveStore equity_store_;
 
         double realized_pnl_ = 0;
         MarginProfile margin_profile_;
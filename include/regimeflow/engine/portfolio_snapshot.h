@@ -0,0 +1,63 @@
+/**
+ * @file portfolio_snapshot.h
+ * @brief RegimeFlow regimeflow position and portfolio snapshot declarations.
+ */
+
+#pragma once
+
+#include "regimeflow/common/time.h"
+#include "regimeflow/common/types.h"
+
+#include <unordered_map>
+
+namespace regimeflow::engine
+{
+    /**
+     * @brief Position state for a single symbol.
+     */
+    struct Position {
+        SymbolId symbol = 0;
+        Quantity quantity = 0;
+        Price avg_cost = 0;
+        Price current_price = 0;
+        Timestamp last_update;
+
+        /**
+         * @brief Current market value of the position.
+         * @return Quantity * current_price.
+         */
+        [[nodiscard]] double market_value() const { return quantity * current_price; }
+        /**
+         * @brief Unrealized PnL in currency units.
+         * @return (current_price - avg_cost) * quantity.
+         */
+        [[nodiscard]] double unrealized_pnl() const { return quantity * (current_price - avg_cost); }
+        /**
+         * @brief Unrealized PnL as a fraction of avg cost.
+         * @return (current_price - avg_cost) / avg_cost or 0 if avg_cost is zero.
+         */
+        [[nodiscard]] double unrealized_pnl_pct() const {
+            return avg_cost != 0 ? (current_price - avg_cost) / avg_cost : 0;
+        }
+    };
+
+    /**
+     * @brief Portfolio state snapshot at a point in time.
+     */
+    struct PortfolioSnapshot {
+        Timestamp timestamp;
+        double cash = 0;
+        double equity = 0;
+        double gross_exposure = 0;
+        double net_exposure = 0;
+        double leverage = 0;
+        double initial_margin = 0;
+        double maintenance_margin = 0;
+        double available_funds = 0;
+        double margin_excess = 0;
+        double buying_power = 0;
+        bool margin_call = false;
+        bool stop_out = false;
+        std::unordered_map<SymbolId, Position> positions;
+    };
+}  // namespace regimeflow::engine
@@ -0,0 +1,167 @@
+/**
+ * @file stage_profiler.h
+ * @brief RegimeFlow regimeflow engine stage profiler declarations.
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace regimeflow::engine
+{
+    /**
+     * @brief Instrumented stages of the backtest event handlers.
+     */
+    enum class EngineStage : uint8_t {
+        Hooks,
+        ReplayTicks,
+        ExecutionPipeline,
+        RiskValidation,
+        RegimeTracker,
+        Strategy,
+        Metrics,
+        AuditJournal,
+        Count
+    };
+
+    /**
+     * @brief Number of log2 latency buckets per stage.
+     *
+     * @details Bucket 0 holds 0 ns samples; bucket b > 0 holds samples in
+     * [2^(b-1), 2^b) ns. The last bucket also absorbs anything longer.
+     */
+    inline constexpr size_t kStageLatencyBuckets = 40;
+
+    /**
+     * @brief Aggregated timings for one engine stage.
+     */
+    struct StageStats {
+        std::string stage;
+        uint64_t calls = 0;
+        int64_t total_ns = 0;
+        int64_t max_ns = 0;
+        std::array<uint64_t, kStageLatencyBuckets> histogram{};
+
+        /**
+         * @brief Mean self time per call in nanoseconds.
+         */
+        [[nodiscard]] double mean_ns() const {
+            return calls == 0 ? 0.0 : static_cast<double>(total_ns) / static_cast<double>(calls);
+        }
+        /**
+         * @brief Approximate latency quantile from the histogram.
+         * @param q Quantile in [0, 1].
+         * @return Upper bound of the bucket containing the quantile, capped at max_ns.
+         */
+        [[nodiscard]] int64_t percentile_ns(double q) const;
+    };
+
+    /**
+     * @brief Opt-in per-stage timer for BacktestEngine.
+     *
+     * @details Each Scope records the self time of a stage: time spent in
+     * stages nested inside it (for example risk validation triggered from a
+     * strategy callback) is charged to the inner stage only, so stage totals
+     * add up to the instrumented share of the run. When disabled a Scope is a
+     * single branch and never reads the clock. Not thread-safe; each engine
+     * owns its profiler.
+     */
+    class StageProfiler {
+    public:
+        /**
+         * @brief RAII timer for one stage invocation.
+         */
+        class Scope {
+        public:
+            Scope(StageProfiler& profiler, const EngineStage stage)
+                : profiler_(profiler.enabled_ ? &profiler : nullptr), stage_(stage) {
+                if (profiler_) {
+                    saved_nested_ns_ = profiler_->nested_ns_;
+                    profiler_->nested_ns_ = 0;
+                    start_ = std::chrono::steady_clock::now();
+                }
+            }
+            ~Scope() {
+                if (profiler_) {
+                    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        std::chrono::steady_clock::now() - start_).count();
+                    profiler_->record(stage_, elapsed - profiler_->nested_ns_);
+                    profiler_->nested_ns_ = saved_nested_ns_ + elapsed;
+                }
+            }
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            StageProfiler* profiler_;
+            EngineStage stage_;
+            int64_t saved_nested_ns_ = 0;
+            std::chrono::steady_clock::time_point start_{};
+        };
+
+        /**
+         * @brief Enable or disable recording. Accumulated stats are kept.
+         * @param enabled True to record.
+         */
+        void set_enabled(const bool enabled) { enabled_ = enabled; }
+        /**
+         * @brief Check whether recording is enabled.
+         */
+        [[nodiscard]] bool enabled() const { return enabled_; }
+
+        /**
+         * @brief Start timing a stage until the returned scope ends.
+         * @param stage Stage to charge.
+         */
+        [[nodiscard]] Scope scope(const EngineStage stage) { return {*this, stage}; }
+
+        /**
+         * @brief Record one stage sample.
+         * @param stage Stage to charge.
+         * @param nanoseconds Self time of the call.
+         */
+        void record(const EngineStage stage, int64_t nanoseconds) {
+            nanoseconds = nanoseconds < 0 ? 0 : nanoseconds;
+            auto& slot = slots_[static_cast<size_t>(stage)];
+            ++slot.calls;
+            slot.total_ns += nanoseconds;
+            slot.max_ns = nanoseconds > slot.max_ns ? nanoseconds : slot.max_ns;
+            const auto bucket = static_cast<size_t>(std::bit_width(static_cast<uint64_t>(nanoseconds)));
+            ++slot.histogram[bucket < kStageLatencyBuckets ? bucket : kStageLatencyBuckets - 1];
+        }
+
+        /**
+         * @brief Stats for every stage that recorded at least one call.
+         * @return Stage rows in EngineStage order.
+         */
+        [[nodiscard]] std::vector<StageStats> stats() const;
+        /**
+         * @brief Drop all accumulated samples.
+         */
+        void reset();
+
+        /**
+         * @brief Stable snake_case name of a stage.
+         * @param stage Stage.
+         */
+        [[nodiscard]] static const char* stage_name(EngineStage stage);
+
+    private:
+        struct Slot {
+            uint64_t calls = 0;
+            int64_t total_ns = 0;
+            int64_t max_ns = 0;
+            std::array<uint64_t, kStageLatencyBuckets> histogram{};
+        };
+
+        std::array<Slot, static_cast<size_t>(EngineStage::Count)> slots_{};
+        int64_t nested_ns_ = 0;
+        bool enabled_ = false;
+    };
+}  // namespace regimeflow::engine
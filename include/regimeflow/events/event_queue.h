@@ -6,6 +6,8 @@
 #pragma once
 
 #include "regimeflow/events/event.h"
+#include "regimeflow/events/event_store.h"
+#include "regimeflow/events/time_bucket_queue.h"
 #include "regimeflow/common/memory.h"
 
 #include <atomic>
@@ -36,14 +38,70 @@ namespace regimeflow::events
      *
      * @details Events are prioritized by timestamp, then priority, then sequence.
      * Producers push into a lock-free pending list, which is drained on pop/peek.
+     * The ordered heap holds compact EventHeaders; payloads are parked in typed
+     * slabs so sift operations only move 32-byte headers.
+     * In SingleThreaded mode the queue instead delegates to a TimeBucketQueue and
+     * takes no locks and touches no atomics.
      */
     class EventQueue {
     public:
+        /**
+         * @brief Queue implementation selector.
+         */
+        enum class Mode : uint8_t {
+            Concurrent,
+            SingleThreaded
+        };
+
+        EventQueue() = default;
+        /**
+         * @brief Construct a queue in the given mode.
+         * @param mode Queue implementation.
+         */
+        explicit EventQueue(const Mode mode) : mode_(mode) {}
+
+        /**
+         * @brief Current queue implementation.
+         */
+        [[nodiscard]] Mode mode() const { return mode_; }
+
+        /**
+         * @brief Switch implementation, carrying over queued events and sequence numbers.
+         * @details Not thread-safe; call only while no other thread uses the queue.
+         * @param mode Queue implementation.
+         */
+        void set_mode(const Mode mode) {
+            if (mode == mode_) {
+                return;
+            }
+            if (mode == Mode::SingleThreaded) {
+                std::lock_guard<std::mutex> lock(queue_mutex_);
+                drain_pending_locked();
+                while (!queue_.empty()) {
+                    buckets_.push(payloads_.take(queue_.top()));
+                    queue_.pop();
+                }
+                local_sequence_ = next_sequence_.load(std::memory_order_relaxed);
+            } else {
+                std::lock_guard<std::mutex> lock(queue_mutex_);
+                while (auto event = buckets_.pop()) {
+                    queue_.push(payloads_.store(std::move(*event)));
+                }
+                next_sequence_.store(local_sequence_, std::memory_order_relaxed);
+            }
+            mode_ = mode;
+        }
+
         /**
          * @brief Enqueue an event.
          * @param event Event to enqueue.
          */
         void push(Event event) {
+            if (mode_ == Mode::SingleThreaded) {
+                event.sequence = local_sequence_++;
+                buckets_.push(std::move(event));
+                return;
+            }
             event.sequence = next_sequence_.fetch_add(1, std::memory_order_relaxed);
             Node* node = pool_.allocate();
             new (node) Node{std::move(event), nullptr};
@@ -60,12 +118,15 @@ namespace regimeflow::events
          * @return Optional event, empty if none.
          */
         std::optional<Event> pop() {
+            if (mode_ == Mode::SingleThreaded) {
+                return buckets_.pop();
+            }
             std::lock_guard<std::mutex> lock(queue_mutex_);
             drain_pending_locked();
             if (queue_.empty()) {
                 return std::nullopt;
             }
-            Event event = queue_.top();
+            Event event = payloads_.take(queue_.top());
             queue_.pop();
             return event;
         }
@@ -75,6 +136,28 @@ namespace regimeflow::events
          * @return Optional event, empty if none.
          */
         std::optional<Event> peek() {
+            if (mode_ == Mode::SingleThreaded) {
+                return buckets_.peek();
+            }
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            drain_pending_locked();
+            if (queue_.empty()) {
+                return std::nullopt;
+            }
+            return payloads_.copy(queue_.top());
+        }
+
+        /**
+         * @brief Compact header of the next event without rebuilding its payload.
+         * @return Optional header, empty if none.
+         */
+        std::optional<EventHeader> peek_header() {
+            if (mode_ == Mode::SingleThreaded) {
+                if (const EventHeader* header = buckets_.top()) {
+                    return *header;
+                }
+                return std::nullopt;
+            }
             std::lock_guard<std::mutex> lock(queue_mutex_);
             drain_pending_locked();
             if (queue_.empty()) {
@@ -83,11 +166,30 @@ namespace regimeflow::events
             return queue_.top();
         }
 
+        /**
+         * @brief Timestamp of the next event without copying it.
+         * @return Optional timestamp, empty if none.
+         */
+        std::optional<Timestamp> next_timestamp() {
+            if (mode_ == Mode::SingleThreaded) {
+                return buckets_.next_timestamp();
+            }
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            drain_pending_locked();
+            if (queue_.empty()) {
+                return std::nullopt;
+            }
+            return queue_.top().timestamp;
+        }
+
         /**
          * @brief Check if the queue is empty.
          * @return True if empty.
          */
         bool empty() {
+            if (mode_ == Mode::SingleThreaded) {
+                return buckets_.empty();
+            }
             std::lock_guard<std::mutex> lock(queue_mutex_);
             drain_pending_locked();
             return queue_.empty();
@@ -98,6 +200,9 @@ namespace regimeflow::events
          * @return Queue size.
          */
         size_t size() {
+            if (mode_ == Mode::SingleThreaded) {
+                return buckets_.size();
+            }
             std::lock_guard<std::mutex> lock(queue_mutex_);
             drain_pending_locked();
             return queue_.size();
@@ -107,9 +212,11 @@ namespace regimeflow::events
          * @brief Clear all queued events.
          */
         void clear() {
+            buckets_.clear();
             std::lock_guard<std::mutex> lock(queue_mutex_);
             drain_pending_locked();
-            queue_ = std::priority_queue<Event, std::vector<Event>, EventComparator>();
+            queue_ = HeaderHeap();
+            payloads_.clear();
         }
 
         /**
@@ -130,17 +237,23 @@ namespace regimeflow::events
             Node* list = pending_.exchange(nullptr, std::memory_order_acq_rel);
             while (list) {
                 Node* next = list->next;
-                queue_.push(std::move(list->event));
+                queue_.push(payloads_.store(std::move(list->event)));
                 list->~Node();
                 pool_.deallocate(list);
                 list = next;
             }
         }
 
+        using HeaderHeap = std::priority_queue<EventHeader, std::vector<EventHeader>, EventHeaderComparator>;
+
         std::mutex queue_mutex_;
-        std::priority_queue<Event, std::vector<Event>, EventComparator> queue_;
+        HeaderHeap queue_;
+        EventPayloadStore payloads_;
         std::atomic<Node*> pending_{nullptr};
         std::atomic<uint64_t> next_sequence_{0};
         common::PoolAllocator<Node> pool_{1024};
+        Mode mode_ = Mode::Concurrent;
+        TimeBucketQueue buckets_;
+        uint64_t local_sequence_ = 0;
     };
 }  // namespace regimeflow::events
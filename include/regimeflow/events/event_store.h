@@ -0,0 +1,248 @@
+/**
+ * @file event_store.h
+ * @brief RegimeFlow regimeflow compact event header and payload store declarations.
+ */
+
+#pragma once
+
+#include "regimeflow/events/event.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace regimeflow::events
+{
+    /**
+     * @brief Typed slab a compact header's payload lives in.
+     */
+    enum class PayloadSlab : uint8_t {
+        None,
+        Bar,
+        Tick,
+        Quote,
+        Book,
+        Order,
+        System
+    };
+
+    /**
+     * @brief Compact, trivially copyable event header used inside queues.
+     *
+     * @details Carries the ordering key and routing fields; the payload is
+     * referenced by slab and slot in an EventPayloadStore. Queue sift operations
+     * move these 32-byte headers instead of full Event objects.
+     */
+    struct EventHeader {
+        Timestamp timestamp;
+        uint64_t sequence = 0;
+        SymbolId symbol = 0;
+        uint32_t slot = 0;
+        EventType type = EventType::Market;
+        uint8_t priority = kMarketPriority;
+        PayloadSlab slab = PayloadSlab::None;
+        MarketEventKind market_kind = MarketEventKind::Bar;
+    };
+
+    static_assert(sizeof(EventHeader) <= 32, "EventHeader should stay within 32 bytes");
+
+    /**
+     * @brief Priority comparator for headers (time, priority, sequence).
+     */
+    struct EventHeaderComparator {
+        bool operator()(const EventHeader& a, const EventHeader& b) const {
+            if (a.timestamp != b.timestamp) {
+                return a.timestamp > b.timestamp;
+            }
+            if (a.priority != b.priority) {
+                return a.priority > b.priority;
+            }
+            return a.sequence > b.sequence;
+        }
+    };
+
+    /**
+     * @brief Typed slab storage for event payloads referenced by EventHeader.
+     *
+     * @details Each payload type gets its own dense vector with a free list, so
+     * released slots are reused and a bar replay never pays for order book sized
+     * storage. Not thread-safe; the owning queue serializes access.
+     */
+    class EventPayloadStore {
+    public:
+        /**
+         * @brief Move an event's payload into the store.
+         * @param event Event to split.
+         * @return Header referencing the stored payload.
+         */
+        EventHeader store(Event&& event) {
+            EventHeader header;
+            header.timestamp = event.timestamp;
+            header.sequence = event.sequence;
+            header.symbol = event.symbol;
+            header.type = event.type;
+            header.priority = event.priority;
+            if (auto* market = std::get_if<MarketEventPayload>(&event.payload)) {
+                header.market_kind = market->kind;
+                if (auto* bar = std::get_if<data::Bar>(&market->data)) {
+                    header.slab = PayloadSlab::Bar;
+                    header.slot = bars_.put(*bar);
+                } else if (auto* tick = std::get_if<data::Tick>(&market->data)) {
+                    header.slab = PayloadSlab::Tick;
+                    header.slot = ticks_.put(*tick);
+                } else if (auto* quote = std::get_if<data::Quote>(&market->data)) {
+                    header.slab = PayloadSlab::Quote;
+                    header.slot = quotes_.put(*quote);
+                } else if (auto* book = std::get_if<data::OrderBook>(&market->data)) {
+                    header.slab = PayloadSlab::Book;
+                    header.slot = books_.put(*book);
+                }
+            } else if (auto* order = std::get_if<OrderEventPayload>(&event.payload)) {
+                header.slab = PayloadSlab::Order;
+                header.slot = orders_.put(std::move(*order));
+            } else if (auto* system = std::get_if<SystemEventPayload>(&event.payload)) {
+                header.slab = PayloadSlab::System;
+                header.slot = systems_.put(std::move(*system));
+            }
+            ++size_;
+            return header;
+        }
+
+        /**
+         * @brief Rebuild the full event and release its payload slot.
+         * @param header Header previously returned by store().
+         * @return Reconstructed event.
+         */
+        Event take(const EventHeader& header) {
+            Event event = make_shell(header);
+            switch (header.slab) {
+            case PayloadSlab::None:
+                break;
+            case PayloadSlab::Bar:
+                event.payload = MarketEventPayload{header.market_kind, bars_.take(header.slot)};
+                break;
+            case PayloadSlab::Tick:
+                event.payload = MarketEventPayload{header.market_kind, ticks_.take(header.slot)};
+                break;
+            case PayloadSlab::Quote:
+                event.payload = MarketEventPayload{header.market_kind, quotes_.take(header.slot)};
+                break;
+            case PayloadSlab::Book:
+                event.payload = MarketEventPayload{header.market_kind, books_.take(header.slot)};
+                break;
+            case PayloadSlab::Order:
+                event.payload = orders_.take(header.slot);
+                break;
+            case PayloadSlab::System:
+                event.payload = systems_.take(header.slot);
+                break;
+            }
+            --size_;
+            return event;
+        }
+
+        /**
+         * @brief Rebuild a copy of the full event, leaving the payload stored.
+         * @param header Header previously returned by store().
+         * @return Reconstructed event.
+         */
+        [[nodiscard]] Event copy(const EventHeader& header) const {
+            Event event = make_shell(header);
+            switch (header.slab) {
+            case PayloadSlab::None:
+                break;
+            case PayloadSlab::Bar:
+                event.payload = MarketEventPayload{header.market_kind, bars_.at(header.slot)};
+                break;
+            case PayloadSlab::Tick:
+                event.payload = MarketEventPayload{header.market_kind, ticks_.at(header.slot)};
+                break;
+            case PayloadSlab::Quote:
+                event.payload = MarketEventPayload{header.market_kind, quotes_.at(header.slot)};
+                break;
+            case PayloadSlab::Book:
+                event.payload = MarketEventPayload{header.market_kind, books_.at(header.slot)};
+                break;
+            case PayloadSlab::Order:
+                event.payload = orders_.at(header.slot);
+                break;
+            case PayloadSlab::System:
+                event.payload = systems_.at(header.slot);
+                break;
+            }
+            return event;
+        }
+
+        /**
+         * @brief Number of live payloads.
+         */
+        [[nodiscard]] size_t size() const { return size_; }
+
+        /**
+         * @brief Drop all payloads, keeping slab capacity for reuse.
+         */
+        void clear() {
+            bars_.clear();
+            ticks_.clear();
+            quotes_.clear();
+            books_.clear();
+            orders_.clear();
+            systems_.clear();
+            size_ = 0;
+        }
+
+    private:
+        /**
+         * @brief Dense vector of payloads with a LIFO free list.
+         */
+        template<typename T>
+        class Slab {
+        public:
+            uint32_t put(T value) {
+                if (!free_.empty()) {
+                    const uint32_t slot = free_.back();
+                    free_.pop_back();
+                    items_[slot] = std::move(value);
+                    return slot;
+                }
+                items_.emplace_back(std::move(value));
+                return static_cast<uint32_t>(items_.size() - 1);
+            }
+
+            T take(const uint32_t slot) {
+                T value = std::move(items_[slot]);
+                free_.push_back(slot);
+                return value;
+            }
+
+            [[nodiscard]] const T& at(const uint32_t slot) const { return items_[slot]; }
+
+            void clear() {
+                items_.clear();
+                free_.clear();
+            }
+
+        private:
+            std::vector<T> items_;
+            std::vector<uint32_t> free_;
+        };
+
+        static Event make_shell(const EventHeader& header) {
+            Event event;
+            event.timestamp = header.timestamp;
+            event.type = header.type;
+            event.priority = header.priority;
+            event.sequence = header.sequence;
+            event.symbol = header.symbol;
+            return event;
+        }
+
+        Slab<data::Bar> bars_;
+        Slab<data::Tick> ticks_;
+        Slab<data::Quote> quotes_;
+        Slab<data::OrderBook> books_;
+        Slab<OrderEventPayload> orders_;
+        Slab<SystemEventPayload> systems_;
+        size_t size_ = 0;
+    };
+}  // namespace regimeflow::events
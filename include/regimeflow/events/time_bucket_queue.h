@@ -0,0 +1,217 @@
+/**
+ * @file time_bucket_queue.h
+ * @brief RegimeFlow regimeflow time-bucketed event queue declarations.
+ */
+
+#pragma once
+
+#include "regimeflow/events/event_store.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace regimeflow::events
+{
+    /**
+     * @brief Single-threaded event queue bucketed by timestamp microseconds.
+     *
+     * @details Events sharing a timestamp live in one bucket holding a FIFO lane
+     * per priority, so ordering is (timestamp, priority, insertion order). Only
+     * distinct timestamps are kept in a heap; pushes and pops within a bucket are
+     * O(1). Lanes hold compact EventHeaders with payloads in an owned
+     * EventPayloadStore. No locking or atomics are used, so the queue must be
+     * owned by a single thread. Callers assign Event::sequence before pushing.
+     */
+    class TimeBucketQueue {
+    public:
+        /**
+         * @brief Enqueue an event.
+         * @param event Event to enqueue.
+         */
+        void push(Event event) {
+            const int64_t ts = event.timestamp.microseconds();
+            const uint8_t priority = event.priority;
+            Bucket& bucket = buckets_[bucket_for(ts)];
+            lane_for(bucket, priority).events.push_back(payloads_.store(std::move(event)));
+            ++bucket.count;
+            ++size_;
+        }
+
+        /**
+         * @brief Pop the next event in (timestamp, priority, FIFO) order.
+         * @return Optional event, empty if none.
+         */
+        std::optional<Event> pop() {
+            if (size_ == 0) {
+                return std::nullopt;
+            }
+            const uint32_t id = times_.front().second;
+            Bucket& bucket = buckets_[id];
+            Lane& lane = front_lane(bucket);
+            Event event = payloads_.take(lane.events[lane.head]);
+            if (++lane.head == lane.events.size()) {
+                lane.events.clear();
+                lane.head = 0;
+            }
+            --size_;
+            if (--bucket.count == 0) {
+                release_front();
+            }
+            return event;
+        }
+
+        /**
+         * @brief Copy the next event without removing it.
+         * @return Optional event, empty if none.
+         */
+        [[nodiscard]] std::optional<Event> peek() const {
+            if (const EventHeader* header = top()) {
+                return payloads_.copy(*header);
+            }
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Access the next event header without removing it.
+         * @return Pointer to the next header, or nullptr if empty.
+         */
+        [[nodiscard]] const EventHeader* top() const {
+            if (size_ == 0) {
+                return nullptr;
+            }
+            const Bucket& bucket = buckets_[times_.front().second];
+            for (const auto& lane : bucket.lanes) {
+                if (lane.head < lane.events.size()) {
+                    return &lane.events[lane.head];
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Timestamp of the next event.
+         * @return Optional timestamp, empty if none.
+         */
+        [[nodiscard]] std::optional<Timestamp> next_timestamp() const {
+            if (size_ == 0) {
+                return std::nullopt;
+            }
+            return Timestamp(times_.front().first);
+        }
+
+        /**
+         * @brief Check if the queue is empty.
+         */
+        [[nodiscard]] bool empty() const { return size_ == 0; }
+        /**
+         * @brief Number of queued events.
+         */
+        [[nodiscard]] size_t size() const { return size_; }
+
+        /**
+         * @brief Drop all queued events, keeping bucket storage for reuse.
+         */
+        void clear() {
+            while (!times_.empty()) {
+                Bucket& bucket = buckets_[times_.front().second];
+                for (auto& lane : bucket.lanes) {
+                    lane.events.clear();
+                    lane.head = 0;
+                }
+                bucket.count = 0;
+                release_front();
+            }
+            payloads_.clear();
+            size_ = 0;
+        }
+
+    private:
+        static constexpr uint32_t kNoBucket = std::numeric_limits<uint32_t>::max();
+
+        /**
+         * @brief FIFO of events sharing a timestamp and priority.
+         */
+        struct Lane {
+            uint8_t priority = 0;
+            std::vector<EventHeader> events;
+            size_t head = 0;
+        };
+
+        /**
+         * @brief All events for one timestamp, lanes sorted by priority.
+         */
+        struct Bucket {
+            int64_t timestamp = 0;
+            size_t count = 0;
+            std::vector<Lane> lanes;
+        };
+
+        using HeapEntry = std::pair<int64_t, uint32_t>;
+
+        uint32_t bucket_for(const int64_t ts) {
+            if (last_bucket_ != kNoBucket && buckets_[last_bucket_].timestamp == ts) {
+                return last_bucket_;
+            }
+            if (const auto it = index_.find(ts); it != index_.end()) {
+                last_bucket_ = it->second;
+                return it->second;
+            }
+            uint32_t id = 0;
+            if (!free_buckets_.empty()) {
+                id = free_buckets_.back();
+                free_buckets_.pop_back();
+            } else {
+                id = static_cast<uint32_t>(buckets_.size());
+                buckets_.emplace_back();
+            }
+            buckets_[id].timestamp = ts;
+            index_.emplace(ts, id);
+            times_.emplace_back(ts, id);
+            std::ranges::push_heap(times_, std::greater<>{});
+            last_bucket_ = id;
+            return id;
+        }
+
+        static Lane& lane_for(Bucket& bucket, const uint8_t priority) {
+            auto it = std::ranges::lower_bound(bucket.lanes, priority, {}, &Lane::priority);
+            if (it == bucket.lanes.end() || it->priority != priority) {
+                it = bucket.lanes.insert(it, Lane{priority, {}, 0});
+            }
+            return *it;
+        }
+
+        static Lane& front_lane(Bucket& bucket) {
+            for (auto& lane : bucket.lanes) {
+                if (lane.head < lane.events.size()) {
+                    return lane;
+                }
+            }
+            return bucket.lanes.front();
+        }
+
+        void release_front() {
+            const auto [ts, id] = times_.front();
+            std::ranges::pop_heap(times_, std::greater<>{});
+            times_.pop_back();
+            index_.erase(ts);
+            free_buckets_.push_back(id);
+            if (last_bucket_ == id) {
+                last_bucket_ = kNoBucket;
+            }
+        }
+
+        std::vector<Bucket> buckets_;
+        std::vector<uint32_t> free_buckets_;
+        std::unordered_map<int64_t, uint32_t> index_;
+        std::vector<HeapEntry> times_;
+        EventPayloadStore payloads_;
+        uint32_t last_bucket_ = kNoBucket;
+        size_t size_ = 0;
+    };
+}  // namespace regimeflow::events
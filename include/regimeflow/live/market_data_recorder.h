@@ -0,0 +1,182 @@
+/**
+ * @file market_data_recorder.h
+ * @brief RegimeFlow regimeflow live market data recorder declarations.
+ */
+
+#pragma once
+
+#include "regimeflow/common/result.h"
+#include "regimeflow/common/time.h"
+#include "regimeflow/data/live_feed.h"
+#include "regimeflow/data/live_segment.h"
+#include "regimeflow/live/event_bus.h"
+#include "regimeflow/live/types.h"
+
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace regimeflow::live
+{
+    /**
+     * @brief Records live market data into day-partitioned binary segments.
+     *
+     * @details Each (symbol, kind) pair of a UTC day is appended to
+     * `<directory>/<YYYYMMDD>/<SYMBOL>.<ticks|quotes|bars|books>.rfl`.
+     * A background thread commits every segment each `sync_interval`;
+     * recording only waits while rows are flushed, not for the fsyncs.
+     * When data for a later day arrives, the previous day's segments are
+     * handed to that thread, which closes them and, with
+     * `seal_on_rollover`, converts them to `.rft`, `.rfb` and `.rfob` files
+     * beside them, so the day can be backtested with the mmap data sources
+     * without stalling the feed. Records older than the current day or
+     * earlier than the last record of their segment are rejected and
+     * counted; failed commits and seals are counted in Stats.
+     */
+    class MarketDataRecorder {
+    public:
+        /**
+         * @brief Recorder configuration.
+         */
+        struct Config {
+            /**
+             * @brief Root directory for day partitions.
+             */
+            std::string directory;
+            /**
+             * @brief Bar type recorded in bar segment headers.
+             */
+            data::BarType bar_type = data::BarType::Time_1Min;
+            /**
+             * @brief Interval between background commits (zero disables them).
+             */
+            Duration sync_interval = Duration::seconds(1);
+            /**
+             * @brief Convert the previous day's segments to mmap files on rollover.
+             */
+            bool seal_on_rollover = true;
+        };
+
+        /**
+         * @brief Recorder counters.
+         */
+        struct Stats {
+            uint64_t recorded = 0;
+            uint64_t rejected = 0;
+            uint64_t commits = 0;
+            uint64_t sealed = 0;
+            uint64_t seal_errors = 0;
+            uint64_t commit_errors = 0;
+        };
+
+        /**
+         * @brief Construct a recorder and start the commit and seal thread.
+         * @param config Recorder configuration.
+         */
+        explicit MarketDataRecorder(Config config);
+        /**
+         * @brief Detach and close on destruction.
+         */
+        ~MarketDataRecorder();
+
+        MarketDataRecorder(const MarketDataRecorder&) = delete;
+        MarketDataRecorder& operator=(const MarketDataRecorder&) = delete;
+
+        /**
+         * @brief Record market data published on a bus.
+         * @param bus Event bus; must outlive the subscription.
+         */
+        void attach(EventBus& bus);
+        /**
+         * @brief Record a feed's bars, ticks and books.
+         *
+         * @details Feeds keep one callback per kind, so this replaces any
+         * callbacks registered on the feed earlier. detach() and the
+         * destructor clear them again.
+         * @param feed Live feed; must outlive the attachment.
+         */
+        void attach(data::LiveFeedAdapter& feed);
+        /**
+         * @brief Unsubscribe from the attached bus and clear the attached
+         * feed's callbacks.
+         */
+        void detach();
+
+        /**
+         * @brief Append one update to its segment.
+         * @param update Market data update.
+         * @return Ok on success, error if the update was rejected.
+         */
+        Result<void> record(const MarketDataUpdate& update);
+        /**
+         * @brief Commit every open segment.
+         */
+        Result<void> sync();
+        /**
+         * @brief Stop the background thread, commit and close every segment,
+         * then seal the days still queued.
+         * @return First commit or seal error.
+         */
+        Result<void> close();
+
+        /**
+         * @brief Counters since construction.
+         */
+        [[nodiscard]] Stats stats() const;
+
+        /**
+         * @brief Directory of one day's segments.
+         * @param directory Root directory.
+         * @param date_yyyymmdd UTC date.
+         */
+        static std::string day_directory(const std::string& directory, int32_t date_yyyymmdd);
+        /**
+         * @brief Convert a day's tick, bar and book segments to mmap files.
+         *
+         * @details Used on rollover, and after a crash to seal a day the
+         * recorder did not finish.
+         * @param directory Root directory.
+         * @param date_yyyymmdd UTC date.
+         * @return Number of files written.
+         */
+        static Result<size_t> seal_day(const std::string& directory, int32_t date_yyyymmdd);
+
+    private:
+        using SegmentKey = std::pair<SymbolId, data::LiveRecordKind>;
+
+        template <typename Row>
+        Result<void> append(const Row& row, data::LiveRecordKind kind);
+        Result<void> roll_to(int32_t date_yyyymmdd);
+        // The three callers hold commit_mutex_ (taken before mutex_).
+        Result<void> commit_segments();
+        Result<void> close_retired();
+        Result<void> seal_pending();
+        void detach_bus();
+        void detach_feed();
+        void sync_loop();
+
+        Config config_;
+        // Serializes commits, closes and seals, which run outside mutex_.
+        std::mutex commit_mutex_;
+        mutable std::mutex mutex_;
+        std::map<SegmentKey, std::unique_ptr<data::LiveSegmentWriter>> segments_;
+        int32_t current_date_ = 0;
+        int64_t current_day_ = -1;
+        std::vector<std::unique_ptr<data::LiveSegmentWriter>> retired_;
+        std::vector<int32_t> pending_seals_;
+        Stats stats_;
+
+        EventBus* bus_ = nullptr;
+        EventBus::SubscriptionId subscription_ = 0;
+        data::LiveFeedAdapter* feed_ = nullptr;
+
+        std::condition_variable sync_cv_;
+        bool stopping_ = false;
+        std::thread sync_thread_;
+    };
+}  // namespace regimeflow::live
@@ -49,10 +49,24 @@ namespace regimeflow::metrics
          */
         const EquityCurve& equity_curve() const { return equity_curve_; }
         /**
-         * @brief Access portfolio snapshots captured during updates.
+         * @brief Rebuild portfolio snapshots captured during updates.
+         * @details Materializes full snapshots from the columnar store; prefer
+         * portfolio_store() for column access on long runs.
          */
-        const std::vector<engine::PortfolioSnapshot>& portfolio_snapshots() const {
-            return portfolio_snapshots_;
+        std::vector<engine::PortfolioSnapshot> portfolio_snapshots() const {
+            return portfolio_store_.snapshots();
+        }
+        /**
+         * @brief Columnar store of portfolio snapshots captured during updates.
+         */
+        const engine::EquityCurveStore& portfolio_store() const { return portfolio_store_; }
+        /**
+         * @brief Configure decimation of captured portfolio snapshots.
+         * @details The equity curve and drawdown still see every update.
+         * @param config Sampling configuration.
+         */
+        void set_snapshot_sampling(const engine::EquitySamplingConfig config) {
+            portfolio_store_.set_sampling(config);
         }
         /**
          * @brief Access drawdown tracker.
@@ -83,7 +97,7 @@ namespace regimeflow::metrics
         AttributionTracker attribution_;
         RegimeAttribution regime_attribution_;
         TransitionMetrics transition_metrics_;
-        std::vector<engine::PortfolioSnapshot> portfolio_snapshots_;
+        engine::EquityCurveStore portfolio_store_;
         std::vector<regime::RegimeState> regime_history_;
         double last_equity_ = 0.0;
         std::optional<regime::RegimeType> last_regime_;
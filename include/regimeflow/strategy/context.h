@@ -105,6 +105,19 @@ namespace regimeflow::strategy
          * @brief Recent bars for a symbol.
          */
         std::vector<data::Bar> recent_bars(SymbolId symbol, size_t count) const;
+        /**
+         * @brief Zero-copy view of recent bars for a symbol.
+         * @details Valid until the next bar for the symbol is processed.
+         */
+        engine::HistoryView<data::Bar> bar_history(SymbolId symbol, size_t count) const;
+        /**
+         * @brief Zero-copy view of recent close prices for a symbol.
+         */
+        engine::HistoryView<Price> close_history(SymbolId symbol, size_t count) const;
+        /**
+         * @brief Zero-copy view of recent bar volumes for a symbol.
+         */
+        engine::HistoryView<Volume> volume_history(SymbolId symbol, size_t count) const;
         /**
          * @brief Latest order book for a symbol.
          */
@@ -40,7 +40,7 @@ namespace regimeflow::strategy
         };
 
         bool load_symbol_from_config();
-        [[nodiscard]] std::vector<Pivot> detect_pivots(const std::vector<double>& prices) const;
+        [[nodiscard]] std::vector<Pivot> detect_pivots(const engine::HistoryView<Price>& prices) const;
         [[nodiscard]] bool match_pattern(PatternType type,
                            double ab_xa,
                            double bc_ab,
@@ -12,6 +12,7 @@
 #include "regimeflow/regime/types.h"
 #include "regimeflow/strategy/context.h"
 
+#include <span>
 #include <string>
 
 namespace regimeflow::strategy
@@ -52,6 +53,16 @@ namespace regimeflow::strategy
          * @brief Handle a bar event.
          */
         virtual void on_bar([[maybe_unused]] const data::Bar& bar) {}
+        /**
+         * @brief Handle all bars sharing one timestamp (slice dispatch mode).
+         * @details Called once per timestamp when the engine runs with slice dispatch
+         * enabled. The default forwards each bar to on_bar().
+         */
+        virtual void on_bars(const std::span<const data::Bar> bars) {
+            for (const auto& bar : bars) {
+                on_bar(bar);
+            }
+        }
         /**
          * @brief Handle a tick event.
          */
@@ -8,6 +8,7 @@
 #include "regimeflow/strategy/strategy.h"
 
 #include <memory>
+#include <span>
 #include <vector>
 
 namespace regimeflow::strategy
@@ -47,6 +48,10 @@ namespace regimeflow::strategy
          * @brief Dispatch bar events to strategies.
          */
         void on_bar(const data::Bar& bar) const;
+        /**
+         * @brief Dispatch a same-timestamp bar slice to strategies.
+         */
+        void on_bars(std::span<const data::Bar> bars) const;
         /**
          * @brief Dispatch tick events to strategies.
          */
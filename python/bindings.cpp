@@ -273,6 +273,37 @@ static py::object venue_fill_summary_dataframe(const std::vector<engine::VenueFi
         py::arg("maker_fill_ratio") = maker_fill_ratio));
 }
 
+static py::object stage_profile_dataframe(const std::vector<engine::StageStats>& stats) {
+    py::list stage;
+    py::list calls;
+    py::list total_ns;
+    py::list mean_ns;
+    py::list p50_ns;
+    py::list p99_ns;
+    py::list max_ns;
+    py::list histogram;
+    for (const auto& entry : stats) {
+        stage.append(entry.stage);
+        calls.append(entry.calls);
+        total_ns.append(entry.total_ns);
+        mean_ns.append(entry.mean_ns());
+        p50_ns.append(entry.percentile_ns(0.5));
+        p99_ns.append(entry.percentile_ns(0.99));
+        max_ns.append(entry.max_ns);
+        histogram.append(py::cast(std::vector<uint64_t>(entry.histogram.begin(), entry.histogram.end())));
+    }
+    const auto pandas = py::module_::import("pandas");
+    return pandas.attr("DataFrame")(py::dict(
+        py::arg("stage") = stage,
+        py::arg("calls") = calls,
+        py::arg("total_ns") = total_ns,
+        py::arg("mean_ns") = mean_ns,
+        py::arg("p50_ns") = p50_ns,
+        py::arg("p99_ns") = p99_ns,
+        py::arg("max_ns") = max_ns,
+        py::arg("histogram") = histogram));
+}
+
 static py::list dashboard_order_list(const std::vector<engine::DashboardOrderSummary>& orders) {
     py::list out;
     for (const auto& order : orders) {
@@ -437,6 +468,7 @@ static py::dict dashboard_snapshot_to_dict(const engine::DashboardSnapshot& snap
     out["recent_fills"] = fills_dataframe(snapshot.recent_fills);
     out["venue_summary"] = dashboard_venue_summary_dataframe(snapshot.venue_summary);
     out["alerts"] = py::cast(snapshot.alerts);
+    out["stage_profile"] = stage_profile_dataframe(snapshot.stage_profile);
     return out;
 }
 
@@ -872,6 +904,7 @@ struct BacktestConfig {
     py::dict commission_params;
     py::dict risk_params;
     py::dict strategy_params;
+    bool profile_stages = false;
 
     static BacktestConfig from_dict(const py::dict& dict) {
         BacktestConfig cfg = {};
@@ -914,6 +947,7 @@ struct BacktestConfig {
         if (dict.contains("commission_params")) cfg.commission_params = dict["commission_params"].cast<py::dict>();
         if (dict.contains("risk_params")) cfg.risk_params = dict["risk_params"].cast<py::dict>();
         if (dict.contains("strategy_params")) cfg.strategy_params = dict["strategy_params"].cast<py::dict>();
+        if (dict.contains("profile_stages")) cfg.profile_stages = dict["profile_stages"].cast<bool>();
         return cfg;
     }
 
@@ -1002,6 +1036,7 @@ struct BacktestConfig {
         if (auto v = config.get_as<ConfigValue::Object>("strategy_params")) {
             cfg.strategy_params = object_to_pydict(*v).cast<py::dict>();
         }
+        if (auto v = config.get_as<bool>("profile_stages")) cfg.profile_stages = *v;
         return cfg;
     }
 };
@@ -1442,6 +1477,7 @@ private:
         engine->configure_execution(execution_config_);
         engine->configure_risk(risk_config_);
         engine->configure_regime(regime_config_);
+        engine->set_stage_profiling(config_.profile_stages);
         engine->set_dashboard_setup(build_dashboard_setup());
         return engine;
     }
@@ -2241,6 +2277,7 @@ PYBIND11_MODULE(_core, m) {
         .def_readwrite("commission_params", &BacktestConfig::commission_params)
         .def_readwrite("risk_params", &BacktestConfig::risk_params)
         .def_readwrite("strategy_params", &BacktestConfig::strategy_params)
+        .def_readwrite("profile_stages", &BacktestConfig::profile_stages)
         .def("set_session_window", [](BacktestConfig& cfg,
                                        const std::string& start_hhmm,
                                        const std::string& end_hhmm,
@@ -2390,6 +2427,9 @@ PYBIND11_MODULE(_core, m) {
         .def("venue_fill_summary", [](const engine::BacktestResults& r) {
             return venue_fill_summary_dataframe(r.venue_analytics());
         })
+        .def("stage_profile", [](const engine::BacktestResults& r) {
+            return stage_profile_dataframe(r.stage_profile);
+        })
         .def("dashboard_snapshot", [](const engine::BacktestResults& r) {
             return dashboard_snapshot_to_dict(r.dashboard_snapshot());
         })
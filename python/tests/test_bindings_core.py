@@ -167,6 +167,24 @@ def test_backtest_engine_run_and_context():
     assert bars.size > 0
 
 
+def test_backtest_engine_stage_profile():
+    cfg = _base_config()
+    cfg.profile_stages = True
+
+    class IdleStrategy(rf.Strategy):
+        def on_bar(self, bar):
+            pass
+
+    results = rf.BacktestEngine(cfg).run(IdleStrategy())
+
+    profile = results.stage_profile()
+    assert "strategy" in list(profile["stage"])
+    assert "p99_ns" in profile.columns
+    assert (profile["calls"] > 0).all()
+    assert "stage_profile" in results.dashboard_snapshot()
+    assert "\"stage_profile\"" in results.dashboard_snapshot_json()
+
+
 def test_backtest_engine_prepare_and_step():
     cfg = _base_config()
 
@@ -0,0 +1,230 @@
+#include "regimeflow/data/column_codec.h"
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+namespace regimeflow::data
+{
+    namespace {
+
+        constexpr uint8_t kMaxScale = 8;
+        constexpr std::array<double, kMaxScale + 1> kPow10 = {
+            1.0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8};
+        // Largest magnitude whose integers are all exactly representable as doubles.
+        constexpr double kMaxExactInteger = 9007199254740992.0;
+        constexpr uint64_t kContinuationBits = 0x8080808080808080ULL;
+
+        uint64_t zigzag(const uint64_t value) {
+            return (value << 1) ^ (0 - (value >> 63));
+        }
+
+        uint64_t unzigzag(const uint64_t value) {
+            return (value >> 1) ^ (0 - (value & 1));
+        }
+
+        void put_varint(uint64_t value, std::vector<uint8_t>& out) {
+            while (value >= 0x80) {
+                out.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast<uint8_t>(value));
+        }
+
+        // Undo zigzag in place, then prefix-sum. Unsigned arithmetic keeps
+        // the wrap-around of the encoder's deltas well defined.
+        void unzigzag_prefix_sum(std::span<uint64_t> values, const size_t first) {
+            for (auto& value : values) {
+                value = unzigzag(value);
+            }
+            for (size_t i = first + 1; i < values.size(); ++i) {
+                values[i] += values[i - 1];
+            }
+        }
+
+        bool fits_scale(const std::span<const double> values, const uint8_t scale) {
+            const double factor = kPow10[scale];
+            for (const double value : values) {
+                const double scaled = value * factor;
+                if (!(std::fabs(scaled) < kMaxExactInteger)) {
+                    return false;
+                }
+                const double restored = static_cast<double>(std::llround(scaled)) / factor;
+                if (std::bit_cast<uint64_t>(restored) != std::bit_cast<uint64_t>(value)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    }  // namespace
+
+    ColumnEncoding encode_timestamp_column(const std::span<const int64_t> values,
+                                           std::vector<uint8_t>& out) {
+        uint64_t prev = 0;
+        uint64_t prev_delta = 0;
+        for (size_t i = 0; i < values.size(); ++i) {
+            const auto value = static_cast<uint64_t>(values[i]);
+            if (i == 0) {
+                put_varint(zigzag(value), out);
+            } else {
+                const uint64_t delta = value - prev;
+                put_varint(zigzag(i == 1 ? delta : delta - prev_delta), out);
+                prev_delta = delta;
+            }
+            prev = value;
+        }
+        return {ColumnCodec::DeltaOfDelta, 0};
+    }
+
+    ColumnEncoding encode_price_column(const std::span<const double> values,
+                                       std::vector<uint8_t>& out) {
+        for (uint8_t scale = 0; scale <= kMaxScale; ++scale) {
+            if (!fits_scale(values, scale)) {
+                continue;
+            }
+            uint64_t prev = 0;
+            for (const double value : values) {
+                const auto scaled = static_cast<uint64_t>(std::llround(value * kPow10[scale]));
+                put_varint(zigzag(scaled - prev), out);
+                prev = scaled;
+            }
+            return {ColumnCodec::ScaledDecimal, scale};
+        }
+
+        uint64_t prev = 0;
+        for (const double value : values) {
+            const uint64_t bits = std::bit_cast<uint64_t>(value);
+            const uint64_t x = bits ^ prev;
+            prev = bits;
+            if (x == 0) {
+                out.push_back(0);
+                continue;
+            }
+            const int trailing = std::countr_zero(x) / 8;
+            const int length = 8 - std::countl_zero(x) / 8 - trailing;
+            out.push_back(static_cast<uint8_t>((trailing << 4) | length));
+            const uint64_t payload = x >> (8 * trailing);
+            for (int i = 0; i < length; ++i) {
+                out.push_back(static_cast<uint8_t>(payload >> (8 * i)));
+            }
+        }
+        return {ColumnCodec::XorFloat, 0};
+    }
+
+    ColumnEncoding encode_varint_column(const std::span<const uint64_t> values,
+                                        std::vector<uint8_t>& out) {
+        for (const uint64_t value : values) {
+            put_varint(value, out);
+        }
+        return {ColumnCodec::Varint, 0};
+    }
+
+    bool ColumnDecoder::decode(const std::span<const uint8_t> in, const ColumnEncoding encoding,
+                               const std::span<int64_t> out) {
+        if (encoding.codec != ColumnCodec::DeltaOfDelta || !unpack(in, out.size())) {
+            return false;
+        }
+        const std::span<uint64_t> values(scratch_.data(), out.size());
+        // Deltas-of-deltas become deltas from index 1 on; deltas become values from index 0.
+        unzigzag_prefix_sum(values, 1);
+        for (size_t i = 1; i < values.size(); ++i) {
+            values[i] += values[i - 1];
+        }
+        for (size_t i = 0; i < out.size(); ++i) {
+            out[i] = static_cast<int64_t>(values[i]);
+        }
+        return true;
+    }
+
+    bool ColumnDecoder::decode(const std::span<const uint8_t> in, const ColumnEncoding encoding,
+                               const std::span<double> out) {
+        if (encoding.codec == ColumnCodec::ScaledDecimal) {
+            if (encoding.scale > kMaxScale || !unpack(in, out.size())) {
+                return false;
+            }
+            const std::span<uint64_t> values(scratch_.data(), out.size());
+            unzigzag_prefix_sum(values, 0);
+            const double factor = kPow10[encoding.scale];
+            for (size_t i = 0; i < out.size(); ++i) {
+                out[i] = static_cast<double>(static_cast<int64_t>(values[i])) / factor;
+            }
+            return true;
+        }
+        if (encoding.codec != ColumnCodec::XorFloat) {
+            return false;
+        }
+
+        const uint8_t* p = in.data();
+        const uint8_t* end = p + in.size();
+        uint64_t prev = 0;
+        for (auto& value : out) {
+            if (p == end) {
+                return false;
+            }
+            const uint8_t control = *p++;
+            const int length = control & 0x0F;
+            const int trailing = control >> 4;
+            if (length > 8 || trailing + length > 8 || end - p < length) {
+                return false;
+            }
+            uint64_t payload = 0;
+            for (int i = 0; i < length; ++i) {
+                payload |= static_cast<uint64_t>(p[i]) << (8 * i);
+            }
+            p += length;
+            prev ^= payload << (8 * trailing);
+            value = std::bit_cast<double>(prev);
+        }
+        return p == end;
+    }
+
+    bool ColumnDecoder::decode(const std::span<const uint8_t> in, const ColumnEncoding encoding,
+                               const std::span<uint64_t> out) {
+        if (encoding.codec != ColumnCodec::Varint || !unpack(in, out.size())) {
+            return false;
+        }
+        std::memcpy(out.data(), scratch_.data(), out.size() * sizeof(uint64_t));
+        return true;
+    }
+
+    bool ColumnDecoder::unpack(const std::span<const uint8_t> in, const size_t count) {
+        if (scratch_.size() < count) {
+            scratch_.resize(count);
+        }
+        const uint8_t* p = in.data();
+        const uint8_t* end = p + in.size();
+        uint64_t* dst = scratch_.data();
+        size_t i = 0;
+        while (i < count) {
+            // Regular series encode mostly as single-byte varints; take eight
+            // of them at once when no continuation bit is set.
+            if (count - i >= 8 && end - p >= 8) {
+                uint64_t word = 0;
+                std::memcpy(&word, p, sizeof(word));
+                if ((word & kContinuationBits) == 0) {
+                    for (size_t k = 0; k < 8; ++k) {
+                        dst[i + k] = p[k];
+                    }
+                    p += 8;
+                    i += 8;
+                    continue;
+                }
+            }
+            uint64_t value = 0;
+            for (int shift = 0;; shift += 7) {
+                if (p == end || shift > 63) {
+                    return false;
+                }
+                const uint8_t byte = *p++;
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    break;
+                }
+            }
+            dst[i++] = value;
+        }
+        return p == end;
+    }
+}  // namespace regimeflow::data
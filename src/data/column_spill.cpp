@@ -0,0 +1,70 @@
+#include "regimeflow/data/column_spill.h"
+
+#include <filesystem>
+#include <numeric>
+
+namespace regimeflow::data
+{
+    ColumnSpill::ColumnSpill(std::string path, std::vector<size_t> widths)
+        : path_(std::move(path)), widths_(std::move(widths)),
+          row_bytes_(std::accumulate(widths_.begin(), widths_.end(), size_t{0})) {}
+
+    ColumnSpill::~ColumnSpill() {
+        if (file_.is_open()) {
+            file_.close();
+        }
+        if (created_) {
+            std::error_code ec;
+            std::filesystem::remove(path_, ec);
+        }
+    }
+
+    Result<void> ColumnSpill::add_block(const size_t rows, const std::span<const void* const> columns) {
+        if (columns.size() != widths_.size()) {
+            return Result<void>(Error(Error::Code::InvalidArgument, "Spill column count mismatch"));
+        }
+        if (!file_.is_open()) {
+            file_.open(path_, std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
+            if (!file_) {
+                return Result<void>(Error(Error::Code::IoError, "Unable to open spill file"));
+            }
+            created_ = true;
+        }
+        file_.seekp(static_cast<std::streamoff>(size_));
+        for (size_t c = 0; c < columns.size(); ++c) {
+            file_.write(static_cast<const char*>(columns[c]),
+                        static_cast<std::streamsize>(rows * widths_[c]));
+        }
+        if (!file_) {
+            return Result<void>(Error(Error::Code::IoError, "Unable to write spill file"));
+        }
+        blocks_.push_back(Block{size_, rows});
+        size_ += static_cast<uint64_t>(rows * row_bytes_);
+        return Ok();
+    }
+
+    Result<void> ColumnSpill::copy_column(const size_t column, std::ofstream& out, Sha256& sha) {
+        if (column >= widths_.size()) {
+            return Result<void>(Error(Error::Code::OutOfRange, "Spill column out of range"));
+        }
+        const size_t width = widths_[column];
+        const size_t prefix = std::accumulate(widths_.begin(), widths_.begin() + static_cast<std::ptrdiff_t>(column),
+                                              size_t{0});
+        file_.flush();
+        for (const auto& block : blocks_) {
+            const size_t bytes = block.rows * width;
+            buffer_.resize(bytes);
+            file_.seekg(static_cast<std::streamoff>(block.offset + block.rows * prefix));
+            file_.read(buffer_.data(), static_cast<std::streamsize>(bytes));
+            if (file_.gcount() != static_cast<std::streamsize>(bytes)) {
+                return Result<void>(Error(Error::Code::IoError, "Unable to read spill file"));
+            }
+            out.write(buffer_.data(), static_cast<std::streamsize>(bytes));
+            sha.update(buffer_.data(), bytes);
+        }
+        if (!out) {
+            return Result<void>(Error(Error::Code::IoError, "Unable to write mmap output file"));
+        }
+        return Ok();
+    }
+}  // namespace regimeflow::data
@@ -0,0 +1,318 @@
+#include "regimeflow/data/column_validation.h"
+
+#include "regimeflow/data/memory_data_source.h"
+#include "regimeflow/data/mmap_reader.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <exception>
+#include <thread>
+
+namespace regimeflow::data
+{
+    namespace {
+
+        constexpr int64_t kMicrosPerSecond = 1'000'000;
+        constexpr int64_t kSecondsPerDay = 86'400;
+
+        // First failing row-independent check of a row, in validate_bars order.
+        enum RowError : uint8_t {
+            kNone = 0,
+            kPrice,
+            kVolume,
+            kFuture,
+            kHours
+        };
+
+        struct ColumnMessages {
+            const char* price;
+            const char* volume;
+            const char* volume_outlier;
+        };
+
+        constexpr ColumnMessages kBarMessages{"OHLC out of range", "Volume exceeds max_volume",
+                                              "Volume outlier detected"};
+        constexpr ColumnMessages kTickMessages{"Invalid price", "Quantity exceeds max_volume",
+                                               "Quantity outlier detected"};
+
+        struct RunningStats {
+            size_t count = 0;
+            double mean = 0.0;
+            double m2 = 0.0;
+
+            void push(const double value) {
+                ++count;
+                const double delta = value - mean;
+                mean += delta / static_cast<double>(count);
+                const double delta2 = value - mean;
+                m2 += delta * delta2;
+            }
+
+            [[nodiscard]] double stddev() const {
+                return std::sqrt(count > 1 ? m2 / static_cast<double>(count - 1) : 0.0);
+            }
+        };
+
+        // Marks rows whose code is still clear and that fail `bad`. Written as
+        // a select so the compiler can vectorize it.
+        template <typename Bad>
+        void mark(std::vector<uint8_t>& codes, const RowError code, const Bad& bad) {
+            const size_t n = codes.size();
+            const auto value = static_cast<uint8_t>(code);
+            uint8_t* out = codes.data();
+            for (size_t i = 0; i < n; ++i) {
+                out[i] = out[i] != kNone ? out[i] : (bad(i) ? value : uint8_t{0});
+            }
+        }
+
+        void mark_time_checks(std::vector<uint8_t>& codes, const std::span<const int64_t> ts,
+                              const ValidationConfig& config, const int64_t now_us) {
+            if (config.check_future_timestamps) {
+                const int64_t limit = now_us + config.max_future_skew.total_microseconds();
+                mark(codes, kFuture, [&](const size_t i) { return ts[i] > limit; });
+            }
+            if (config.check_trading_hours) {
+                const int64_t start = config.trading_start_seconds;
+                const int64_t end = config.trading_end_seconds;
+                const bool wraps = start > end;
+                mark(codes, kHours, [&](const size_t i) {
+                    // Same truncation as the gmtime path, folded into [0, 86400).
+                    int64_t secs = (ts[i] / kMicrosPerSecond) % kSecondsPerDay;
+                    secs += secs < 0 ? kSecondsPerDay : 0;
+                    const bool inside = wraps ? (secs >= start) | (secs <= end)
+                                              : (secs >= start) & (secs <= end);
+                    return !inside;
+                });
+            }
+        }
+
+        bool keep_warning(const ValidationAction action) {
+            return action != ValidationAction::Fail && action != ValidationAction::Skip;
+        }
+
+        // Replays the order-dependent checks of validate_bars/validate_ticks.
+        // Only rows that pass every check update the running state.
+        template <typename Volume>
+        ValidationReport replay_rows(const std::vector<uint8_t>& codes, const std::span<const int64_t> ts,
+                                     const std::span<const double> prices, const Volume& volume,
+                                     const ValidationConfig& config, const ColumnMessages& messages) {
+            ValidationReport report;
+            int64_t last_ts = 0;
+            bool has_last = false;
+            double last_price = 0.0;
+            RunningStats price_stats;
+            RunningStats volume_stats;
+            const int64_t max_gap = config.max_gap.total_microseconds();
+
+            for (size_t i = 0; i < ts.size(); ++i) {
+                const size_t line = i + 1;
+                switch (codes[i]) {
+                case kPrice:
+                    report.add_issue({ValidationSeverity::Error, line, messages.price});
+                    continue;
+                case kVolume:
+                    report.add_issue({ValidationSeverity::Error, line, messages.volume});
+                    continue;
+                case kFuture:
+                    report.add_issue({ValidationSeverity::Error, line, "Timestamp is in the future"});
+                    continue;
+                case kHours:
+                    report.add_issue({ValidationSeverity::Error, line, "Timestamp outside trading hours"});
+                    continue;
+                default:
+                    break;
+                }
+
+                if (config.require_monotonic_timestamps && has_last && ts[i] < last_ts) {
+                    report.add_issue({ValidationSeverity::Error, line, "Non-monotonic timestamp"});
+                    continue;
+                }
+                if (config.check_gap && has_last && ts[i] - last_ts > max_gap) {
+                    report.add_issue({ValidationSeverity::Warning, line, "Timestamp gap exceeds max_gap"});
+                    if (!keep_warning(config.on_gap)) {
+                        continue;
+                    }
+                }
+                if (config.check_price_jump && has_last && last_price != 0.0 &&
+                    std::abs(prices[i] - last_price) / std::abs(last_price) > config.max_jump_pct) {
+                    report.add_issue({ValidationSeverity::Warning, line, "Price jump exceeds max_jump_pct"});
+                    if (!keep_warning(config.on_warning)) {
+                        continue;
+                    }
+                }
+                if (config.check_outliers && price_stats.count >= config.outlier_warmup) {
+                    if (const double stddev = price_stats.stddev();
+                        stddev > 0.0 && std::abs(prices[i] - price_stats.mean) / stddev > config.outlier_zscore) {
+                        report.add_issue({ValidationSeverity::Warning, line, "Price outlier detected"});
+                        if (!keep_warning(config.on_warning)) {
+                            continue;
+                        }
+                    }
+                }
+                if (config.check_outliers && volume_stats.count >= config.outlier_warmup) {
+                    if (const double stddev = volume_stats.stddev();
+                        stddev > 0.0 && std::abs(volume(i) - volume_stats.mean) / stddev > config.outlier_zscore) {
+                        report.add_issue({ValidationSeverity::Warning, line, messages.volume_outlier});
+                        if (!keep_warning(config.on_warning)) {
+                            continue;
+                        }
+                    }
+                }
+
+                last_ts = ts[i];
+                has_last = true;
+                last_price = prices[i];
+                if (config.check_outliers) {
+                    price_stats.push(prices[i]);
+                    volume_stats.push(volume(i));
+                }
+            }
+            return report;
+        }
+
+        // True when no row was flagged and the order-dependent checks cannot
+        // fire, so the row replay can be skipped entirely.
+        bool clean_without_replay(const std::vector<uint8_t>& codes, const std::span<const int64_t> ts,
+                                  const ValidationConfig& config) {
+            if (config.check_gap || config.check_price_jump || config.check_outliers) {
+                return false;
+            }
+            size_t flagged = 0;
+            for (const auto code : codes) {
+                flagged += code != kNone;
+            }
+            if (flagged != 0) {
+                return false;
+            }
+            return !config.require_monotonic_timestamps || std::is_sorted(ts.begin(), ts.end());
+        }
+
+        ValidationReport validate_bars_at(const BarColumnsView& columns, const ValidationConfig& config,
+                                          const int64_t now_us) {
+            const size_t n = columns.size();
+            if (n == 0) {
+                return {};
+            }
+            std::vector<uint8_t> codes(n, kNone);
+            if (config.check_price_bounds) {
+                const double bound = config.max_price > 0.0 ? config.max_price : DBL_MAX;
+                const double* o = columns.opens.data();
+                const double* h = columns.highs.data();
+                const double* l = columns.lows.data();
+                const double* c = columns.closes.data();
+                // Comparisons are false for NaN, so one range test per field also
+                // covers the finiteness check.
+                mark(codes, kPrice, [&](const size_t i) {
+                    const bool in_range = (o[i] > 0.0) & (o[i] <= bound) & (h[i] > 0.0) & (h[i] <= bound) &
+                                          (l[i] > 0.0) & (l[i] <= bound) & (c[i] > 0.0) & (c[i] <= bound);
+                    const bool ordered = (h[i] >= l[i]) & (o[i] >= l[i]) & (o[i] <= h[i]) &
+                                         (c[i] >= l[i]) & (c[i] <= h[i]);
+                    return !(in_range & ordered);
+                });
+            }
+            if (config.check_volume_bounds && config.max_volume > 0) {
+                const uint64_t* v = columns.volumes.data();
+                mark(codes, kVolume, [&](const size_t i) { return v[i] > config.max_volume; });
+            }
+            mark_time_checks(codes, columns.timestamps, config, now_us);
+
+            if (clean_without_replay(codes, columns.timestamps, config)) {
+                return {};
+            }
+            const auto volumes = columns.volumes;
+            return replay_rows(codes, columns.timestamps, columns.closes,
+                               [&](const size_t i) { return static_cast<double>(volumes[i]); },
+                               config, kBarMessages);
+        }
+
+    }  // namespace
+
+    BarColumnsView BarColumnsView::of(const BarColumns& columns) {
+        return {columns.symbol, columns.timestamps, columns.opens, columns.highs,
+                columns.lows, columns.closes, columns.volumes};
+    }
+
+    BarColumnsView BarColumnsView::of(const MemoryMappedDataFile& file) {
+        return {file.symbol_id(), file.timestamps(), file.opens(), file.highs(),
+                file.lows(), file.closes(), file.volumes()};
+    }
+
+    TickColumnsView TickColumnsView::of(const TickColumns& columns) {
+        return {columns.symbol, columns.timestamps, columns.prices, columns.quantities};
+    }
+
+    ValidationReport validate_bar_columns(const BarColumnsView& columns, const ValidationConfig& config) {
+        const int64_t now_us = config.check_future_timestamps ? Timestamp::now().microseconds() : 0;
+        return validate_bars_at(columns, config, now_us);
+    }
+
+    ValidationReport validate_tick_columns(const TickColumnsView& columns, const ValidationConfig& config) {
+        const size_t n = columns.size();
+        if (n == 0) {
+            return {};
+        }
+        std::vector<uint8_t> codes(n, kNone);
+        if (config.check_price_bounds) {
+            const double bound = config.max_price > 0.0 ? config.max_price : DBL_MAX;
+            const double* p = columns.prices.data();
+            mark(codes, kPrice, [&](const size_t i) { return !((p[i] > 0.0) & (p[i] <= bound)); });
+        }
+        if (config.check_volume_bounds && config.max_volume > 0) {
+            const double limit = static_cast<double>(config.max_volume);
+            const double* q = columns.quantities.data();
+            mark(codes, kVolume, [&](const size_t i) { return q[i] > limit; });
+        }
+        const int64_t now_us = config.check_future_timestamps ? Timestamp::now().microseconds() : 0;
+        mark_time_checks(codes, columns.timestamps, config, now_us);
+
+        if (clean_without_replay(codes, columns.timestamps, config)) {
+            return {};
+        }
+        const auto quantities = columns.quantities;
+        return replay_rows(codes, columns.timestamps, columns.prices,
+                           [&](const size_t i) { return quantities[i]; }, config, kTickMessages);
+    }
+
+    std::vector<ValidationReport> validate_bar_universe(const std::span<const BarColumnsView> universe,
+                                                        const ValidationConfig& config,
+                                                        size_t threads) {
+        std::vector<ValidationReport> reports(universe.size());
+        // One clock reading so every symbol judges "future" against the same instant.
+        const int64_t now_us = config.check_future_timestamps ? Timestamp::now().microseconds() : 0;
+        if (threads == 0) {
+            threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        }
+        threads = std::min(threads, universe.size());
+
+        std::atomic<size_t> next{0};
+        std::atomic<bool> failed{false};
+        std::exception_ptr failure;
+        auto work = [&]() {
+            try {
+                for (size_t i = next.fetch_add(1); i < universe.size() && !failed.load();
+                     i = next.fetch_add(1)) {
+                    reports[i] = validate_bars_at(universe[i], config, now_us);
+                }
+            } catch (...) {
+                if (!failed.exchange(true)) {
+                    failure = std::current_exception();
+                }
+            }
+        };
+        std::vector<std::thread> workers;
+        workers.reserve(threads > 0 ? threads - 1 : 0);
+        for (size_t t = 1; t < threads; ++t) {
+            workers.emplace_back(work);
+        }
+        work();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+        return reports;
+    }
+}  // namespace regimeflow::data
@@ -0,0 +1,647 @@
+#include "regimeflow/data/compressed_mmap.h"
+
+#include "regimeflow/common/sha256.h"
+#include "regimeflow/data/mmap_writer.h"
+#include "regimeflow/data/tick_mmap.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace regimeflow::data
+{
+    namespace {
+
+        constexpr char kBarMagic[8] = {'R', 'G', 'M', 'F', 'C', 'B', 'R', '1'};
+        constexpr char kTickMagic[8] = {'R', 'G', 'M', 'F', 'C', 'T', 'K', '1'};
+        constexpr uint32_t kFileVersion = 1;
+        constexpr size_t kBarColumns = 6;
+        constexpr size_t kTickColumns = 4;
+
+        std::string_view trim_nulls(const char* data, const size_t size) {
+            size_t len = 0;
+            for (; len < size; ++len) {
+                if (data[len] == '\0') {
+                    break;
+                }
+            }
+            return std::string_view{data, len};
+        }
+
+        void write_bytes(std::ofstream& out, const void* data, const size_t len, Sha256* sha) {
+            out.write(static_cast<const char*>(data), static_cast<std::streamsize>(len));
+            if (sha) {
+                sha->update(data, len);
+            }
+        }
+
+        bool is_empty(const TimeRange range) {
+            return range.start.microseconds() == 0 && range.end.microseconds() == 0;
+        }
+
+        template <typename Encode>
+        void append_column(std::vector<CompressedColumnEntry>& entries, std::vector<uint8_t>& data,
+                           Encode&& encode) {
+            const size_t before = data.size();
+            const ColumnEncoding encoding = encode(data);
+            CompressedColumnEntry entry{};
+            entry.size = static_cast<uint32_t>(data.size() - before);
+            entry.codec = static_cast<uint8_t>(encoding.codec);
+            entry.scale = encoding.scale;
+            entries.push_back(entry);
+        }
+
+        CompressedFileHeader make_header(const char* magic, const std::string& symbol,
+                                         const std::span<const int64_t> timestamps,
+                                         const uint32_t block_rows) {
+            CompressedFileHeader header{};
+            std::memcpy(header.magic, magic, sizeof(header.magic));
+            header.version = kFileVersion;
+            std::memset(header.symbol, 0, sizeof(header.symbol));
+#if defined(_WIN32)
+            strncpy_s(header.symbol, sizeof(header.symbol), symbol.c_str(), _TRUNCATE);
+#else
+            std::strncpy(header.symbol, symbol.c_str(), sizeof(header.symbol) - 1);
+#endif
+            if (!timestamps.empty()) {
+                header.start_timestamp = timestamps.front();
+                header.end_timestamp = timestamps.back();
+            }
+            header.row_count = timestamps.size();
+            header.block_rows = block_rows;
+            return header;
+        }
+
+        // Splits the rows into blocks, lets encode_block append each block's
+        // column entries and data, and writes header, blocks and index.
+        template <typename EncodeBlock>
+        Result<void> write_blocks(const std::string& path, CompressedFileHeader header,
+                                  const std::span<const int64_t> timestamps,
+                                  EncodeBlock&& encode_block) {
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                return Result<void>(Error(Error::Code::IoError, "Unable to open compressed output file"));
+            }
+            write_bytes(out, &header, sizeof(header), nullptr);
+
+            Sha256 sha;
+            std::vector<CompressedBlockEntry> index;
+            std::vector<CompressedColumnEntry> columns;
+            std::vector<uint8_t> data;
+            uint64_t offset = sizeof(CompressedFileHeader);
+            for (size_t begin = 0; begin < timestamps.size(); begin += header.block_rows) {
+                const size_t count = std::min<size_t>(header.block_rows, timestamps.size() - begin);
+                columns.clear();
+                data.clear();
+                encode_block(begin, count, columns, data);
+
+                CompressedBlockEntry entry{};
+                entry.first_timestamp = timestamps[begin];
+                entry.last_timestamp = timestamps[begin + count - 1];
+                entry.row_begin = begin;
+                entry.offset = offset;
+                entry.size = static_cast<uint32_t>(columns.size() * sizeof(CompressedColumnEntry) +
+                                                   data.size());
+                entry.row_count = static_cast<uint32_t>(count);
+                index.push_back(entry);
+
+                write_bytes(out, columns.data(), columns.size() * sizeof(CompressedColumnEntry), &sha);
+                write_bytes(out, data.data(), data.size(), &sha);
+                offset += entry.size;
+            }
+            write_bytes(out, index.data(), index.size() * sizeof(CompressedBlockEntry), &sha);
+
+            header.block_count = static_cast<uint32_t>(index.size());
+            header.index_offset = offset;
+            auto checksum = sha.digest();
+            std::memcpy(header.checksum, checksum.data(), checksum.size());
+            out.seekp(0);
+            write_bytes(out, &header, sizeof(header), nullptr);
+            if (!out) {
+                return Result<void>(Error(Error::Code::IoError, "Failed to write compressed file"));
+            }
+            return Ok();
+        }
+
+        template <typename T>
+        void decode_column(const std::span<const uint8_t> bytes, const ColumnEncoding encoding,
+                           ColumnDecoder& decoder, std::vector<T>& out, const size_t rows) {
+            out.resize(rows);
+            if (!decoder.decode(bytes, encoding, std::span<T>(out))) {
+                throw std::runtime_error("CompressedMmapFile: corrupt block");
+            }
+        }
+
+    }  // namespace
+
+    CompressedMmapFile::CompressedMmapFile(const std::string& path, const char* magic,
+                                           const size_t columns)
+        : columns_(columns) {
+        try {
+            map_file(path);
+            if (std::memcmp(header_->magic, magic, sizeof(header_->magic)) != 0) {
+                throw std::runtime_error("CompressedMmapFile: invalid magic");
+            }
+        } catch (...) {
+            unmap_file();
+            throw;
+        }
+    }
+
+    CompressedMmapFile::~CompressedMmapFile() {
+        unmap_file();
+    }
+
+    TimeRange CompressedMmapFile::time_range() const {
+        TimeRange range;
+        range.start = Timestamp(header_->start_timestamp);
+        range.end = Timestamp(header_->end_timestamp);
+        return range;
+    }
+
+    std::pair<size_t, size_t> CompressedMmapFile::find_blocks(const TimeRange range) const {
+        if (is_empty(range)) {
+            return {0, blocks_.size()};
+        }
+        const int64_t start = range.start.microseconds();
+        const int64_t end = range.end.microseconds();
+        const auto first = std::ranges::partition_point(blocks_, [&](const CompressedBlockEntry& b) {
+            return b.last_timestamp < start;
+        });
+        const auto last = std::ranges::partition_point(blocks_, [&](const CompressedBlockEntry& b) {
+            return b.first_timestamp <= end;
+        });
+        const auto b = static_cast<size_t>(first - blocks_.begin());
+        const auto e = static_cast<size_t>(last - blocks_.begin());
+        return {b, std::max(b, e)};
+    }
+
+    std::pair<size_t, size_t> CompressedMmapFile::find_range(const TimeRange range) const {
+        const size_t count = row_count();
+        if (count == 0) {
+            return {0, 0};
+        }
+        if (is_empty(range)) {
+            return {0, count};
+        }
+        const auto [first, last] = find_blocks(range);
+        if (first == last) {
+            const size_t row = first < blocks_.size() ? blocks_[first].row_begin : count;
+            return {row, row};
+        }
+        ColumnDecoder decoder;
+        std::vector<int64_t> timestamps;
+        decode_timestamps(first, decoder, timestamps);
+        const size_t start = blocks_[first].row_begin +
+            static_cast<size_t>(std::ranges::lower_bound(timestamps, range.start.microseconds()) -
+                                timestamps.begin());
+        if (last - 1 != first) {
+            decode_timestamps(last - 1, decoder, timestamps);
+        }
+        const size_t end = blocks_[last - 1].row_begin +
+            static_cast<size_t>(std::ranges::upper_bound(timestamps, range.end.microseconds()) -
+                                timestamps.begin());
+        return {start, std::max(start, end)};
+    }
+
+    std::span<const uint8_t> CompressedMmapFile::column(const size_t block, const size_t column,
+                                                        ColumnEncoding& encoding) const {
+        const auto& entry = blocks_[block];
+        const auto* base = static_cast<const uint8_t*>(mapping_) + entry.offset;
+        const auto* entries = reinterpret_cast<const CompressedColumnEntry*>(base);
+        uint64_t offset = columns_ * sizeof(CompressedColumnEntry);
+        for (size_t i = 0; i < column; ++i) {
+            offset += entries[i].size;
+        }
+        const uint32_t size = entries[column].size;
+        if (offset + size > entry.size) {
+            throw std::runtime_error("CompressedMmapFile: column out of range");
+        }
+        encoding.codec = static_cast<ColumnCodec>(entries[column].codec);
+        encoding.scale = entries[column].scale;
+        return {base + offset, size};
+    }
+
+    void CompressedMmapFile::decode_timestamps(const size_t block, ColumnDecoder& decoder,
+                                               std::vector<int64_t>& out) const {
+        ColumnEncoding encoding;
+        const auto bytes = column(block, 0, encoding);
+        decode_column(bytes, encoding, decoder, out, blocks_[block].row_count);
+    }
+
+    void CompressedMmapFile::map_file(const std::string& path) {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("CompressedMmapFile: open failed");
+        }
+        LARGE_INTEGER size {};
+        if (!GetFileSizeEx(file, &size)) {
+            CloseHandle(file);
+            throw std::runtime_error("CompressedMmapFile: stat failed");
+        }
+        if (size.QuadPart < static_cast<LONGLONG>(sizeof(CompressedFileHeader))) {
+            CloseHandle(file);
+            throw std::runtime_error("CompressedMmapFile: file too small");
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            CloseHandle(file);
+            throw std::runtime_error("CompressedMmapFile: mmap failed");
+        }
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            throw std::runtime_error("CompressedMmapFile: mmap failed");
+        }
+        file_handle_ = file;
+        mapping_handle_ = mapping;
+        mapping_ = view;
+        file_size_ = static_cast<size_t>(size.QuadPart);
+#else
+        fd_ = ::open(path.c_str(), O_RDONLY);
+        if (fd_ < 0) {
+            throw std::runtime_error("CompressedMmapFile: open failed: " +
+                                     std::string(std::strerror(errno)));
+        }
+
+        struct stat st {};
+        if (::fstat(fd_, &st) != 0) {
+            const int err = errno;
+            ::close(fd_);
+            fd_ = -1;
+            throw std::runtime_error("CompressedMmapFile: stat failed: " +
+                                     std::string(std::strerror(err)));
+        }
+
+        if (st.st_size < static_cast<off_t>(sizeof(CompressedFileHeader))) {
+            ::close(fd_);
+            fd_ = -1;
+            throw std::runtime_error("CompressedMmapFile: file too small");
+        }
+
+        file_size_ = static_cast<size_t>(st.st_size);
+        mapping_ = ::mmap(nullptr, file_size_, PROT_READ, MAP_SHARED, fd_, 0);
+        if (mapping_ == MAP_FAILED) {
+            mapping_ = nullptr;
+            ::close(fd_);
+            fd_ = -1;
+            throw std::runtime_error("CompressedMmapFile: mmap failed");
+        }
+#endif
+
+        header_ = static_cast<const CompressedFileHeader*>(mapping_);
+        if (header_->version != kFileVersion) {
+            throw std::runtime_error("CompressedMmapFile: unsupported version");
+        }
+        const uint64_t index_offset = header_->index_offset;
+        const uint64_t index_bytes = static_cast<uint64_t>(header_->block_count) *
+            sizeof(CompressedBlockEntry);
+        if (index_offset > file_size_ || index_bytes > file_size_ - index_offset) {
+            throw std::runtime_error("CompressedMmapFile: block index out of range");
+        }
+        blocks_ = {reinterpret_cast<const CompressedBlockEntry*>(
+                       static_cast<const uint8_t*>(mapping_) + index_offset),
+                   header_->block_count};
+        uint64_t rows = 0;
+        for (const auto& block : blocks_) {
+            if (block.offset > index_offset || block.size > index_offset - block.offset ||
+                block.size < columns_ * sizeof(CompressedColumnEntry) ||
+                block.row_begin != rows) {
+                throw std::runtime_error("CompressedMmapFile: block out of range");
+            }
+            rows += block.row_count;
+        }
+        if (rows != header_->row_count) {
+            throw std::runtime_error("CompressedMmapFile: row count mismatch");
+        }
+
+        symbol_ = std::string(trim_nulls(header_->symbol, sizeof(header_->symbol)));
+        symbol_id_ = SymbolRegistry::instance().intern(symbol_);
+    }
+
+    void CompressedMmapFile::unmap_file() {
+        if (mapping_) {
+#if defined(_WIN32)
+            UnmapViewOfFile(mapping_);
+#else
+            ::munmap(mapping_, file_size_);
+#endif
+            mapping_ = nullptr;
+        }
+#if defined(_WIN32)
+        if (mapping_handle_) {
+            CloseHandle(static_cast<HANDLE>(mapping_handle_));
+            mapping_handle_ = nullptr;
+        }
+        if (file_handle_) {
+            CloseHandle(static_cast<HANDLE>(file_handle_));
+            file_handle_ = nullptr;
+        }
+#else
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+#endif
+        file_size_ = 0;
+        header_ = nullptr;
+        blocks_ = {};
+    }
+
+    CompressedBarFile::CompressedBarFile(const std::string& path)
+        : CompressedMmapFile(path, kBarMagic, kBarColumns) {}
+
+    void CompressedBarFile::decode_block(const size_t block, Block& out) const {
+        const size_t rows = blocks()[block].row_count;
+        ColumnEncoding encoding;
+        decode_timestamps(block, out.decoder, out.timestamps);
+        decode_column(column(block, 1, encoding), encoding, out.decoder, out.opens, rows);
+        decode_column(column(block, 2, encoding), encoding, out.decoder, out.highs, rows);
+        decode_column(column(block, 3, encoding), encoding, out.decoder, out.lows, rows);
+        decode_column(column(block, 4, encoding), encoding, out.decoder, out.closes, rows);
+        decode_column(column(block, 5, encoding), encoding, out.decoder, out.volumes, rows);
+    }
+
+    CompressedTickFile::CompressedTickFile(const std::string& path)
+        : CompressedMmapFile(path, kTickMagic, kTickColumns) {}
+
+    void CompressedTickFile::decode_block(const size_t block, Block& out) const {
+        const size_t rows = blocks()[block].row_count;
+        ColumnEncoding encoding;
+        decode_timestamps(block, out.decoder, out.timestamps);
+        decode_column(column(block, 1, encoding), encoding, out.decoder, out.prices, rows);
+        decode_column(column(block, 2, encoding), encoding, out.decoder, out.quantities, rows);
+        decode_column(column(block, 3, encoding), encoding, out.decoder, out.flags, rows);
+    }
+
+    CompressedMmapWriter::CompressedMmapWriter(const uint32_t block_rows)
+        : block_rows_(std::max<uint32_t>(block_rows, 1)) {}
+
+    Result<void> CompressedMmapWriter::write_bars(const std::string& path,
+                                                  const std::string& symbol,
+                                                  const BarType bar_type,
+                                                  std::vector<Bar> bars) const {
+        std::ranges::sort(bars, [](const Bar& a, const Bar& b) {
+            return a.timestamp < b.timestamp;
+        });
+        if (auto validation = MmapWriter::validate_bars(bars); validation.is_err()) {
+            return validation;
+        }
+
+        const size_t count = bars.size();
+        std::vector<int64_t> timestamps(count);
+        std::vector<double> opens(count);
+        std::vector<double> highs(count);
+        std::vector<double> lows(count);
+        std::vector<double> closes(count);
+        std::vector<uint64_t> volumes(count);
+        for (size_t i = 0; i < count; ++i) {
+            timestamps[i] = bars[i].timestamp.microseconds();
+            opens[i] = bars[i].open;
+            highs[i] = bars[i].high;
+            lows[i] = bars[i].low;
+            closes[i] = bars[i].close;
+            volumes[i] = bars[i].volume;
+        }
+
+        auto header = make_header(kBarMagic, symbol, timestamps, block_rows_);
+        header.bar_type = static_cast<uint32_t>(bar_type);
+        header.bar_size_ms = MmapWriter::bar_size_ms(bar_type);
+        return write_blocks(path, header, timestamps,
+            [&](const size_t begin, const size_t rows, std::vector<CompressedColumnEntry>& columns,
+                std::vector<uint8_t>& data) {
+                const auto slice = [&](const auto& column) {
+                    return std::span(column).subspan(begin, rows);
+                };
+                append_column(columns, data, [&](auto& buf) {
+                    return encode_timestamp_column(slice(timestamps), buf);
+                });
+                for (const auto* prices : {&opens, &highs, &lows, &closes}) {
+                    append_column(columns, data, [&](auto& buf) {
+                        return encode_price_column(slice(*prices), buf);
+                    });
+                }
+                append_column(columns, data, [&](auto& buf) {
+                    return encode_varint_column(slice(volumes), buf);
+                });
+            });
+    }
+
+    Result<void> CompressedMmapWriter::write_ticks(const std::string& path,
+                                                   const std::string& symbol,
+                                                   std::vector<Tick> ticks) const {
+        std::ranges::sort(ticks, [](const Tick& a, const Tick& b) {
+            return a.timestamp < b.timestamp;
+        });
+        if (auto validation = TickMmapWriter::validate_ticks(ticks); validation.is_err()) {
+            return validation;
+        }
+
+        const size_t count = ticks.size();
+        std::vector<int64_t> timestamps(count);
+        std::vector<double> prices(count);
+        std::vector<double> quantities(count);
+        std::vector<uint64_t> flags(count);
+        for (size_t i = 0; i < count; ++i) {
+            timestamps[i] = ticks[i].timestamp.microseconds();
+            prices[i] = ticks[i].price;
+            quantities[i] = ticks[i].quantity;
+            flags[i] = ticks[i].flags;
+        }
+
+        const auto header = make_header(kTickMagic, symbol, timestamps, block_rows_);
+        return write_blocks(path, header, timestamps,
+            [&](const size_t begin, const size_t rows, std::vector<CompressedColumnEntry>& columns,
+                std::vector<uint8_t>& data) {
+                const auto slice = [&](const auto& column) {
+                    return std::span(column).subspan(begin, rows);
+                };
+                append_column(columns, data, [&](auto& buf) {
+                    return encode_timestamp_column(slice(timestamps), buf);
+                });
+                append_column(columns, data, [&](auto& buf) {
+                    return encode_price_column(slice(prices), buf);
+                });
+                append_column(columns, data, [&](auto& buf) {
+                    return encode_price_column(slice(quantities), buf);
+                });
+                append_column(columns, data, [&](auto& buf) {
+                    return encode_varint_column(slice(flags), buf);
+                });
+            });
+    }
+
+    CompressedBarIterator::CompressedBarIterator(std::shared_ptr<const CompressedBarFile> file,
+                                                 const TimeRange range,
+                                                 std::vector<CorporateAction> actions)
+        : file_(std::move(file)) {
+        if (!file_) {
+            return;
+        }
+        std::tie(row_begin_, row_end_) = file_->find_range(range);
+        symbol_ = file_->symbol_id();
+        adjust_ = !actions.empty();
+        if (adjust_) {
+            adjuster_.add_actions(symbol_, std::move(actions));
+        }
+        reset();
+    }
+
+    bool CompressedBarIterator::has_next() const {
+        return row_ < row_end_;
+    }
+
+    Bar CompressedBarIterator::next() {
+        if (!has_next()) {
+            throw std::out_of_range("No more bars");
+        }
+        if (row_ - block_row_begin_ >= decoded_.size()) {
+            load_block(block_ + 1);
+        }
+        const Bar bar = read(row_++ - block_row_begin_);
+        return adjust_ ? adjuster_.adjust_bar(symbol_, bar) : bar;
+    }
+
+    size_t CompressedBarIterator::next_batch(const std::span<Bar> out) {
+        size_t count = 0;
+        while (count < out.size() && has_next()) {
+            if (row_ - block_row_begin_ >= decoded_.size()) {
+                load_block(block_ + 1);
+            }
+            const size_t offset = row_ - block_row_begin_;
+            const size_t run = std::min({out.size() - count, decoded_.size() - offset,
+                                         row_end_ - row_});
+            for (size_t i = 0; i < run; ++i) {
+                out[count + i] = read(offset + i);
+            }
+            row_ += run;
+            count += run;
+        }
+        if (adjust_) {
+            adjuster_.adjust_bars(symbol_, out.first(count));
+        }
+        return count;
+    }
+
+    void CompressedBarIterator::reset() {
+        row_ = row_begin_;
+        decoded_.timestamps.clear();
+        block_row_begin_ = row_;
+        if (!file_ || row_ >= row_end_) {
+            return;
+        }
+        const auto blocks = file_->blocks();
+        const auto it = std::ranges::partition_point(blocks, [&](const CompressedBlockEntry& b) {
+            return b.row_begin <= row_;
+        });
+        load_block(static_cast<size_t>(it - blocks.begin()) - 1);
+    }
+
+    void CompressedBarIterator::load_block(const size_t block) {
+        file_->decode_block(block, decoded_);
+        block_ = block;
+        block_row_begin_ = static_cast<size_t>(file_->blocks()[block].row_begin);
+    }
+
+    Bar CompressedBarIterator::read(const size_t index) const {
+        Bar bar;
+        bar.timestamp = Timestamp(decoded_.timestamps[index]);
+        bar.symbol = symbol_;
+        bar.open = decoded_.opens[index];
+        bar.high = decoded_.highs[index];
+        bar.low = decoded_.lows[index];
+        bar.close = decoded_.closes[index];
+        bar.volume = decoded_.volumes[index];
+        return bar;
+    }
+
+    CompressedTickIterator::CompressedTickIterator(std::shared_ptr<const CompressedTickFile> file,
+                                                   const TimeRange range)
+        : file_(std::move(file)) {
+        if (!file_) {
+            return;
+        }
+        std::tie(row_begin_, row_end_) = file_->find_range(range);
+        symbol_ = file_->symbol_id();
+        reset();
+    }
+
+    bool CompressedTickIterator::has_next() const {
+        return row_ < row_end_;
+    }
+
+    Tick CompressedTickIterator::next() {
+        if (!has_next()) {
+            throw std::out_of_range("No more ticks");
+        }
+        if (row_ - block_row_begin_ >= decoded_.size()) {
+            load_block(block_ + 1);
+        }
+        return read(row_++ - block_row_begin_);
+    }
+
+    size_t CompressedTickIterator::next_batch(const std::span<Tick> out) {
+        size_t count = 0;
+        while (count < out.size() && has_next()) {
+            if (row_ - block_row_begin_ >= decoded_.size()) {
+                load_block(block_ + 1);
+            }
+            const size_t offset = row_ - block_row_begin_;
+            const size_t run = std::min({out.size() - count, decoded_.size() - offset,
+                                         row_end_ - row_});
+            for (size_t i = 0; i < run; ++i) {
+                out[count + i] = read(offset + i);
+            }
+            row_ += run;
+            count += run;
+        }
+        return count;
+    }
+
+    void CompressedTickIterator::reset() {
+        row_ = row_begin_;
+        decoded_.timestamps.clear();
+        block_row_begin_ = row_;
+        if (!file_ || row_ >= row_end_) {
+            return;
+        }
+        const auto blocks = file_->blocks();
+        const auto it = std::ranges::partition_point(blocks, [&](const CompressedBlockEntry& b) {
+            return b.row_begin <= row_;
+        });
+        load_block(static_cast<size_t>(it - blocks.begin()) - 1);
+    }
+
+    void CompressedTickIterator::load_block(const size_t block) {
+        file_->decode_block(block, decoded_);
+        block_ = block;
+        block_row_begin_ = static_cast<size_t>(file_->blocks()[block].row_begin);
+    }
+
+    Tick CompressedTickIterator::read(const size_t index) const {
+        Tick tick;
+        tick.timestamp = Timestamp(decoded_.timestamps[index]);
+        tick.symbol = symbol_;
+        tick.price = decoded_.prices[index];
+        tick.quantity = decoded_.quantities[index];
+        tick.flags = static_cast<uint8_t>(decoded_.flags[index]);
+        return tick;
+    }
+}  // namespace regimeflow::data
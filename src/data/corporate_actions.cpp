@@ -8,47 +8,198 @@ namespace regimeflow::data
         auto& list = actions_[symbol];
         list.insert(list.end(), std::make_move_iterator(actions.begin()),
                     std::make_move_iterator(actions.end()));
-        std::ranges::sort(list, [](const CorporateAction& a, const CorporateAction& b) {
+        std::ranges::stable_sort(list, [](const CorporateAction& a, const CorporateAction& b) {
             return a.effective_date < b.effective_date;
         });
+        tables_[symbol] = build_table(list);
+    }
+
+    CorporateActionAdjuster::StepTable CorporateActionAdjuster::build_table(
+        const std::vector<CorporateAction>& actions) {
+        const size_t count = actions.size();
+        StepTable table;
+        table.effective.resize(count);
+        table.split_divisor.assign(count + 1, 1.0);
+        table.dividend_factor.assign(count + 1, 1.0);
+        table.volume_factor.assign(count + 1, 1.0);
+        table.next_cash_dividend.assign(count + 1, static_cast<uint32_t>(count));
+        table.cash_amount.assign(count, 0.0);
+        table.symbol.assign(count + 1, 0);
+        for (size_t k = 0; k < count; ++k) {
+            table.effective[k] = actions[k].effective_date.microseconds();
+        }
+        // Segment k sees every action from k on; fold them from the back.
+        for (size_t k = count; k-- > 0;) {
+            const auto& action = actions[k];
+            double split = 1.0;
+            double dividend = 1.0;
+            bool cash = false;
+            if (action.type == CorporateActionType::Split) {
+                split = action.factor > 0 ? action.factor : 1.0;
+            } else if (action.type == CorporateActionType::Dividend) {
+                cash = (action.factor <= 0.0 || action.factor == 1.0) && action.amount > 0.0;
+                dividend = !cash && action.factor > 0.0 ? action.factor : 1.0;
+            }
+            table.volume_factor[k] = table.volume_factor[k + 1] * split;
+            if (cash) {
+                table.next_cash_dividend[k] = static_cast<uint32_t>(k);
+                table.cash_amount[k] = action.amount;
+            } else {
+                table.next_cash_dividend[k] = table.next_cash_dividend[k + 1];
+                table.split_divisor[k] = table.split_divisor[k + 1] * split;
+                table.dividend_factor[k] = table.dividend_factor[k + 1] * dividend;
+            }
+        }
+        for (size_t k = 1; k <= count; ++k) {
+            const auto& action = actions[k - 1];
+            table.symbol[k] = action.type == CorporateActionType::SymbolChange && !action.new_symbol.empty()
+                ? SymbolRegistry::instance().intern(action.new_symbol)
+                : table.symbol[k - 1];
+        }
+        return table;
+    }
+
+    void CorporateActionAdjuster::adjust_prices(const StepTable& table, size_t segment,
+                                                double& open, double& high, double& low, double& close) {
+        const size_t count = table.effective.size();
+        while (true) {
+            if (const double divisor = table.split_divisor[segment]; divisor != 1.0) {
+                open /= divisor;
+                high /= divisor;
+                low /= divisor;
+                close /= divisor;
+            }
+            if (const double factor = table.dividend_factor[segment]; factor != 1.0) {
+                open *= factor;
+                high *= factor;
+                low *= factor;
+                close *= factor;
+            }
+            const size_t cash = table.next_cash_dividend[segment];
+            if (cash >= count) {
+                return;
+            }
+            // Cash dividends scale by the close adjusted so far.
+            if (close > 0.0) {
+                if (const double ratio = (close - table.cash_amount[cash]) / close; ratio > 0.0) {
+                    open *= ratio;
+                    high *= ratio;
+                    low *= ratio;
+                    close *= ratio;
+                }
+            }
+            segment = cash + 1;
+        }
+    }
+
+    void CorporateActionAdjuster::apply_segment(const StepTable& table, const size_t segment, Bar& bar) {
+        adjust_prices(table, segment, bar.open, bar.high, bar.low, bar.close);
+        if (const double factor = table.volume_factor[segment]; factor != 1.0) {
+            bar.volume = static_cast<Volume>(static_cast<double>(bar.volume) * factor);
+        }
+        if (const SymbolId renamed = table.symbol[segment]; renamed != 0) {
+            bar.symbol = renamed;
+        }
     }
 
     Bar CorporateActionAdjuster::adjust_bar(const SymbolId symbol, const Bar& bar) const {
         Bar adjusted = bar;
-        const auto it = actions_.find(symbol);
-        if (it == actions_.end()) {
+        const auto it = tables_.find(symbol);
+        if (it == tables_.end()) {
             return adjusted;
         }
-        for (const auto& [type, effective_date, factor, amount, new_symbol] : it->second) {
-            if (bar.timestamp < effective_date) {
-                if (type == CorporateActionType::Split) {
-                    if (factor > 0) {
-                        adjusted.open /= factor;
-                        adjusted.high /= factor;
-                        adjusted.low /= factor;
-                        adjusted.close /= factor;
-                        adjusted.volume = static_cast<Volume>(static_cast<double>(adjusted.volume) * factor);
+        const auto& table = it->second;
+        const auto segment = std::ranges::upper_bound(table.effective, bar.timestamp.microseconds())
+            - table.effective.begin();
+        apply_segment(table, static_cast<size_t>(segment), adjusted);
+        return adjusted;
+    }
+
+    void CorporateActionAdjuster::adjust_bars(const SymbolId symbol, const std::span<Bar> bars) const {
+        const auto it = tables_.find(symbol);
+        if (it == tables_.end() || bars.empty()) {
+            return;
+        }
+        const auto& table = it->second;
+        const auto& effective = table.effective;
+        const auto seek = [&](const int64_t ts) {
+            return static_cast<size_t>(std::ranges::upper_bound(effective, ts) - effective.begin());
+        };
+        int64_t last = bars.front().timestamp.microseconds();
+        size_t segment = seek(last);
+        for (auto& bar : bars) {
+            const int64_t ts = bar.timestamp.microseconds();
+            if (ts < last) {
+                segment = seek(ts);
+            } else {
+                while (segment < effective.size() && effective[segment] <= ts) {
+                    ++segment;
+                }
+            }
+            last = ts;
+            apply_segment(table, segment, bar);
+        }
+    }
+
+    void CorporateActionAdjuster::adjust_columns(const SymbolId symbol,
+                                                 const std::span<const int64_t> timestamps,
+                                                 const std::span<double> opens,
+                                                 const std::span<double> highs,
+                                                 const std::span<double> lows,
+                                                 const std::span<double> closes,
+                                                 const std::span<uint64_t> volumes) const {
+        const auto it = tables_.find(symbol);
+        if (it == tables_.end()) {
+            return;
+        }
+        const auto& table = it->second;
+        const auto& effective = table.effective;
+        const size_t count = effective.size();
+        const size_t rows = timestamps.size();
+        size_t row = 0;
+        while (row < rows) {
+            // Rows before the next effective date share one segment.
+            const auto segment = static_cast<size_t>(
+                std::ranges::upper_bound(effective, timestamps[row]) - effective.begin());
+            const size_t end = segment < count
+                ? static_cast<size_t>(std::lower_bound(timestamps.begin() + static_cast<std::ptrdiff_t>(row),
+                                                       timestamps.end(), effective[segment]) -
+                                      timestamps.begin())
+                : rows;
+            if (table.next_cash_dividend[segment] >= count) {
+                const auto scale = [&](const std::span<double> column) {
+                    if (const double divisor = table.split_divisor[segment]; divisor != 1.0) {
+                        for (size_t i = row; i < end; ++i) {
+                            column[i] /= divisor;
+                        }
                     }
-                } else if (type == CorporateActionType::Dividend) {
-                    double r_factor = factor;
-                    if ((r_factor <= 0.0 || r_factor == 1.0) && amount > 0.0 &&
-                        adjusted.close > 0.0) {
-                        r_factor = (adjusted.close - amount) / adjusted.close;
+                    if (const double factor = table.dividend_factor[segment]; factor != 1.0) {
+                        for (size_t i = row; i < end; ++i) {
+                            column[i] *= factor;
                         }
-                    if (r_factor > 0.0) {
-                        adjusted.open *= r_factor;
-                        adjusted.high *= r_factor;
-                        adjusted.low *= r_factor;
-                        adjusted.close *= r_factor;
                     }
+                };
+                scale(opens);
+                scale(highs);
+                scale(lows);
+                scale(closes);
+            } else {
+                for (size_t i = row; i < end; ++i) {
+                    adjust_prices(table, segment, opens[i], highs[i], lows[i], closes[i]);
                 }
-            } else if (type == CorporateActionType::SymbolChange) {
-                if (!new_symbol.empty() && bar.timestamp >= effective_date) {
-                    adjusted.symbol = SymbolRegistry::instance().intern(new_symbol);
+            }
+            if (const double factor = table.volume_factor[segment]; factor != 1.0 && !volumes.empty()) {
+                for (size_t i = row; i < end; ++i) {
+                    volumes[i] = static_cast<uint64_t>(static_cast<double>(volumes[i]) * factor);
                 }
             }
+            row = end;
         }
-        return adjusted;
+    }
+
+    bool CorporateActionAdjuster::has_actions(const SymbolId symbol) const {
+        const auto it = actions_.find(symbol);
+        return it != actions_.end() && !it->second.empty();
     }
 
     SymbolId CorporateActionAdjuster::resolve_symbol(const SymbolId symbol) const {
@@ -88,4 +239,12 @@ namespace regimeflow::data
         }
         return aliases;
     }
+
+    std::vector<CorporateAction> CorporateActionAdjuster::actions_for(const SymbolId symbol) const {
+        const auto it = actions_.find(symbol);
+        if (it == actions_.end()) {
+            return {};
+        }
+        return it->second;
+    }
 }  // namespace regimeflow::data
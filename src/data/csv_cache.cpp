@@ -0,0 +1,175 @@
+#include "regimeflow/data/csv_cache.h"
+
+#include "regimeflow/common/sha256.h"
+#include "regimeflow/data/mmap_reader.h"
+#include "regimeflow/data/mmap_writer.h"
+#include "regimeflow/data/tick_mmap.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <sstream>
+#include <thread>
+
+namespace regimeflow::data
+{
+    namespace {
+
+        // Unique sibling of the entry; renamed over it once fully written.
+        std::filesystem::path temp_path_for(const std::string& entry) {
+            const auto thread = std::hash<std::thread::id>{}(std::this_thread::get_id());
+            return entry + ".tmp" + std::to_string(thread) + "_" +
+                   std::to_string(Timestamp::now().microseconds());
+        }
+
+        template <typename Write>
+        bool publish(const std::string& entry, Write&& write) {
+            std::error_code ec;
+            std::filesystem::create_directories(std::filesystem::path(entry).parent_path(), ec);
+            const auto temp = temp_path_for(entry);
+            if (write(temp.string()).is_err()) {
+                std::filesystem::remove(temp, ec);
+                return false;
+            }
+            std::filesystem::rename(temp, entry, ec);
+            if (ec) {
+                std::filesystem::remove(temp, ec);
+                return false;
+            }
+            return true;
+        }
+
+        template <typename Row>
+        bool in_timestamp_order(const std::vector<Row>& rows) {
+            return std::ranges::is_sorted(rows, [](const Row& a, const Row& b) {
+                return a.timestamp < b.timestamp;
+            });
+        }
+
+    }  // namespace
+
+    CsvCache::CsvCache(std::string directory) : directory_(std::move(directory)) {}
+
+    std::string CsvCache::entry_path(const std::string& source,
+                                     const std::string& fingerprint,
+                                     const std::string& extension) const {
+        if (directory_.empty()) {
+            return {};
+        }
+        std::error_code ec;
+        const auto absolute = std::filesystem::absolute(source, ec);
+        const auto size = std::filesystem::file_size(absolute, ec);
+        if (ec) {
+            return {};
+        }
+        const auto mtime = std::filesystem::last_write_time(absolute, ec);
+        if (ec) {
+            return {};
+        }
+
+        std::ostringstream key;
+        key << absolute.string() << '\n' << size << '\n'
+            << mtime.time_since_epoch().count() << '\n' << fingerprint;
+        const std::string text = key.str();
+        Sha256 sha;
+        sha.update(text.data(), text.size());
+        const auto digest = sha.digest();
+        static constexpr char kHex[] = "0123456789abcdef";
+        std::string name = absolute.stem().string() + "-";
+        for (size_t i = 0; i < 8; ++i) {
+            name.push_back(kHex[digest[i] >> 4]);
+            name.push_back(kHex[digest[i] & 0x0F]);
+        }
+        return (std::filesystem::path(directory_) / (name + extension)).string();
+    }
+
+    bool CsvCache::load_bars(const std::string& entry, const SymbolId symbol, const TimeRange range,
+                             std::vector<Bar>& bars) {
+        std::error_code ec;
+        if (!std::filesystem::exists(entry, ec)) {
+            return false;
+        }
+        try {
+            const MemoryMappedDataFile file(entry);
+            const auto [begin, end] = file.find_range(range);
+            const auto ts = file.timestamps();
+            const auto opens = file.opens();
+            const auto highs = file.highs();
+            const auto lows = file.lows();
+            const auto closes = file.closes();
+            const auto volumes = file.volumes();
+            bars.resize(end - begin);
+            for (size_t i = begin; i < end; ++i) {
+                auto& bar = bars[i - begin];
+                bar.timestamp = Timestamp(ts[i]);
+                bar.symbol = symbol;
+                bar.open = opens[i];
+                bar.high = highs[i];
+                bar.low = lows[i];
+                bar.close = closes[i];
+                bar.volume = volumes[i];
+            }
+            return true;
+        } catch (const std::exception&) {
+            bars.clear();
+            return false;
+        }
+    }
+
+    bool CsvCache::store_bars(const std::string& entry, const std::vector<Bar>& bars) {
+        if (bars.empty() || !in_timestamp_order(bars)) {
+            return false;
+        }
+        const auto& symbol = SymbolRegistry::instance().lookup(bars.front().symbol);
+        return publish(entry, [&](const std::string& path) {
+            return MmapWriter().write_bars(path, symbol, BarType::Time_1Day, bars);
+        });
+    }
+
+    bool CsvCache::load_ticks(const std::string& entry, const SymbolId symbol, const TimeRange range,
+                              std::vector<Tick>& ticks) {
+        std::error_code ec;
+        if (!std::filesystem::exists(entry, ec)) {
+            return false;
+        }
+        try {
+            const TickMmapFile file(entry);
+            const auto [begin, end] = file.find_range(range);
+            ticks.resize(end - begin);
+            for (size_t i = begin; i < end; ++i) {
+                auto& tick = ticks[i - begin];
+                tick = file[i].to_tick();
+                tick.symbol = symbol;
+            }
+            return true;
+        } catch (const std::exception&) {
+            ticks.clear();
+            return false;
+        }
+    }
+
+    bool CsvCache::store_ticks(const std::string& entry, const std::vector<Tick>& ticks) {
+        if (ticks.empty() || !in_timestamp_order(ticks)) {
+            return false;
+        }
+        const auto& symbol = SymbolRegistry::instance().lookup(ticks.front().symbol);
+        return publish(entry, [&](const std::string& path) {
+            return TickMmapWriter().write_ticks(path, symbol, ticks);
+        });
+    }
+
+    void append_cache_fingerprint(std::string& out, const ValidationConfig& config) {
+        std::ostringstream text;
+        text.precision(17);
+        text << config.max_gap.total_microseconds() << ',' << config.max_jump_pct << ','
+             << config.max_future_skew.total_microseconds() << ',' << config.max_volume << ','
+             << config.max_price << ',' << config.outlier_zscore << ',' << config.outlier_warmup << ','
+             << config.trading_start_seconds << ',' << config.trading_end_seconds << ','
+             << config.require_monotonic_timestamps << config.check_price_bounds << config.check_gap
+             << config.check_price_jump << config.check_future_timestamps << config.check_trading_hours
+             << config.check_volume_bounds << config.check_outliers << ','
+             << static_cast<int>(config.on_error) << static_cast<int>(config.on_gap)
+             << static_cast<int>(config.on_warning) << ';';
+        out += text.str();
+    }
+}  // namespace regimeflow::data
@@ -0,0 +1,324 @@
+#include "regimeflow/data/csv_parser.h"
+
+#include <algorithm>
+#include <charconv>
+#include <system_error>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace regimeflow::data
+{
+    namespace {
+
+        // Items are stored as (kind, value) pairs: a field specifier or a
+        // literal character.
+        constexpr char kField = 'f';
+        constexpr char kLiteral = 'l';
+
+        bool is_space(const char c) {
+            return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+        }
+
+        bool is_field_padding(const char c) {
+            return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+        }
+
+        std::string_view skip_leading_space(std::string_view field) {
+            size_t i = 0;
+            while (i < field.size() && is_space(field[i])) {
+                ++i;
+            }
+            return field.substr(i);
+        }
+
+        bool read_digits(const std::string_view value, const size_t pos, const size_t width, int& out) {
+            if (value.size() - pos < width) {
+                return false;
+            }
+            int result = 0;
+            for (size_t i = 0; i < width; ++i) {
+                const char c = value[pos + i];
+                if (c < '0' || c > '9') {
+                    return false;
+                }
+                result = result * 10 + (c - '0');
+            }
+            out = result;
+            return true;
+        }
+
+        // Days since 1970-01-01 for a proleptic Gregorian date. Linear in
+        // day, so out-of-range days normalize the way timegm does.
+        int64_t days_from_civil(int64_t year, const int month, const int day) {
+            year -= month <= 2 ? 1 : 0;
+            const int64_t era = (year >= 0 ? year : year - 399) / 400;
+            const int64_t yoe = year - era * 400;
+            const int64_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+            const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+            return era * 146097 + doe - 719468;
+        }
+
+    }  // namespace
+
+    MappedTextFile::MappedTextFile(const std::string& path) {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            return;
+        }
+        LARGE_INTEGER size {};
+        if (!GetFileSizeEx(file, &size)) {
+            CloseHandle(file);
+            return;
+        }
+        file_handle_ = file;
+        if (size.QuadPart == 0) {
+            open_ = true;
+            return;
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            return;
+        }
+        mapping_handle_ = mapping;
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            return;
+        }
+        mapping_ = view;
+        file_size_ = static_cast<size_t>(size.QuadPart);
+        open_ = true;
+#else
+        fd_ = ::open(path.c_str(), O_RDONLY);
+        if (fd_ < 0) {
+            return;
+        }
+        struct stat st {};
+        if (::fstat(fd_, &st) != 0 || !S_ISREG(st.st_mode)) {
+            return;
+        }
+        if (st.st_size == 0) {
+            open_ = true;
+            return;
+        }
+        void* mapping = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd_, 0);
+        if (mapping == MAP_FAILED) {
+            return;
+        }
+        mapping_ = mapping;
+        file_size_ = static_cast<size_t>(st.st_size);
+        ::madvise(mapping_, file_size_, MADV_SEQUENTIAL);
+        open_ = true;
+#endif
+    }
+
+    MappedTextFile::~MappedTextFile() {
+        if (mapping_) {
+#if defined(_WIN32)
+            UnmapViewOfFile(mapping_);
+#else
+            ::munmap(mapping_, file_size_);
+#endif
+        }
+#if defined(_WIN32)
+        if (mapping_handle_) {
+            CloseHandle(static_cast<HANDLE>(mapping_handle_));
+        }
+        if (file_handle_) {
+            CloseHandle(static_cast<HANDLE>(file_handle_));
+        }
+#else
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+#endif
+    }
+
+    FixedTimestampFormat::FixedTimestampFormat(const std::string& format) {
+        auto add = [&](const char kind, const char value) {
+            items_.push_back(kind);
+            items_.push_back(value);
+        };
+        for (size_t i = 0; i < format.size(); ++i) {
+            if (format[i] != '%') {
+                add(kLiteral, format[i]);
+                continue;
+            }
+            if (++i == format.size()) {
+                compiled_ = false;
+                return;
+            }
+            switch (format[i]) {
+                case 'Y': case 'm': case 'd': case 'H': case 'M': case 'S':
+                    add(kField, format[i]);
+                    break;
+                case 'F':
+                    add(kField, 'Y'); add(kLiteral, '-'); add(kField, 'm'); add(kLiteral, '-');
+                    add(kField, 'd');
+                    break;
+                case 'T':
+                    add(kField, 'H'); add(kLiteral, ':'); add(kField, 'M'); add(kLiteral, ':');
+                    add(kField, 'S');
+                    break;
+                case '%':
+                    add(kLiteral, '%');
+                    break;
+                default:
+                    compiled_ = false;
+                    return;
+            }
+        }
+    }
+
+    FixedTimestampFormat::Status FixedTimestampFormat::parse(const std::string_view value,
+                                                             int64_t& microseconds) const {
+        if (!compiled_) {
+            return Status::Unsupported;
+        }
+        // Defaults mirror a zeroed std::tm: 1900-01-00 00:00:00.
+        int year = 1900;
+        int month = 1;
+        int day = 0;
+        int hour = 0;
+        int minute = 0;
+        int second = 0;
+        size_t pos = 0;
+        for (size_t i = 0; i < items_.size(); i += 2) {
+            const char kind = items_[i];
+            const char item = items_[i + 1];
+            if (pos == value.size()) {
+                for (size_t rest = i; rest < items_.size(); rest += 2) {
+                    if (items_[rest] == kField) {
+                        return Status::Truncated;
+                    }
+                }
+                return Status::Unsupported;
+            }
+            if (kind == kLiteral) {
+                if (value[pos] != item) {
+                    return Status::Unsupported;
+                }
+                ++pos;
+                continue;
+            }
+            const size_t width = item == 'Y' ? 4 : 2;
+            int parsed = 0;
+            if (!read_digits(value, pos, width, parsed)) {
+                return Status::Unsupported;
+            }
+            pos += width;
+            switch (item) {
+                case 'Y': year = parsed; break;
+                case 'm': month = parsed; break;
+                case 'd':
+                    if (parsed < 1) {
+                        return Status::Unsupported;
+                    }
+                    day = parsed;
+                    break;
+                case 'H': hour = parsed; break;
+                case 'M': minute = parsed; break;
+                default: second = parsed; break;
+            }
+        }
+        if (month < 1 || month > 12 || day > 31 || hour > 23 || minute > 59 || second > 59) {
+            return Status::Unsupported;
+        }
+        const int64_t seconds = days_from_civil(year, month, day) * 86'400 +
+                                hour * 3'600 + minute * 60 + second;
+        // timegm reports -1 as an error; leave that instant to the general parser.
+        if (seconds == -1) {
+            return Status::Unsupported;
+        }
+        microseconds = seconds * 1'000'000;
+        return Status::Parsed;
+    }
+
+    std::string_view trim_csv_field(std::string_view field) {
+        while (!field.empty() && is_field_padding(field.front())) {
+            field.remove_prefix(1);
+        }
+        while (!field.empty() && is_field_padding(field.back())) {
+            field.remove_suffix(1);
+        }
+        return field;
+    }
+
+    double parse_csv_double(const std::string_view field) {
+        const auto text = skip_leading_space(field);
+        double value = 0.0;
+        const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+        // Hex input parses as "0" here but as hex in std::stod.
+        if (ec == std::errc{} && (ptr == text.data() + text.size() || (*ptr != 'x' && *ptr != 'X'))) {
+            return value;
+        }
+        return std::stod(std::string(field));
+    }
+
+    uint64_t parse_csv_uint64(const std::string_view field) {
+        const auto text = skip_leading_space(field);
+        uint64_t value = 0;
+        if (const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+            ec == std::errc{}) {
+            return value;
+        }
+        return std::stoull(std::string(field));
+    }
+
+    void split_csv_line(const std::string_view line, const char delimiter,
+                        std::vector<std::string_view>& fields, const bool keep_trailing_empty) {
+        fields.clear();
+        size_t start = 0;
+        while (true) {
+            const auto next = line.find(delimiter, start);
+            if (next == std::string_view::npos) {
+                if (keep_trailing_empty || start < line.size()) {
+                    fields.push_back(line.substr(start));
+                }
+                return;
+            }
+            fields.push_back(line.substr(start, next - start));
+            start = next + 1;
+        }
+    }
+
+    std::vector<std::string_view> split_csv_chunks(const std::string_view text, const size_t max_chunks,
+                                                   const size_t min_chunk_bytes) {
+        std::vector<std::string_view> chunks;
+        if (text.empty()) {
+            return chunks;
+        }
+        const size_t target = std::max({text.size() / std::max<size_t>(max_chunks, 1),
+                                        min_chunk_bytes, size_t{1}});
+        size_t start = 0;
+        while (start < text.size()) {
+            size_t end = start + target;
+            if (end >= text.size()) {
+                end = text.size();
+            } else {
+                const auto newline = text.find('\n', end - 1);
+                end = newline == std::string_view::npos ? text.size() : newline + 1;
+            }
+            chunks.push_back(text.substr(start, end - start));
+            start = end;
+        }
+        return chunks;
+    }
+
+    size_t csv_parse_threads(const int requested) {
+        if (requested > 0) {
+            return static_cast<size_t>(requested);
+        }
+        const unsigned hardware = std::thread::hardware_concurrency();
+        return hardware > 0 ? hardware : 1;
+    }
+}  // namespace regimeflow::data
@@ -1,6 +1,8 @@
 #include "regimeflow/data/csv_reader.h"
 
 #include "regimeflow/common/time.h"
+#include "regimeflow/data/csv_cache.h"
+#include "regimeflow/data/csv_parser.h"
 #include "regimeflow/data/merged_iterator.h"
 #include "regimeflow/data/validation_utils.h"
 
@@ -106,6 +108,64 @@ namespace regimeflow::data
             }
         }
 
+        // Why a row could not be turned into a bar; reported during validation.
+        enum class RowError : uint8_t {
+            None,
+            MissingColumns,
+            Timestamp,
+            Value
+        };
+
+        struct ParsedBarRow {
+            Bar bar;
+            std::string_view symbol;
+            RowError error = RowError::None;
+            std::string message;
+        };
+
+        // Fixed-format fast path, falling back to the strftime-style parser
+        // for anything it does not handle.
+        std::optional<Timestamp> parse_row_timestamp(const std::string_view value,
+                                                     const FixedTimestampFormat& datetime,
+                                                     const FixedTimestampFormat& date,
+                                                     const CSVDataSource::Config& config) {
+            int64_t us = 0;
+            const auto status = datetime.parse(value, us);
+            if (status == FixedTimestampFormat::Status::Parsed ||
+                (status == FixedTimestampFormat::Status::Truncated &&
+                 date.parse(value, us) == FixedTimestampFormat::Status::Parsed)) {
+                return Timestamp(us);
+            }
+            const std::string text(value);
+            try {
+                return Timestamp::from_string(text, config.datetime_format);
+            } catch (const std::exception&) {
+                try {
+                    return Timestamp::from_string(text, config.date_format);
+                } catch (const std::exception&) {
+                    return std::nullopt;
+                }
+            }
+        }
+
+        // Settings the cached rows of a bar file depend on.
+        std::string parse_fingerprint(const CSVDataSource::Config& config) {
+            std::string out = "bars-v1;";
+            out += config.delimiter;
+            out += config.has_header ? "h;" : "n;";
+            out += config.date_format + ';' + config.datetime_format + ';';
+            for (const auto& [name, index] : config.column_mapping) {
+                out += name + '=' + std::to_string(index) + ',';
+            }
+            out += ';';
+            for (const auto& [alias, name] : config.column_aliases) {
+                out += alias + '=' + name + ',';
+            }
+            out += ';' + std::to_string(config.utc_offset_seconds) + ';';
+            append_cache_fingerprint(out, config.validation);
+            return out;
+        }
+
         struct RunningStats {
             size_t count = 0;
             double mean = 0.0;
@@ -331,7 +391,9 @@ namespace regimeflow::data
 
     }  // namespace
 
-    CSVDataSource::CSVDataSource(const Config& config) : config_(config) {
+    CSVDataSource::CSVDataSource(const Config& config)
+        : config_(config), cache_(config.cache_directory) {
+        cache_fingerprint_ = parse_fingerprint(config_);
         scan_directory();
     }
 
@@ -509,23 +571,65 @@ namespace regimeflow::data
         return mapping;
     }
 
-    std::vector<Bar> CSVDataSource::parse_bars(SymbolId symbol, const std::string& path,
-                                               TimeRange range, BarType bar_type) const {
-        std::ifstream file(path);
-        if (!file) {
+    std::string CSVDataSource::cache_entry(const std::string& path) const {
+        // Reports, per-row symbols, wall-clock checks and gap fills depend on
+        // more than the cached rows, so those settings always re-parse.
+        if (path.empty() || config_.collect_validation_report || config_.allow_symbol_column ||
+            config_.validation.check_future_timestamps ||
+            (config_.validation.check_gap && config_.validation.on_gap == ValidationAction::Fill)) {
+            return {};
+        }
+        return cache_.entry_path(path, cache_fingerprint_, ".rfb");
+    }
+
+    std::vector<Bar> CSVDataSource::parse_bars(const SymbolId symbol, const std::string& path,
+                                               const TimeRange range, const BarType bar_type) const {
+        // Cache entries hold every validated row, so one entry serves any
+        // range; adjustment and filling are applied per query.
+        const std::string entry = cache_entry(path);
+        std::vector<Bar> bars;
+        bool fill_on_gap = false;
+        if (!entry.empty() && CsvCache::load_bars(entry, symbol, range, bars)) {
+            last_report_ = ValidationReport();
+        } else {
+            bars = read_bars(symbol, path, fill_on_gap);
+            if (!entry.empty()) {
+                CsvCache::store_bars(entry, bars);
+            }
+            if (range.start.microseconds() != 0 || range.end.microseconds() != 0) {
+                std::erase_if(bars, [&](const Bar& bar) { return !range.contains(bar.timestamp); });
+            }
+        }
+        adjuster_.adjust_bars(symbol, bars);
+
+        if (config_.fill_missing_bars || fill_on_gap) {
+            if (auto interval = bar_interval_for(bar_type); interval.has_value()) {
+                return fill_missing_time_bars(bars, *interval);
+            }
+        }
+        return bars;
+    }
+
+    std::vector<Bar> CSVDataSource::read_bars(const SymbolId symbol, const std::string& path,
+                                              bool& fill_on_gap) const {
+        fill_on_gap = false;
+        const MappedTextFile file(path);
+        if (!file.is_open()) {
             return {};
         }
 
         last_report_ = ValidationReport();
-        std::string line;
+        std::string_view body = file.text();
         std::map<std::string, int> col = config_.column_mapping;
-        auto aliases = config_.column_aliases.empty() ? default_aliases() : config_.column_aliases;
         if (config_.has_header) {
-            if (!std::getline(file, line)) {
+            if (body.empty()) {
                 return {};
             }
+            const auto newline = body.find('\n');
+            const auto header = body.substr(0, newline);
+            body = newline == std::string_view::npos ? std::string_view{} : body.substr(newline + 1);
             if (col.empty()) {
-                col = resolve_mapping(line);
+                col = resolve_mapping(std::string(header));
             }
         }
         ensure_required_columns(col);
@@ -536,8 +640,51 @@ namespace regimeflow::data
         int close_col = col.contains("close") ? col["close"] : 4;
         int vol_col = col.contains("volume") ? col["volume"] : 5;
         int symbol_col = col.contains(config_.symbol_column) ? col[config_.symbol_column] : -1;
+        int max_col = std::max({ts_col, open_col, high_col, low_col, close_col, vol_col});
+        if (config_.allow_symbol_column && symbol_col >= 0) {
+            max_col = std::max(max_col, symbol_col);
+        }
+
+        // Rows are independent until validation, so they parse in parallel
+        // chunks; consume() then checks them in file order, one bounded
+        // window at a time.
+        const FixedTimestampFormat datetime_format(config_.datetime_format);
+        const FixedTimestampFormat date_format(config_.date_format);
+        const auto parse_line = [&](const std::string_view line, std::vector<std::string_view>& fields) {
+            ParsedBarRow row;
+            split_csv_line(line, config_.delimiter, fields);
+            if (static_cast<int>(fields.size()) <= max_col) {
+                row.error = RowError::MissingColumns;
+                return row;
+            }
+            const auto ts = parse_row_timestamp(fields[ts_col], datetime_format, date_format, config_);
+            if (!ts) {
+                row.error = RowError::Timestamp;
+                return row;
+            }
+            row.bar.timestamp = *ts;
+            if (config_.utc_offset_seconds != 0) {
+                row.bar.timestamp = row.bar.timestamp - Duration::seconds(config_.utc_offset_seconds);
+            }
+            try {
+                row.bar.open = parse_csv_double(fields[open_col]);
+                row.bar.high = parse_csv_double(fields[high_col]);
+                row.bar.low = parse_csv_double(fields[low_col]);
+                row.bar.close = parse_csv_double(fields[close_col]);
+                row.bar.volume = static_cast<Volume>(parse_csv_uint64(fields[vol_col]));
+            } catch (const std::exception& ex) {
+                row.error = RowError::Value;
+                row.message = ex.what();
+                return row;
+            }
+            if (config_.allow_symbol_column && symbol_col >= 0) {
+                row.symbol = fields[symbol_col];
+            }
+            return row;
+        };
 
         std::vector<Bar> bars;
+        bars.reserve(static_cast<size_t>(std::count(body.begin(), body.end(), '\n')) + 1);
         Timestamp last_ts;
         bool has_last_ts = false;
         double last_close = 0.0;
@@ -578,7 +725,6 @@ namespace regimeflow::data
             }
             return true;
         };
-        bool fill_on_gap = false;
         auto error_action = [&]() {
             auto action = config_.validation.on_error;
             if (action == ValidationAction::Continue || action == ValidationAction::Fill) {
@@ -587,38 +733,20 @@ namespace regimeflow::data
             return action;
         };
 
-        while (std::getline(file, line)) {
-            auto fields = split_line(line, config_.delimiter);
-            int max_col = std::max({ts_col, open_col, high_col, low_col, close_col, vol_col});
-            if (config_.allow_symbol_column && symbol_col >= 0) {
-                max_col = std::max(max_col, symbol_col);
-            }
-            if (static_cast<int>(fields.size()) <= max_col) {
-                if (!handle_issue(ValidationSeverity::Error, error_action(), "Missing columns")) {
+        auto consume = [&](const ParsedBarRow& row) {
+            if (row.error != RowError::None) {
+                const std::string message = row.error == RowError::MissingColumns
+                    ? std::string("Missing columns")
+                    : row.error == RowError::Timestamp
+                        ? "CSV parse error: invalid timestamp at line " + std::to_string(line_number)
+                        : row.message;
+                if (!handle_issue(ValidationSeverity::Error, error_action(), message)) {
                     ++line_number;
-                    continue;
-                }
-            }
-
-            Bar bar;
-            try {
-                bar.timestamp = parse_timestamp(fields[ts_col], config_.datetime_format,
-                                                config_.date_format, line_number);
-                if (config_.utc_offset_seconds != 0) {
-                    bar.timestamp = bar.timestamp - Duration::seconds(config_.utc_offset_seconds);
-                }
-                bar.open = std::stod(fields[open_col]);
-                bar.high = std::stod(fields[high_col]);
-                bar.low = std::stod(fields[low_col]);
-                bar.close = std::stod(fields[close_col]);
-                bar.volume = static_cast<Volume>(std::stoull(fields[vol_col]));
-            } catch (const std::exception& ex) {
-                if (!handle_issue(ValidationSeverity::Error, error_action(), ex.what())) {
-                    ++line_number;
-                    continue;
+                    return;
                 }
             }
 
+            Bar bar = row.bar;
             if (config_.validation.check_price_bounds) {
                 if (!std::isfinite(bar.open) || !std::isfinite(bar.high) ||
                     !std::isfinite(bar.low) || !std::isfinite(bar.close) ||
@@ -633,7 +761,7 @@ namespace regimeflow::data
                     if (!handle_issue(ValidationSeverity::Error, error_action(),
                                       "OHLC out of range")) {
                         ++line_number;
-                        continue;
+                        return;
                                       }
                      }
             }
@@ -643,7 +771,7 @@ namespace regimeflow::data
                 if (!handle_issue(ValidationSeverity::Error, error_action(),
                                   "Volume exceeds max_volume")) {
                     ++line_number;
-                    continue;
+                    return;
                                   }
                 }
 
@@ -652,7 +780,7 @@ namespace regimeflow::data
                     if (!handle_issue(ValidationSeverity::Error, error_action(),
                                       "Timestamp is in the future")) {
                         ++line_number;
-                        continue;
+                        return;
                                       }
                 }
             }
@@ -664,7 +792,7 @@ namespace regimeflow::data
                 if (!handle_issue(ValidationSeverity::Error, error_action(),
                                   "Timestamp outside trading hours")) {
                     ++line_number;
-                    continue;
+                    return;
                                   }
                                       }
 
@@ -673,7 +801,7 @@ namespace regimeflow::data
                 if (!handle_issue(ValidationSeverity::Error, error_action(),
                                   "Non-monotonic timestamp")) {
                     ++line_number;
-                    continue;
+                    return;
                                   }
                 }
 
@@ -686,7 +814,7 @@ namespace regimeflow::data
                     if (!handle_issue(ValidationSeverity::Warning, action,
                                       "Timestamp gap exceeds max_gap")) {
                         ++line_number;
-                        continue;
+                        return;
                                       }
                 }
             }
@@ -696,7 +824,7 @@ namespace regimeflow::data
                     if (!handle_issue(ValidationSeverity::Warning, config_.validation.on_warning,
                                       "Price jump exceeds max_jump_pct")) {
                         ++line_number;
-                        continue;
+                        return;
                                       }
                 }
             }
@@ -725,11 +853,11 @@ namespace regimeflow::data
                 }
 
             if (config_.allow_symbol_column && symbol_col >= 0) {
-                auto sym = trim(fields[symbol_col]);
+                const auto sym = trim_csv_field(row.symbol);
                 if (sym.empty()) {
                     if (!handle_issue(ValidationSeverity::Error, error_action(), "Empty symbol")) {
                         ++line_number;
-                        continue;
+                        return;
                     }
                 }
                 bar.symbol = SymbolRegistry::instance().intern(sym);
@@ -745,22 +873,10 @@ namespace regimeflow::data
                 volume_stats.push(static_cast<double>(bar.volume));
             }
 
-            if (range.start.microseconds() != 0 || range.end.microseconds() != 0) {
-                if (!range.contains(bar.timestamp)) {
-                    ++line_number;
-                    continue;
-                }
-            }
-
-            bars.push_back(adjuster_.adjust_bar(bar.symbol, bar));
+            bars.push_back(bar);
             ++line_number;
-        }
-
-        if (config_.fill_missing_bars || fill_on_gap) {
-            if (auto interval = bar_interval_for(bar_type); interval.has_value()) {
-                return fill_missing_time_bars(bars, *interval);
-            }
-        }
+        };
+        for_each_parsed_csv_row<ParsedBarRow>(body, csv_parse_threads(config_.parse_threads), parse_line, consume);
         return bars;
     }
 }  // namespace regimeflow::data
@@ -5,6 +5,8 @@
 #include "regimeflow/plugins/interfaces.h"
 #include "regimeflow/plugins/registry.h"
 
+#include <map>
+#include <mutex>
 #include <sstream>
 
 namespace regimeflow::data
@@ -24,6 +26,60 @@ namespace regimeflow::data
             return ValidationAction::Fail;
         }
 
+        // Settings shared by the mmap, mmap_ticks and mmap_books sources.
+        template <typename SourceConfig>
+        void parse_mmap_cache_config(const Config& cfg, SourceConfig& out) {
+            if (auto v = cfg.get_as<int64_t>("max_cached_files")) {
+                if (*v > 0) {
+                    out.max_cached_files = static_cast<size_t>(*v);
+                }
+            }
+            if (auto v = cfg.get_as<int64_t>("max_cached_ranges")) {
+                if (*v > 0) {
+                    out.max_cached_ranges = static_cast<size_t>(*v);
+                }
+            }
+            if (auto v = cfg.get_as<int64_t>("max_cached_range_bytes")) {
+                if (*v > 0) {
+                    out.max_cached_range_bytes = static_cast<size_t>(*v);
+                }
+            }
+            if (auto v = cfg.get_as<int64_t>("cache_shards")) {
+                if (*v > 0) {
+                    out.cache_shards = static_cast<size_t>(*v);
+                }
+            }
+            if (auto v = cfg.get_as<std::string>("cache_eviction")) {
+                out.cache_eviction = parse_cache_eviction(*v, out.cache_eviction);
+            }
+            if (auto v = cfg.get_as<std::string>("access_policy")) {
+                out.access_policy = parse_mmap_access_policy(*v, out.access_policy);
+            }
+            if (auto v = cfg.get_as<bool>("huge_pages")) out.huge_pages = *v;
+        }
+
+        // With `shared_cache`, every source of one type over the same
+        // directory (e.g. each run_parallel worker) uses one set of caches.
+        // The first source created sets the limits; the caches are released
+        // with the last source.
+        template <typename Source>
+        void attach_shared_caches(const Config& cfg, typename Source::Config& out) {
+            if (!cfg.get_as<bool>("shared_cache").value_or(false)) {
+                return;
+            }
+            using Caches = typename Source::Caches;
+            static std::mutex mutex;
+            static std::map<std::string, std::weak_ptr<Caches>> registry;
+            std::lock_guard lock(mutex);
+            auto& slot = registry[out.data_directory];
+            auto caches = slot.lock();
+            if (!caches) {
+                caches = Caches::create(out);
+                slot = caches;
+            }
+            out.shared_caches = std::move(caches);
+        }
+
         void parse_validation_config(const Config& cfg, ValidationConfig& out) {
             if (auto v = cfg.get_as<bool>("validation.require_monotonic_timestamps")) {
                 out.require_monotonic_timestamps = *v;
@@ -106,44 +162,29 @@ namespace regimeflow::data
             MemoryMappedDataSource::Config mmap_cfg;
             if (auto v = config.get_as<std::string>("data_directory")) mmap_cfg.data_directory = *v;
             if (auto v = config.get_as<bool>("preload_index")) mmap_cfg.preload_index = *v;
-            if (auto v = config.get_as<int64_t>("max_cached_files")) {
-                if (*v > 0) {
-                    mmap_cfg.max_cached_files = static_cast<size_t>(*v);
-                }
-            }
-            if (auto v = config.get_as<int64_t>("max_cached_ranges")) {
+            parse_mmap_cache_config(config, mmap_cfg);
+            if (auto v = config.get_as<int64_t>("prefetch_rows")) {
                 if (*v > 0) {
-                    mmap_cfg.max_cached_ranges = static_cast<size_t>(*v);
+                    mmap_cfg.prefetch_rows = static_cast<size_t>(*v);
                 }
             }
+            attach_shared_caches<MemoryMappedDataSource>(config, mmap_cfg);
             source = std::make_unique<MemoryMappedDataSource>(mmap_cfg);
+        } else if (type == "mmap_universe") {
+            UniverseMmapDataSource::Config universe_cfg;
+            if (auto v = config.get_as<std::string>("path")) universe_cfg.path = *v;
+            source = std::make_unique<UniverseMmapDataSource>(universe_cfg);
         } else if (type == "mmap_ticks") {
             TickMmapDataSource::Config tick_cfg;
             if (auto v = config.get_as<std::string>("data_directory")) tick_cfg.data_directory = *v;
-            if (auto v = config.get_as<int64_t>("max_cached_files")) {
-                if (*v > 0) {
-                    tick_cfg.max_cached_files = static_cast<size_t>(*v);
-                }
-            }
-            if (auto v = config.get_as<int64_t>("max_cached_ranges")) {
-                if (*v > 0) {
-                    tick_cfg.max_cached_ranges = static_cast<size_t>(*v);
-                }
-            }
+            parse_mmap_cache_config(config, tick_cfg);
+            attach_shared_caches<TickMmapDataSource>(config, tick_cfg);
             source = std::make_unique<TickMmapDataSource>(tick_cfg);
         } else if (type == "mmap_books") {
             OrderBookMmapDataSource::Config book_cfg;
             if (auto v = config.get_as<std::string>("data_directory")) book_cfg.data_directory = *v;
-            if (auto v = config.get_as<int64_t>("max_cached_files")) {
-                if (*v > 0) {
-                    book_cfg.max_cached_files = static_cast<size_t>(*v);
-                }
-            }
-            if (auto v = config.get_as<int64_t>("max_cached_ranges")) {
-                if (*v > 0) {
-                    book_cfg.max_cached_ranges = static_cast<size_t>(*v);
-                }
-            }
+            parse_mmap_cache_config(config, book_cfg);
+            attach_shared_caches<OrderBookMmapDataSource>(config, book_cfg);
             source = std::make_unique<OrderBookMmapDataSource>(book_cfg);
         } else if (type == "api") {
             ApiDataSource::Config api;
@@ -274,6 +315,8 @@ namespace regimeflow::data
             out.utc_offset_seconds = static_cast<int>(*v);
         }
         if (auto v = cfg.get_as<bool>("fill_missing_bars")) out.fill_missing_bars = *v;
+        if (auto v = cfg.get_as<int64_t>("parse_threads")) out.parse_threads = static_cast<int>(*v);
+        if (auto v = cfg.get_as<std::string>("cache_directory")) out.cache_directory = *v;
 
         parse_validation_config(cfg, out.validation);
 
@@ -291,6 +334,8 @@ namespace regimeflow::data
         if (auto v = cfg.get_as<int64_t>("utc_offset_seconds")) {
             out.utc_offset_seconds = static_cast<int>(*v);
         }
+        if (auto v = cfg.get_as<int64_t>("parse_threads")) out.parse_threads = static_cast<int>(*v);
+        if (auto v = cfg.get_as<std::string>("cache_directory")) out.cache_directory = *v;
 
         parse_validation_config(cfg, out.validation);
 
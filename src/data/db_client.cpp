@@ -5,6 +5,26 @@
 
 namespace regimeflow::data
 {
+    namespace {
+
+        // Last element of a bucket sorted by timestamp with timestamp <= ts.
+        template <typename T>
+        std::optional<T> last_at_or_before(const std::unordered_map<SymbolId, std::vector<T>>& buckets,
+                                           const SymbolId symbol, const Timestamp ts) {
+            const auto it = buckets.find(symbol);
+            if (it == buckets.end()) {
+                return std::nullopt;
+            }
+            const auto& bucket = it->second;
+            const auto pos = std::ranges::upper_bound(bucket, ts, {}, &T::timestamp);
+            if (pos == bucket.begin()) {
+                return std::nullopt;
+            }
+            return *(pos - 1);
+        }
+
+    }  // namespace
+
     void InMemoryDbClient::add_bars(const SymbolId symbol, std::vector<Bar> bars) {
         auto& bucket = bars_[symbol];
         bucket.insert(bucket.end(), std::make_move_iterator(bars.begin()),
@@ -125,4 +145,16 @@ namespace regimeflow::data
         }
         return result;
     }
+
+    std::optional<Bar> InMemoryDbClient::query_bar_as_of(const SymbolId symbol, const Timestamp ts, BarType) {
+        return last_at_or_before(bars_, symbol, ts);
+    }
+
+    std::optional<Tick> InMemoryDbClient::query_tick_as_of(const SymbolId symbol, const Timestamp ts) {
+        return last_at_or_before(ticks_, symbol, ts);
+    }
+
+    std::optional<OrderBook> InMemoryDbClient::query_order_book_as_of(const SymbolId symbol, const Timestamp ts) {
+        return last_at_or_before(books_, symbol, ts);
+    }
 }  // namespace regimeflow::data
@@ -6,11 +6,52 @@
 #include "regimeflow/data/symbol_metadata.h"
 #include "regimeflow/data/validation_utils.h"
 
+#include <limits>
 #include <stdexcept>
 #include <unordered_set>
 
 namespace regimeflow::data
 {
+    namespace {
+
+        // Warning actions under which validate_bars/validate_ticks keep the row.
+        bool keeps_row(const ValidationAction action) {
+            return action == ValidationAction::Continue || action == ValidationAction::Fill;
+        }
+
+        // True when validating only the latest row gives the same answer as
+        // validating the whole history: nothing fills rows in, and the checks
+        // that compare against earlier rows never drop one.
+        bool row_local_bars(const DatabaseDataSource::Config& config) {
+            const auto& validation = config.validation;
+            if (config.fill_missing_bars) {
+                return false;
+            }
+            if (validation.check_gap && validation.on_gap != ValidationAction::Continue) {
+                return false;
+            }
+            return !(validation.check_price_jump || validation.check_outliers) || keeps_row(validation.on_warning);
+        }
+
+        bool row_local_ticks(const ValidationConfig& validation) {
+            if (validation.check_gap && !keeps_row(validation.on_gap)) {
+                return false;
+            }
+            return !(validation.check_price_jump || validation.check_outliers) || keeps_row(validation.on_warning);
+        }
+
+        // The client only reports the row itself, so a result is known to
+        // hold from the row's time up to the probed time.
+        template <typename Row>
+        void store_probe(AsOfCache<Row>& cache, const uint64_t key, const std::optional<Row>& row,
+                         const int64_t probe) {
+            const int64_t from = row ? row->timestamp.microseconds() : std::numeric_limits<int64_t>::min();
+            const int64_t until = probe == std::numeric_limits<int64_t>::max() ? probe : probe + 1;
+            cache.store(key, from, until, row);
+        }
+
+    }  // namespace
+
     DatabaseDataSource::DatabaseDataSource(const Config& config) : config_(config) {
         if (config_.connection_string.empty()) {
             throw std::invalid_argument("Database connection_string is required");
@@ -30,10 +71,18 @@ namespace regimeflow::data
 
     void DatabaseDataSource::set_client(std::shared_ptr<DbClient> client) {
         client_ = std::move(client);
+        clear_as_of_caches();
     }
 
     void DatabaseDataSource::set_corporate_actions(const SymbolId symbol, std::vector<CorporateAction> actions) {
         adjuster_.add_actions(symbol, std::move(actions));
+        clear_as_of_caches();
+    }
+
+    void DatabaseDataSource::clear_as_of_caches() {
+        bar_as_of_.clear();
+        tick_as_of_.clear();
+        book_as_of_.clear();
     }
     std::vector<SymbolInfo> DatabaseDataSource::get_available_symbols() const {
         if (!client_) {
@@ -75,9 +124,7 @@ namespace regimeflow::data
         }
         const auto resolved = adjuster_.resolve_symbol(symbol, range.start);
         auto bars = client_->query_bars(resolved, range, bar_type);
-        for (auto& bar : bars) {
-            bar = adjuster_.adjust_bar(resolved, bar);
-        }
+        adjuster_.adjust_bars(resolved, bars);
         last_report_ = ValidationReport();
         return validate_bars(std::move(bars), bar_type, config_.validation, config_.fill_missing_bars,
                              config_.collect_validation_report, &last_report_);
@@ -102,6 +149,74 @@ namespace regimeflow::data
         return client_->query_order_books(resolved, range);
     }
 
+    std::optional<Bar> DatabaseDataSource::get_bar_as_of(const SymbolId symbol, const Timestamp ts,
+                                                         const BarType bar_type) {
+        if (!client_) {
+            throw std::runtime_error("Database client not configured");
+        }
+        const int64_t us = ts.microseconds();
+        const auto key = AsOfCache<Bar>::make_key(symbol, static_cast<uint8_t>(bar_type));
+        if (const auto* hit = bar_as_of_.lookup(key, us)) {
+            return hit->row;
+        }
+        if (!row_local_bars(config_)) {
+            return DataSource::get_bar_as_of(symbol, ts, bar_type);
+        }
+        const auto resolved = adjuster_.resolve_symbol(symbol, ts);
+        auto bar = client_->query_bar_as_of(resolved, ts, bar_type);
+        if (bar) {
+            last_report_ = ValidationReport();
+            auto kept = validate_bars({adjuster_.adjust_bar(resolved, *bar)}, bar_type, config_.validation,
+                                      false, config_.collect_validation_report, &last_report_);
+            if (kept.empty()) {
+                return DataSource::get_bar_as_of(symbol, ts, bar_type);
+            }
+            bar = kept.front();
+        }
+        store_probe(bar_as_of_, key, bar, us);
+        return bar;
+    }
+
+    std::optional<Tick> DatabaseDataSource::get_tick_as_of(const SymbolId symbol, const Timestamp ts) {
+        if (!client_) {
+            throw std::runtime_error("Database client not configured");
+        }
+        const int64_t us = ts.microseconds();
+        const auto key = AsOfCache<Tick>::make_key(symbol);
+        if (const auto* hit = tick_as_of_.lookup(key, us)) {
+            return hit->row;
+        }
+        if (!row_local_ticks(config_.validation)) {
+            return DataSource::get_tick_as_of(symbol, ts);
+        }
+        auto tick = client_->query_tick_as_of(adjuster_.resolve_symbol(symbol, ts), ts);
+        if (tick) {
+            last_report_ = ValidationReport();
+            auto kept = validate_ticks({*tick}, config_.validation, config_.collect_validation_report,
+                                       &last_report_);
+            if (kept.empty()) {
+                return DataSource::get_tick_as_of(symbol, ts);
+            }
+            tick = kept.front();
+        }
+        store_probe(tick_as_of_, key, tick, us);
+        return tick;
+    }
+
+    std::optional<OrderBook> DatabaseDataSource::get_order_book_as_of(const SymbolId symbol, const Timestamp ts) {
+        if (!client_) {
+            throw std::runtime_error("Database client not configured");
+        }
+        const int64_t us = ts.microseconds();
+        const auto key = AsOfCache<OrderBook>::make_key(symbol);
+        if (const auto* hit = book_as_of_.lookup(key, us)) {
+            return hit->row;
+        }
+        auto book = client_->query_order_book_as_of(adjuster_.resolve_symbol(symbol, ts), ts);
+        store_probe(book_as_of_, key, book, us);
+        return book;
+    }
+
     std::unique_ptr<DataIterator> DatabaseDataSource::create_iterator(
         const std::vector<SymbolId>& symbols, const TimeRange range, const BarType bar_type) {
         if (!client_) {
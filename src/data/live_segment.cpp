@@ -0,0 +1,563 @@
+#include "regimeflow/data/live_segment.h"
+
+#include "regimeflow/data/column_spill.h"
+#include "regimeflow/data/mmap_writer.h"
+#include "regimeflow/data/order_book_mmap.h"
+#include "regimeflow/data/tick_mmap.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <span>
+
+#if defined(_WIN32)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace regimeflow::data
+{
+    namespace {
+
+        constexpr char kMagic[8] = {'R', 'G', 'M', 'L', 'I', 'V', 'E', '1'};
+        constexpr uint32_t kFileVersion = 1;
+        constexpr size_t kLevels = 10;
+
+#pragma pack(push, 1)
+        struct TickRecord {
+            int64_t timestamp;
+            double price;
+            double quantity;
+            uint32_t flags;
+            uint32_t reserved;
+        };
+
+        struct QuoteRecord {
+            int64_t timestamp;
+            double bid;
+            double ask;
+            double bid_size;
+            double ask_size;
+        };
+
+        struct BarRecord {
+            int64_t timestamp;
+            double open;
+            double high;
+            double low;
+            double close;
+            uint64_t volume;
+            uint64_t trade_count;
+            double vwap;
+        };
+
+        struct LevelRecord {
+            double price;
+            double quantity;
+            int64_t num_orders;
+        };
+
+        struct BookRecord {
+            int64_t timestamp;
+            LevelRecord bids[kLevels];
+            LevelRecord asks[kLevels];
+        };
+#pragma pack(pop)
+
+        uint32_t record_size(const LiveRecordKind kind) {
+            switch (kind) {
+            case LiveRecordKind::Tick: return sizeof(TickRecord);
+            case LiveRecordKind::Quote: return sizeof(QuoteRecord);
+            case LiveRecordKind::Bar: return sizeof(BarRecord);
+            case LiveRecordKind::Book: return sizeof(BookRecord);
+            }
+            return 0;
+        }
+
+        // FNV-1a over the slot fields; an all-zero slot never validates.
+        uint64_t commit_checksum(const LiveSegmentCommit& commit) {
+            uint64_t hash = 1469598103934665603ULL;
+            const auto* bytes = reinterpret_cast<const unsigned char*>(&commit);
+            for (size_t i = 0; i < offsetof(LiveSegmentCommit, checksum); ++i) {
+                hash ^= bytes[i];
+                hash *= 1099511628211ULL;
+            }
+            return hash;
+        }
+
+        const LiveSegmentCommit* latest_commit(const LiveSegmentHeader& header) {
+            const LiveSegmentCommit* best = nullptr;
+            for (const auto& commit : header.commits) {
+                if (commit.checksum != commit_checksum(commit)) {
+                    continue;
+                }
+                if (!best || commit.sequence > best->sequence) {
+                    best = &commit;
+                }
+            }
+            return best;
+        }
+
+        bool sync_file(std::FILE* file) {
+            if (std::fflush(file) != 0) {
+                return false;
+            }
+#if defined(_WIN32)
+            return _commit(_fileno(file)) == 0;
+#else
+            return ::fsync(::fileno(file)) == 0;
+#endif
+        }
+
+        size_t commit_slot(const LiveSegmentCommit& commit) {
+            return offsetof(LiveSegmentHeader, commits) + (commit.sequence % 2) * sizeof(LiveSegmentCommit);
+        }
+
+        std::string bar_type_suffix(const BarType type) {
+            switch (type) {
+            case BarType::Time_1Min: return "1m";
+            case BarType::Time_5Min: return "5m";
+            case BarType::Time_15Min: return "15m";
+            case BarType::Time_30Min: return "30m";
+            case BarType::Time_1Hour: return "1h";
+            case BarType::Time_4Hour: return "4h";
+            case BarType::Time_1Day: return "1d";
+            case BarType::Volume: return "volume";
+            case BarType::Tick: return "tick";
+            case BarType::Dollar: return "dollar";
+            }
+            return "1d";
+        }
+
+        Result<void> invalid(const char* message) {
+            return Result<void>(Error(Error::Code::InvalidArgument, message));
+        }
+
+        template <typename Row, typename Writer>
+        Result<void> copy_segment(LiveSegmentReader& reader, Writer& writer) {
+            std::vector<Row> rows;
+            rows.reserve(kDefaultStreamRows);
+            while (true) {
+                rows.clear();
+                auto read = reader.read(rows, kDefaultStreamRows);
+                if (read.is_err()) {
+                    return Result<void>(read.error());
+                }
+                if (read.value() == 0) {
+                    return writer.finalize();
+                }
+                if (auto appended = writer.append(std::span<const Row>(rows)); appended.is_err()) {
+                    return appended;
+                }
+            }
+        }
+
+    }  // namespace
+
+    LiveSegmentWriter::~LiveSegmentWriter() {
+        if (file_) {
+            close();
+        }
+    }
+
+    Result<void> LiveSegmentWriter::open(const std::string& path, const LiveRecordKind kind,
+                                         const std::string& symbol, const int32_t date_yyyymmdd,
+                                         const BarType bar_type) {
+        if (file_) {
+            return Result<void>(Error(Error::Code::InvalidState, "Live segment already open"));
+        }
+        if (symbol.size() >= sizeof(header_.symbol)) {
+            return invalid("Live segment symbol is too long");
+        }
+        LiveSegmentHeader header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kFileVersion;
+        header.kind = static_cast<uint32_t>(kind);
+        std::memcpy(header.symbol, symbol.data(), symbol.size());
+        header.date_yyyymmdd = date_yyyymmdd;
+        header.record_size = record_size(kind);
+        header.bar_type = static_cast<uint32_t>(bar_type);
+
+        std::error_code ec;
+        const auto size = std::filesystem::file_size(path, ec);
+        if (!ec && size >= sizeof(LiveSegmentHeader)) {
+            // Resume: keep committed rows and drop any torn tail.
+            LiveSegmentHeader existing{};
+            {
+                std::ifstream in(path, std::ios::binary);
+                in.read(reinterpret_cast<char*>(&existing), sizeof(existing));
+                if (in.gcount() != static_cast<std::streamsize>(sizeof(existing)) ||
+                    std::memcmp(existing.magic, kMagic, sizeof(kMagic)) != 0) {
+                    return Result<void>(Error(Error::Code::InvalidState, "File is not a live segment"));
+                }
+            }
+            if (existing.kind != header.kind || existing.date_yyyymmdd != date_yyyymmdd ||
+                existing.record_size != header.record_size ||
+                std::memcmp(existing.symbol, header.symbol, sizeof(header.symbol)) != 0) {
+                return Result<void>(Error(Error::Code::AlreadyExists,
+                                          "Live segment belongs to another stream"));
+            }
+            const auto* commit = latest_commit(existing);
+            if (!commit) {
+                return Result<void>(Error(Error::Code::InvalidState, "Live segment has no valid commit"));
+            }
+            std::filesystem::resize_file(path, sizeof(LiveSegmentHeader) +
+                                                   commit->record_count * existing.record_size, ec);
+            if (ec) {
+                return Result<void>(Error(Error::Code::IoError, "Unable to truncate live segment"));
+            }
+            file_ = std::fopen(path.c_str(), "r+b");
+            if (!file_ || std::fseek(file_, 0, SEEK_END) != 0) {
+                if (file_) {
+                    std::fclose(file_);
+                    file_ = nullptr;
+                }
+                return Result<void>(Error(Error::Code::IoError, "Unable to open live segment"));
+            }
+            header_ = existing;
+            count_ = committed_ = commit->record_count;
+            sequence_ = commit->sequence;
+            start_timestamp_ = commit->start_timestamp;
+            last_timestamp_ = commit->end_timestamp;
+            path_ = path;
+            return Ok();
+        }
+
+        file_ = std::fopen(path.c_str(), "w+b");
+        if (!file_) {
+            return Result<void>(Error(Error::Code::IoError, "Unable to open live segment"));
+        }
+        header.commits[0].checksum = commit_checksum(header.commits[0]);
+        if (std::fwrite(&header, sizeof(header), 1, file_) != 1 || !sync_file(file_)) {
+            std::fclose(file_);
+            file_ = nullptr;
+            return Result<void>(Error(Error::Code::IoError, "Unable to write live segment header"));
+        }
+        header_ = header;
+        count_ = committed_ = 0;
+        sequence_ = 0;
+        start_timestamp_ = last_timestamp_ = 0;
+        path_ = path;
+        return Ok();
+    }
+
+    Result<void> LiveSegmentWriter::check_next(const LiveRecordKind kind, const Timestamp timestamp) const {
+        if (!file_) {
+            return Result<void>(Error(Error::Code::InvalidState, "Live segment not open"));
+        }
+        if (static_cast<LiveRecordKind>(header_.kind) != kind) {
+            return invalid("Record kind does not match live segment");
+        }
+        if (timestamp.microseconds() <= 0) {
+            return invalid("Record timestamp must be positive");
+        }
+        if (count_ > 0 && timestamp.microseconds() < last_timestamp_) {
+            return invalid("Records must be appended in timestamp order");
+        }
+        return Ok();
+    }
+
+    Result<void> LiveSegmentWriter::write_record(const void* record, const Timestamp timestamp) {
+        if (std::fwrite(record, header_.record_size, 1, file_) != 1) {
+            return Result<void>(Error(Error::Code::IoError, "Unable to write live segment"));
+        }
+        if (count_ == 0) {
+            start_timestamp_ = timestamp.microseconds();
+        }
+        last_timestamp_ = timestamp.microseconds();
+        ++count_;
+        return Ok();
+    }
+
+    Result<void> LiveSegmentWriter::append(const Tick& tick) {
+        if (auto check = check_next(LiveRecordKind::Tick, tick.timestamp); check.is_err()) {
+            return check;
+        }
+        if (!std::isfinite(tick.price) || tick.price <= 0) {
+            return invalid("Tick price must be positive");
+        }
+        if (!std::isfinite(tick.quantity) || tick.quantity <= 0) {
+            return invalid("Tick quantity must be positive");
+        }
+        const TickRecord record{tick.timestamp.microseconds(), tick.price, tick.quantity, tick.flags, 0};
+        return write_record(&record, tick.timestamp);
+    }
+
+    Result<void> LiveSegmentWriter::append(const Quote& quote) {
+        if (auto check = check_next(LiveRecordKind::Quote, quote.timestamp); check.is_err()) {
+            return check;
+        }
+        if (!std::isfinite(quote.bid) || !std::isfinite(quote.ask) || !std::isfinite(quote.bid_size) ||
+            !std::isfinite(quote.ask_size)) {
+            return invalid("Quote values must be finite");
+        }
+        const QuoteRecord record{quote.timestamp.microseconds(), quote.bid, quote.ask, quote.bid_size,
+                                 quote.ask_size};
+        return write_record(&record, quote.timestamp);
+    }
+
+    Result<void> LiveSegmentWriter::append(const Bar& bar) {
+        if (auto check = check_next(LiveRecordKind::Bar, bar.timestamp); check.is_err()) {
+            return check;
+        }
+        if (auto check = MmapWriter::validate_bars({bar}); check.is_err()) {
+            return check;
+        }
+        const BarRecord record{bar.timestamp.microseconds(), bar.open, bar.high, bar.low, bar.close,
+                               bar.volume, bar.trade_count, bar.vwap};
+        return write_record(&record, bar.timestamp);
+    }
+
+    Result<void> LiveSegmentWriter::append(const OrderBook& book) {
+        if (auto check = check_next(LiveRecordKind::Book, book.timestamp); check.is_err()) {
+            return check;
+        }
+        BookRecord record{};
+        record.timestamp = book.timestamp.microseconds();
+        for (size_t level = 0; level < kLevels; ++level) {
+            record.bids[level] = {book.bids[level].price, book.bids[level].quantity, book.bids[level].num_orders};
+            record.asks[level] = {book.asks[level].price, book.asks[level].quantity, book.asks[level].num_orders};
+        }
+        return write_record(&record, book.timestamp);
+    }
+
+    Result<void> LiveSegmentWriter::commit() {
+        auto commit = prepare_commit();
+        if (commit.is_err()) {
+            return Result<void>(commit.error());
+        }
+        return finish_commit(commit.value());
+    }
+
+    Result<LiveSegmentCommit> LiveSegmentWriter::prepare_commit() {
+        if (!file_) {
+            return Result<LiveSegmentCommit>(Error(Error::Code::InvalidState, "Live segment not open"));
+        }
+        LiveSegmentCommit commit{};
+        commit.sequence = sequence_ + 1;
+        commit.record_count = count_;
+        commit.start_timestamp = start_timestamp_;
+        commit.end_timestamp = last_timestamp_;
+        commit.checksum = commit_checksum(commit);
+        if (count_ == committed_) {
+            return Result<LiveSegmentCommit>(commit);
+        }
+#if defined(_WIN32)
+        // Rows reach the disk before the header slot that counts them.
+        if (!sync_file(file_)) {
+            return Result<LiveSegmentCommit>(Error(Error::Code::IoError, "Unable to sync live segment"));
+        }
+        if (std::fseek(file_, static_cast<long>(commit_slot(commit)), SEEK_SET) != 0 ||
+            std::fwrite(&commit, sizeof(commit), 1, file_) != 1 || !sync_file(file_) ||
+            std::fseek(file_, 0, SEEK_END) != 0) {
+            return Result<LiveSegmentCommit>(Error(Error::Code::IoError, "Unable to commit live segment"));
+        }
+#else
+        // Hand the rows to the kernel; finish_commit() syncs them by descriptor.
+        if (std::fflush(file_) != 0) {
+            return Result<LiveSegmentCommit>(Error(Error::Code::IoError, "Unable to flush live segment"));
+        }
+#endif
+        return Result<LiveSegmentCommit>(commit);
+    }
+
+    Result<void> LiveSegmentWriter::finish_commit(const LiveSegmentCommit& commit) {
+        if (!file_) {
+            return Result<void>(Error(Error::Code::InvalidState, "Live segment not open"));
+        }
+        if (commit.record_count == committed_) {
+            return Ok();
+        }
+#if !defined(_WIN32)
+        // Rows reach the disk before the header slot that counts them. The
+        // slot is written by position, so the stream's append offset and
+        // any rows buffered since prepare_commit() are left alone.
+        const int fd = ::fileno(file_);
+        if (::fsync(fd) != 0) {
+            return Result<void>(Error(Error::Code::IoError, "Unable to sync live segment"));
+        }
+        if (::pwrite(fd, &commit, sizeof(commit), static_cast<off_t>(commit_slot(commit))) !=
+                static_cast<ssize_t>(sizeof(commit)) ||
+            ::fsync(fd) != 0) {
+            return Result<void>(Error(Error::Code::IoError, "Unable to commit live segment"));
+        }
+#endif
+        header_.commits[commit.sequence % 2] = commit;
+        sequence_ = commit.sequence;
+        committed_ = commit.record_count;
+        return Ok();
+    }
+
+    Result<void> LiveSegmentWriter::close() {
+        if (!file_) {
+            return Ok();
+        }
+        auto result = commit();
+        std::fclose(file_);
+        file_ = nullptr;
+        return result;
+    }
+
+    Result<void> LiveSegmentReader::open(const std::string& path) {
+        in_.open(path, std::ios::binary);
+        if (!in_) {
+            return Result<void>(Error(Error::Code::NotFound, "Unable to open live segment"));
+        }
+        in_.read(reinterpret_cast<char*>(&header_), sizeof(header_));
+        if (in_.gcount() != static_cast<std::streamsize>(sizeof(header_)) ||
+            std::memcmp(header_.magic, kMagic, sizeof(kMagic)) != 0 || header_.version != kFileVersion ||
+            header_.record_size != record_size(kind())) {
+            return Result<void>(Error(Error::Code::ParseError, "File is not a live segment"));
+        }
+        symbol_id_ = SymbolRegistry::instance().intern(symbol());
+        committed_ = 0;
+        cursor_ = 0;
+        refresh();
+        return Ok();
+    }
+
+    uint64_t LiveSegmentReader::refresh() {
+        LiveSegmentHeader header{};
+        in_.clear();
+        in_.seekg(0);
+        in_.read(reinterpret_cast<char*>(&header), sizeof(header));
+        if (in_.gcount() == static_cast<std::streamsize>(sizeof(header))) {
+            if (const auto* commit = latest_commit(header); commit && commit->record_count >= committed_) {
+                committed_ = commit->record_count;
+            }
+        }
+        return committed_;
+    }
+
+    std::string LiveSegmentReader::symbol() const {
+        const auto* end = std::find(header_.symbol, header_.symbol + sizeof(header_.symbol), '\0');
+        return std::string(header_.symbol, end);
+    }
+
+    template <typename Row, typename Record, typename Decode>
+    Result<size_t> LiveSegmentReader::read_rows(const LiveRecordKind kind, std::vector<Row>& out,
+                                                const size_t max_records, Decode&& decode) {
+        if (this->kind() != kind) {
+            return Result<size_t>(Error(Error::Code::InvalidArgument, "Record kind does not match live segment"));
+        }
+        const size_t count = static_cast<size_t>(std::min<uint64_t>(committed_ - cursor_, max_records));
+        if (count == 0) {
+            return Result<size_t>(size_t{0});
+        }
+        std::vector<Record> records(count);
+        in_.clear();
+        in_.seekg(static_cast<std::streamoff>(sizeof(LiveSegmentHeader) + cursor_ * sizeof(Record)));
+        in_.read(reinterpret_cast<char*>(records.data()), static_cast<std::streamsize>(count * sizeof(Record)));
+        if (in_.gcount() != static_cast<std::streamsize>(count * sizeof(Record))) {
+            return Result<size_t>(Error(Error::Code::IoError, "Live segment is shorter than its commit"));
+        }
+        out.reserve(out.size() + count);
+        for (const auto& record : records) {
+            out.push_back(decode(record));
+        }
+        cursor_ += count;
+        return Result<size_t>(count);
+    }
+
+    Result<size_t> LiveSegmentReader::read(std::vector<Tick>& out, const size_t max_records) {
+        return read_rows<Tick, TickRecord>(LiveRecordKind::Tick, out, max_records, [&](const TickRecord& r) {
+            Tick tick;
+            tick.timestamp = Timestamp(r.timestamp);
+            tick.symbol = symbol_id_;
+            tick.price = r.price;
+            tick.quantity = r.quantity;
+            tick.flags = static_cast<uint8_t>(r.flags);
+            return tick;
+        });
+    }
+
+    Result<size_t> LiveSegmentReader::read(std::vector<Quote>& out, const size_t max_records) {
+        return read_rows<Quote, QuoteRecord>(LiveRecordKind::Quote, out, max_records, [&](const QuoteRecord& r) {
+            Quote quote;
+            quote.timestamp = Timestamp(r.timestamp);
+            quote.symbol = symbol_id_;
+            quote.bid = r.bid;
+            quote.ask = r.ask;
+            quote.bid_size = r.bid_size;
+            quote.ask_size = r.ask_size;
+            return quote;
+        });
+    }
+
+    Result<size_t> LiveSegmentReader::read(std::vector<Bar>& out, const size_t max_records) {
+        return read_rows<Bar, BarRecord>(LiveRecordKind::Bar, out, max_records, [&](const BarRecord& r) {
+            Bar bar;
+            bar.timestamp = Timestamp(r.timestamp);
+            bar.symbol = symbol_id_;
+            bar.open = r.open;
+            bar.high = r.high;
+            bar.low = r.low;
+            bar.close = r.close;
+            bar.volume = r.volume;
+            bar.trade_count = r.trade_count;
+            bar.vwap = r.vwap;
+            return bar;
+        });
+    }
+
+    Result<size_t> LiveSegmentReader::read(std::vector<OrderBook>& out, const size_t max_records) {
+        return read_rows<OrderBook, BookRecord>(LiveRecordKind::Book, out, max_records, [&](const BookRecord& r) {
+            OrderBook book;
+            book.timestamp = Timestamp(r.timestamp);
+            book.symbol = symbol_id_;
+            for (size_t level = 0; level < kLevels; ++level) {
+                book.bids[level] = {r.bids[level].price, r.bids[level].quantity,
+                                    static_cast<int>(r.bids[level].num_orders)};
+                book.asks[level] = {r.asks[level].price, r.asks[level].quantity,
+                                    static_cast<int>(r.asks[level].num_orders)};
+            }
+            return book;
+        });
+    }
+
+    Result<std::string> seal_live_segment(const std::string& segment_path, const std::string& output_directory) {
+        LiveSegmentReader reader;
+        if (auto opened = reader.open(segment_path); opened.is_err()) {
+            return Result<std::string>(opened.error());
+        }
+        std::filesystem::path out = output_directory;
+        Result<void> result = Ok();
+        switch (reader.kind()) {
+        case LiveRecordKind::Tick: {
+            out /= reader.symbol() + ".rft";
+            TickMmapWriter writer;
+            result = writer.open(out.string(), reader.symbol());
+            if (result.is_ok()) {
+                result = copy_segment<Tick>(reader, writer);
+            }
+            break;
+        }
+        case LiveRecordKind::Bar: {
+            out /= reader.symbol() + "_" + bar_type_suffix(reader.bar_type()) + ".rfb";
+            MmapWriter writer;
+            result = writer.open(out.string(), reader.symbol(), reader.bar_type());
+            if (result.is_ok()) {
+                result = copy_segment<Bar>(reader, writer);
+            }
+            break;
+        }
+        case LiveRecordKind::Book: {
+            out /= reader.symbol() + ".rfob";
+            OrderBookMmapWriter writer;
+            result = writer.open(out.string(), reader.symbol());
+            if (result.is_ok()) {
+                result = copy_segment<OrderBook>(reader, writer);
+            }
+            break;
+        }
+        case LiveRecordKind::Quote:
+            return Result<std::string>(Error(Error::Code::InvalidArgument, "Quote segments have no mmap format"));
+        }
+        if (result.is_err()) {
+            return Result<std::string>(result.error());
+        }
+        return Result<std::string>(out.string());
+    }
+}  // namespace regimeflow::data
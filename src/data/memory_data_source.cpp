@@ -2,11 +2,33 @@
 
 #include "regimeflow/data/merged_iterator.h"
 
+#include <algorithm>
 #include <stdexcept>
 #include <unordered_set>
 
 namespace regimeflow::data
 {
+    namespace {
+
+        std::pair<size_t, size_t> find_window(const std::vector<int64_t>& timestamps, const TimeRange range) {
+            if (range.start.microseconds() == 0 && range.end.microseconds() == 0) {
+                return {0, timestamps.size()};
+            }
+            const auto begin = std::ranges::lower_bound(timestamps, range.start.microseconds());
+            const auto end = std::upper_bound(begin, timestamps.end(), range.end.microseconds());
+            return {static_cast<size_t>(begin - timestamps.begin()),
+                    static_cast<size_t>(end - timestamps.begin())};
+        }
+
+        template <typename Row>
+        void sort_by_time(std::vector<Row>& rows) {
+            std::ranges::stable_sort(rows, [](const Row& a, const Row& b) {
+                return a.timestamp < b.timestamp;
+            });
+        }
+
+    }  // namespace
+
     VectorBarIterator::VectorBarIterator(std::vector<Bar> bars) : bars_(std::move(bars)) {
         std::ranges::sort(bars_, [](const Bar& a, const Bar& b) {
             if (a.timestamp == b.timestamp) {
@@ -27,6 +49,13 @@ namespace regimeflow::data
         return bars_[index_++];
     }
 
+    size_t VectorBarIterator::next_batch(const std::span<Bar> out) {
+        const size_t count = std::min(out.size(), bars_.size() - index_);
+        std::copy_n(bars_.begin() + static_cast<std::ptrdiff_t>(index_), count, out.begin());
+        index_ += count;
+        return count;
+    }
+
     void VectorBarIterator::reset() {
         index_ = 0;
     }
@@ -52,6 +81,13 @@ namespace regimeflow::data
         return books_[index_++];
     }
 
+    size_t VectorOrderBookIterator::next_batch(const std::span<OrderBook> out) {
+        const size_t count = std::min(out.size(), books_.size() - index_);
+        std::copy_n(books_.begin() + static_cast<std::ptrdiff_t>(index_), count, out.begin());
+        index_ += count;
+        return count;
+    }
+
     void VectorOrderBookIterator::reset() {
         index_ = 0;
     }
@@ -76,35 +112,249 @@ namespace regimeflow::data
         return ticks_[index_++];
     }
 
+    size_t VectorTickIterator::next_batch(const std::span<Tick> out) {
+        const size_t count = std::min(out.size(), ticks_.size() - index_);
+        std::copy_n(ticks_.begin() + static_cast<std::ptrdiff_t>(index_), count, out.begin());
+        index_ += count;
+        return count;
+    }
+
     void VectorTickIterator::reset() {
         index_ = 0;
     }
 
+    std::shared_ptr<const BarColumns> BarColumns::from_bars(const SymbolId symbol, const std::vector<Bar>& bars) {
+        auto columns = std::make_shared<BarColumns>();
+        columns->symbol = symbol;
+        const size_t count = bars.size();
+        columns->timestamps.resize(count);
+        columns->opens.resize(count);
+        columns->highs.resize(count);
+        columns->lows.resize(count);
+        columns->closes.resize(count);
+        columns->volumes.resize(count);
+        columns->trade_counts.resize(count);
+        columns->vwaps.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            const auto& bar = bars[i];
+            columns->timestamps[i] = bar.timestamp.microseconds();
+            columns->opens[i] = bar.open;
+            columns->highs[i] = bar.high;
+            columns->lows[i] = bar.low;
+            columns->closes[i] = bar.close;
+            columns->volumes[i] = bar.volume;
+            columns->trade_counts[i] = bar.trade_count;
+            columns->vwaps[i] = bar.vwap;
+        }
+        return columns;
+    }
+
+    Bar BarColumns::bar(const size_t index) const {
+        Bar bar;
+        bar.timestamp = Timestamp(timestamps[index]);
+        bar.symbol = symbol;
+        bar.open = opens[index];
+        bar.high = highs[index];
+        bar.low = lows[index];
+        bar.close = closes[index];
+        bar.volume = volumes[index];
+        bar.trade_count = trade_counts[index];
+        bar.vwap = vwaps[index];
+        return bar;
+    }
+
+    std::pair<size_t, size_t> BarColumns::find_range(const TimeRange range) const {
+        return find_window(timestamps, range);
+    }
+
+    std::shared_ptr<const TickColumns> TickColumns::from_ticks(const SymbolId symbol,
+                                                               const std::vector<Tick>& ticks) {
+        auto columns = std::make_shared<TickColumns>();
+        columns->symbol = symbol;
+        const size_t count = ticks.size();
+        columns->timestamps.resize(count);
+        columns->prices.resize(count);
+        columns->quantities.resize(count);
+        columns->flags.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            const auto& tick = ticks[i];
+            columns->timestamps[i] = tick.timestamp.microseconds();
+            columns->prices[i] = tick.price;
+            columns->quantities[i] = tick.quantity;
+            columns->flags[i] = tick.flags;
+        }
+        return columns;
+    }
+
+    Tick TickColumns::tick(const size_t index) const {
+        Tick tick;
+        tick.timestamp = Timestamp(timestamps[index]);
+        tick.symbol = symbol;
+        tick.price = prices[index];
+        tick.quantity = quantities[index];
+        tick.flags = flags[index];
+        return tick;
+    }
+
+    std::pair<size_t, size_t> TickColumns::find_range(const TimeRange range) const {
+        return find_window(timestamps, range);
+    }
+
+    std::shared_ptr<const OrderBookSeries> OrderBookSeries::from_books(std::vector<OrderBook> books) {
+        auto series = std::make_shared<OrderBookSeries>();
+        series->timestamps.reserve(books.size());
+        for (const auto& book : books) {
+            series->timestamps.push_back(book.timestamp.microseconds());
+        }
+        series->books = std::move(books);
+        return series;
+    }
+
+    std::pair<size_t, size_t> OrderBookSeries::find_range(const TimeRange range) const {
+        return find_window(timestamps, range);
+    }
+
+    BarColumnsIterator::BarColumnsIterator(std::shared_ptr<const BarColumns> columns, const size_t begin,
+                                           const size_t end)
+        : columns_(std::move(columns)), begin_(begin), end_(end), index_(begin) {}
+
+    bool BarColumnsIterator::has_next() const {
+        return index_ < end_;
+    }
+
+    Bar BarColumnsIterator::next() {
+        if (!has_next()) {
+            throw std::out_of_range("No more bars");
+        }
+        return columns_->bar(index_++);
+    }
+
+    size_t BarColumnsIterator::next_batch(const std::span<Bar> out) {
+        const size_t count = std::min(out.size(), end_ - index_);
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = columns_->bar(index_ + i);
+        }
+        index_ += count;
+        return count;
+    }
+
+    void BarColumnsIterator::reset() {
+        index_ = begin_;
+    }
+
+    TickColumnsIterator::TickColumnsIterator(std::shared_ptr<const TickColumns> columns, const size_t begin,
+                                             const size_t end)
+        : columns_(std::move(columns)), begin_(begin), end_(end), index_(begin) {}
+
+    bool TickColumnsIterator::has_next() const {
+        return index_ < end_;
+    }
+
+    Tick TickColumnsIterator::next() {
+        if (!has_next()) {
+            throw std::out_of_range("No more ticks");
+        }
+        return columns_->tick(index_++);
+    }
+
+    size_t TickColumnsIterator::next_batch(const std::span<Tick> out) {
+        const size_t count = std::min(out.size(), end_ - index_);
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = columns_->tick(index_ + i);
+        }
+        index_ += count;
+        return count;
+    }
+
+    void TickColumnsIterator::reset() {
+        index_ = begin_;
+    }
+
+    OrderBookSeriesIterator::OrderBookSeriesIterator(std::shared_ptr<const OrderBookSeries> series,
+                                                     const size_t begin, const size_t end)
+        : series_(std::move(series)), begin_(begin), end_(end), index_(begin) {}
+
+    bool OrderBookSeriesIterator::has_next() const {
+        return index_ < end_;
+    }
+
+    OrderBook OrderBookSeriesIterator::next() {
+        if (!has_next()) {
+            throw std::out_of_range("No more order books");
+        }
+        return series_->books[index_++];
+    }
+
+    size_t OrderBookSeriesIterator::next_batch(const std::span<OrderBook> out) {
+        const size_t count = std::min(out.size(), end_ - index_);
+        std::copy_n(series_->books.begin() + static_cast<std::ptrdiff_t>(index_), count, out.begin());
+        index_ += count;
+        return count;
+    }
+
+    void OrderBookSeriesIterator::reset() {
+        index_ = begin_;
+    }
+
     void MemoryDataSource::add_bars(const SymbolId symbol, std::vector<Bar> bars) {
-        auto& bucket = bars_[symbol];
-        bucket.insert(bucket.end(), std::make_move_iterator(bars.begin()),
-                      std::make_move_iterator(bars.end()));
-        std::ranges::sort(bucket, [](const Bar& a, const Bar& b) {
-            return a.timestamp < b.timestamp;
-        });
+        // Series are immutable: merge into a fresh buffer and swap it in.
+        if (const auto it = bars_.find(symbol); it != bars_.end()) {
+            const auto& existing = *it->second;
+            std::vector<Bar> merged;
+            merged.reserve(existing.size() + bars.size());
+            for (size_t i = 0; i < existing.size(); ++i) {
+                merged.push_back(existing.bar(i));
+            }
+            merged.insert(merged.end(), bars.begin(), bars.end());
+            bars = std::move(merged);
+        }
+        sort_by_time(bars);
+        bars_[symbol] = BarColumns::from_bars(symbol, bars);
+        bar_as_of_.clear();
+    }
+
+    void MemoryDataSource::set_bar_columns(const SymbolId symbol, std::shared_ptr<const BarColumns> columns) {
+        bar_as_of_.clear();
+        if (!columns) {
+            bars_.erase(symbol);
+            return;
+        }
+        bars_[symbol] = std::move(columns);
+    }
+
+    std::shared_ptr<const BarColumns> MemoryDataSource::bar_columns(const SymbolId symbol) const {
+        const auto it = bars_.find(symbol);
+        return it == bars_.end() ? nullptr : it->second;
     }
 
     void MemoryDataSource::add_ticks(const SymbolId symbol, std::vector<Tick> ticks) {
-        auto& bucket = ticks_[symbol];
-        bucket.insert(bucket.end(), std::make_move_iterator(ticks.begin()),
-                      std::make_move_iterator(ticks.end()));
-        std::ranges::sort(bucket, [](const Tick& a, const Tick& b) {
-            return a.timestamp < b.timestamp;
-        });
+        if (const auto it = ticks_.find(symbol); it != ticks_.end()) {
+            const auto& existing = *it->second;
+            std::vector<Tick> merged;
+            merged.reserve(existing.size() + ticks.size());
+            for (size_t i = 0; i < existing.size(); ++i) {
+                merged.push_back(existing.tick(i));
+            }
+            merged.insert(merged.end(), ticks.begin(), ticks.end());
+            ticks = std::move(merged);
+        }
+        sort_by_time(ticks);
+        ticks_[symbol] = TickColumns::from_ticks(symbol, ticks);
+        tick_as_of_.clear();
+    }
+
+    std::shared_ptr<const TickColumns> MemoryDataSource::tick_columns(const SymbolId symbol) const {
+        const auto it = ticks_.find(symbol);
+        return it == ticks_.end() ? nullptr : it->second;
     }
 
     void MemoryDataSource::add_order_books(const SymbolId symbol, std::vector<OrderBook> books) {
-        auto& bucket = books_[symbol];
-        bucket.insert(bucket.end(), std::make_move_iterator(books.begin()),
-                      std::make_move_iterator(books.end()));
-        std::ranges::sort(bucket, [](const OrderBook& a, const OrderBook& b) {
-            return a.timestamp < b.timestamp;
-        });
+        if (const auto it = books_.find(symbol); it != books_.end()) {
+            books.insert(books.begin(), it->second->books.begin(), it->second->books.end());
+        }
+        sort_by_time(books);
+        books_[symbol] = OrderBookSeries::from_books(std::move(books));
+        book_as_of_.clear();
     }
 
     void MemoryDataSource::add_symbol_info(SymbolInfo info) {
@@ -113,6 +363,14 @@ namespace regimeflow::data
 
     void MemoryDataSource::set_corporate_actions(const SymbolId symbol, std::vector<CorporateAction> actions) {
         adjuster_.add_actions(symbol, std::move(actions));
+        // Symbol changes alter which series a symbol resolves to.
+        clear_as_of_caches();
+    }
+
+    void MemoryDataSource::clear_as_of_caches() {
+        bar_as_of_.clear();
+        tick_as_of_.clear();
+        book_as_of_.clear();
     }
 
     std::vector<SymbolInfo> MemoryDataSource::get_available_symbols() const {
@@ -136,19 +394,23 @@ namespace regimeflow::data
     TimeRange MemoryDataSource::get_available_range(SymbolId symbol) const {
         TimeRange range;
         symbol = adjuster_.resolve_symbol(symbol);
-        if (const auto bar_it = bars_.find(symbol); bar_it != bars_.end() && !bar_it->second.empty()) {
-            range.start = bar_it->second.front().timestamp;
-            range.end = bar_it->second.back().timestamp;
+        const auto covered = [&](const std::vector<int64_t>& timestamps) {
+            if (timestamps.empty()) {
+                return false;
+            }
+            range.start = Timestamp(timestamps.front());
+            range.end = Timestamp(timestamps.back());
+            return true;
+        };
+        if (const auto bar_it = bars_.find(symbol); bar_it != bars_.end() && covered(bar_it->second->timestamps)) {
             return range;
         }
-        if (const auto tick_it = ticks_.find(symbol); tick_it != ticks_.end() && !tick_it->second.empty()) {
-            range.start = tick_it->second.front().timestamp;
-            range.end = tick_it->second.back().timestamp;
+        if (const auto tick_it = ticks_.find(symbol);
+            tick_it != ticks_.end() && covered(tick_it->second->timestamps)) {
             return range;
         }
-        if (const auto book_it = books_.find(symbol); book_it != books_.end() && !book_it->second.empty()) {
-            range.start = book_it->second.front().timestamp;
-            range.end = book_it->second.back().timestamp;
+        if (const auto book_it = books_.find(symbol);
+            book_it != books_.end() && covered(book_it->second->timestamps)) {
             return range;
         }
         return range;
@@ -162,10 +424,10 @@ namespace regimeflow::data
         if (it == bars_.end()) {
             return result;
         }
-        for (const auto& bar : it->second) {
-            if (in_range(bar.timestamp, range)) {
-                result.push_back(bar);
-            }
+        const auto [begin, end] = it->second->find_range(range);
+        result.reserve(end - begin);
+        for (size_t i = begin; i < end; ++i) {
+            result.push_back(it->second->bar(i));
         }
         return result;
     }
@@ -177,36 +439,98 @@ namespace regimeflow::data
         if (it == ticks_.end()) {
             return result;
         }
-        for (const auto& tick : it->second) {
-            if (in_range(tick.timestamp, range)) {
-                result.push_back(tick);
-            }
+        const auto [begin, end] = it->second->find_range(range);
+        result.reserve(end - begin);
+        for (size_t i = begin; i < end; ++i) {
+            result.push_back(it->second->tick(i));
         }
         return result;
     }
 
     std::vector<OrderBook> MemoryDataSource::get_order_books(SymbolId symbol, const TimeRange range) {
-        std::vector<OrderBook> result;
         symbol = adjuster_.resolve_symbol(symbol, range.start);
         const auto it = books_.find(symbol);
         if (it == books_.end()) {
-            return result;
+            return {};
         }
-        for (const auto& book : it->second) {
-            if (in_range(book.timestamp, range)) {
-                result.push_back(book);
-            }
+        const auto [begin, end] = it->second->find_range(range);
+        const auto& books = it->second->books;
+        return {books.begin() + static_cast<std::ptrdiff_t>(begin), books.begin() + static_cast<std::ptrdiff_t>(end)};
+    }
+
+    std::optional<Bar> MemoryDataSource::get_bar_as_of(const SymbolId symbol, const Timestamp ts, BarType) {
+        const int64_t us = ts.microseconds();
+        const auto key = AsOfCache<Bar>::make_key(symbol);
+        if (const auto* hit = bar_as_of_.lookup(key, us)) {
+            return hit->row;
         }
-        return result;
+        const auto it = bars_.find(adjuster_.resolve_symbol(symbol, ts));
+        if (it == bars_.end()) {
+            return std::nullopt;
+        }
+        const auto& columns = *it->second;
+        const auto row = find_as_of_row(columns.timestamps, us);
+        std::optional<Bar> bar;
+        if (row) {
+            bar = columns.bar(*row);
+        }
+        bar_as_of_.store_row(key, columns.timestamps, row, bar);
+        return bar;
+    }
+
+    std::optional<Tick> MemoryDataSource::get_tick_as_of(const SymbolId symbol, const Timestamp ts) {
+        const int64_t us = ts.microseconds();
+        const auto key = AsOfCache<Tick>::make_key(symbol);
+        if (const auto* hit = tick_as_of_.lookup(key, us)) {
+            return hit->row;
+        }
+        const auto it = ticks_.find(adjuster_.resolve_symbol(symbol, ts));
+        if (it == ticks_.end()) {
+            return std::nullopt;
+        }
+        const auto& columns = *it->second;
+        const auto row = find_as_of_row(columns.timestamps, us);
+        std::optional<Tick> tick;
+        if (row) {
+            tick = columns.tick(*row);
+        }
+        tick_as_of_.store_row(key, columns.timestamps, row, tick);
+        return tick;
+    }
+
+    std::optional<OrderBook> MemoryDataSource::get_order_book_as_of(const SymbolId symbol, const Timestamp ts) {
+        const int64_t us = ts.microseconds();
+        const auto key = AsOfCache<OrderBook>::make_key(symbol);
+        if (const auto* hit = book_as_of_.lookup(key, us)) {
+            return hit->row;
+        }
+        const auto it = books_.find(adjuster_.resolve_symbol(symbol, ts));
+        if (it == books_.end()) {
+            return std::nullopt;
+        }
+        const auto& series = *it->second;
+        const auto row = find_as_of_row(series.timestamps, us);
+        std::optional<OrderBook> book;
+        if (row) {
+            book = series.books[*row];
+        }
+        book_as_of_.store_row(key, series.timestamps, row, book);
+        return book;
     }
 
     std::unique_ptr<DataIterator> MemoryDataSource::create_iterator(
-        const std::vector<SymbolId>& symbols, const TimeRange range, const BarType bar_type) {
+        const std::vector<SymbolId>& symbols, const TimeRange range, BarType) {
         std::vector<std::unique_ptr<DataIterator>> iterators;
         iterators.reserve(symbols.size());
-        for (const SymbolId symbol : symbols) {
-            auto bars = get_bars(symbol, range, bar_type);
-            iterators.push_back(std::make_unique<VectorBarIterator>(std::move(bars)));
+        for (SymbolId symbol : symbols) {
+            symbol = adjuster_.resolve_symbol(symbol, range.start);
+            const auto it = bars_.find(symbol);
+            if (it == bars_.end()) {
+                iterators.push_back(std::make_unique<VectorBarIterator>(std::vector<Bar>{}));
+                continue;
+            }
+            const auto [begin, end] = it->second->find_range(range);
+            iterators.push_back(std::make_unique<BarColumnsIterator>(it->second, begin, end));
         }
         return std::make_unique<MergedBarIterator>(std::move(iterators));
     }
@@ -215,9 +539,15 @@ namespace regimeflow::data
         const std::vector<SymbolId>& symbols, const TimeRange range) {
         std::vector<std::unique_ptr<TickIterator>> iterators;
         iterators.reserve(symbols.size());
-        for (const SymbolId symbol : symbols) {
-            auto ticks = get_ticks(symbol, range);
-            iterators.push_back(std::make_unique<VectorTickIterator>(std::move(ticks)));
+        for (SymbolId symbol : symbols) {
+            symbol = adjuster_.resolve_symbol(symbol, range.start);
+            const auto it = ticks_.find(symbol);
+            if (it == ticks_.end()) {
+                iterators.push_back(std::make_unique<VectorTickIterator>(std::vector<Tick>{}));
+                continue;
+            }
+            const auto [begin, end] = it->second->find_range(range);
+            iterators.push_back(std::make_unique<TickColumnsIterator>(it->second, begin, end));
         }
         return std::make_unique<MergedTickIterator>(std::move(iterators));
     }
@@ -226,9 +556,15 @@ namespace regimeflow::data
         const std::vector<SymbolId>& symbols, const TimeRange range) {
         std::vector<std::unique_ptr<OrderBookIterator>> iterators;
         iterators.reserve(symbols.size());
-        for (const SymbolId symbol : symbols) {
-            auto books = get_order_books(symbol, range);
-            iterators.push_back(std::make_unique<VectorOrderBookIterator>(std::move(books)));
+        for (SymbolId symbol : symbols) {
+            symbol = adjuster_.resolve_symbol(symbol, range.start);
+            const auto it = books_.find(symbol);
+            if (it == books_.end()) {
+                iterators.push_back(std::make_unique<VectorOrderBookIterator>(std::vector<OrderBook>{}));
+                continue;
+            }
+            const auto [begin, end] = it->second->find_range(range);
+            iterators.push_back(std::make_unique<OrderBookSeriesIterator>(it->second, begin, end));
         }
         return std::make_unique<MergedOrderBookIterator>(std::move(iterators));
     }
@@ -237,11 +573,4 @@ namespace regimeflow::data
                                                                         TimeRange) {
         return {};
     }
-
-    bool MemoryDataSource::in_range(const Timestamp& ts, const TimeRange range) {
-        if (range.start.microseconds() == 0 && range.end.microseconds() == 0) {
-            return true;
-        }
-        return range.contains(ts);
-    }
 }  // namespace regimeflow::data
@@ -4,130 +4,80 @@
 
 namespace regimeflow::data
 {
+    namespace {
+
+        // Per-source read-ahead. Bars and ticks are small; order books carry
+        // twenty levels each, so they buffer fewer entries per source.
+        constexpr size_t kBarBatch = 32;
+        constexpr size_t kTickBatch = 32;
+        constexpr size_t kBookBatch = 8;
+
+    }  // namespace
+
     MergedBarIterator::MergedBarIterator(std::vector<std::unique_ptr<DataIterator>> iterators)
-        : iterators_(std::move(iterators)) {
-        initialize_heap();
-    }
+        : merger_(std::move(iterators), kBarBatch) {}
 
     bool MergedBarIterator::has_next() const {
-        return !heap_.empty();
+        return !merger_.empty();
     }
 
     Bar MergedBarIterator::next() {
         if (!has_next()) {
             throw std::out_of_range("No more bars");
         }
-        auto [bar, iterator_index] = heap_.top();
-        heap_.pop();
-
-        if (const auto& iterator = iterators_[iterator_index]; iterator && iterator->has_next()) {
-            heap_.push({iterator->next(), iterator_index});
-        }
-        return bar;
+        return merger_.pop();
     }
 
-    void MergedBarIterator::reset() {
-        for (auto& iterator : iterators_) {
-            if (iterator) {
-                iterator->reset();
-            }
-        }
-        while (!heap_.empty()) {
-            heap_.pop();
-        }
-        initialize_heap();
+    size_t MergedBarIterator::next_batch(const std::span<Bar> out) {
+        return merger_.pop_batch(out);
     }
 
-    void MergedBarIterator::initialize_heap() {
-        for (size_t i = 0; i < iterators_.size(); ++i) {
-            if (const auto& iterator = iterators_[i]; iterator && iterator->has_next()) {
-                heap_.push({iterator->next(), i});
-            }
-        }
+    void MergedBarIterator::reset() {
+        merger_.reset();
     }
 
     MergedTickIterator::MergedTickIterator(std::vector<std::unique_ptr<TickIterator>> iterators)
-        : iterators_(std::move(iterators)) {
-        initialize_heap();
-    }
+        : merger_(std::move(iterators), kTickBatch) {}
 
     bool MergedTickIterator::has_next() const {
-        return !heap_.empty();
+        return !merger_.empty();
     }
 
     Tick MergedTickIterator::next() {
         if (!has_next()) {
             throw std::out_of_range("No more ticks");
         }
-        auto [tick, iterator_index] = heap_.top();
-        heap_.pop();
-
-        if (const auto& iterator = iterators_[iterator_index]; iterator && iterator->has_next()) {
-            heap_.push({iterator->next(), iterator_index});
-        }
-        return tick;
+        return merger_.pop();
     }
 
-    void MergedTickIterator::reset() {
-        for (auto& iterator : iterators_) {
-            if (iterator) {
-                iterator->reset();
-            }
-        }
-        while (!heap_.empty()) {
-            heap_.pop();
-        }
-        initialize_heap();
+    size_t MergedTickIterator::next_batch(const std::span<Tick> out) {
+        return merger_.pop_batch(out);
     }
 
-    void MergedTickIterator::initialize_heap() {
-        for (size_t i = 0; i < iterators_.size(); ++i) {
-            if (const auto& iterator = iterators_[i]; iterator && iterator->has_next()) {
-                heap_.push({iterator->next(), i});
-            }
-        }
+    void MergedTickIterator::reset() {
+        merger_.reset();
     }
 
     MergedOrderBookIterator::MergedOrderBookIterator(
         std::vector<std::unique_ptr<OrderBookIterator>> iterators)
-        : iterators_(std::move(iterators)) {
-        initialize_heap();
-    }
+        : merger_(std::move(iterators), kBookBatch) {}
 
     bool MergedOrderBookIterator::has_next() const {
-        return !heap_.empty();
+        return !merger_.empty();
     }
 
     OrderBook MergedOrderBookIterator::next() {
         if (!has_next()) {
             throw std::out_of_range("No more order books");
         }
-        auto [book, iterator_index] = heap_.top();
-        heap_.pop();
-
-        if (auto& iterator = iterators_[iterator_index]; iterator && iterator->has_next()) {
-            heap_.push({iterator->next(), iterator_index});
-        }
-        return book;
+        return merger_.pop();
     }
 
-    void MergedOrderBookIterator::reset() {
-        for (auto& iterator : iterators_) {
-            if (iterator) {
-                iterator->reset();
-            }
-        }
-        while (!heap_.empty()) {
-            heap_.pop();
-        }
-        initialize_heap();
+    size_t MergedOrderBookIterator::next_batch(const std::span<OrderBook> out) {
+        return merger_.pop_batch(out);
     }
 
-    void MergedOrderBookIterator::initialize_heap() {
-        for (size_t i = 0; i < iterators_.size(); ++i) {
-            if (const auto& iterator = iterators_[i]; iterator && iterator->has_next()) {
-                heap_.push({iterator->next(), i});
-            }
-        }
+    void MergedOrderBookIterator::reset() {
+        merger_.reset();
     }
 }  // namespace regimeflow::data
@@ -34,6 +34,20 @@ namespace regimeflow::data
         return inner_->get_order_books(symbol, range);
     }
 
+    std::optional<Bar> MetadataOverlayDataSource::get_bar_as_of(const SymbolId symbol, const Timestamp ts,
+                                                                const BarType bar_type) {
+        return inner_->get_bar_as_of(symbol, ts, bar_type);
+    }
+
+    std::optional<Tick> MetadataOverlayDataSource::get_tick_as_of(const SymbolId symbol, const Timestamp ts) {
+        return inner_->get_tick_as_of(symbol, ts);
+    }
+
+    std::optional<OrderBook> MetadataOverlayDataSource::get_order_book_as_of(const SymbolId symbol,
+                                                                             const Timestamp ts) {
+        return inner_->get_order_book_as_of(symbol, ts);
+    }
+
     std::unique_ptr<DataIterator> MetadataOverlayDataSource::create_iterator(
         const std::vector<SymbolId>& symbols,
         const TimeRange range,
@@ -0,0 +1,208 @@
+#include "regimeflow/data/mmap_access.h"
+
+#include <algorithm>
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace regimeflow::data
+{
+    namespace {
+
+        size_t page_size() {
+#if defined(_WIN32)
+            return 4096;
+#else
+            static const size_t size = [] {
+                const long value = ::sysconf(_SC_PAGESIZE);
+                return value > 0 ? static_cast<size_t>(value) : size_t{4096};
+            }();
+            return size;
+#endif
+        }
+
+    }  // namespace
+
+    MmapAccessPolicy parse_mmap_access_policy(const std::string_view name, const MmapAccessPolicy fallback) {
+        if (name == "default") {
+            return MmapAccessPolicy::Default;
+        }
+        if (name == "sequential") {
+            return MmapAccessPolicy::Sequential;
+        }
+        if (name == "random") {
+            return MmapAccessPolicy::Random;
+        }
+        if (name == "prefetch_range" || name == "prefetch") {
+            return MmapAccessPolicy::PrefetchRange;
+        }
+        return fallback;
+    }
+
+    void advise_mmap_rows(const void* mapping, const size_t mapping_size,
+                          const std::vector<MmapColumn>& columns,
+                          const size_t begin, const size_t end, const MmapAccessPolicy policy) {
+        if (!mapping || mapping_size == 0 || policy == MmapAccessPolicy::Default) {
+            return;
+        }
+#if defined(_WIN32)
+        (void)columns;
+        (void)begin;
+        (void)end;
+#else
+        if (begin >= end) {
+            return;
+        }
+        const size_t page = page_size();
+        auto* const lo = static_cast<std::byte*>(const_cast<void*>(mapping));
+        auto* const hi = lo + mapping_size;
+        for (const auto& column : columns) {
+            auto* first = static_cast<std::byte*>(const_cast<void*>(column.base)) + begin * column.row_bytes;
+            auto* last = static_cast<std::byte*>(const_cast<void*>(column.base)) + end * column.row_bytes;
+            first = std::max(first, lo);
+            last = std::min(last, hi);
+            if (first >= last) {
+                continue;
+            }
+            auto* aligned = lo + (static_cast<size_t>(first - lo) / page) * page;
+            const auto length = static_cast<size_t>(last - aligned);
+            // The mapping is shared through the file cache, so even Random
+            // only touches this window and leaves other readers' readahead.
+            if (policy == MmapAccessPolicy::Random) {
+                ::madvise(aligned, length, MADV_RANDOM);
+                continue;
+            }
+            ::madvise(aligned, length, MADV_SEQUENTIAL);
+            if (policy == MmapAccessPolicy::PrefetchRange) {
+                ::madvise(aligned, length, MADV_WILLNEED);
+            }
+        }
+#endif
+    }
+
+    void advise_mmap_huge_pages(const void* mapping, const size_t mapping_size) {
+#if defined(MADV_HUGEPAGE)
+        if (mapping && mapping_size > 0) {
+            ::madvise(const_cast<void*>(mapping), mapping_size, MADV_HUGEPAGE);
+        }
+#else
+        (void)mapping;
+        (void)mapping_size;
+#endif
+    }
+
+    MmapPrefetchWorker::MmapPrefetchWorker() {
+        thread_ = std::thread([this]() { run(); });
+    }
+
+    MmapPrefetchWorker::~MmapPrefetchWorker() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+    }
+
+    void MmapPrefetchWorker::schedule(MmapPrefetcher* prefetcher) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (prefetcher->queued_.load()) {
+                return;
+            }
+            prefetcher->queued_.store(true);
+            queue_.push_back(prefetcher);
+        }
+        cv_.notify_one();
+    }
+
+    void MmapPrefetchWorker::remove(MmapPrefetcher* prefetcher) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        idle_cv_.wait(lock, [&]() { return busy_ != prefetcher; });
+        std::erase(queue_, prefetcher);
+    }
+
+    void MmapPrefetchWorker::run() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+            if (stop_) {
+                return;
+            }
+            auto* prefetcher = queue_.front();
+            queue_.pop_front();
+            prefetcher->queued_.store(false);
+            busy_ = prefetcher;
+            lock.unlock();
+            const bool more = prefetcher->step();
+            lock.lock();
+            busy_ = nullptr;
+            // Round robin: a cursor still behind goes to the back of the queue.
+            if (more && !prefetcher->queued_.load()) {
+                prefetcher->queued_.store(true);
+                queue_.push_back(prefetcher);
+            }
+            idle_cv_.notify_all();
+        }
+    }
+
+    MmapPrefetcher::MmapPrefetcher(std::vector<MmapColumn> columns, const size_t begin, const size_t end,
+                                   const size_t ahead_rows, std::shared_ptr<MmapPrefetchWorker> worker)
+        : columns_(std::move(columns)), end_(end), ahead_(std::max<size_t>(ahead_rows, 1)),
+          cursor_(begin), done_(begin) {
+        if (begin < end) {
+            worker_ = worker ? std::move(worker) : std::make_shared<MmapPrefetchWorker>();
+            worker_->schedule(this);
+        }
+    }
+
+    MmapPrefetcher::~MmapPrefetcher() {
+        if (worker_) {
+            worker_->remove(this);
+        }
+    }
+
+    void MmapPrefetcher::advance(const size_t row) {
+        cursor_.store(row);
+        // Queue only once the cursor eats into half of the window.
+        if (worker_ && !queued_.load() && row + ahead_ / 2 >= done_.load(std::memory_order_acquire) &&
+            done_.load(std::memory_order_acquire) < end_) {
+            worker_->schedule(this);
+        }
+    }
+
+    bool MmapPrefetcher::step() {
+        // Small steps keep cursors sharing the worker responsive to each other.
+        const size_t step = std::max<size_t>(ahead_ / 8, 1);
+        const size_t done = done_.load(std::memory_order_relaxed);
+        const size_t target = std::min(end_, cursor_.load() + ahead_);
+        if (done >= target) {
+            return false;
+        }
+        const size_t next = std::min(target, done + step);
+        touch(done, next);
+        done_.store(next, std::memory_order_release);
+        return next < std::min(end_, cursor_.load() + ahead_);
+    }
+
+    void MmapPrefetcher::touch(const size_t begin, const size_t end) {
+        const size_t page = page_size();
+        unsigned char sink = 0;
+        for (const auto& column : columns_) {
+            const auto* first = static_cast<const volatile unsigned char*>(column.base) + begin * column.row_bytes;
+            const auto* last = static_cast<const volatile unsigned char*>(column.base) + end * column.row_bytes;
+            for (const auto* p = first; p < last; p += page) {
+                sink ^= *p;
+            }
+            if (first < last) {
+                sink ^= *(last - 1);
+            }
+        }
+        static std::atomic<unsigned char> sink_out{0};
+        sink_out.fetch_xor(sink, std::memory_order_relaxed);
+    }
+}  // namespace regimeflow::data
@@ -2,8 +2,11 @@
 
 #include "regimeflow/data/merged_iterator.h"
 
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <optional>
+#include <stdexcept>
 #include <unordered_set>
 
 namespace regimeflow::data
@@ -15,7 +18,7 @@ namespace regimeflow::data
         }
 
         std::optional<std::string> extract_symbol(const std::filesystem::path& path) {
-            if (path.extension() != ".rfb") {
+            if (path.extension() != ".rfb" && path.extension() != ".rfbz") {
                 return std::nullopt;
             }
             auto stem = path.stem().string();
@@ -26,7 +29,12 @@ namespace regimeflow::data
             return stem.substr(0, pos);
         }
 
-        std::string make_range_key(const SymbolId symbol, BarType bar_type, const TimeRange range) {
+        // Tags sources whose corporate actions were set, so a shared range
+        // cache never serves bars adjusted by another source's actions.
+        std::atomic<uint64_t> next_range_tag{1};
+
+        std::string make_range_key(const SymbolId symbol, BarType bar_type, const TimeRange range,
+                                   const uint64_t tag) {
             const auto& name = SymbolRegistry::instance().lookup(symbol);
             std::string key = name;
             key.push_back('|');
@@ -35,15 +43,102 @@ namespace regimeflow::data
             key += std::to_string(range.start.microseconds());
             key.push_back(':');
             key += std::to_string(range.end.microseconds());
+            if (tag != 0) {
+                key.push_back('#');
+                key += std::to_string(tag);
+            }
             return key;
         }
 
     }  // namespace
 
+    MemoryMappedBarIterator::MemoryMappedBarIterator(std::shared_ptr<const MemoryMappedDataFile> file,
+                                                     const TimeRange range,
+                                                     std::vector<CorporateAction> actions,
+                                                     const MmapAccessPolicy policy,
+                                                     const size_t prefetch_rows,
+                                                     std::shared_ptr<MmapPrefetchWorker> prefetch_worker)
+        : file_(std::move(file)) {
+        if (!file_) {
+            return;
+        }
+        const auto [start, end] = file_->find_range(range);
+        const size_t count = end - start;
+        begin_ = start;
+        file_->advise(policy, start, end);
+        if (prefetch_rows > 0 && count > 0) {
+            prefetcher_ = std::make_unique<MmapPrefetcher>(file_->columns(), start, end, prefetch_rows,
+                                                           std::move(prefetch_worker));
+        }
+        timestamps_ = file_->timestamps().subspan(start, count);
+        opens_ = file_->opens().subspan(start, count);
+        highs_ = file_->highs().subspan(start, count);
+        lows_ = file_->lows().subspan(start, count);
+        closes_ = file_->closes().subspan(start, count);
+        volumes_ = file_->volumes().subspan(start, count);
+        symbol_ = file_->symbol_id();
+        adjust_ = !actions.empty();
+        if (adjust_) {
+            adjuster_.add_actions(symbol_, std::move(actions));
+        }
+    }
+
+    bool MemoryMappedBarIterator::has_next() const {
+        return index_ < timestamps_.size();
+    }
+
+    Bar MemoryMappedBarIterator::next() {
+        if (!has_next()) {
+            throw std::out_of_range("No more bars");
+        }
+        if (prefetcher_) {
+            prefetcher_->advance(begin_ + index_);
+        }
+        const Bar bar = read(index_++);
+        return adjust_ ? adjuster_.adjust_bar(symbol_, bar) : bar;
+    }
+
+    size_t MemoryMappedBarIterator::next_batch(const std::span<Bar> out) {
+        const size_t count = std::min(out.size(), timestamps_.size() - index_);
+        if (prefetcher_) {
+            prefetcher_->advance(begin_ + index_);
+        }
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = read(index_ + i);
+        }
+        if (adjust_) {
+            adjuster_.adjust_bars(symbol_, out.first(count));
+        }
+        index_ += count;
+        return count;
+    }
+
+    Bar MemoryMappedBarIterator::read(const size_t index) const {
+        Bar bar;
+        bar.timestamp = Timestamp(timestamps_[index]);
+        bar.symbol = symbol_;
+        bar.open = opens_[index];
+        bar.high = highs_[index];
+        bar.low = lows_[index];
+        bar.close = closes_[index];
+        bar.volume = volumes_[index];
+        return bar;
+    }
+
+    void MemoryMappedBarIterator::reset() {
+        index_ = 0;
+        if (prefetcher_) {
+            prefetcher_->advance(begin_);
+        }
+    }
+
     MemoryMappedDataSource::MemoryMappedDataSource(const Config& config)
         : config_(config),
-          file_cache_(config.max_cached_files),
-          range_cache_(config.max_cached_ranges) {}
+          caches_(config.shared_caches ? config.shared_caches : Caches::create(config)) {
+        if (config_.prefetch_rows > 0) {
+            prefetch_worker_ = std::make_shared<MmapPrefetchWorker>();
+        }
+    }
 
     std::vector<SymbolInfo> MemoryMappedDataSource::get_available_symbols() const {
         std::vector<SymbolInfo> symbols;
@@ -81,38 +176,49 @@ namespace regimeflow::data
 
     TimeRange MemoryMappedDataSource::get_available_range(SymbolId symbol) const {
         symbol = adjuster_.resolve_symbol(symbol);
-        const auto file = get_file(symbol, BarType::Time_1Day);
-        if (!file) {
-            return {};
+        if (const auto file = get_file(symbol, BarType::Time_1Day)) {
+            return file->time_range();
         }
-        return file->time_range();
+        if (const auto compressed = get_compressed_file(symbol, BarType::Time_1Day)) {
+            return compressed->time_range();
+        }
+        return {};
     }
 
     std::vector<Bar> MemoryMappedDataSource::get_bars(SymbolId symbol, const TimeRange range,
                                                       const BarType bar_type) {
         symbol = adjuster_.resolve_symbol(symbol, range.start);
         std::string cache_key;
-        if (config_.max_cached_ranges > 0) {
-            cache_key = make_range_key(symbol, bar_type, range);
-            if (const auto cached = range_cache_.get(cache_key)) {
+        if (caches_->ranges.enabled()) {
+            cache_key = make_range_key(symbol, bar_type, range, range_tag_);
+            if (const auto cached = caches_->ranges.get(cache_key)) {
                 return **cached;
             }
         }
 
         std::vector<Bar> result;
-        const auto file = get_file(symbol, bar_type);
-        if (!file) {
+        if (const auto file = get_file(symbol, bar_type)) {
+            auto [start, end] = file->find_range(range);
+            file->advise(config_.access_policy, start, end);
+            result.reserve(end - start);
+            for (size_t i = start; i < end; ++i) {
+                result.push_back((*file)[i].to_bar());
+            }
+            adjuster_.adjust_bars(symbol, result);
+        } else if (const auto compressed = get_compressed_file(symbol, bar_type)) {
+            CompressedBarIterator iter(compressed, range, adjuster_.actions_for(symbol));
+            std::vector<Bar> batch(256);
+            while (const size_t count = iter.next_batch(batch)) {
+                result.insert(result.end(), batch.begin(),
+                              batch.begin() + static_cast<std::ptrdiff_t>(count));
+            }
+        } else {
             return result;
         }
-        auto [start, end] = file->find_range(range);
-        result.reserve(end - start);
-        for (size_t i = start; i < end; ++i) {
-            result.push_back((*file)[i].to_bar());
-        }
 
-        if (config_.max_cached_ranges > 0) {
+        if (caches_->ranges.enabled()) {
             const auto shared = std::make_shared<std::vector<Bar>>(result);
-            range_cache_.put(cache_key, shared);
+            caches_->ranges.put(cache_key, shared);
             return *shared;
         }
         return result;
@@ -122,15 +228,52 @@ namespace regimeflow::data
         return {};
     }
 
+    std::optional<Bar> MemoryMappedDataSource::get_bar_as_of(const SymbolId symbol, const Timestamp ts,
+                                                             const BarType bar_type) {
+        const int64_t us = ts.microseconds();
+        const auto key = AsOfCache<Bar>::make_key(symbol, static_cast<uint8_t>(bar_type));
+        std::shared_ptr<const MemoryMappedDataFile> file;
+        if (const auto* entry = bar_as_of_.find(key)) {
+            if (entry->covers(us)) {
+                return entry->row;
+            }
+            file = entry->owner;
+        }
+        const SymbolId resolved = adjuster_.resolve_symbol(symbol, ts);
+        if (!file) {
+            file = get_file(resolved, bar_type);
+        }
+        if (!file) {
+            return DataSource::get_bar_as_of(symbol, ts, bar_type);
+        }
+        const auto row = file->find_as_of(ts);
+        std::optional<Bar> bar;
+        if (row) {
+            bar = adjuster_.adjust_bar(resolved, (*file)[*row].to_bar());
+        }
+        bar_as_of_.store_row(key, file->timestamps(), row, bar, file);
+        return bar;
+    }
+
     std::unique_ptr<DataIterator> MemoryMappedDataSource::create_iterator(
         const std::vector<SymbolId>& symbols,
         const TimeRange range,
         const BarType bar_type) {
         std::vector<std::unique_ptr<DataIterator>> iterators;
         iterators.reserve(symbols.size());
-        for (const SymbolId symbol : symbols) {
-            auto bars = get_bars(symbol, range, bar_type);
-            iterators.push_back(std::make_unique<VectorBarIterator>(std::move(bars)));
+        for (SymbolId symbol : symbols) {
+            symbol = adjuster_.resolve_symbol(symbol, range.start);
+            auto file = get_file(symbol, bar_type);
+            if (!file) {
+                if (auto compressed = get_compressed_file(symbol, bar_type)) {
+                    iterators.push_back(std::make_unique<CompressedBarIterator>(
+                        std::move(compressed), range, adjuster_.actions_for(symbol)));
+                    continue;
+                }
+            }
+            iterators.push_back(std::make_unique<MemoryMappedBarIterator>(
+                std::move(file), range, adjuster_.actions_for(symbol), config_.access_policy,
+                config_.prefetch_rows, prefetch_worker_));
         }
         return std::make_unique<MergedBarIterator>(std::move(iterators));
     }
@@ -143,6 +286,8 @@ namespace regimeflow::data
     void MemoryMappedDataSource::set_corporate_actions(SymbolId symbol,
                                                        std::vector<CorporateAction> actions) {
         adjuster_.add_actions(symbol, std::move(actions));
+        bar_as_of_.clear();
+        range_tag_ = next_range_tag.fetch_add(1, std::memory_order_relaxed);
     }
 
     std::shared_ptr<MemoryMappedDataFile> MemoryMappedDataSource::get_file(const SymbolId symbol,
@@ -158,15 +303,47 @@ namespace regimeflow::data
         path /= build_filename(symbol_name, bar_type_suffix(bar_type));
         std::string key = path.string();
 
-        if (auto cached = file_cache_.get(key)) {
+        if (auto cached = caches_->files.get(key)) {
             return *cached;
         }
+        // Symbols stored only in the compressed format are served by
+        // get_compressed_file instead.
+        if (!std::filesystem::exists(path) && std::filesystem::exists(path.string() + "z")) {
+            return nullptr;
+        }
 
         auto file = std::make_shared<MemoryMappedDataFile>(key);
         if (config_.preload_index) {
             file->preload_index();
         }
-        file_cache_.put(key, file);
+        if (config_.huge_pages) {
+            file->advise_huge_pages();
+        }
+        caches_->files.put(key, file);
+        return file;
+    }
+
+    std::shared_ptr<CompressedBarFile> MemoryMappedDataSource::get_compressed_file(
+        const SymbolId symbol, const BarType bar_type) const {
+        if (config_.data_directory.empty()) {
+            return nullptr;
+        }
+        const auto& symbol_name = SymbolRegistry::instance().lookup(symbol);
+        if (symbol_name.empty()) {
+            return nullptr;
+        }
+        std::filesystem::path path = config_.data_directory;
+        path /= build_filename(symbol_name, bar_type_suffix(bar_type)) + "z";
+        std::string key = path.string();
+
+        if (auto cached = caches_->packed.get(key)) {
+            return *cached;
+        }
+        if (!std::filesystem::exists(path)) {
+            return nullptr;
+        }
+        auto file = std::make_shared<CompressedBarFile>(key);
+        caches_->packed.put(key, file);
         return file;
     }
 
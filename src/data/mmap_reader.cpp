@@ -1,5 +1,7 @@
 #include "regimeflow/data/mmap_reader.h"
 
+#include "regimeflow/data/as_of_cache.h"
+
 #include <algorithm>
 #include <atomic>
 #include <cerrno>
@@ -235,6 +237,31 @@ namespace regimeflow::data
                 static_cast<size_t>(end_it - span.begin())};
     }
 
+    std::optional<size_t> MemoryMappedDataFile::find_as_of(const Timestamp ts) const {
+        return find_as_of_row(timestamps(), std::span<const DateIndex>(date_index_, date_index_ ? index_count_ : 0),
+                              ts.microseconds());
+    }
+
+    std::vector<MmapColumn> MemoryMappedDataFile::columns() const {
+        if (!header_) {
+            return {};
+        }
+        return {{timestamps_, sizeof(int64_t)},
+                {opens_, sizeof(double)},
+                {highs_, sizeof(double)},
+                {lows_, sizeof(double)},
+                {closes_, sizeof(double)},
+                {volumes_, sizeof(uint64_t)}};
+    }
+
+    void MemoryMappedDataFile::advise(const MmapAccessPolicy policy, const size_t begin, const size_t end) const {
+        advise_mmap_rows(mapping_, file_size_, columns(), begin, end, policy);
+    }
+
+    void MemoryMappedDataFile::advise_huge_pages() const {
+        advise_mmap_huge_pages(mapping_, file_size_);
+    }
+
     std::span<const int64_t> MemoryMappedDataFile::timestamps() const {
         return {timestamps_, bar_count()};
     }
@@ -8,6 +8,7 @@
 #include <cmath>
 #include <cstddef>
 #include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <limits>
 #include <vector>
@@ -48,13 +49,76 @@ namespace regimeflow::data
             }
         }
 
+        Result<void> check_bar(const Bar& bar, const bool first, const Timestamp last) {
+            if (bar.timestamp.microseconds() <= 0) {
+                return Result<void>(Error(Error::Code::InvalidArgument, "Bar timestamp must be positive"));
+            }
+            if (!first && bar.timestamp < last) {
+                return Result<void>(Error(Error::Code::InvalidArgument, "Bars must be sorted by timestamp"));
+            }
+            if (!is_finite(bar.open) || !is_finite(bar.high) || !is_finite(bar.low) ||
+                !is_finite(bar.close)) {
+                return Result<void>(Error(Error::Code::InvalidArgument, "Bar prices must be finite"));
+            }
+            if (bar.open <= 0 || bar.high <= 0 || bar.low <= 0 || bar.close <= 0) {
+                return Result<void>(Error(Error::Code::InvalidArgument, "Bar prices must be positive"));
+            }
+            if (bar.high < bar.low) {
+                return Result<void>(Error(Error::Code::InvalidArgument, "Bar high must be >= low"));
+            }
+            return Ok();
+        }
+
+        constexpr int64_t kMicrosPerDay = 86'400'000'000LL;
+        constexpr size_t kSpillColumns = 5;
+
     }  // namespace
 
+    struct MmapWriter::Stream {
+        Stream(const std::string& output, const size_t rows)
+            : path(output), buffer_rows(rows),
+              spill(output + ".spill", {sizeof(double), sizeof(double), sizeof(double), sizeof(double),
+                                        sizeof(uint64_t)}) {
+            timestamps.reserve(rows);
+            opens.reserve(rows);
+            highs.reserve(rows);
+            lows.reserve(rows);
+            closes.reserve(rows);
+            volumes.reserve(rows);
+        }
+
+        std::string path;
+        size_t buffer_rows;
+        std::ofstream out;
+        FileHeader header{};
+        Sha256 sha;
+        std::vector<int64_t> timestamps;
+        std::vector<double> opens;
+        std::vector<double> highs;
+        std::vector<double> lows;
+        std::vector<double> closes;
+        std::vector<uint64_t> volumes;
+        ColumnSpill spill;
+        std::vector<DateIndex> index;
+        int64_t last_day = 0;
+        uint64_t count = 0;
+        Timestamp last;
+    };
+
+    MmapWriter::MmapWriter() = default;
+    MmapWriter::~MmapWriter() {
+        if (stream_) {
+            fail_stream(Ok());
+        }
+    }
+    MmapWriter::MmapWriter(MmapWriter&&) noexcept = default;
+    MmapWriter& MmapWriter::operator=(MmapWriter&&) noexcept = default;
+
     Result<void> MmapWriter::write_bars(const std::string& path,
                                         const std::string& symbol,
                                         BarType bar_type,
                                         std::vector<Bar> bars) {
-        std::ranges::sort(bars, [](const Bar& a, const Bar& b) {
+        std::ranges::stable_sort(bars, [](const Bar& a, const Bar& b) {
             return a.timestamp < b.timestamp;
         });
         if (auto validation = validate_bars(bars); validation.is_err()) {
@@ -130,33 +194,161 @@ namespace regimeflow::data
     }
 
     Result<void> MmapWriter::validate_bars(const std::vector<Bar>& bars) {
-        if (bars.empty()) {
-            return Ok();
-        }
-        Timestamp last = bars.front().timestamp;
         for (size_t i = 0; i < bars.size(); ++i) {
-            const auto& bar = bars[i];
-            if (bar.timestamp.microseconds() <= 0) {
-                return Result<void>(Error(Error::Code::InvalidArgument, "Bar timestamp must be positive"));
+            if (auto check = check_bar(bars[i], i == 0, i > 0 ? bars[i - 1].timestamp : Timestamp());
+                check.is_err()) {
+                return check;
             }
-            if (i > 0 && bar.timestamp < last) {
-                return Result<void>(Error(Error::Code::InvalidArgument, "Bars must be sorted by timestamp"));
+        }
+        return Ok();
+    }
+
+    Result<void> MmapWriter::open(const std::string& path, const std::string& symbol,
+                                  const BarType bar_type, const size_t buffer_rows) {
+        if (stream_) {
+            return Result<void>(Error(Error::Code::InvalidState, "Mmap stream already open"));
+        }
+        auto stream = std::make_unique<Stream>(path, std::max<size_t>(buffer_rows, 1));
+        stream->out.open(path, std::ios::binary | std::ios::trunc);
+        if (!stream->out) {
+            return Result<void>(Error(Error::Code::IoError, "Unable to open mmap output file"));
+        }
+        auto& header = stream->header;
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kFileVersion;
+        header.flags = 0;
+        std::memset(header.symbol, 0, sizeof(header.symbol));
+#if defined(_WIN32)
+        strncpy_s(header.symbol, sizeof(header.symbol), symbol.c_str(), _TRUNCATE);
+#else
+        std::strncpy(header.symbol, symbol.c_str(), sizeof(header.symbol) - 1);
+#endif
+        header.bar_type = static_cast<uint32_t>(bar_type);
+        header.bar_size_ms = bar_size_ms(bar_type);
+        header.data_offset = sizeof(FileHeader);
+        write_bytes(stream->out, &header, sizeof(header), nullptr);
+        stream_ = std::move(stream);
+        return Ok();
+    }
+
+    Result<void> MmapWriter::append(const std::span<const Bar> bars) {
+        if (!stream_) {
+            return Result<void>(Error(Error::Code::InvalidState, "Mmap stream not open"));
+        }
+        auto& s = *stream_;
+        for (const auto& bar : bars) {
+            if (auto check = check_bar(bar, s.count == 0, s.last); check.is_err()) {
+                return fail_stream(std::move(check));
             }
-            if (!is_finite(bar.open) || !is_finite(bar.high) || !is_finite(bar.low) ||
-                !is_finite(bar.close)) {
-                return Result<void>(Error(Error::Code::InvalidArgument, "Bar prices must be finite"));
+            // Dates only change when the UTC day does; skip formatting otherwise.
+            const int64_t us = bar.timestamp.microseconds();
+            if (const int64_t day = us / kMicrosPerDay; s.count == 0 || day != s.last_day) {
+                const int32_t date = yyyymmdd_from_timestamp(bar.timestamp);
+                if (s.index.empty() || s.index.back().date_yyyymmdd != date) {
+                    DateIndex entry{};
+                    entry.date_yyyymmdd = date;
+                    entry.offset = s.count;
+                    s.index.push_back(entry);
                 }
-            if (bar.open <= 0 || bar.high <= 0 || bar.low <= 0 || bar.close <= 0) {
-                return Result<void>(Error(Error::Code::InvalidArgument, "Bar prices must be positive"));
+                s.last_day = day;
             }
-            if (bar.high < bar.low) {
-                return Result<void>(Error(Error::Code::InvalidArgument, "Bar high must be >= low"));
+            if (s.count == 0) {
+                s.header.start_timestamp = us;
+            }
+            s.timestamps.push_back(us);
+            s.opens.push_back(bar.open);
+            s.highs.push_back(bar.high);
+            s.lows.push_back(bar.low);
+            s.closes.push_back(bar.close);
+            s.volumes.push_back(bar.volume);
+            s.last = bar.timestamp;
+            ++s.count;
+            if (s.timestamps.size() == s.buffer_rows) {
+                if (auto flushed = flush_stream(); flushed.is_err()) {
+                    return fail_stream(std::move(flushed));
+                }
             }
-            last = bar.timestamp;
         }
         return Ok();
     }
 
+    Result<void> MmapWriter::flush_stream() {
+        auto& s = *stream_;
+        const size_t rows = s.timestamps.size();
+        if (rows == 0) {
+            return Ok();
+        }
+        write_bytes(s.out, s.timestamps.data(), rows * sizeof(int64_t), &s.sha);
+        const std::array<const void*, kSpillColumns> columns{s.opens.data(), s.highs.data(), s.lows.data(),
+                                                             s.closes.data(), s.volumes.data()};
+        if (auto spilled = s.spill.add_block(rows, columns); spilled.is_err()) {
+            return spilled;
+        }
+        s.timestamps.clear();
+        s.opens.clear();
+        s.highs.clear();
+        s.lows.clear();
+        s.closes.clear();
+        s.volumes.clear();
+        return s.out ? Ok() : Result<void>(Error(Error::Code::IoError, "Unable to write mmap output file"));
+    }
+
+    Result<void> MmapWriter::finalize() {
+        if (!stream_) {
+            return Result<void>(Error(Error::Code::InvalidState, "Mmap stream not open"));
+        }
+        auto& s = *stream_;
+        if (s.spill.empty()) {
+            // Everything fit in the buffers: write the columns directly.
+            const size_t rows = s.timestamps.size();
+            write_bytes(s.out, s.timestamps.data(), rows * sizeof(int64_t), &s.sha);
+            write_bytes(s.out, s.opens.data(), rows * sizeof(double), &s.sha);
+            write_bytes(s.out, s.highs.data(), rows * sizeof(double), &s.sha);
+            write_bytes(s.out, s.lows.data(), rows * sizeof(double), &s.sha);
+            write_bytes(s.out, s.closes.data(), rows * sizeof(double), &s.sha);
+            write_bytes(s.out, s.volumes.data(), rows * sizeof(uint64_t), &s.sha);
+        } else {
+            if (auto flushed = flush_stream(); flushed.is_err()) {
+                return fail_stream(std::move(flushed));
+            }
+            for (size_t column = 0; column < kSpillColumns; ++column) {
+                if (auto copied = s.spill.copy_column(column, s.out, s.sha); copied.is_err()) {
+                    return fail_stream(std::move(copied));
+                }
+            }
+        }
+        if (!s.index.empty()) {
+            write_date_index(s.out, s.index);
+        }
+
+        auto& header = s.header;
+        if (s.count > 0) {
+            header.end_timestamp = s.last.microseconds();
+        }
+        header.bar_count = s.count;
+        const size_t data_bytes = s.count * (sizeof(int64_t) + 4 * sizeof(double) + sizeof(uint64_t));
+        header.index_offset = header.data_offset + static_cast<uint64_t>(data_bytes);
+        auto checksum = s.sha.digest();
+        std::memcpy(header.checksum, checksum.data(), checksum.size());
+        s.out.seekp(0);
+        write_bytes(s.out, &header, sizeof(header), nullptr);
+        s.out.close();
+        if (!s.out) {
+            return fail_stream(Result<void>(Error(Error::Code::IoError, "Unable to write mmap output file")));
+        }
+        stream_.reset();
+        return Ok();
+    }
+
+    Result<void> MmapWriter::fail_stream(Result<void> error) {
+        const std::string path = stream_->path;
+        stream_->out.close();
+        stream_.reset();
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        return error;
+    }
+
     uint32_t MmapWriter::bar_size_ms(const BarType type) {
         switch (type) {
         case BarType::Time_1Min: return 60'000;
@@ -0,0 +1,535 @@
+#include "regimeflow/data/order_book_delta.h"
+
+#include "regimeflow/common/sha256.h"
+#include "regimeflow/data/order_book_mmap.h"
+
+#include <algorithm>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <tuple>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace regimeflow::data
+{
+    namespace {
+
+        constexpr char kMagic[8] = {'R', 'G', 'M', 'F', 'O', 'B', 'D', '1'};
+        constexpr uint32_t kFileVersion = 1;
+        constexpr size_t kLevels = 10;
+        constexpr size_t kSlots = 2 * kLevels;
+
+        // Record kinds. A keyframe clears the book before its levels apply.
+        constexpr uint8_t kDeltaRecord = 0;
+        constexpr uint8_t kKeyframeRecord = 1;
+
+        // Change byte: slot in the low five bits (bids then asks), changed
+        // fields in the high three.
+        constexpr uint8_t kPriceChanged = 1 << 5;
+        constexpr uint8_t kQuantityChanged = 1 << 6;
+        constexpr uint8_t kOrdersChanged = 1 << 7;
+        constexpr uint8_t kSlotMask = 0x1F;
+
+        std::string_view trim_nulls(const char* data, const size_t size) {
+            size_t len = 0;
+            for (; len < size; ++len) {
+                if (data[len] == '\0') {
+                    break;
+                }
+            }
+            return std::string_view{data, len};
+        }
+
+        void write_bytes(std::ofstream& out, const void* data, const size_t len, Sha256* sha) {
+            out.write(static_cast<const char*>(data), static_cast<std::streamsize>(len));
+            if (sha) {
+                sha->update(data, len);
+            }
+        }
+
+        BookLevel& level_at(OrderBook& book, const size_t slot) {
+            return slot < kLevels ? book.bids[slot] : book.asks[slot - kLevels];
+        }
+
+        const BookLevel& level_at(const OrderBook& book, const size_t slot) {
+            return slot < kLevels ? book.bids[slot] : book.asks[slot - kLevels];
+        }
+
+        bool same_bits(const double a, const double b) {
+            return std::bit_cast<uint64_t>(a) == std::bit_cast<uint64_t>(b);
+        }
+
+        void put_varint(uint64_t value, std::vector<uint8_t>& out) {
+            while (value >= 0x80) {
+                out.push_back(static_cast<uint8_t>(value | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast<uint8_t>(value));
+        }
+
+        uint64_t zigzag(const uint64_t value) {
+            return (value << 1) ^ (0 - (value >> 63));
+        }
+
+        uint64_t unzigzag(const uint64_t value) {
+            return (value >> 1) ^ (0 - (value & 1));
+        }
+
+        // XOR against the previous value at the slot, dropping zero bytes at
+        // both ends; a moved level usually differs in a few mantissa bytes.
+        void put_xor(const double value, const double previous, std::vector<uint8_t>& out) {
+            const uint64_t x = std::bit_cast<uint64_t>(value) ^ std::bit_cast<uint64_t>(previous);
+            if (x == 0) {
+                out.push_back(0);
+                return;
+            }
+            const int trailing = std::countr_zero(x) / 8;
+            const int length = 8 - std::countl_zero(x) / 8 - trailing;
+            out.push_back(static_cast<uint8_t>((trailing << 4) | length));
+            const uint64_t payload = x >> (8 * trailing);
+            for (int i = 0; i < length; ++i) {
+                out.push_back(static_cast<uint8_t>(payload >> (8 * i)));
+            }
+        }
+
+        bool get_varint(const uint8_t*& p, const uint8_t* end, uint64_t& value) {
+            value = 0;
+            for (int shift = 0; shift <= 63; shift += 7) {
+                if (p == end) {
+                    return false;
+                }
+                const uint8_t byte = *p++;
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool get_xor(const uint8_t*& p, const uint8_t* end, double& value) {
+            if (p == end) {
+                return false;
+            }
+            const uint8_t control = *p++;
+            const int length = control & 0x0F;
+            const int trailing = control >> 4;
+            if (length > 8 || trailing + length > 8 || end - p < length) {
+                return false;
+            }
+            uint64_t payload = 0;
+            for (int i = 0; i < length; ++i) {
+                payload |= static_cast<uint64_t>(p[i]) << (8 * i);
+            }
+            p += length;
+            value = std::bit_cast<double>(std::bit_cast<uint64_t>(value) ^ (payload << (8 * trailing)));
+            return true;
+        }
+
+        void encode_record(const OrderBook& book, const OrderBook& previous, const int64_t prev_ts,
+                           const bool keyframe, std::vector<uint8_t>& out) {
+            out.push_back(keyframe ? kKeyframeRecord : kDeltaRecord);
+            put_varint(zigzag(static_cast<uint64_t>(book.timestamp.microseconds()) -
+                              static_cast<uint64_t>(prev_ts)), out);
+            uint8_t changes[kSlots];
+            size_t change_count = 0;
+            for (size_t slot = 0; slot < kSlots; ++slot) {
+                const auto& now = level_at(book, slot);
+                const auto& before = level_at(previous, slot);
+                uint8_t change = 0;
+                if (!same_bits(now.price, before.price)) change |= kPriceChanged;
+                if (!same_bits(now.quantity, before.quantity)) change |= kQuantityChanged;
+                if (now.num_orders != before.num_orders) change |= kOrdersChanged;
+                if (change != 0) {
+                    changes[change_count++] = static_cast<uint8_t>(change | slot);
+                }
+            }
+            out.push_back(static_cast<uint8_t>(change_count));
+            for (size_t i = 0; i < change_count; ++i) {
+                const uint8_t change = changes[i];
+                const size_t slot = change & kSlotMask;
+                const auto& now = level_at(book, slot);
+                const auto& before = level_at(previous, slot);
+                out.push_back(change);
+                if (change & kPriceChanged) put_xor(now.price, before.price, out);
+                if (change & kQuantityChanged) put_xor(now.quantity, before.quantity, out);
+                if (change & kOrdersChanged) {
+                    put_varint(zigzag(static_cast<uint64_t>(static_cast<int64_t>(now.num_orders) -
+                                                            before.num_orders)), out);
+                }
+            }
+        }
+
+    }  // namespace
+
+    OrderBookDeltaFile::Cursor::Cursor(const OrderBookDeltaFile& file) : file_(&file) {
+        seek(0);
+    }
+
+    void OrderBookDeltaFile::Cursor::seek(const size_t keyframe) {
+        book_ = OrderBook{};
+        book_.symbol = file_->symbol_id();
+        if (keyframe >= file_->keyframes_.size()) {
+            pos_ = file_->data_end_;
+            end_ = file_->data_end_;
+            next_index_ = file_->book_count();
+            return;
+        }
+        const auto& entry = file_->keyframes_[keyframe];
+        pos_ = file_->data_ + (entry.offset - file_->header_->data_offset);
+        end_ = file_->data_end_;
+        next_index_ = static_cast<size_t>(entry.book_index);
+    }
+
+    bool OrderBookDeltaFile::Cursor::advance() {
+        if (pos_ == end_) {
+            return false;
+        }
+        const uint8_t kind = *pos_++;
+        if (kind == kKeyframeRecord) {
+            book_.bids = {};
+            book_.asks = {};
+            book_.timestamp = Timestamp(0);
+        } else if (kind != kDeltaRecord) {
+            throw std::runtime_error("OrderBookDeltaFile: corrupt record");
+        }
+        uint64_t ts_delta = 0;
+        if (!get_varint(pos_, end_, ts_delta) || pos_ == end_) {
+            throw std::runtime_error("OrderBookDeltaFile: corrupt record");
+        }
+        book_.timestamp = Timestamp(static_cast<int64_t>(
+            static_cast<uint64_t>(book_.timestamp.microseconds()) + unzigzag(ts_delta)));
+        const uint8_t change_count = *pos_++;
+        for (uint8_t i = 0; i < change_count; ++i) {
+            if (pos_ == end_) {
+                throw std::runtime_error("OrderBookDeltaFile: corrupt record");
+            }
+            const uint8_t change = *pos_++;
+            const size_t slot = change & kSlotMask;
+            if (slot >= kSlots) {
+                throw std::runtime_error("OrderBookDeltaFile: corrupt record");
+            }
+            auto& level = level_at(book_, slot);
+            bool ok = true;
+            if (change & kPriceChanged) ok = ok && get_xor(pos_, end_, level.price);
+            if (change & kQuantityChanged) ok = ok && get_xor(pos_, end_, level.quantity);
+            if (change & kOrdersChanged) {
+                uint64_t diff = 0;
+                ok = ok && get_varint(pos_, end_, diff);
+                level.num_orders = static_cast<int>(level.num_orders + static_cast<int64_t>(unzigzag(diff)));
+            }
+            if (!ok) {
+                throw std::runtime_error("OrderBookDeltaFile: corrupt record");
+            }
+        }
+        ++next_index_;
+        return true;
+    }
+
+    OrderBookDeltaFile::OrderBookDeltaFile(const std::string& path) {
+        try {
+            map_file(path);
+        } catch (...) {
+            unmap_file();
+            throw;
+        }
+    }
+
+    OrderBookDeltaFile::~OrderBookDeltaFile() {
+        unmap_file();
+    }
+
+    TimeRange OrderBookDeltaFile::time_range() const {
+        TimeRange range;
+        range.start = Timestamp(header_->start_timestamp);
+        range.end = Timestamp(header_->end_timestamp);
+        return range;
+    }
+
+    size_t OrderBookDeltaFile::keyframe_for(const size_t index) const {
+        const auto it = std::ranges::partition_point(keyframes_, [&](const BookKeyframeEntry& k) {
+            return k.book_index <= index;
+        });
+        return it == keyframes_.begin() ? 0 : static_cast<size_t>(it - keyframes_.begin()) - 1;
+    }
+
+    std::pair<size_t, size_t> OrderBookDeltaFile::find_range(const TimeRange range) const {
+        const size_t count = book_count();
+        if (count == 0) {
+            return {0, 0};
+        }
+        if (range.start.microseconds() == 0 && range.end.microseconds() == 0) {
+            return {0, count};
+        }
+        const size_t start = first_at_or_after(range.start.microseconds(), true);
+        const size_t end = first_at_or_after(range.end.microseconds(), false);
+        return {start, std::max(start, end)};
+    }
+
+    size_t OrderBookDeltaFile::first_at_or_after(const int64_t timestamp, const bool inclusive) const {
+        // Start from the last keyframe strictly before the boundary so equal
+        // timestamps spanning a keyframe are not skipped.
+        const auto it = std::ranges::partition_point(keyframes_, [&](const BookKeyframeEntry& k) {
+            return inclusive ? k.timestamp < timestamp : k.timestamp <= timestamp;
+        });
+        Cursor cursor(*this);
+        cursor.seek(it == keyframes_.begin() ? 0 : static_cast<size_t>(it - keyframes_.begin()) - 1);
+        while (cursor.advance()) {
+            const int64_t ts = cursor.book().timestamp.microseconds();
+            if (inclusive ? ts >= timestamp : ts > timestamp) {
+                return cursor.next_index() - 1;
+            }
+        }
+        return book_count();
+    }
+
+    void OrderBookDeltaFile::map_file(const std::string& path) {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("OrderBookDeltaFile: open failed");
+        }
+        LARGE_INTEGER size {};
+        if (!GetFileSizeEx(file, &size)) {
+            CloseHandle(file);
+            throw std::runtime_error("OrderBookDeltaFile: stat failed");
+        }
+        if (size.QuadPart < static_cast<LONGLONG>(sizeof(BookDeltaFileHeader))) {
+            CloseHandle(file);
+            throw std::runtime_error("OrderBookDeltaFile: file too small");
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            CloseHandle(file);
+            throw std::runtime_error("OrderBookDeltaFile: mmap failed");
+        }
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            throw std::runtime_error("OrderBookDeltaFile: mmap failed");
+        }
+        file_handle_ = file;
+        mapping_handle_ = mapping;
+        mapping_ = view;
+        file_size_ = static_cast<size_t>(size.QuadPart);
+#else
+        fd_ = ::open(path.c_str(), O_RDONLY);
+        if (fd_ < 0) {
+            throw std::runtime_error("OrderBookDeltaFile: open failed: " +
+                                     std::string(std::strerror(errno)));
+        }
+
+        struct stat st {};
+        if (::fstat(fd_, &st) != 0) {
+            const int err = errno;
+            ::close(fd_);
+            fd_ = -1;
+            throw std::runtime_error("OrderBookDeltaFile: stat failed: " +
+                                     std::string(std::strerror(err)));
+        }
+
+        if (st.st_size < static_cast<off_t>(sizeof(BookDeltaFileHeader))) {
+            ::close(fd_);
+            fd_ = -1;
+            throw std::runtime_error("OrderBookDeltaFile: file too small");
+        }
+
+        file_size_ = static_cast<size_t>(st.st_size);
+        mapping_ = ::mmap(nullptr, file_size_, PROT_READ, MAP_SHARED, fd_, 0);
+        if (mapping_ == MAP_FAILED) {
+            mapping_ = nullptr;
+            ::close(fd_);
+            fd_ = -1;
+            throw std::runtime_error("OrderBookDeltaFile: mmap failed");
+        }
+#endif
+
+        header_ = static_cast<const BookDeltaFileHeader*>(mapping_);
+        if (std::memcmp(header_->magic, kMagic, sizeof(kMagic)) != 0) {
+            throw std::runtime_error("OrderBookDeltaFile: invalid magic");
+        }
+        if (header_->version != kFileVersion) {
+            throw std::runtime_error("OrderBookDeltaFile: unsupported version");
+        }
+        if (header_->level_count != kLevels) {
+            throw std::runtime_error("OrderBookDeltaFile: unsupported level count");
+        }
+        const uint64_t data_offset = header_->data_offset;
+        const uint64_t index_offset = header_->index_offset;
+        const uint64_t index_bytes = header_->keyframe_count * sizeof(BookKeyframeEntry);
+        if (data_offset > index_offset || index_offset > file_size_ ||
+            header_->keyframe_count > (file_size_ - index_offset) / sizeof(BookKeyframeEntry) ||
+            index_bytes > file_size_ - index_offset) {
+            throw std::runtime_error("OrderBookDeltaFile: sections out of range");
+        }
+        const auto* base = static_cast<const uint8_t*>(mapping_);
+        data_ = base + data_offset;
+        data_end_ = base + index_offset;
+        keyframes_ = {reinterpret_cast<const BookKeyframeEntry*>(base + index_offset),
+                      static_cast<size_t>(header_->keyframe_count)};
+        for (const auto& entry : keyframes_) {
+            if (entry.offset < data_offset || entry.offset >= index_offset ||
+                entry.book_index >= header_->book_count) {
+                throw std::runtime_error("OrderBookDeltaFile: keyframe out of range");
+            }
+        }
+        if (header_->book_count > 0 && (keyframes_.empty() || keyframes_.front().book_index != 0)) {
+            throw std::runtime_error("OrderBookDeltaFile: missing first keyframe");
+        }
+
+        symbol_ = std::string(trim_nulls(header_->symbol, sizeof(header_->symbol)));
+        symbol_id_ = SymbolRegistry::instance().intern(symbol_);
+    }
+
+    void OrderBookDeltaFile::unmap_file() {
+        if (mapping_) {
+#if defined(_WIN32)
+            UnmapViewOfFile(mapping_);
+#else
+            ::munmap(mapping_, file_size_);
+#endif
+            mapping_ = nullptr;
+        }
+#if defined(_WIN32)
+        if (mapping_handle_) {
+            CloseHandle(static_cast<HANDLE>(mapping_handle_));
+            mapping_handle_ = nullptr;
+        }
+        if (file_handle_) {
+            CloseHandle(static_cast<HANDLE>(file_handle_));
+            file_handle_ = nullptr;
+        }
+#else
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+#endif
+        file_size_ = 0;
+        header_ = nullptr;
+        data_ = nullptr;
+        data_end_ = nullptr;
+        keyframes_ = {};
+    }
+
+    OrderBookDeltaWriter::OrderBookDeltaWriter(const uint32_t keyframe_interval)
+        : keyframe_interval_(std::max<uint32_t>(keyframe_interval, 1)) {}
+
+    Result<void> OrderBookDeltaWriter::write_books(const std::string& path,
+                                                   const std::string& symbol,
+                                                   std::vector<OrderBook> books) const {
+        std::ranges::stable_sort(books, [](const OrderBook& a, const OrderBook& b) {
+            return a.timestamp < b.timestamp;
+        });
+        if (auto validation = OrderBookMmapWriter::validate_books(books); validation.is_err()) {
+            return validation;
+        }
+
+        BookDeltaFileHeader header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kFileVersion;
+        std::memset(header.symbol, 0, sizeof(header.symbol));
+#if defined(_WIN32)
+        strncpy_s(header.symbol, sizeof(header.symbol), symbol.c_str(), _TRUNCATE);
+#else
+        std::strncpy(header.symbol, symbol.c_str(), sizeof(header.symbol) - 1);
+#endif
+        header.level_count = kLevels;
+        header.keyframe_interval = keyframe_interval_;
+        if (!books.empty()) {
+            header.start_timestamp = books.front().timestamp.microseconds();
+            header.end_timestamp = books.back().timestamp.microseconds();
+        }
+        header.book_count = books.size();
+        header.data_offset = sizeof(BookDeltaFileHeader);
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return Result<void>(Error(Error::Code::IoError, "Unable to open book delta output file"));
+        }
+        write_bytes(out, &header, sizeof(header), nullptr);
+
+        Sha256 sha;
+        std::vector<BookKeyframeEntry> keyframes;
+        std::vector<uint8_t> buffer;
+        const OrderBook empty{};
+        uint64_t offset = header.data_offset;
+        for (size_t i = 0; i < books.size(); ++i) {
+            const bool keyframe = i % keyframe_interval_ == 0;
+            if (keyframe) {
+                keyframes.push_back({books[i].timestamp.microseconds(), i, offset + buffer.size()});
+            }
+            encode_record(books[i], keyframe ? empty : books[i - 1],
+                          keyframe ? 0 : books[i - 1].timestamp.microseconds(), keyframe, buffer);
+            if (buffer.size() >= (1u << 20)) {
+                write_bytes(out, buffer.data(), buffer.size(), &sha);
+                offset += buffer.size();
+                buffer.clear();
+            }
+        }
+        write_bytes(out, buffer.data(), buffer.size(), &sha);
+        offset += buffer.size();
+        write_bytes(out, keyframes.data(), keyframes.size() * sizeof(BookKeyframeEntry), &sha);
+
+        header.keyframe_count = keyframes.size();
+        header.index_offset = offset;
+        auto checksum = sha.digest();
+        std::memcpy(header.checksum, checksum.data(), checksum.size());
+        out.seekp(0);
+        write_bytes(out, &header, sizeof(header), nullptr);
+        if (!out) {
+            return Result<void>(Error(Error::Code::IoError, "Failed to write book delta file"));
+        }
+        return Ok();
+    }
+
+    OrderBookDeltaIterator::OrderBookDeltaIterator(std::shared_ptr<const OrderBookDeltaFile> file,
+                                                   const TimeRange range)
+        : file_(std::move(file)) {
+        if (!file_) {
+            return;
+        }
+        std::tie(begin_, end_) = file_->find_range(range);
+        cursor_ = std::make_unique<OrderBookDeltaFile::Cursor>(*file_);
+        reset();
+    }
+
+    bool OrderBookDeltaIterator::has_next() const {
+        return index_ < end_;
+    }
+
+    OrderBook OrderBookDeltaIterator::next() {
+        if (!has_next()) {
+            throw std::out_of_range("No more order books");
+        }
+        OrderBook book = cursor_->book();
+        if (++index_ < end_) {
+            cursor_->advance();
+        }
+        return book;
+    }
+
+    void OrderBookDeltaIterator::reset() {
+        index_ = begin_;
+        if (!cursor_ || begin_ >= end_) {
+            return;
+        }
+        cursor_->seek(file_->keyframe_for(begin_));
+        while (cursor_->next_index() <= begin_ && cursor_->advance()) {
+        }
+    }
+}  // namespace regimeflow::data
@@ -2,6 +2,7 @@
 
 #include "regimeflow/common/sha256.h"
 #include "regimeflow/common/types.h"
+#include "regimeflow/data/as_of_cache.h"
 
 #include <algorithm>
 #include <array>
@@ -9,6 +10,7 @@
 #include <cmath>
 #include <cstddef>
 #include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <limits>
 #include <stdexcept>
@@ -86,8 +88,61 @@ namespace regimeflow::data
             }
         }
 
+        Result<void> check_book(const OrderBook& book, const bool first, const Timestamp last) {
+            if (book.timestamp.microseconds() <= 0) {
+                return Result<void>(Error(Error::Code::InvalidArgument, "Book timestamp must be positive"));
+            }
+            if (!first && book.timestamp < last) {
+                return Result<void>(Error(Error::Code::InvalidArgument, "Books must be sorted by timestamp"));
+            }
+            return Ok();
+        }
+
+        constexpr int64_t kMicrosPerDay = 86'400'000'000LL;
+        // Bid price, quantity and order count, then the same for asks, per level.
+        constexpr size_t kLevelFields = 6;
+        constexpr size_t kSpillColumns = kLevelFields * kLevels;
+
     }  // namespace
 
+    struct OrderBookMmapWriter::Stream {
+        Stream(const std::string& output, const size_t rows)
+            : path(output), buffer_rows(rows),
+              spill(output + ".spill", std::vector<size_t>(kSpillColumns, sizeof(double))) {
+            timestamps.reserve(rows);
+            for (auto& field : fields) {
+                field.resize(rows * kLevels);
+            }
+        }
+
+        // Row `row` of level `level` of one field.
+        void* cell(const size_t field, const size_t level, const size_t row) {
+            return fields[field].data() + level * buffer_rows + row;
+        }
+
+        std::string path;
+        size_t buffer_rows;
+        std::ofstream out;
+        BookFileHeader header{};
+        Sha256 sha;
+        std::vector<int64_t> timestamps;
+        std::array<std::vector<uint64_t>, kLevelFields> fields;
+        ColumnSpill spill;
+        std::vector<BookDateIndex> index;
+        int64_t last_day = 0;
+        uint64_t count = 0;
+        Timestamp last;
+    };
+
+    OrderBookMmapWriter::OrderBookMmapWriter() = default;
+    OrderBookMmapWriter::~OrderBookMmapWriter() {
+        if (stream_) {
+            fail_stream(Ok());
+        }
+    }
+    OrderBookMmapWriter::OrderBookMmapWriter(OrderBookMmapWriter&&) noexcept = default;
+    OrderBookMmapWriter& OrderBookMmapWriter::operator=(OrderBookMmapWriter&&) noexcept = default;
+
     OrderBookMmapFile::OrderBookMmapFile(const std::string& path) {
         map_file(path);
     }
@@ -172,6 +227,10 @@ namespace regimeflow::data
         return header_ ? static_cast<size_t>(header_->book_count) : 0;
     }
 
+    std::span<const int64_t> OrderBookMmapFile::timestamps() const {
+        return {timestamps_, book_count()};
+    }
+
     OrderBook OrderBookMmapFile::at(size_t index) const {
         if (!header_ || index >= header_->book_count) {
             throw std::out_of_range("OrderBookMmapFile: index out of range");
@@ -207,6 +266,35 @@ namespace regimeflow::data
                 static_cast<size_t>(end_it - timestamps_)};
     }
 
+    std::optional<size_t> OrderBookMmapFile::find_as_of(const Timestamp ts) const {
+        std::span<const BookDateIndex> index;
+        if (date_index_) {
+            index = {date_index_, (file_size_ - static_cast<size_t>(header_->index_offset)) / sizeof(BookDateIndex)};
+        }
+        return find_as_of_row(timestamps(), index, ts.microseconds());
+    }
+
+    std::vector<MmapColumn> OrderBookMmapFile::columns() const {
+        if (!header_) {
+            return {};
+        }
+        return {{timestamps_, sizeof(int64_t)},
+                {bid_prices_, sizeof(double) * kLevels},
+                {bid_qty_, sizeof(double) * kLevels},
+                {bid_orders_, sizeof(int64_t) * kLevels},
+                {ask_prices_, sizeof(double) * kLevels},
+                {ask_qty_, sizeof(double) * kLevels},
+                {ask_orders_, sizeof(int64_t) * kLevels}};
+    }
+
+    void OrderBookMmapFile::advise(const MmapAccessPolicy policy, const size_t begin, const size_t end) const {
+        advise_mmap_rows(mapping_, file_size_, columns(), begin, end, policy);
+    }
+
+    void OrderBookMmapFile::advise_huge_pages() const {
+        advise_mmap_huge_pages(mapping_, file_size_);
+    }
+
     void OrderBookMmapFile::map_file(const std::string& path) {
 #if defined(_WIN32)
         HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
@@ -451,24 +539,167 @@ namespace regimeflow::data
         return Ok();
     }
 
-    Result<void> OrderBookMmapWriter::validate_books(const std::vector<OrderBook>& books) const {
-        if (books.empty()) {
+    Result<void> OrderBookMmapWriter::validate_books(const std::vector<OrderBook>& books) {
+        for (size_t i = 0; i < books.size(); ++i) {
+            if (auto check = check_book(books[i], i == 0, i > 0 ? books[i - 1].timestamp : Timestamp());
+                check.is_err()) {
+                return check;
+            }
+        }
+        return Ok();
+    }
+
+    Result<void> OrderBookMmapWriter::open(const std::string& path, const std::string& symbol,
+                                           const size_t buffer_rows) {
+        if (stream_) {
+            return Result<void>(Error(Error::Code::InvalidState, "Order book mmap stream already open"));
+        }
+        auto stream = std::make_unique<Stream>(path, std::max<size_t>(buffer_rows, 1));
+        stream->out.open(path, std::ios::binary | std::ios::trunc);
+        if (!stream->out) {
+            return Result<void>(Error(Error::Code::IoError, "Unable to open order book mmap output file"));
+        }
+        auto& header = stream->header;
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kFileVersion;
+        header.flags = 0;
+        std::memset(header.symbol, 0, sizeof(header.symbol));
+#if defined(_WIN32)
+        strncpy_s(header.symbol, sizeof(header.symbol), symbol.c_str(), _TRUNCATE);
+#else
+        std::strncpy(header.symbol, symbol.c_str(), sizeof(header.symbol) - 1);
+#endif
+        header.level_count = kLevels;
+        header.data_offset = sizeof(BookFileHeader);
+        write_bytes(stream->out, &header, sizeof(header), nullptr);
+        stream_ = std::move(stream);
+        return Ok();
+    }
+
+    Result<void> OrderBookMmapWriter::append(const std::span<const OrderBook> books) {
+        if (!stream_) {
+            return Result<void>(Error(Error::Code::InvalidState, "Order book mmap stream not open"));
+        }
+        auto& s = *stream_;
+        for (const auto& book : books) {
+            if (auto check = check_book(book, s.count == 0, s.last); check.is_err()) {
+                return fail_stream(std::move(check));
+            }
+            // Dates only change when the UTC day does; skip formatting otherwise.
+            const int64_t us = book.timestamp.microseconds();
+            if (const int64_t day = us / kMicrosPerDay; s.count == 0 || day != s.last_day) {
+                const int32_t date = yyyymmdd_from_timestamp(book.timestamp);
+                if (s.index.empty() || s.index.back().date_yyyymmdd != date) {
+                    s.index.push_back(BookDateIndex{date, s.count});
+                }
+                s.last_day = day;
+            }
+            if (s.count == 0) {
+                s.header.start_timestamp = us;
+            }
+            const size_t row = s.timestamps.size();
+            for (size_t level = 0; level < kLevels; ++level) {
+                const auto& bid = book.bids[level];
+                const auto& ask = book.asks[level];
+                const int64_t bid_orders = bid.num_orders;
+                const int64_t ask_orders = ask.num_orders;
+                std::memcpy(s.cell(0, level, row), &bid.price, sizeof(double));
+                std::memcpy(s.cell(1, level, row), &bid.quantity, sizeof(double));
+                std::memcpy(s.cell(2, level, row), &bid_orders, sizeof(int64_t));
+                std::memcpy(s.cell(3, level, row), &ask.price, sizeof(double));
+                std::memcpy(s.cell(4, level, row), &ask.quantity, sizeof(double));
+                std::memcpy(s.cell(5, level, row), &ask_orders, sizeof(int64_t));
+            }
+            s.timestamps.push_back(us);
+            s.last = book.timestamp;
+            ++s.count;
+            if (s.timestamps.size() == s.buffer_rows) {
+                if (auto flushed = flush_stream(); flushed.is_err()) {
+                    return fail_stream(std::move(flushed));
+                }
+            }
+        }
+        return Ok();
+    }
+
+    Result<void> OrderBookMmapWriter::flush_stream() {
+        auto& s = *stream_;
+        const size_t rows = s.timestamps.size();
+        if (rows == 0) {
             return Ok();
         }
-        Timestamp last = books.front().timestamp;
-        for (size_t i = 0; i < books.size(); ++i) {
-            const auto& book = books[i];
-            if (book.timestamp.microseconds() <= 0) {
-                return Result<void>(Error(Error::Code::InvalidArgument, "Book timestamp must be positive"));
+        write_bytes(s.out, s.timestamps.data(), rows * sizeof(int64_t), &s.sha);
+        std::array<const void*, kSpillColumns> columns{};
+        for (size_t field = 0; field < kLevelFields; ++field) {
+            for (size_t level = 0; level < kLevels; ++level) {
+                columns[field * kLevels + level] = s.cell(field, level, 0);
             }
-            if (i > 0 && book.timestamp < last) {
-                return Result<void>(Error(Error::Code::InvalidArgument, "Books must be sorted by timestamp"));
+        }
+        if (auto spilled = s.spill.add_block(rows, columns); spilled.is_err()) {
+            return spilled;
+        }
+        s.timestamps.clear();
+        return s.out ? Ok()
+                     : Result<void>(Error(Error::Code::IoError, "Unable to write order book mmap output file"));
+    }
+
+    Result<void> OrderBookMmapWriter::finalize() {
+        if (!stream_) {
+            return Result<void>(Error(Error::Code::InvalidState, "Order book mmap stream not open"));
+        }
+        auto& s = *stream_;
+        if (s.spill.empty()) {
+            // Everything fit in the buffers: write the columns directly.
+            const size_t rows = s.timestamps.size();
+            write_bytes(s.out, s.timestamps.data(), rows * sizeof(int64_t), &s.sha);
+            for (size_t field = 0; field < kLevelFields; ++field) {
+                for (size_t level = 0; level < kLevels; ++level) {
+                    write_bytes(s.out, s.cell(field, level, 0), rows * sizeof(double), &s.sha);
+                }
+            }
+        } else {
+            if (auto flushed = flush_stream(); flushed.is_err()) {
+                return fail_stream(std::move(flushed));
+            }
+            for (size_t column = 0; column < kSpillColumns; ++column) {
+                if (auto copied = s.spill.copy_column(column, s.out, s.sha); copied.is_err()) {
+                    return fail_stream(std::move(copied));
+                }
             }
-            last = book.timestamp;
         }
+        if (!s.index.empty()) {
+            write_date_index(s.out, s.index);
+        }
+
+        auto& header = s.header;
+        if (s.count > 0) {
+            header.end_timestamp = s.last.microseconds();
+        }
+        header.book_count = s.count;
+        const size_t data_bytes = s.count * (sizeof(int64_t) + kSpillColumns * sizeof(double));
+        header.index_offset = header.data_offset + static_cast<uint64_t>(data_bytes);
+        auto checksum = s.sha.digest();
+        std::memcpy(header.checksum, checksum.data(), checksum.size());
+        s.out.seekp(0);
+        write_bytes(s.out, &header, sizeof(header), nullptr);
+        s.out.close();
+        if (!s.out) {
+            return fail_stream(Result<void>(Error(Error::Code::IoError,
+                                                  "Unable to write order book mmap output file")));
+        }
+        stream_.reset();
         return Ok();
     }
 
+    Result<void> OrderBookMmapWriter::fail_stream(Result<void> error) {
+        const std::string path = stream_->path;
+        stream_->out.close();
+        stream_.reset();
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        return error;
+    }
+
     std::vector<BookDateIndex> OrderBookMmapWriter::build_date_index(
         const std::vector<OrderBook>& books) {
         std::vector<BookDateIndex> index;
@@ -11,7 +11,7 @@ namespace regimeflow::data
     namespace {
 
         std::optional<std::string> extract_symbol(const std::filesystem::path& path) {
-            if (path.extension() != ".rfob") {
+            if (path.extension() != ".rfob" && path.extension() != ".rfobd") {
                 return std::nullopt;
             }
             return path.stem().string();
@@ -31,8 +31,7 @@ namespace regimeflow::data
 
     OrderBookMmapDataSource::OrderBookMmapDataSource(const Config& config)
         : config_(config),
-          file_cache_(config.max_cached_files),
-          range_cache_(config.max_cached_ranges) {}
+          caches_(config.shared_caches ? config.shared_caches : Caches::create(config)) {}
 
     std::vector<SymbolInfo> OrderBookMmapDataSource::get_available_symbols() const {
         std::vector<SymbolInfo> symbols;
@@ -70,11 +69,13 @@ namespace regimeflow::data
 
     TimeRange OrderBookMmapDataSource::get_available_range(SymbolId symbol) const {
         symbol = adjuster_.resolve_symbol(symbol);
-        const auto file = get_file(symbol);
-        if (!file) {
-            return {};
+        if (const auto file = get_file(symbol)) {
+            return file->time_range();
+        }
+        if (const auto delta = get_delta_file(symbol)) {
+            return delta->time_range();
         }
-        return file->time_range();
+        return {};
     }
 
     std::vector<Bar> OrderBookMmapDataSource::get_bars(SymbolId, TimeRange, BarType) {
@@ -88,31 +89,63 @@ namespace regimeflow::data
     std::vector<OrderBook> OrderBookMmapDataSource::get_order_books(SymbolId symbol, TimeRange range) {
         symbol = adjuster_.resolve_symbol(symbol, range.start);
         std::string cache_key;
-        if (config_.max_cached_ranges > 0) {
+        if (caches_->ranges.enabled()) {
             cache_key = make_range_key(symbol, range);
-            if (const auto cached = range_cache_.get(cache_key)) {
+            if (const auto cached = caches_->ranges.get(cache_key)) {
                 return **cached;
             }
         }
 
         std::vector<OrderBook> result;
-        const auto file = get_file(symbol);
-        if (!file) {
+        if (const auto file = get_file(symbol)) {
+            auto [start, end] = file->find_range(range);
+            file->advise(config_.access_policy, start, end);
+            result.reserve(end - start);
+            for (size_t i = start; i < end; ++i) {
+                result.push_back(file->at(i));
+            }
+        } else if (const auto delta = get_delta_file(symbol)) {
+            OrderBookDeltaIterator iter(delta, range);
+            while (iter.has_next()) {
+                result.push_back(iter.next());
+            }
+        } else {
             return result;
         }
-        auto [start, end] = file->find_range(range);
-        result.reserve(end - start);
-        for (size_t i = start; i < end; ++i) {
-            result.push_back(file->at(i));
-        }
-        if (config_.max_cached_ranges > 0) {
+        if (caches_->ranges.enabled()) {
             const auto shared = std::make_shared<std::vector<OrderBook>>(result);
-            range_cache_.put(cache_key, shared);
+            caches_->ranges.put(cache_key, shared);
             return *shared;
         }
         return result;
     }
 
+    std::optional<OrderBook> OrderBookMmapDataSource::get_order_book_as_of(const SymbolId symbol,
+                                                                          const Timestamp ts) {
+        const int64_t us = ts.microseconds();
+        const auto key = AsOfCache<OrderBook>::make_key(symbol);
+        std::shared_ptr<const OrderBookMmapFile> file;
+        if (const auto* entry = book_as_of_.find(key)) {
+            if (entry->covers(us)) {
+                return entry->row;
+            }
+            file = entry->owner;
+        }
+        if (!file) {
+            file = get_file(adjuster_.resolve_symbol(symbol, ts));
+        }
+        if (!file) {
+            return DataSource::get_order_book_as_of(symbol, ts);
+        }
+        const auto row = file->find_as_of(ts);
+        std::optional<OrderBook> book;
+        if (row) {
+            book = file->at(*row);
+        }
+        book_as_of_.store_row(key, file->timestamps(), row, book, file);
+        return book;
+    }
+
     std::unique_ptr<DataIterator> OrderBookMmapDataSource::create_iterator(
         const std::vector<SymbolId>& symbols,
         const TimeRange range,
@@ -144,6 +177,14 @@ namespace regimeflow::data
         std::vector<std::unique_ptr<OrderBookIterator>> iterators;
         iterators.reserve(symbols.size());
         for (const SymbolId symbol : symbols) {
+            // Delta files replay incrementally instead of loading the range.
+            const SymbolId resolved = adjuster_.resolve_symbol(symbol, range.start);
+            if (!get_file(resolved)) {
+                if (auto delta = get_delta_file(resolved)) {
+                    iterators.push_back(std::make_unique<OrderBookDeltaIterator>(std::move(delta), range));
+                    continue;
+                }
+            }
             auto books = get_order_books(symbol, range);
             iterators.push_back(std::make_unique<VectorOrderBookIterator>(std::move(books)));
         }
@@ -158,6 +199,7 @@ namespace regimeflow::data
     void OrderBookMmapDataSource::set_corporate_actions(const SymbolId symbol,
                                                         std::vector<CorporateAction> actions) {
         adjuster_.add_actions(symbol, std::move(actions));
+        book_as_of_.clear();
     }
 
     std::shared_ptr<OrderBookMmapFile> OrderBookMmapDataSource::get_file(SymbolId symbol) const {
@@ -172,12 +214,43 @@ namespace regimeflow::data
         path /= symbol_name + ".rfob";
         std::string key = path.string();
 
-        if (auto cached = file_cache_.get(key)) {
+        if (auto cached = caches_->files.get(key)) {
             return *cached;
         }
+        // Symbols stored only as deltas are served by get_delta_file instead.
+        if (!std::filesystem::exists(path) && std::filesystem::exists(path.string() + "d")) {
+            return nullptr;
+        }
 
         auto file = std::make_shared<OrderBookMmapFile>(key);
-        file_cache_.put(key, file);
+        if (config_.huge_pages) {
+            file->advise_huge_pages();
+        }
+        caches_->files.put(key, file);
+        return file;
+    }
+
+    std::shared_ptr<OrderBookDeltaFile> OrderBookMmapDataSource::get_delta_file(
+        const SymbolId symbol) const {
+        if (config_.data_directory.empty()) {
+            return nullptr;
+        }
+        const auto& symbol_name = SymbolRegistry::instance().lookup(symbol);
+        if (symbol_name.empty()) {
+            return nullptr;
+        }
+        std::filesystem::path path = config_.data_directory;
+        path /= symbol_name + ".rfobd";
+        std::string key = path.string();
+
+        if (auto cached = caches_->packed.get(key)) {
+            return *cached;
+        }
+        if (!std::filesystem::exists(path)) {
+            return nullptr;
+        }
+        auto file = std::make_shared<OrderBookDeltaFile>(key);
+        caches_->packed.put(key, file);
         return file;
     }
 }  // namespace regimeflow::data
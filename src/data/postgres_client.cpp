@@ -426,6 +426,77 @@ namespace regimeflow::data
         return out;
     }
 
+    std::optional<Bar> PostgresDbClient::query_bar_as_of(const SymbolId symbol, const Timestamp ts,
+                                                         const BarType bar_type) {
+        const auto type = config_.bars_has_bar_type ? std::optional<BarType>(bar_type) : std::nullopt;
+        const auto at = latest_timestamp(config_.bars_table, symbol, ts, type);
+        if (!at) {
+            return std::nullopt;
+        }
+        auto bars = query_bars(symbol, TimeRange{Timestamp(*at), Timestamp(*at)}, bar_type);
+        if (bars.empty()) {
+            return std::nullopt;
+        }
+        return bars.back();
+    }
+
+    std::optional<Tick> PostgresDbClient::query_tick_as_of(const SymbolId symbol, const Timestamp ts) {
+        const auto at = latest_timestamp(config_.ticks_table, symbol, ts, std::nullopt);
+        if (!at) {
+            return std::nullopt;
+        }
+        auto ticks = query_ticks(symbol, TimeRange{Timestamp(*at), Timestamp(*at)});
+        if (ticks.empty()) {
+            return std::nullopt;
+        }
+        return ticks.back();
+    }
+
+    std::optional<OrderBook> PostgresDbClient::query_order_book_as_of(const SymbolId symbol, const Timestamp ts) {
+        const auto at = latest_timestamp(config_.order_books_table, symbol, ts, std::nullopt);
+        if (!at) {
+            return std::nullopt;
+        }
+        auto books = query_order_books(symbol, TimeRange{Timestamp(*at), Timestamp(*at)});
+        if (books.empty()) {
+            return std::nullopt;
+        }
+        return books.back();
+    }
+
+    std::optional<int64_t> PostgresDbClient::latest_timestamp(const std::string& table, const SymbolId symbol,
+                                                              const Timestamp ts,
+                                                              const std::optional<BarType> bar_type) {
+        std::optional<int64_t> out;
+#ifdef REGIMEFLOW_USE_LIBPQ
+        const auto& symbol_name = SymbolRegistry::instance().lookup(symbol);
+        if (symbol_name.empty()) {
+            return out;
+        }
+        std::string sql = "SELECT MAX(timestamp) FROM " + table + " WHERE symbol = $1 AND timestamp <= $2";
+        std::vector<std::string> params = {symbol_name, std::to_string(ts.microseconds())};
+        if (bar_type) {
+            sql += " AND bar_type = $3";
+            params.push_back(std::to_string(static_cast<int>(*bar_type)));
+        }
+        auto result = execute_query(sql, params, [&](void* row) {
+            auto* res = static_cast<PGresult*>(row);
+            if (PQntuples(res) > 0 && !PQgetisnull(res, 0, 0)) {
+                out = std::stoll(PQgetvalue(res, 0, 0));
+            }
+        });
+        if (result.is_err()) {
+            throw std::runtime_error(result.error().message);
+        }
+#else
+        (void)table;
+        (void)symbol;
+        (void)ts;
+        (void)bar_type;
+#endif
+        return out;
+    }
+
     Result<void> PostgresDbClient::execute_query(const std::string& sql,
                                                  const std::vector<std::string>& params,
                                                  std::function<void(void*)> row_handler) {
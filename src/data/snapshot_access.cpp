@@ -13,37 +13,16 @@ namespace regimeflow::data
 
     std::optional<Bar> SnapshotAccess::bar_at(const SymbolId symbol, const Timestamp ts, const BarType bar_type) const
     {
-        TimeRange range;
-        range.start = Timestamp(0);
-        range.end = ts;
-        auto bars = source_->get_bars(symbol, range, bar_type);
-        if (bars.empty()) {
-            return std::nullopt;
-        }
-        return bars.back();
+        return source_->get_bar_as_of(symbol, ts, bar_type);
     }
 
     std::optional<Tick> SnapshotAccess::tick_at(const SymbolId symbol, const Timestamp ts) const
     {
-        TimeRange range;
-        range.start = Timestamp(0);
-        range.end = ts;
-        auto ticks = source_->get_ticks(symbol, range);
-        if (ticks.empty()) {
-            return std::nullopt;
-        }
-        return ticks.back();
+        return source_->get_tick_as_of(symbol, ts);
     }
 
     std::optional<OrderBook> SnapshotAccess::order_book_at(const SymbolId symbol, const Timestamp ts) const
     {
-        TimeRange range;
-        range.start = Timestamp(0);
-        range.end = ts;
-        auto books = source_->get_order_books(symbol, range);
-        if (books.empty()) {
-            return std::nullopt;
-        }
-        return books.back();
+        return source_->get_order_book_as_of(symbol, ts);
     }
 }  // namespace regimeflow::data
@@ -1,6 +1,8 @@
 #include "regimeflow/data/tick_csv_reader.h"
 
 #include "regimeflow/common/time.h"
+#include "regimeflow/data/csv_cache.h"
+#include "regimeflow/data/csv_parser.h"
 #include "regimeflow/data/merged_iterator.h"
 #include "regimeflow/data/memory_data_source.h"
 
@@ -9,26 +11,15 @@
 #include <cmath>
 #include <ctime>
 #include <filesystem>
-#include <fstream>
 #include <limits>
+#include <optional>
 #include <ranges>
-#include <sstream>
 #include <stdexcept>
 
 namespace regimeflow::data
 {
     namespace {
 
-        std::vector<std::string> split_line(const std::string& line, const char delimiter) {
-            std::vector<std::string> fields;
-            std::string token;
-            std::istringstream stream(line);
-            while (std::getline(stream, token, delimiter)) {
-                fields.push_back(token);
-            }
-            return fields;
-        }
-
         std::string trim(const std::string& value) {
             const auto first = value.find_first_not_of(" \t\r\n");
             if (first == std::string::npos) {
@@ -110,20 +101,52 @@ namespace regimeflow::data
             }
         }
 
-        Timestamp parse_timestamp(const std::string& value,
-                                  const std::string& datetime_format,
-                                  const size_t line_number) {
+        // Settings the cached rows of a tick file depend on.
+        std::string parse_fingerprint(const CSVTickDataSource::Config& config) {
+            std::string out = "ticks-v1;";
+            out += config.delimiter;
+            out += config.has_header ? "h;" : "n;";
+            out += config.datetime_format + ';';
+            for (const auto& [name, index] : config.column_mapping) {
+                out += name + '=' + std::to_string(index) + ',';
+            }
+            out += ';' + std::to_string(config.utc_offset_seconds) + ';';
+            append_cache_fingerprint(out, config.validation);
+            return out;
+        }
+
+        // Why a row could not be turned into a tick; reported during validation.
+        enum class RowError : uint8_t {
+            None,
+            MissingColumns,
+            Timestamp,
+            Value
+        };
+
+        struct ParsedTickRow {
+            Tick tick;
+            RowError error = RowError::None;
+            std::string message;
+        };
+
+        std::optional<Timestamp> parse_row_timestamp(const std::string_view value,
+                                                     const FixedTimestampFormat& fast,
+                                                     const std::string& datetime_format) {
+            if (int64_t us = 0; fast.parse(value, us) == FixedTimestampFormat::Status::Parsed) {
+                return Timestamp(us);
+            }
             try {
-                return Timestamp::from_string(value, datetime_format);
+                return Timestamp::from_string(std::string(value), datetime_format);
             } catch (const std::exception&) {
-                throw std::runtime_error("CSV parse error: invalid timestamp at line " +
-                                         std::to_string(line_number));
+                return std::nullopt;
             }
         }
 
     }  // namespace
 
-    CSVTickDataSource::CSVTickDataSource(const Config& config) : config_(config) {
+    CSVTickDataSource::CSVTickDataSource(const Config& config)
+        : config_(config), cache_(config.cache_directory) {
+        cache_fingerprint_ = parse_fingerprint(config_);
         scan_directory();
     }
 
@@ -252,25 +275,55 @@ namespace regimeflow::data
         }
     }
 
-    std::vector<Tick> CSVTickDataSource::parse_ticks(SymbolId symbol, const std::string& path,
-                                                     TimeRange range) const {
-        std::ifstream file(path);
-        if (!file) {
+    std::string CSVTickDataSource::cache_entry(const std::string& path) const {
+        // Reports and wall-clock checks depend on more than the cached rows.
+        if (path.empty() || config_.collect_validation_report ||
+            config_.validation.check_future_timestamps) {
+            return {};
+        }
+        return cache_.entry_path(path, cache_fingerprint_, ".rft");
+    }
+
+    std::vector<Tick> CSVTickDataSource::parse_ticks(const SymbolId symbol, const std::string& path,
+                                                     const TimeRange range) const {
+        const std::string entry = cache_entry(path);
+        std::vector<Tick> ticks;
+        if (!entry.empty() && CsvCache::load_ticks(entry, symbol, range, ticks)) {
+            last_report_ = ValidationReport();
+            return ticks;
+        }
+        ticks = read_ticks(symbol, path);
+        if (!entry.empty()) {
+            CsvCache::store_ticks(entry, ticks);
+        }
+        if (range.start.microseconds() != 0 || range.end.microseconds() != 0) {
+            std::erase_if(ticks, [&](const Tick& tick) { return !range.contains(tick.timestamp); });
+        }
+        return ticks;
+    }
+
+    std::vector<Tick> CSVTickDataSource::read_ticks(const SymbolId symbol, const std::string& path) const {
+        const MappedTextFile file(path);
+        if (!file.is_open()) {
             return {};
         }
 
         last_report_ = ValidationReport();
-        std::string line;
+        std::string_view body = file.text();
         std::map<std::string, int> col = config_.column_mapping;
         auto aliases = default_aliases();
         if (config_.has_header) {
-            if (!std::getline(file, line)) {
+            if (body.empty()) {
                 return {};
             }
+            const auto newline = body.find('\n');
+            const auto header = body.substr(0, newline);
+            body = newline == std::string_view::npos ? std::string_view{} : body.substr(newline + 1);
             if (col.empty()) {
-                auto fields = split_line(line, config_.delimiter);
+                std::vector<std::string_view> fields;
+                split_csv_line(header, config_.delimiter, fields, false);
                 for (size_t i = 0; i < fields.size(); ++i) {
-                    auto key = normalize_header(fields[i]);
+                    auto key = normalize_header(std::string(fields[i]));
                     auto canonical = apply_alias(key, aliases);
                     col[canonical] = static_cast<int>(i);
                 }
@@ -281,6 +334,34 @@ namespace regimeflow::data
         int ts_col = col.contains("timestamp") ? col["timestamp"] : 0;
         int price_col = col.contains("price") ? col["price"] : 1;
         int qty_col = col.contains("quantity") ? col["quantity"] : 2;
+        const int max_col = std::max({ts_col, price_col, qty_col});
+
+        const FixedTimestampFormat datetime_format(config_.datetime_format);
+        const auto parse_line = [&](const std::string_view line, std::vector<std::string_view>& fields) {
+            ParsedTickRow row;
+            split_csv_line(line, config_.delimiter, fields, false);
+            if (static_cast<int>(fields.size()) <= max_col) {
+                row.error = RowError::MissingColumns;
+                return row;
+            }
+            const auto ts = parse_row_timestamp(fields[ts_col], datetime_format, config_.datetime_format);
+            if (!ts) {
+                row.error = RowError::Timestamp;
+                return row;
+            }
+            row.tick.timestamp = *ts;
+            if (config_.utc_offset_seconds != 0) {
+                row.tick.timestamp = row.tick.timestamp - Duration::seconds(config_.utc_offset_seconds);
+            }
+            try {
+                row.tick.price = parse_csv_double(fields[price_col]);
+                row.tick.quantity = parse_csv_double(fields[qty_col]);
+            } catch (const std::exception& ex) {
+                row.error = RowError::Value;
+                row.message = ex.what();
+            }
+            return row;
+        };
 
         std::vector<Tick> ticks;
         Timestamp last_ts;
@@ -331,37 +412,28 @@ namespace regimeflow::data
             return action;
         };
 
-        while (std::getline(file, line)) {
-            auto fields = split_line(line, config_.delimiter);
-            if (static_cast<int>(fields.size()) <= std::max({ts_col, price_col, qty_col})) {
-                if (!handle_issue(ValidationSeverity::Error, error_action(), "Missing columns")) {
-                    ++line_number;
-                    continue;
-                }
-            }
-
-            Tick tick;
-            try {
-                tick.timestamp = parse_timestamp(fields[ts_col], config_.datetime_format, line_number);
-                if (config_.utc_offset_seconds != 0) {
-                    tick.timestamp = tick.timestamp - Duration::seconds(config_.utc_offset_seconds);
-                }
-                tick.price = std::stod(fields[price_col]);
-                tick.quantity = std::stod(fields[qty_col]);
-            } catch (const std::exception& ex) {
-                if (!handle_issue(ValidationSeverity::Error, error_action(), ex.what())) {
+        ticks.reserve(static_cast<size_t>(std::count(body.begin(), body.end(), '\n')) + 1);
+        auto consume = [&](const ParsedTickRow& row) {
+            if (row.error != RowError::None) {
+                const std::string message = row.error == RowError::MissingColumns
+                    ? std::string("Missing columns")
+                    : row.error == RowError::Timestamp
+                        ? "CSV parse error: invalid timestamp at line " + std::to_string(line_number)
+                        : row.message;
+                if (!handle_issue(ValidationSeverity::Error, error_action(), message)) {
                     ++line_number;
-                    continue;
+                    return;
                 }
             }
 
+            Tick tick = row.tick;
             if (config_.validation.check_price_bounds) {
                 if (!std::isfinite(tick.price) || tick.price <= 0.0 ||
                     (config_.validation.max_price > 0.0 &&
                      tick.price > config_.validation.max_price)) {
                     if (!handle_issue(ValidationSeverity::Error, error_action(), "Invalid price")) {
                         ++line_number;
-                        continue;
+                        return;
                     }
                      }
             }
@@ -371,7 +443,7 @@ namespace regimeflow::data
                 if (!handle_issue(ValidationSeverity::Error, error_action(),
                                   "Quantity exceeds max_volume")) {
                     ++line_number;
-                    continue;
+                    return;
                                   }
                 }
 
@@ -380,7 +452,7 @@ namespace regimeflow::data
                     if (!handle_issue(ValidationSeverity::Error, error_action(),
                                       "Timestamp is in the future")) {
                         ++line_number;
-                        continue;
+                        return;
                                       }
                 }
             }
@@ -392,7 +464,7 @@ namespace regimeflow::data
                 if (!handle_issue(ValidationSeverity::Error, error_action(),
                                   "Timestamp outside trading hours")) {
                     ++line_number;
-                    continue;
+                    return;
                                   }
                                       }
 
@@ -401,7 +473,7 @@ namespace regimeflow::data
                 if (!handle_issue(ValidationSeverity::Error, error_action(),
                                   "Non-monotonic timestamp")) {
                     ++line_number;
-                    continue;
+                    return;
                                   }
                 }
 
@@ -410,7 +482,7 @@ namespace regimeflow::data
                     if (!handle_issue(ValidationSeverity::Warning, config_.validation.on_gap,
                                       "Timestamp gap exceeds max_gap")) {
                         ++line_number;
-                        continue;
+                        return;
                                       }
                 }
             }
@@ -420,7 +492,7 @@ namespace regimeflow::data
                     if (!handle_issue(ValidationSeverity::Warning, config_.validation.on_warning,
                                       "Price jump exceeds max_jump_pct")) {
                         ++line_number;
-                        continue;
+                        return;
                                       }
                 }
             }
@@ -457,16 +529,10 @@ namespace regimeflow::data
                 volume_stats.push(tick.quantity);
             }
 
-            if (range.start.microseconds() != 0 || range.end.microseconds() != 0) {
-                if (!range.contains(tick.timestamp)) {
-                    ++line_number;
-                    continue;
-                }
-            }
-
             ticks.push_back(tick);
             ++line_number;
-        }
+        };
+        for_each_parsed_csv_row<ParsedTickRow>(body, csv_parse_threads(config_.parse_threads), parse_line, consume);
 
         return ticks;
     }
@@ -2,6 +2,7 @@
 
 #include "regimeflow/common/sha256.h"
 #include "regimeflow/common/types.h"
+#include "regimeflow/data/as_of_cache.h"
 
 #include <algorithm>
 #include <array>
@@ -9,6 +10,7 @@
 #include <cmath>
 #include <cstddef>
 #include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <limits>
 #include <stdexcept>
@@ -85,8 +87,62 @@ namespace regimeflow::data
             }
         }
 
+        Result<void> check_tick(const Tick& tick, const bool first, const Timestamp last) {
+            if (tick.timestamp.microseconds() <= 0) {
+                return Result<void>(Error(Error::Code::InvalidArgument, "Tick timestamp must be positive"));
+            }
+            if (!first && tick.timestamp < last) {
+                return Result<void>(Error(Error::Code::InvalidArgument, "Ticks must be sorted by timestamp"));
+            }
+            if (!std::isfinite(tick.price) || tick.price <= 0) {
+                return Result<void>(Error(Error::Code::InvalidArgument, "Tick price must be positive"));
+            }
+            if (!std::isfinite(tick.quantity) || tick.quantity <= 0) {
+                return Result<void>(Error(Error::Code::InvalidArgument, "Tick quantity must be positive"));
+            }
+            return Ok();
+        }
+
+        constexpr int64_t kMicrosPerDay = 86'400'000'000LL;
+        constexpr size_t kSpillColumns = 3;
+
     }  // namespace
 
+    struct TickMmapWriter::Stream {
+        Stream(const std::string& output, const size_t rows)
+            : path(output), buffer_rows(rows),
+              spill(output + ".spill", {sizeof(double), sizeof(double), sizeof(uint32_t)}) {
+            timestamps.reserve(rows);
+            prices.reserve(rows);
+            quantities.reserve(rows);
+            flags.reserve(rows);
+        }
+
+        std::string path;
+        size_t buffer_rows;
+        std::ofstream out;
+        TickFileHeader header{};
+        Sha256 sha;
+        std::vector<int64_t> timestamps;
+        std::vector<double> prices;
+        std::vector<double> quantities;
+        std::vector<uint32_t> flags;
+        ColumnSpill spill;
+        std::vector<TickDateIndex> index;
+        int64_t last_day = 0;
+        uint64_t count = 0;
+        Timestamp last;
+    };
+
+    TickMmapWriter::TickMmapWriter() = default;
+    TickMmapWriter::~TickMmapWriter() {
+        if (stream_) {
+            fail_stream(Ok());
+        }
+    }
+    TickMmapWriter::TickMmapWriter(TickMmapWriter&&) noexcept = default;
+    TickMmapWriter& TickMmapWriter::operator=(TickMmapWriter&&) noexcept = default;
+
     TickMmapFile::TickMmapFile(const std::string& path) {
         map_file(path);
     }
@@ -222,6 +278,32 @@ namespace regimeflow::data
                 static_cast<size_t>(end_it - span.begin())};
     }
 
+    std::optional<size_t> TickMmapFile::find_as_of(const Timestamp ts) const {
+        std::span<const TickDateIndex> index;
+        if (date_index_) {
+            index = {date_index_, (file_size_ - static_cast<size_t>(header_->index_offset)) / sizeof(TickDateIndex)};
+        }
+        return find_as_of_row(timestamps(), index, ts.microseconds());
+    }
+
+    std::vector<MmapColumn> TickMmapFile::columns() const {
+        if (!header_) {
+            return {};
+        }
+        return {{timestamps_, sizeof(int64_t)},
+                {prices_, sizeof(double)},
+                {quantities_, sizeof(double)},
+                {flags_, sizeof(uint32_t)}};
+    }
+
+    void TickMmapFile::advise(const MmapAccessPolicy policy, const size_t begin, const size_t end) const {
+        advise_mmap_rows(mapping_, file_size_, columns(), begin, end, policy);
+    }
+
+    void TickMmapFile::advise_huge_pages() const {
+        advise_mmap_huge_pages(mapping_, file_size_);
+    }
+
     std::span<const int64_t> TickMmapFile::timestamps() const {
         return {timestamps_, tick_count()};
     }
@@ -383,7 +465,7 @@ namespace regimeflow::data
     Result<void> TickMmapWriter::write_ticks(const std::string& path,
                                              const std::string& symbol,
                                              std::vector<Tick> ticks) {
-        std::ranges::sort(ticks, [](const Tick& a, const Tick& b) {
+        std::ranges::stable_sort(ticks, [](const Tick& a, const Tick& b) {
             return a.timestamp < b.timestamp;
         });
         if (auto validation = validate_ticks(ticks); validation.is_err()) {
@@ -448,30 +530,151 @@ namespace regimeflow::data
         return Ok();
     }
 
-    Result<void> TickMmapWriter::validate_ticks(const std::vector<Tick>& ticks) const {
-        if (ticks.empty()) {
-            return Ok();
-        }
-        Timestamp last = ticks.front().timestamp;
+    Result<void> TickMmapWriter::validate_ticks(const std::vector<Tick>& ticks) {
         for (size_t i = 0; i < ticks.size(); ++i) {
-            const auto& tick = ticks[i];
-            if (tick.timestamp.microseconds() <= 0) {
-                return Result<void>(Error(Error::Code::InvalidArgument, "Tick timestamp must be positive"));
+            if (auto check = check_tick(ticks[i], i == 0, i > 0 ? ticks[i - 1].timestamp : Timestamp());
+                check.is_err()) {
+                return check;
             }
-            if (i > 0 && tick.timestamp < last) {
-                return Result<void>(Error(Error::Code::InvalidArgument, "Ticks must be sorted by timestamp"));
+        }
+        return Ok();
+    }
+
+    Result<void> TickMmapWriter::open(const std::string& path, const std::string& symbol,
+                                      const size_t buffer_rows) {
+        if (stream_) {
+            return Result<void>(Error(Error::Code::InvalidState, "Tick mmap stream already open"));
+        }
+        auto stream = std::make_unique<Stream>(path, std::max<size_t>(buffer_rows, 1));
+        stream->out.open(path, std::ios::binary | std::ios::trunc);
+        if (!stream->out) {
+            return Result<void>(Error(Error::Code::IoError, "Unable to open tick mmap output file"));
+        }
+        auto& header = stream->header;
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kFileVersion;
+        header.flags = 0;
+        std::memset(header.symbol, 0, sizeof(header.symbol));
+#if defined(_WIN32)
+        strncpy_s(header.symbol, sizeof(header.symbol), symbol.c_str(), _TRUNCATE);
+#else
+        std::strncpy(header.symbol, symbol.c_str(), sizeof(header.symbol) - 1);
+#endif
+        header.data_offset = sizeof(TickFileHeader);
+        write_bytes(stream->out, &header, sizeof(header), nullptr);
+        stream_ = std::move(stream);
+        return Ok();
+    }
+
+    Result<void> TickMmapWriter::append(const std::span<const Tick> ticks) {
+        if (!stream_) {
+            return Result<void>(Error(Error::Code::InvalidState, "Tick mmap stream not open"));
+        }
+        auto& s = *stream_;
+        for (const auto& tick : ticks) {
+            if (auto check = check_tick(tick, s.count == 0, s.last); check.is_err()) {
+                return fail_stream(std::move(check));
             }
-            if (!std::isfinite(tick.price) || tick.price <= 0) {
-                return Result<void>(Error(Error::Code::InvalidArgument, "Tick price must be positive"));
+            // Dates only change when the UTC day does; skip formatting otherwise.
+            const int64_t us = tick.timestamp.microseconds();
+            if (const int64_t day = us / kMicrosPerDay; s.count == 0 || day != s.last_day) {
+                const int32_t date = yyyymmdd_from_timestamp(tick.timestamp);
+                if (s.index.empty() || s.index.back().date_yyyymmdd != date) {
+                    s.index.push_back(TickDateIndex{date, s.count});
+                }
+                s.last_day = day;
             }
-            if (!std::isfinite(tick.quantity) || tick.quantity <= 0) {
-                return Result<void>(Error(Error::Code::InvalidArgument, "Tick quantity must be positive"));
+            if (s.count == 0) {
+                s.header.start_timestamp = us;
+            }
+            s.timestamps.push_back(us);
+            s.prices.push_back(tick.price);
+            s.quantities.push_back(tick.quantity);
+            s.flags.push_back(tick.flags);
+            s.last = tick.timestamp;
+            ++s.count;
+            if (s.timestamps.size() == s.buffer_rows) {
+                if (auto flushed = flush_stream(); flushed.is_err()) {
+                    return fail_stream(std::move(flushed));
+                }
             }
-            last = tick.timestamp;
         }
         return Ok();
     }
 
+    Result<void> TickMmapWriter::flush_stream() {
+        auto& s = *stream_;
+        const size_t rows = s.timestamps.size();
+        if (rows == 0) {
+            return Ok();
+        }
+        write_bytes(s.out, s.timestamps.data(), rows * sizeof(int64_t), &s.sha);
+        const std::array<const void*, kSpillColumns> columns{s.prices.data(), s.quantities.data(), s.flags.data()};
+        if (auto spilled = s.spill.add_block(rows, columns); spilled.is_err()) {
+            return spilled;
+        }
+        s.timestamps.clear();
+        s.prices.clear();
+        s.quantities.clear();
+        s.flags.clear();
+        return s.out ? Ok() : Result<void>(Error(Error::Code::IoError, "Unable to write tick mmap output file"));
+    }
+
+    Result<void> TickMmapWriter::finalize() {
+        if (!stream_) {
+            return Result<void>(Error(Error::Code::InvalidState, "Tick mmap stream not open"));
+        }
+        auto& s = *stream_;
+        if (s.spill.empty()) {
+            // Everything fit in the buffers: write the columns directly.
+            const size_t rows = s.timestamps.size();
+            write_bytes(s.out, s.timestamps.data(), rows * sizeof(int64_t), &s.sha);
+            write_bytes(s.out, s.prices.data(), rows * sizeof(double), &s.sha);
+            write_bytes(s.out, s.quantities.data(), rows * sizeof(double), &s.sha);
+            write_bytes(s.out, s.flags.data(), rows * sizeof(uint32_t), &s.sha);
+        } else {
+            if (auto flushed = flush_stream(); flushed.is_err()) {
+                return fail_stream(std::move(flushed));
+            }
+            for (size_t column = 0; column < kSpillColumns; ++column) {
+                if (auto copied = s.spill.copy_column(column, s.out, s.sha); copied.is_err()) {
+                    return fail_stream(std::move(copied));
+                }
+            }
+        }
+        if (!s.index.empty()) {
+            write_date_index(s.out, s.index);
+        }
+
+        auto& header = s.header;
+        if (s.count > 0) {
+            header.end_timestamp = s.last.microseconds();
+        }
+        header.tick_count = s.count;
+        const size_t data_bytes = s.count * (sizeof(int64_t) + 2 * sizeof(double) + sizeof(uint32_t));
+        header.index_offset = header.data_offset + static_cast<uint64_t>(data_bytes);
+        auto checksum = s.sha.digest();
+        std::memcpy(header.checksum, checksum.data(), checksum.size());
+        s.out.seekp(0);
+        write_bytes(s.out, &header, sizeof(header), nullptr);
+        s.out.close();
+        if (!s.out) {
+            return fail_stream(Result<void>(Error(Error::Code::IoError,
+                                                  "Unable to write tick mmap output file")));
+        }
+        stream_.reset();
+        return Ok();
+    }
+
+    Result<void> TickMmapWriter::fail_stream(Result<void> error) {
+        const std::string path = stream_->path;
+        stream_->out.close();
+        stream_.reset();
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        return error;
+    }
+
     std::vector<TickDateIndex> TickMmapWriter::build_date_index(const std::vector<Tick>& ticks) {
         std::vector<TickDateIndex> index;
         int32_t last_date = 0;
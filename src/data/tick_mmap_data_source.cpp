@@ -11,7 +11,7 @@ namespace regimeflow::data
     namespace {
 
         std::optional<std::string> extract_symbol(const std::filesystem::path& path) {
-            if (path.extension() != ".rft") {
+            if (path.extension() != ".rft" && path.extension() != ".rftz") {
                 return std::nullopt;
             }
             return path.stem().string();
@@ -31,8 +31,7 @@ namespace regimeflow::data
 
     TickMmapDataSource::TickMmapDataSource(const Config& config)
         : config_(config),
-          file_cache_(config.max_cached_files),
-          range_cache_(config.max_cached_ranges) {}
+          caches_(config.shared_caches ? config.shared_caches : Caches::create(config)) {}
 
     std::vector<SymbolInfo> TickMmapDataSource::get_available_symbols() const {
         std::vector<SymbolInfo> symbols;
@@ -70,11 +69,13 @@ namespace regimeflow::data
 
     TimeRange TickMmapDataSource::get_available_range(SymbolId symbol) const {
         symbol = adjuster_.resolve_symbol(symbol);
-        const auto file = get_file(symbol);
-        if (!file) {
-            return {};
+        if (const auto file = get_file(symbol)) {
+            return file->time_range();
+        }
+        if (const auto compressed = get_compressed_file(symbol)) {
+            return compressed->time_range();
         }
-        return file->time_range();
+        return {};
     }
 
     std::vector<Bar> TickMmapDataSource::get_bars(SymbolId, TimeRange, BarType) {
@@ -84,31 +85,64 @@ namespace regimeflow::data
     std::vector<Tick> TickMmapDataSource::get_ticks(SymbolId symbol, const TimeRange range) {
         symbol = adjuster_.resolve_symbol(symbol, range.start);
         std::string cache_key;
-        if (config_.max_cached_ranges > 0) {
+        if (caches_->ranges.enabled()) {
             cache_key = make_range_key(symbol, range);
-            if (const auto cached = range_cache_.get(cache_key)) {
+            if (const auto cached = caches_->ranges.get(cache_key)) {
                 return **cached;
             }
         }
 
         std::vector<Tick> result;
-        const auto file = get_file(symbol);
-        if (!file) {
+        if (const auto file = get_file(symbol)) {
+            auto [start, end] = file->find_range(range);
+            file->advise(config_.access_policy, start, end);
+            result.reserve(end - start);
+            for (size_t i = start; i < end; ++i) {
+                result.push_back((*file)[i].to_tick());
+            }
+        } else if (const auto compressed = get_compressed_file(symbol)) {
+            CompressedTickIterator iter(compressed, range);
+            std::vector<Tick> batch(256);
+            while (const size_t count = iter.next_batch(batch)) {
+                result.insert(result.end(), batch.begin(),
+                              batch.begin() + static_cast<std::ptrdiff_t>(count));
+            }
+        } else {
             return result;
         }
-        auto [start, end] = file->find_range(range);
-        result.reserve(end - start);
-        for (size_t i = start; i < end; ++i) {
-            result.push_back((*file)[i].to_tick());
-        }
-        if (config_.max_cached_ranges > 0) {
+        if (caches_->ranges.enabled()) {
             const auto shared = std::make_shared<std::vector<Tick>>(result);
-            range_cache_.put(cache_key, shared);
+            caches_->ranges.put(cache_key, shared);
             return *shared;
         }
         return result;
     }
 
+    std::optional<Tick> TickMmapDataSource::get_tick_as_of(const SymbolId symbol, const Timestamp ts) {
+        const int64_t us = ts.microseconds();
+        const auto key = AsOfCache<Tick>::make_key(symbol);
+        std::shared_ptr<const TickMmapFile> file;
+        if (const auto* entry = tick_as_of_.find(key)) {
+            if (entry->covers(us)) {
+                return entry->row;
+            }
+            file = entry->owner;
+        }
+        if (!file) {
+            file = get_file(adjuster_.resolve_symbol(symbol, ts));
+        }
+        if (!file) {
+            return DataSource::get_tick_as_of(symbol, ts);
+        }
+        const auto row = file->find_as_of(ts);
+        std::optional<Tick> tick;
+        if (row) {
+            tick = (*file)[*row].to_tick();
+        }
+        tick_as_of_.store_row(key, file->timestamps(), row, tick, file);
+        return tick;
+    }
+
     std::unique_ptr<DataIterator> TickMmapDataSource::create_iterator(
         const std::vector<SymbolId>& symbols,
         const TimeRange range,
@@ -128,6 +162,15 @@ namespace regimeflow::data
         std::vector<std::unique_ptr<TickIterator>> iterators;
         iterators.reserve(symbols.size());
         for (const SymbolId symbol : symbols) {
+            // Compressed files stream block by block instead of loading the range.
+            const SymbolId resolved = adjuster_.resolve_symbol(symbol, range.start);
+            if (!get_file(resolved)) {
+                if (auto compressed = get_compressed_file(resolved)) {
+                    iterators.push_back(std::make_unique<CompressedTickIterator>(std::move(compressed),
+                                                                                 range));
+                    continue;
+                }
+            }
             auto ticks = get_ticks(symbol, range);
             iterators.push_back(std::make_unique<VectorTickIterator>(std::move(ticks)));
         }
@@ -141,6 +184,7 @@ namespace regimeflow::data
     void TickMmapDataSource::set_corporate_actions(const SymbolId symbol,
                                                    std::vector<CorporateAction> actions) {
         adjuster_.add_actions(symbol, std::move(actions));
+        tick_as_of_.clear();
     }
 
     std::shared_ptr<TickMmapFile> TickMmapDataSource::get_file(const SymbolId symbol) const {
@@ -155,12 +199,44 @@ namespace regimeflow::data
         path /= symbol_name + ".rft";
         std::string key = path.string();
 
-        if (auto cached = file_cache_.get(key)) {
+        if (auto cached = caches_->files.get(key)) {
             return *cached;
         }
+        // Symbols stored only in the compressed format are served by
+        // get_compressed_file instead.
+        if (!std::filesystem::exists(path) && std::filesystem::exists(path.string() + "z")) {
+            return nullptr;
+        }
 
         auto file = std::make_shared<TickMmapFile>(key);
-        file_cache_.put(key, file);
+        if (config_.huge_pages) {
+            file->advise_huge_pages();
+        }
+        caches_->files.put(key, file);
+        return file;
+    }
+
+    std::shared_ptr<CompressedTickFile> TickMmapDataSource::get_compressed_file(
+        const SymbolId symbol) const {
+        if (config_.data_directory.empty()) {
+            return nullptr;
+        }
+        const auto& symbol_name = SymbolRegistry::instance().lookup(symbol);
+        if (symbol_name.empty()) {
+            return nullptr;
+        }
+        std::filesystem::path path = config_.data_directory;
+        path /= symbol_name + ".rftz";
+        std::string key = path.string();
+
+        if (auto cached = caches_->packed.get(key)) {
+            return *cached;
+        }
+        if (!std::filesystem::exists(path)) {
+            return nullptr;
+        }
+        auto file = std::make_shared<CompressedTickFile>(key);
+        caches_->packed.put(key, file);
         return file;
     }
 }  // namespace regimeflow::data
@@ -25,4 +25,32 @@ namespace regimeflow::data
     {
         return source_->get_order_books(symbol, range);
     }
+
+    std::optional<Bar> TimeSeriesQuery::bar_as_of(const SymbolId symbol, const Timestamp ts,
+                                                  const BarType bar_type) const
+    {
+        return source_->get_bar_as_of(symbol, ts, bar_type);
+    }
+
+    std::optional<Tick> TimeSeriesQuery::tick_as_of(const SymbolId symbol, const Timestamp ts) const
+    {
+        return source_->get_tick_as_of(symbol, ts);
+    }
+
+    std::optional<OrderBook> TimeSeriesQuery::order_book_as_of(const SymbolId symbol, const Timestamp ts) const
+    {
+        return source_->get_order_book_as_of(symbol, ts);
+    }
+
+    std::vector<std::optional<Bar>> TimeSeriesQuery::bars_as_of(const SymbolId symbol,
+                                                                const std::span<const Timestamp> times,
+                                                                const BarType bar_type) const
+    {
+        std::vector<std::optional<Bar>> out;
+        out.reserve(times.size());
+        for (const auto ts : times) {
+            out.push_back(source_->get_bar_as_of(symbol, ts, bar_type));
+        }
+        return out;
+    }
 }  // namespace regimeflow::data
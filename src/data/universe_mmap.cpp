@@ -0,0 +1,466 @@
+#include "regimeflow/data/universe_mmap.h"
+
+#include "regimeflow/common/sha256.h"
+#include "regimeflow/data/mmap_writer.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace regimeflow::data
+{
+    namespace {
+
+        constexpr char kMagic[8] = {'R', 'G', 'M', 'F', 'U', 'N', 'V', '1'};
+        constexpr uint32_t kFileVersion = 1;
+        constexpr int64_t kMicrosPerDay = 86'400'000'000LL;
+        constexpr size_t kBarColumnBytes = sizeof(int64_t) + 4 * sizeof(double) + sizeof(uint64_t);
+
+        int32_t day_of(const int64_t timestamp_us) {
+            int64_t day = timestamp_us / kMicrosPerDay;
+            if (timestamp_us % kMicrosPerDay < 0) {
+                --day;
+            }
+            return static_cast<int32_t>(day);
+        }
+
+        std::string_view trim_nulls(const char* data, const size_t size) {
+            size_t len = 0;
+            for (; len < size; ++len) {
+                if (data[len] == '\0') {
+                    break;
+                }
+            }
+            return std::string_view{data, len};
+        }
+
+        bool section_fits(const uint64_t offset, const uint64_t count, const size_t stride,
+                          const size_t file_size) {
+            if (offset > file_size) {
+                return false;
+            }
+            if (count != 0 && count > (file_size - offset) / stride) {
+                return false;
+            }
+            return true;
+        }
+
+        void write_bytes(std::ofstream& out, const void* data, const size_t len, Sha256* sha) {
+            out.write(static_cast<const char*>(data), static_cast<std::streamsize>(len));
+            if (sha) {
+                sha->update(data, len);
+            }
+        }
+
+    }  // namespace
+
+    UniverseMmapFile::UniverseMmapFile(const std::string& path) {
+        try {
+            map_file(path);
+        } catch (...) {
+            unmap_file();
+            throw;
+        }
+    }
+
+    UniverseMmapFile::~UniverseMmapFile() {
+        unmap_file();
+    }
+
+    TimeRange UniverseMmapFile::time_range() const {
+        TimeRange range;
+        range.start = Timestamp(header_->start_timestamp);
+        range.end = Timestamp(header_->end_timestamp);
+        return range;
+    }
+
+    std::optional<uint32_t> UniverseMmapFile::find_symbol(const SymbolId symbol) const {
+        const auto it = symbol_lookup_.find(symbol);
+        if (it == symbol_lookup_.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    std::pair<size_t, size_t> UniverseMmapFile::find_partitions(const TimeRange range) const {
+        if (range.start.microseconds() == 0 && range.end.microseconds() == 0) {
+            return {0, partitions_.size()};
+        }
+        const int32_t first = day_of(range.start.microseconds());
+        const int32_t last = day_of(range.end.microseconds());
+        const auto begin = std::ranges::lower_bound(partitions_, first, {},
+                                                    &UniversePartitionEntry::day);
+        const auto end = std::ranges::upper_bound(partitions_, last, {},
+                                                  &UniversePartitionEntry::day);
+        const auto b = static_cast<size_t>(begin - partitions_.begin());
+        const auto e = static_cast<size_t>(end - partitions_.begin());
+        return {b, std::max(b, e)};
+    }
+
+    std::span<const UniverseSlice> UniverseMmapFile::slices(const size_t partition) const {
+        const auto& entry = partitions_[partition];
+        return slices_.subspan(entry.slice_begin, entry.slice_count);
+    }
+
+    std::optional<UniverseSlice> UniverseMmapFile::find_slice(const size_t partition,
+                                                              const uint32_t symbol_index) const {
+        const auto list = slices(partition);
+        const auto it = std::ranges::lower_bound(list, symbol_index, {}, &UniverseSlice::symbol_index);
+        if (it == list.end() || it->symbol_index != symbol_index) {
+            return std::nullopt;
+        }
+        return *it;
+    }
+
+    UniverseMmapFile::Columns UniverseMmapFile::columns(const size_t partition) const {
+        const auto& entry = partitions_[partition];
+        const auto* base = static_cast<const unsigned char*>(mapping_) + entry.offset;
+        const auto count = static_cast<size_t>(entry.bar_count);
+        Columns cols;
+        cols.timestamps = {reinterpret_cast<const int64_t*>(base), count};
+        base += count * sizeof(int64_t);
+        cols.opens = {reinterpret_cast<const double*>(base), count};
+        base += count * sizeof(double);
+        cols.highs = {reinterpret_cast<const double*>(base), count};
+        base += count * sizeof(double);
+        cols.lows = {reinterpret_cast<const double*>(base), count};
+        base += count * sizeof(double);
+        cols.closes = {reinterpret_cast<const double*>(base), count};
+        base += count * sizeof(double);
+        cols.volumes = {reinterpret_cast<const uint64_t*>(base), count};
+        return cols;
+    }
+
+    void UniverseMmapFile::map_file(const std::string& path) {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("UniverseMmapFile: open failed");
+        }
+        LARGE_INTEGER size {};
+        if (!GetFileSizeEx(file, &size)) {
+            CloseHandle(file);
+            throw std::runtime_error("UniverseMmapFile: stat failed");
+        }
+        if (size.QuadPart < static_cast<LONGLONG>(sizeof(UniverseFileHeader))) {
+            CloseHandle(file);
+            throw std::runtime_error("UniverseMmapFile: file too small");
+        }
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) {
+            CloseHandle(file);
+            throw std::runtime_error("UniverseMmapFile: mmap failed");
+        }
+        void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            throw std::runtime_error("UniverseMmapFile: mmap failed");
+        }
+        file_handle_ = file;
+        mapping_handle_ = mapping;
+        mapping_ = view;
+        file_size_ = static_cast<size_t>(size.QuadPart);
+#else
+        fd_ = ::open(path.c_str(), O_RDONLY);
+        if (fd_ < 0) {
+            throw std::runtime_error("UniverseMmapFile: open failed: " +
+                                     std::string(std::strerror(errno)));
+        }
+
+        struct stat st {};
+        if (::fstat(fd_, &st) != 0) {
+            const int err = errno;
+            ::close(fd_);
+            fd_ = -1;
+            throw std::runtime_error("UniverseMmapFile: stat failed: " +
+                                     std::string(std::strerror(err)));
+        }
+
+        if (st.st_size < static_cast<off_t>(sizeof(UniverseFileHeader))) {
+            ::close(fd_);
+            fd_ = -1;
+            throw std::runtime_error("UniverseMmapFile: file too small");
+        }
+
+        file_size_ = static_cast<size_t>(st.st_size);
+        mapping_ = ::mmap(nullptr, file_size_, PROT_READ, MAP_SHARED, fd_, 0);
+        if (mapping_ == MAP_FAILED) {
+            mapping_ = nullptr;
+            ::close(fd_);
+            fd_ = -1;
+            throw std::runtime_error("UniverseMmapFile: mmap failed");
+        }
+#endif
+
+        header_ = static_cast<const UniverseFileHeader*>(mapping_);
+        if (std::memcmp(header_->magic, kMagic, sizeof(kMagic)) != 0) {
+            throw std::runtime_error("UniverseMmapFile: invalid magic");
+        }
+        if (header_->version != kFileVersion) {
+            throw std::runtime_error("UniverseMmapFile: unsupported version");
+        }
+        setup_sections();
+    }
+
+    void UniverseMmapFile::unmap_file() {
+        if (mapping_) {
+#if defined(_WIN32)
+            UnmapViewOfFile(mapping_);
+#else
+            ::munmap(mapping_, file_size_);
+#endif
+            mapping_ = nullptr;
+        }
+#if defined(_WIN32)
+        if (mapping_handle_) {
+            CloseHandle(static_cast<HANDLE>(mapping_handle_));
+            mapping_handle_ = nullptr;
+        }
+        if (file_handle_) {
+            CloseHandle(static_cast<HANDLE>(file_handle_));
+            file_handle_ = nullptr;
+        }
+#else
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+#endif
+        file_size_ = 0;
+        header_ = nullptr;
+        symbols_ = {};
+        partitions_ = {};
+        slices_ = {};
+        symbol_ids_.clear();
+        symbol_lookup_.clear();
+    }
+
+    void UniverseMmapFile::setup_sections() {
+        const auto* base = static_cast<const unsigned char*>(mapping_);
+        if (!section_fits(header_->directory_offset, header_->symbol_count,
+                          sizeof(UniverseSymbolEntry), file_size_)) {
+            throw std::runtime_error("UniverseMmapFile: symbol directory out of range");
+        }
+        symbols_ = {reinterpret_cast<const UniverseSymbolEntry*>(base + header_->directory_offset),
+                    header_->symbol_count};
+
+        if (!section_fits(header_->footer_offset, header_->partition_count,
+                          sizeof(UniversePartitionEntry), file_size_)) {
+            throw std::runtime_error("UniverseMmapFile: partition table out of range");
+        }
+        partitions_ = {reinterpret_cast<const UniversePartitionEntry*>(base + header_->footer_offset),
+                       header_->partition_count};
+        const uint64_t slice_offset = header_->footer_offset +
+            static_cast<uint64_t>(header_->partition_count) * sizeof(UniversePartitionEntry);
+        if (!section_fits(slice_offset, header_->slice_count, sizeof(UniverseSlice), file_size_)) {
+            throw std::runtime_error("UniverseMmapFile: slice table out of range");
+        }
+        slices_ = {reinterpret_cast<const UniverseSlice*>(base + slice_offset),
+                   static_cast<size_t>(header_->slice_count)};
+
+        for (const auto& entry : partitions_) {
+            if (static_cast<uint64_t>(entry.slice_begin) + entry.slice_count > slices_.size()) {
+                throw std::runtime_error("UniverseMmapFile: partition slices out of range");
+            }
+            if (entry.offset % alignof(int64_t) != 0 ||
+                !section_fits(entry.offset, entry.bar_count, kBarColumnBytes, file_size_)) {
+                throw std::runtime_error("UniverseMmapFile: partition data out of range");
+            }
+            // Readers index the partition columns straight from the slices and
+            // binary search them by symbol, so each must be in range and sorted.
+            const auto list = slices_.subspan(entry.slice_begin, entry.slice_count);
+            for (size_t i = 0; i < list.size(); ++i) {
+                const auto& slice = list[i];
+                if (slice.symbol_index >= symbols_.size() ||
+                    (i > 0 && slice.symbol_index <= list[i - 1].symbol_index)) {
+                    throw std::runtime_error("UniverseMmapFile: invalid slice symbol");
+                }
+                if (static_cast<uint64_t>(slice.begin) + slice.count > entry.bar_count) {
+                    throw std::runtime_error("UniverseMmapFile: slice rows out of range");
+                }
+            }
+        }
+
+        symbol_ids_.reserve(symbols_.size());
+        symbol_lookup_.reserve(symbols_.size());
+        for (uint32_t i = 0; i < symbols_.size(); ++i) {
+            const auto name = trim_nulls(symbols_[i].symbol, sizeof(symbols_[i].symbol));
+            const SymbolId id = SymbolRegistry::instance().intern(std::string(name));
+            symbol_ids_.push_back(id);
+            symbol_lookup_.emplace(id, i);
+        }
+    }
+
+    UniverseMmapWriter::UniverseMmapWriter(const BarType bar_type) : bar_type_(bar_type) {}
+
+    Result<void> UniverseMmapWriter::add_bars(const std::string& symbol, std::vector<Bar> bars) {
+        if (symbol.empty() || symbol.size() >= sizeof(UniverseSymbolEntry::symbol)) {
+            return Result<void>(Error(Error::Code::InvalidArgument,
+                                      "Universe symbol must be 1-31 characters"));
+        }
+        if (std::ranges::any_of(series_, [&](const auto& entry) { return entry.first == symbol; })) {
+            return Result<void>(Error(Error::Code::AlreadyExists, "Symbol already added: " + symbol));
+        }
+        std::ranges::sort(bars, [](const Bar& a, const Bar& b) {
+            return a.timestamp < b.timestamp;
+        });
+        if (auto validation = MmapWriter::validate_bars(bars); validation.is_err()) {
+            return validation;
+        }
+        series_.emplace_back(symbol, std::move(bars));
+        return Ok();
+    }
+
+    Result<void> UniverseMmapWriter::write(const std::string& path) const {
+        // Directory order is by name so readers can list symbols deterministically.
+        std::vector<uint32_t> order(series_.size());
+        for (uint32_t i = 0; i < order.size(); ++i) {
+            order[i] = i;
+        }
+        std::ranges::sort(order, [&](const uint32_t a, const uint32_t b) {
+            return series_[a].first < series_[b].first;
+        });
+
+        UniverseFileHeader header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kFileVersion;
+        header.bar_type = static_cast<uint32_t>(bar_type_);
+        header.bar_size_ms = MmapWriter::bar_size_ms(bar_type_);
+        header.symbol_count = static_cast<uint32_t>(series_.size());
+        header.directory_offset = sizeof(UniverseFileHeader);
+        header.start_timestamp = std::numeric_limits<int64_t>::max();
+        header.end_timestamp = 0;
+
+        std::vector<UniverseSymbolEntry> directory(series_.size());
+        for (uint32_t i = 0; i < order.size(); ++i) {
+            const auto& [name, bars] = series_[order[i]];
+            auto& entry = directory[i];
+            std::memset(&entry, 0, sizeof(entry));
+            std::memcpy(entry.symbol, name.data(), name.size());
+            entry.bar_count = bars.size();
+            if (!bars.empty()) {
+                entry.start_timestamp = bars.front().timestamp.microseconds();
+                entry.end_timestamp = bars.back().timestamp.microseconds();
+                header.start_timestamp = std::min(header.start_timestamp, entry.start_timestamp);
+                header.end_timestamp = std::max(header.end_timestamp, entry.end_timestamp);
+            }
+            header.bar_count += bars.size();
+        }
+        if (header.bar_count == 0) {
+            header.start_timestamp = 0;
+        }
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            return Result<void>(Error(Error::Code::IoError, "Unable to open universe output file"));
+        }
+        write_bytes(out, &header, sizeof(header), nullptr);
+
+        Sha256 sha;
+        write_bytes(out, directory.data(), directory.size() * sizeof(UniverseSymbolEntry), &sha);
+        uint64_t offset = header.directory_offset + directory.size() * sizeof(UniverseSymbolEntry);
+        constexpr unsigned char kPadding[8] = {};
+        if (const auto misalign = offset % alignof(int64_t); misalign != 0) {
+            write_bytes(out, kPadding, alignof(int64_t) - misalign, &sha);
+            offset += alignof(int64_t) - misalign;
+        }
+
+        // Walk all symbols day by day with one cursor each, emitting a
+        // partition per day with the symbols' runs in directory order.
+        std::vector<size_t> cursors(series_.size(), 0);
+        std::vector<UniversePartitionEntry> partitions;
+        std::vector<UniverseSlice> slices;
+        std::vector<int64_t> timestamps;
+        std::vector<double> opens;
+        std::vector<double> highs;
+        std::vector<double> lows;
+        std::vector<double> closes;
+        std::vector<uint64_t> volumes;
+        while (true) {
+            std::optional<int32_t> day;
+            for (uint32_t i = 0; i < order.size(); ++i) {
+                const auto& bars = series_[order[i]].second;
+                if (cursors[i] < bars.size()) {
+                    const int32_t d = day_of(bars[cursors[i]].timestamp.microseconds());
+                    day = day ? std::min(*day, d) : d;
+                }
+            }
+            if (!day) {
+                break;
+            }
+
+            UniversePartitionEntry partition{};
+            partition.day = *day;
+            partition.slice_begin = static_cast<uint32_t>(slices.size());
+            partition.offset = offset;
+            timestamps.clear();
+            opens.clear();
+            highs.clear();
+            lows.clear();
+            closes.clear();
+            volumes.clear();
+            for (uint32_t i = 0; i < order.size(); ++i) {
+                const auto& bars = series_[order[i]].second;
+                size_t& cursor = cursors[i];
+                const size_t begin = timestamps.size();
+                while (cursor < bars.size() && day_of(bars[cursor].timestamp.microseconds()) == *day) {
+                    const auto& bar = bars[cursor++];
+                    timestamps.push_back(bar.timestamp.microseconds());
+                    opens.push_back(bar.open);
+                    highs.push_back(bar.high);
+                    lows.push_back(bar.low);
+                    closes.push_back(bar.close);
+                    volumes.push_back(bar.volume);
+                }
+                if (timestamps.size() > begin) {
+                    UniverseSlice slice{};
+                    slice.symbol_index = i;
+                    slice.begin = static_cast<uint32_t>(begin);
+                    slice.count = static_cast<uint32_t>(timestamps.size() - begin);
+                    slices.push_back(slice);
+                }
+            }
+            partition.slice_count = static_cast<uint32_t>(slices.size()) - partition.slice_begin;
+            partition.bar_count = timestamps.size();
+            write_bytes(out, timestamps.data(), timestamps.size() * sizeof(int64_t), &sha);
+            write_bytes(out, opens.data(), opens.size() * sizeof(double), &sha);
+            write_bytes(out, highs.data(), highs.size() * sizeof(double), &sha);
+            write_bytes(out, lows.data(), lows.size() * sizeof(double), &sha);
+            write_bytes(out, closes.data(), closes.size() * sizeof(double), &sha);
+            write_bytes(out, volumes.data(), volumes.size() * sizeof(uint64_t), &sha);
+            offset += partition.bar_count * kBarColumnBytes;
+            partitions.push_back(partition);
+        }
+
+        header.partition_count = static_cast<uint32_t>(partitions.size());
+        header.footer_offset = offset;
+        header.slice_count = slices.size();
+        write_bytes(out, partitions.data(), partitions.size() * sizeof(UniversePartitionEntry), &sha);
+        write_bytes(out, slices.data(), slices.size() * sizeof(UniverseSlice), &sha);
+
+        const auto checksum = sha.digest();
+        std::memcpy(header.checksum, checksum.data(), checksum.size());
+        out.seekp(0);
+        write_bytes(out, &header, sizeof(header), nullptr);
+        if (!out) {
+            return Result<void>(Error(Error::Code::IoError, "Failed to write universe file"));
+        }
+        return Ok();
+    }
+}  // namespace regimeflow::data
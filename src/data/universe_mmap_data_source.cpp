@@ -0,0 +1,207 @@
+#include "regimeflow/data/universe_mmap_data_source.h"
+
+#include "regimeflow/data/merged_iterator.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_set>
+
+namespace regimeflow::data
+{
+    UniverseBarIterator::UniverseBarIterator(std::shared_ptr<const UniverseMmapFile> file,
+                                             const uint32_t symbol_index,
+                                             const TimeRange range,
+                                             std::vector<CorporateAction> actions)
+        : file_(std::move(file)), symbol_index_(symbol_index) {
+        if (!file_) {
+            return;
+        }
+        symbol_ = file_->symbol_ids()[symbol_index_];
+        start_us_ = range.start.microseconds();
+        end_us_ = range.end.microseconds();
+        bounded_ = start_us_ != 0 || end_us_ != 0;
+        std::tie(first_partition_, last_partition_) = file_->find_partitions(range);
+        adjust_ = !actions.empty();
+        if (adjust_) {
+            adjuster_.add_actions(symbol_, std::move(actions));
+        }
+        reset();
+    }
+
+    bool UniverseBarIterator::has_next() const {
+        return pos_ < end_;
+    }
+
+    Bar UniverseBarIterator::next() {
+        if (!has_next()) {
+            throw std::out_of_range("No more bars");
+        }
+        Bar bar = read(pos_++);
+        if (pos_ == end_) {
+            ++partition_;
+            seek_partition();
+        }
+        return adjust_ ? adjuster_.adjust_bar(symbol_, bar) : bar;
+    }
+
+    size_t UniverseBarIterator::next_batch(const std::span<Bar> out) {
+        size_t count = 0;
+        while (count < out.size() && has_next()) {
+            const size_t run = std::min(out.size() - count, end_ - pos_);
+            for (size_t i = 0; i < run; ++i) {
+                out[count + i] = read(pos_ + i);
+            }
+            pos_ += run;
+            count += run;
+            if (pos_ == end_) {
+                ++partition_;
+                seek_partition();
+            }
+        }
+        if (adjust_) {
+            adjuster_.adjust_bars(symbol_, out.first(count));
+        }
+        return count;
+    }
+
+    void UniverseBarIterator::reset() {
+        partition_ = first_partition_;
+        seek_partition();
+    }
+
+    void UniverseBarIterator::seek_partition() {
+        for (; file_ && partition_ < last_partition_; ++partition_) {
+            const auto slice = file_->find_slice(partition_, symbol_index_);
+            if (!slice) {
+                continue;
+            }
+            columns_ = file_->columns(partition_);
+            pos_ = slice->begin;
+            end_ = static_cast<size_t>(slice->begin) + slice->count;
+            if (bounded_) {
+                const auto ts = columns_.timestamps.subspan(pos_, end_ - pos_);
+                const auto lo = std::ranges::lower_bound(ts, start_us_);
+                const auto hi = std::ranges::upper_bound(ts, end_us_);
+                end_ = pos_ + static_cast<size_t>(hi - ts.begin());
+                pos_ += static_cast<size_t>(lo - ts.begin());
+            }
+            if (pos_ < end_) {
+                return;
+            }
+        }
+        pos_ = 0;
+        end_ = 0;
+    }
+
+    Bar UniverseBarIterator::read(const size_t index) const {
+        Bar bar;
+        bar.timestamp = Timestamp(columns_.timestamps[index]);
+        bar.symbol = symbol_;
+        bar.open = columns_.opens[index];
+        bar.high = columns_.highs[index];
+        bar.low = columns_.lows[index];
+        bar.close = columns_.closes[index];
+        bar.volume = columns_.volumes[index];
+        return bar;
+    }
+
+    UniverseMmapDataSource::UniverseMmapDataSource(const Config& config) : config_(config) {
+        if (!config_.path.empty()) {
+            file_ = std::make_shared<const UniverseMmapFile>(config_.path);
+        }
+    }
+
+    std::vector<SymbolInfo> UniverseMmapDataSource::get_available_symbols() const {
+        std::vector<SymbolInfo> symbols;
+        if (!file_) {
+            return symbols;
+        }
+        std::unordered_set<SymbolId> seen;
+        for (const SymbolId id : file_->symbol_ids()) {
+            for (auto alias : adjuster_.aliases_for(id)) {
+                if (!seen.insert(alias).second) {
+                    continue;
+                }
+                SymbolInfo info;
+                info.id = alias;
+                info.ticker = SymbolRegistry::instance().lookup(alias);
+                symbols.push_back(std::move(info));
+            }
+        }
+        return symbols;
+    }
+
+    TimeRange UniverseMmapDataSource::get_available_range(SymbolId symbol) const {
+        symbol = adjuster_.resolve_symbol(symbol);
+        if (!file_) {
+            return {};
+        }
+        const auto index = file_->find_symbol(symbol);
+        if (!index) {
+            return {};
+        }
+        const auto& entry = file_->symbols()[*index];
+        TimeRange range;
+        range.start = Timestamp(entry.start_timestamp);
+        range.end = Timestamp(entry.end_timestamp);
+        return range;
+    }
+
+    std::vector<Bar> UniverseMmapDataSource::get_bars(const SymbolId symbol, const TimeRange range,
+                                                      const BarType bar_type) {
+        std::vector<Bar> result;
+        const auto iter = make_symbol_iterator(symbol, range, bar_type);
+        if (!iter) {
+            return result;
+        }
+        std::vector<Bar> batch(256);
+        while (const size_t count = iter->next_batch(batch)) {
+            result.insert(result.end(), batch.begin(),
+                          batch.begin() + static_cast<std::ptrdiff_t>(count));
+        }
+        return result;
+    }
+
+    std::vector<Tick> UniverseMmapDataSource::get_ticks(SymbolId, TimeRange) {
+        return {};
+    }
+
+    std::unique_ptr<DataIterator> UniverseMmapDataSource::create_iterator(
+        const std::vector<SymbolId>& symbols,
+        const TimeRange range,
+        const BarType bar_type) {
+        std::vector<std::unique_ptr<DataIterator>> iterators;
+        iterators.reserve(symbols.size());
+        for (const SymbolId symbol : symbols) {
+            if (auto iter = make_symbol_iterator(symbol, range, bar_type)) {
+                iterators.push_back(std::move(iter));
+            }
+        }
+        return std::make_unique<MergedBarIterator>(std::move(iterators));
+    }
+
+    std::vector<CorporateAction> UniverseMmapDataSource::get_corporate_actions(SymbolId,
+                                                                              TimeRange) {
+        return {};
+    }
+
+    void UniverseMmapDataSource::set_corporate_actions(const SymbolId symbol,
+                                                       std::vector<CorporateAction> actions) {
+        adjuster_.add_actions(symbol, std::move(actions));
+    }
+
+    std::unique_ptr<DataIterator> UniverseMmapDataSource::make_symbol_iterator(
+        SymbolId symbol, const TimeRange range, const BarType bar_type) const {
+        if (!file_ || file_->bar_type() != bar_type) {
+            return nullptr;
+        }
+        symbol = adjuster_.resolve_symbol(symbol, range.start);
+        const auto index = file_->find_symbol(symbol);
+        if (!index) {
+            return nullptr;
+        }
+        return std::make_unique<UniverseBarIterator>(file_, *index, range,
+                                                     adjuster_.actions_for(symbol));
+    }
+}  // namespace regimeflow::data
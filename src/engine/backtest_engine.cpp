@@ -22,6 +22,11 @@ namespace regimeflow::engine
           regime_tracker_(nullptr) {
         event_loop_.set_dispatcher(&dispatcher_);
         install_default_handlers();
+        event_loop_.add_post_hook([this](const events::Event&) {
+            if (!bar_slice_.empty() && bar_slice_closed()) {
+                flush_bar_slice();
+            }
+        });
     }
 
     namespace {
@@ -229,8 +234,10 @@ namespace regimeflow::engine
     }
 
     void BacktestEngine::replay_execution_ticks(const data::Bar& bar) {
+        const auto scope = stage_profiler_.scope(EngineStage::ReplayTicks);
         for (const auto& tick : build_execution_ticks(bar)) {
             market_data_.update(tick);
+            const auto pipeline_scope = stage_profiler_.scope(EngineStage::ExecutionPipeline);
             execution_pipeline_.on_market_update(tick.symbol, tick.timestamp);
         }
     }
@@ -359,6 +366,7 @@ namespace regimeflow::engine
     }
 
     void BacktestEngine::record_audit_event(AuditEvent event) {
+        const auto scope = stage_profiler_.scope(EngineStage::AuditJournal);
         journal_events_.emplace_back(event);
         if (!audit_logger_) {
             return;
@@ -416,10 +424,63 @@ namespace regimeflow::engine
         event_queue_.push(std::move(event));
     }
 
+    void BacktestEngine::set_event_queue_mode(const events::EventQueue::Mode mode) {
+        event_queue_.set_mode(mode);
+    }
+
+    void BacktestEngine::set_slice_dispatch(const bool enabled) {
+        if (!enabled && !bar_slice_.empty()) {
+            flush_bar_slice();
+        }
+        slice_dispatch_ = enabled;
+    }
+
+    void BacktestEngine::set_stage_profiling(const bool enabled) {
+        stage_profiler_.set_enabled(enabled);
+    }
+
+    void BacktestEngine::set_equity_sampling(const EquitySamplingConfig config) {
+        equity_sampling_ = config;
+        portfolio_.set_equity_sampling(config);
+        metrics_.set_snapshot_sampling(config);
+    }
+
+    bool BacktestEngine::bar_slice_closed() {
+        // Market events at one timestamp are contiguous in the queue, except for
+        // higher-priority system events (e.g. regime changes) raised mid-slice.
+        const auto next = event_queue_.peek_header();
+        return !next || next->timestamp != bar_slice_.front().timestamp
+            || next->priority > events::kMarketPriority;
+    }
+
+    void BacktestEngine::flush_bar_slice() {
+        const Timestamp timestamp = bar_slice_.front().timestamp;
+        portfolio_.record_snapshot(timestamp);
+        evaluate_account_state(timestamp, "bar");
+        {
+            const auto scope = stage_profiler_.scope(EngineStage::Metrics);
+            metrics_.update(timestamp, portfolio_, regime_tracker_.current_state());
+        }
+        const std::span<const data::Bar> slice(bar_slice_);
+        {
+            const auto scope = stage_profiler_.scope(EngineStage::Strategy);
+            if (strategy_) {
+                strategy_->on_bars(slice);
+            }
+            strategy_manager_.on_bars(slice);
+        }
+        bar_slice_.clear();
+    }
+
+    void BacktestEngine::set_event_generator_config(EventGenerator::Config config) {
+        event_generator_config_ = config;
+    }
+
     void BacktestEngine::load_data(std::unique_ptr<data::DataIterator> iterator) {
         symbols_with_real_ticks_.clear();
-        event_generator_ = std::make_unique<EventGenerator>(std::move(iterator), &event_queue_);
-        event_generator_->enqueue_all();
+        event_generator_ = std::make_unique<EventGenerator>(std::move(iterator), &event_queue_,
+                                                            event_generator_config_);
+        attach_event_generator();
     }
 
     void BacktestEngine::load_data(std::unique_ptr<data::DataIterator> bar_iterator,
@@ -429,8 +490,26 @@ namespace regimeflow::engine
         event_generator_ = std::make_unique<EventGenerator>(std::move(bar_iterator),
                                                             std::move(tick_iterator),
                                                             std::move(book_iterator),
-                                                            &event_queue_);
-        event_generator_->enqueue_all();
+                                                            &event_queue_,
+                                                            event_generator_config_);
+        attach_event_generator();
+    }
+
+    void BacktestEngine::attach_event_generator() {
+        if (!event_generator_->config().streaming) {
+            event_loop_.set_refill_callback({});
+            event_generator_->enqueue_all();
+            return;
+        }
+        event_generator_->start_streaming();
+        event_loop_.set_refill_callback([this]() { event_generator_->feed(); });
+    }
+
+    bool BacktestEngine::has_pending_events() {
+        if (event_generator_) {
+            event_generator_->feed();
+        }
+        return !event_queue_.empty();
     }
 
     void BacktestEngine::set_strategy(std::unique_ptr<strategy::Strategy> strategy, Config config) {
@@ -878,6 +957,13 @@ namespace regimeflow::engine
                 try {
                     const auto& params = param_sets[i];
                     BacktestEngine engine(portfolio_.initial_capital(), portfolio_.currency());
+                    engine.set_event_queue_mode(event_queue_.mode());
+                    engine.order_manager().set_mode(order_manager_.mode());
+                    engine.set_stage_profiling(stage_profiler_.enabled());
+                    engine.set_slice_dispatch(slice_dispatch_);
+                    engine.set_equity_sampling(equity_sampling_);
+                    engine.market_data().set_history_depth(market_data_.history_depth());
+                    engine.set_event_generator_config(event_generator_config_);
                     if (execution_config_) {
                         engine.configure_execution(*execution_config_);
                     }
@@ -940,6 +1026,7 @@ namespace regimeflow::engine
         if (!started_) {
             journal_events_.clear();
             journal_submitted_order_ids_.clear();
+            stage_profiler_.reset();
             if (progress_callback_) {
                 progress_callback_(0.0, "starting");
             }
@@ -964,7 +1051,7 @@ namespace regimeflow::engine
             started_ = true;
         }
         event_loop_.run();
-        if (event_queue_.empty()) {
+        if (!has_pending_events()) {
             strategy_manager_.stop();
             hooks_.run_stop();
             if (strategy_) {
@@ -994,6 +1081,7 @@ namespace regimeflow::engine
         if (!started_) {
             journal_events_.clear();
             journal_submitted_order_ids_.clear();
+            stage_profiler_.reset();
             if (progress_callback_) {
                 progress_callback_(0.0, "starting");
             }
@@ -1018,7 +1106,7 @@ namespace regimeflow::engine
             started_ = true;
         }
         const bool processed = event_loop_.step();
-        if (!processed || event_queue_.empty()) {
+        if (!processed || !has_pending_events()) {
             strategy_manager_.stop();
             hooks_.run_stop();
             if (strategy_) {
@@ -1045,6 +1133,7 @@ namespace regimeflow::engine
         if (!started_) {
             journal_events_.clear();
             journal_submitted_order_ids_.clear();
+            stage_profiler_.reset();
             if (progress_callback_) {
                 progress_callback_(0.0, "starting");
             }
@@ -1069,7 +1158,7 @@ namespace regimeflow::engine
             started_ = true;
         }
         event_loop_.run_until(end_time);
-        if (event_queue_.empty()) {
+        if (!has_pending_events()) {
             strategy_manager_.stop();
             hooks_.run_stop();
             if (strategy_) {
@@ -1102,6 +1191,7 @@ namespace regimeflow::engine
         result.fills = portfolio_.get_fills();
         result.regime_history = metrics_.regime_history();
         result.journal_events = journal_events_;
+        result.stage_profile = stage_profiler_.stats();
         return result;
     }
 
@@ -1229,6 +1319,7 @@ namespace regimeflow::engine
         if (stop_out_state_) {
             snapshot.alerts.emplace_back("Stop-out active");
         }
+        snapshot.stage_profile = stage_profiler_.stats();
 
         return snapshot;
     }
@@ -1246,6 +1337,7 @@ namespace regimeflow::engine
             if (account_trading_halted_ && !order.metadata.contains("forced_liquidation")) {
                 return Result<void>(Error(Error::Code::InvalidState, "Trading halted by account enforcement"));
             }
+            const auto scope = stage_profiler_.scope(EngineStage::Hooks);
             plugins::HookContext ctx(&portfolio_, &market_data_, &regime_tracker_.current_state(),
                                      &event_queue_, event_loop_.current_time());
             ctx.set_order(&order);
@@ -1275,13 +1367,18 @@ namespace regimeflow::engine
             record_audit_event(std::move(event));
         });
         order_manager_.on_fill([this](const Fill& fill) {
+            const auto scope = stage_profiler_.scope(EngineStage::Strategy);
             if (strategy_) {
                 strategy_->on_fill(fill);
             }
             strategy_manager_.on_fill(fill);
         });
         order_manager_.on_order_update([this](const Order& order) {
-            execution_pipeline_.on_order_update(order);
+            {
+                const auto scope = stage_profiler_.scope(EngineStage::ExecutionPipeline);
+                execution_pipeline_.on_order_update(order);
+            }
+            const auto scope = stage_profiler_.scope(EngineStage::Strategy);
             if (strategy_) {
                 strategy_->on_order_update(order);
             }
@@ -1308,15 +1405,21 @@ namespace regimeflow::engine
                     record_audit_event(std::move(event));
                     journal_submitted_order_ids_.insert(order.id);
                 }
+                bool approved = false;
+                {
+                    const auto scope = stage_profiler_.scope(EngineStage::RiskValidation);
+                    approved = risk_manager_.validate(order, portfolio_).is_ok();
+                }
                 if (order.is_parent) {
-                    if (const auto result = risk_manager_.validate(order, portfolio_); result.is_ok()) {
+                    if (approved) {
                         order_manager_.activate_routed_order(order.id);
                     } else {
                         order_manager_.update_order_status(order.id, OrderStatus::Rejected);
                     }
                     return;
                 }
-                if (const auto result = risk_manager_.validate(order, portfolio_); result.is_ok()) {
+                if (approved) {
+                    const auto scope = stage_profiler_.scope(EngineStage::ExecutionPipeline);
                     execution_pipeline_.on_order_submitted(order);
                 } else {
                     order_manager_.update_order_status(order.id, OrderStatus::Rejected);
@@ -1325,18 +1428,25 @@ namespace regimeflow::engine
         });
 
         dispatcher_.set_market_handler([this](const events::Event& event) {
-            hooks_.run_pre_event(event);
+            {
+                const auto scope = stage_profiler_.scope(EngineStage::Hooks);
+                hooks_.run_pre_event(event);
+            }
             const auto* payload = std::get_if<events::MarketEventPayload>(&event.payload);
             if (!payload) {
                 return;
             }
-            cancel_day_orders_if_needed(event.timestamp);
-            cancel_expired_orders(event.timestamp);
-            timer_service_.on_time_advance(event.timestamp);
+            const bool slice_bar = slice_dispatch_ && payload->kind == events::MarketEventKind::Bar;
+            if (!slice_bar || bar_slice_.empty()) {
+                cancel_day_orders_if_needed(event.timestamp);
+                cancel_expired_orders(event.timestamp);
+                timer_service_.on_time_advance(event.timestamp);
+            }
             switch (payload->kind) {
                 case events::MarketEventKind::Bar: {
                     const auto& bar = std::get<data::Bar>(payload->data);
                     {
+                        const auto scope = stage_profiler_.scope(EngineStage::Hooks);
                         plugins::HookContext ctx(&portfolio_, &market_data_,
                                                  &regime_tracker_.current_state(),
                                                  &event_queue_, event.timestamp);
@@ -1354,21 +1464,34 @@ namespace regimeflow::engine
                         replay_execution_ticks(bar);
                     }
                     portfolio_.mark_to_market(bar.symbol, bar.close, bar.timestamp);
-                    portfolio_.record_snapshot(bar.timestamp);
-                    evaluate_account_state(bar.timestamp, "bar");
+                    if (!slice_bar) {
+                        portfolio_.record_snapshot(bar.timestamp);
+                        evaluate_account_state(bar.timestamp, "bar");
+                    }
                     stop_loss_manager_.on_bar(bar, order_manager_);
-                    metrics_.update(bar.timestamp, portfolio_, regime_tracker_.current_state());
-                    if (auto transition = regime_tracker_.on_bar(bar)) {
+                    if (!slice_bar) {
+                        const auto scope = stage_profiler_.scope(EngineStage::Metrics);
+                        metrics_.update(bar.timestamp, portfolio_, regime_tracker_.current_state());
+                    }
+                    std::optional<regime::RegimeTransition> transition;
+                    {
+                        const auto scope = stage_profiler_.scope(EngineStage::RegimeTracker);
+                        transition = regime_tracker_.on_bar(bar);
+                    }
+                    if (transition) {
                         events::Event evt = events::make_system_event(
                             events::SystemEventKind::RegimeChange, transition->timestamp);
                         event_queue_.push(std::move(evt));
-                        plugins::HookContext ctx(&portfolio_, &market_data_,
-                                                 &regime_tracker_.current_state(),
-                                                 &event_queue_, transition->timestamp);
-                        ctx.set_regime_change(&(*transition));
-                        if (hook_manager_.invoke(plugins::HookType::RegimeChange, ctx)
-                            == plugins::HookResult::Cancel) {
-                            return;
+                        {
+                            const auto scope = stage_profiler_.scope(EngineStage::Hooks);
+                            plugins::HookContext ctx(&portfolio_, &market_data_,
+                                                     &regime_tracker_.current_state(),
+                                                     &event_queue_, transition->timestamp);
+                            ctx.set_regime_change(&(*transition));
+                            if (hook_manager_.invoke(plugins::HookType::RegimeChange, ctx)
+                                == plugins::HookResult::Cancel) {
+                                return;
+                            }
                         }
                         AuditEvent audit_event;
                         audit_event.timestamp = transition->timestamp;
@@ -1378,20 +1501,29 @@ namespace regimeflow::engine
                         audit_event.metadata["to"] = std::to_string(static_cast<int>(transition->to));
                         audit_event.metadata["confidence"] = std::to_string(transition->confidence);
                         record_audit_event(std::move(audit_event));
+                        const auto scope = stage_profiler_.scope(EngineStage::Strategy);
                         if (strategy_) {
                             strategy_->on_regime_change(*transition);
                         }
                         strategy_manager_.on_regime_change(*transition);
                     }
-                    if (strategy_) {
-                        strategy_->on_bar(bar);
+                    if (slice_bar) {
+                        bar_slice_.push_back(bar);
+                        break;
+                    }
+                    {
+                        const auto scope = stage_profiler_.scope(EngineStage::Strategy);
+                        if (strategy_) {
+                            strategy_->on_bar(bar);
+                        }
+                        strategy_manager_.on_bar(bar);
                     }
-                    strategy_manager_.on_bar(bar);
                     break;
                 }
                 case events::MarketEventKind::Tick: {
                     const auto& tick = std::get<data::Tick>(payload->data);
                     {
+                        const auto scope = stage_profiler_.scope(EngineStage::Hooks);
                         plugins::HookContext ctx(&portfolio_, &market_data_,
                                                  &regime_tracker_.current_state(),
                                                  &event_queue_, event.timestamp);
@@ -1403,23 +1535,37 @@ namespace regimeflow::engine
                     }
                     symbols_with_real_ticks_.insert(tick.symbol);
                     market_data_.update(tick);
-                    execution_pipeline_.on_market_update(tick.symbol, tick.timestamp);
+                    {
+                        const auto scope = stage_profiler_.scope(EngineStage::ExecutionPipeline);
+                        execution_pipeline_.on_market_update(tick.symbol, tick.timestamp);
+                    }
                     portfolio_.mark_to_market(tick.symbol, tick.price, tick.timestamp);
                     portfolio_.record_snapshot(tick.timestamp);
                     evaluate_account_state(tick.timestamp, "tick");
                     stop_loss_manager_.on_tick(tick, order_manager_);
-                    metrics_.update(tick.timestamp, portfolio_, regime_tracker_.current_state());
-                    if (auto transition = regime_tracker_.on_tick(tick)) {
+                    {
+                        const auto scope = stage_profiler_.scope(EngineStage::Metrics);
+                        metrics_.update(tick.timestamp, portfolio_, regime_tracker_.current_state());
+                    }
+                    std::optional<regime::RegimeTransition> transition;
+                    {
+                        const auto scope = stage_profiler_.scope(EngineStage::RegimeTracker);
+                        transition = regime_tracker_.on_tick(tick);
+                    }
+                    if (transition) {
                         events::Event evt = events::make_system_event(
                             events::SystemEventKind::RegimeChange, transition->timestamp);
                         event_queue_.push(std::move(evt));
-                        plugins::HookContext ctx(&portfolio_, &market_data_,
-                                                 &regime_tracker_.current_state(),
-                                                 &event_queue_, transition->timestamp);
-                        ctx.set_regime_change(&(*transition));
-                        if (hook_manager_.invoke(plugins::HookType::RegimeChange, ctx)
-                            == plugins::HookResult::Cancel) {
-                            return;
+                        {
+                            const auto scope = stage_profiler_.scope(EngineStage::Hooks);
+                            plugins::HookContext ctx(&portfolio_, &market_data_,
+                                                     &regime_tracker_.current_state(),
+                                                     &event_queue_, transition->timestamp);
+                            ctx.set_regime_change(&(*transition));
+                            if (hook_manager_.invoke(plugins::HookType::RegimeChange, ctx)
+                                == plugins::HookResult::Cancel) {
+                                return;
+                            }
                         }
                         AuditEvent audit_event;
                         audit_event.timestamp = transition->timestamp;
@@ -1429,20 +1575,25 @@ namespace regimeflow::engine
                         audit_event.metadata["to"] = std::to_string(static_cast<int>(transition->to));
                         audit_event.metadata["confidence"] = std::to_string(transition->confidence);
                         record_audit_event(std::move(audit_event));
+                        const auto scope = stage_profiler_.scope(EngineStage::Strategy);
                         if (strategy_) {
                             strategy_->on_regime_change(*transition);
                         }
                         strategy_manager_.on_regime_change(*transition);
                     }
-                    if (strategy_) {
-                        strategy_->on_tick(tick);
+                    {
+                        const auto scope = stage_profiler_.scope(EngineStage::Strategy);
+                        if (strategy_) {
+                            strategy_->on_tick(tick);
+                        }
+                        strategy_manager_.on_tick(tick);
                     }
-                    strategy_manager_.on_tick(tick);
                     break;
                 }
                 case events::MarketEventKind::Quote: {
                     const auto& quote = std::get<data::Quote>(payload->data);
                     {
+                        const auto scope = stage_profiler_.scope(EngineStage::Hooks);
                         plugins::HookContext ctx(&portfolio_, &market_data_,
                                                  &regime_tracker_.current_state(),
                                                  &event_queue_, event.timestamp);
@@ -1454,20 +1605,27 @@ namespace regimeflow::engine
                     }
                     symbols_with_real_ticks_.insert(quote.symbol);
                     market_data_.update(quote);
-                    execution_pipeline_.on_market_update(quote.symbol, quote.timestamp);
+                    {
+                        const auto scope = stage_profiler_.scope(EngineStage::ExecutionPipeline);
+                        execution_pipeline_.on_market_update(quote.symbol, quote.timestamp);
+                    }
                     portfolio_.mark_to_market(quote.symbol, quote.mid(), quote.timestamp);
                     portfolio_.record_snapshot(quote.timestamp);
                     evaluate_account_state(quote.timestamp, "quote");
-                    if (strategy_) {
-                        strategy_->on_quote(quote);
+                    {
+                        const auto scope = stage_profiler_.scope(EngineStage::Strategy);
+                        if (strategy_) {
+                            strategy_->on_quote(quote);
+                        }
+                        strategy_manager_.on_quote(quote);
                     }
-                    strategy_manager_.on_quote(quote);
                     break;
                 }
                 case events::MarketEventKind::Book:
                     {
                         const auto& book = std::get<data::OrderBook>(payload->data);
                         {
+                            const auto scope = stage_profiler_.scope(EngineStage::Hooks);
                             plugins::HookContext ctx(&portfolio_, &market_data_,
                                                      &regime_tracker_.current_state(),
                                                      &event_queue_, event.timestamp);
@@ -1479,19 +1637,29 @@ namespace regimeflow::engine
                         }
                         symbols_with_real_ticks_.insert(book.symbol);
                         order_book_cache_.update(book);
-                        execution_pipeline_.on_market_update(book.symbol, book.timestamp);
-                        if (strategy_) {
-                            strategy_->on_order_book(book);
+                        {
+                            const auto scope = stage_profiler_.scope(EngineStage::ExecutionPipeline);
+                            execution_pipeline_.on_market_update(book.symbol, book.timestamp);
+                        }
+                        {
+                            const auto scope = stage_profiler_.scope(EngineStage::Strategy);
+                            if (strategy_) {
+                                strategy_->on_order_book(book);
+                            }
+                            strategy_manager_.on_order_book(book);
                         }
-                        strategy_manager_.on_order_book(book);
                         break;
                     }
                 }
+                const auto scope = stage_profiler_.scope(EngineStage::Hooks);
                 hooks_.run_post_event(event);
             });
 
         dispatcher_.set_order_handler([this](const events::Event& event) {
-            hooks_.run_pre_event(event);
+            {
+                const auto scope = stage_profiler_.scope(EngineStage::Hooks);
+                hooks_.run_pre_event(event);
+            }
             const auto* payload = std::get_if<events::OrderEventPayload>(&event.payload);
             if (!payload) {
                 return;
@@ -1511,6 +1679,7 @@ namespace regimeflow::engine
                     fill.venue = payload->venue;
                     fill.timestamp = event.timestamp;
                     {
+                        const auto scope = stage_profiler_.scope(EngineStage::Hooks);
                         plugins::HookContext ctx(&portfolio_, &market_data_,
                                                  &regime_tracker_.current_state(),
                                                  &event_queue_, event.timestamp);
@@ -1552,34 +1721,44 @@ namespace regimeflow::engine
                 order_manager_.update_order_status(payload->order_id, OrderStatus::Pending);
                 break;
         }
+        const auto scope = stage_profiler_.scope(EngineStage::Hooks);
         hooks_.run_post_event(event);
     });
 
         dispatcher_.set_system_handler([this](const events::Event& event) {
-            hooks_.run_pre_event(event);
+            {
+                const auto scope = stage_profiler_.scope(EngineStage::Hooks);
+                hooks_.run_pre_event(event);
+            }
             const auto* payload = std::get_if<events::SystemEventPayload>(&event.payload);
             if (!payload) {
                 return;
             }
             if (payload->kind == events::SystemEventKind::DayStart) {
+                const auto scope = stage_profiler_.scope(EngineStage::Hooks);
                 plugins::HookContext ctx(&portfolio_, &market_data_, &regime_tracker_.current_state(),
                                          &event_queue_, event.timestamp);
                 hook_manager_.invoke(plugins::HookType::DayStart, ctx);
             }
             if (payload->kind == events::SystemEventKind::EndOfDay) {
+                const auto scope = stage_profiler_.scope(EngineStage::Hooks);
                 plugins::HookContext ctx(&portfolio_, &market_data_, &regime_tracker_.current_state(),
                                          &event_queue_, event.timestamp);
                 hook_manager_.invoke(plugins::HookType::DayEnd, ctx);
             }
             if (payload->kind == events::SystemEventKind::Timer) {
-                plugins::HookContext ctx(&portfolio_, &market_data_, &regime_tracker_.current_state(),
-                                         &event_queue_, event.timestamp);
-                ctx.set_timer_id(payload->id);
-                if (hook_manager_.invoke(plugins::HookType::Timer, ctx)
-                    == plugins::HookResult::Cancel) {
-                    hooks_.run_post_event(event);
-                    return;
+                {
+                    const auto scope = stage_profiler_.scope(EngineStage::Hooks);
+                    plugins::HookContext ctx(&portfolio_, &market_data_, &regime_tracker_.current_state(),
+                                             &event_queue_, event.timestamp);
+                    ctx.set_timer_id(payload->id);
+                    if (hook_manager_.invoke(plugins::HookType::Timer, ctx)
+                        == plugins::HookResult::Cancel) {
+                        hooks_.run_post_event(event);
+                        return;
+                    }
                 }
+                const auto scope = stage_profiler_.scope(EngineStage::Strategy);
                 if (strategy_) {
                     strategy_->on_timer(payload->id);
                 }
@@ -1596,6 +1775,7 @@ namespace regimeflow::engine
                         halted);
                 }
             }
+            const auto scope = stage_profiler_.scope(EngineStage::Hooks);
             hooks_.run_post_event(event);
         });
     }
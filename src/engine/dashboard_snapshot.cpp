@@ -203,6 +203,7 @@ namespace regimeflow::engine
         snapshot.fill_count = results.fills.size();
         snapshot.equity_curve = results.metrics.portfolio_snapshots();
         snapshot.venue_summary = summarize_dashboard_venues(results.fills);
+        snapshot.stage_profile = results.stage_profile;
         snapshot.recent_fills = results.fills;
         if (snapshot.recent_fills.size() > 10) {
             snapshot.recent_fills.erase(snapshot.recent_fills.begin(),
@@ -356,6 +357,34 @@ namespace regimeflow::engine
             }
             out << "\"" << json_escape(snapshot.alerts[i]) << "\"";
         }
+        out << "],"
+            << "\"stage_profile\":[";
+        for (size_t i = 0; i < snapshot.stage_profile.size(); ++i) {
+            const auto& stage = snapshot.stage_profile[i];
+            if (i > 0) {
+                out << ",";
+            }
+            out << "{"
+                << "\"stage\":\"" << json_escape(stage.stage) << "\","
+                << "\"calls\":" << stage.calls << ","
+                << "\"total_ns\":" << stage.total_ns << ","
+                << "\"mean_ns\":" << stage.mean_ns() << ","
+                << "\"p50_ns\":" << stage.percentile_ns(0.5) << ","
+                << "\"p99_ns\":" << stage.percentile_ns(0.99) << ","
+                << "\"max_ns\":" << stage.max_ns << ","
+                << "\"histogram\":[";
+            size_t used = stage.histogram.size();
+            while (used > 0 && stage.histogram[used - 1] == 0) {
+                --used;
+            }
+            for (size_t bucket = 0; bucket < used; ++bucket) {
+                if (bucket > 0) {
+                    out << ",";
+                }
+                out << stage.histogram[bucket];
+            }
+            out << "]}";
+        }
         out << "]}";
         return out.str();
     }
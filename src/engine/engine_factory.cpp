@@ -2,7 +2,9 @@
 
 #include "regimeflow/plugins/registry.h"
 
+#include <algorithm>
 #include <filesystem>
+#include <stdexcept>
 
 namespace regimeflow::engine
 {
@@ -50,6 +52,51 @@ namespace regimeflow::engine
                 engine->set_audit_log_path(*audit_path);
             }
         }
+        if (const auto queue = config.get_as<std::string>("engine.event_queue")) {
+            if (*queue == "single_threaded" || *queue == "time_bucket") {
+                engine->set_event_queue_mode(events::EventQueue::Mode::SingleThreaded);
+            } else if (*queue == "concurrent") {
+                engine->set_event_queue_mode(events::EventQueue::Mode::Concurrent);
+            } else {
+                throw std::invalid_argument("Unknown engine.event_queue: " + *queue +
+                                            " (expected concurrent or single_threaded)");
+            }
+        }
+        if (const auto mode = config.get_as<std::string>("engine.order_manager")) {
+            if (*mode == "single_threaded") {
+                engine->order_manager().set_mode(OrderManager::Mode::SingleThreaded);
+            } else if (*mode == "concurrent") {
+                engine->order_manager().set_mode(OrderManager::Mode::Concurrent);
+            } else {
+                throw std::invalid_argument("Unknown engine.order_manager: " + *mode +
+                                            " (expected concurrent or single_threaded)");
+            }
+        }
+        if (const auto profile = config.get_as<bool>("engine.profile_stages")) {
+            engine->set_stage_profiling(*profile);
+        }
+        if (const auto slices = config.get_as<bool>("engine.slice_dispatch")) {
+            engine->set_slice_dispatch(*slices);
+        }
+        if (const auto depth = config.get_as<int64_t>("engine.bar_history_depth")) {
+            engine->market_data().set_history_depth(static_cast<size_t>(std::max<int64_t>(*depth, 1)));
+        }
+        if (const auto sampling = config.get_as<std::string>("engine.equity_sampling")) {
+            EquitySamplingConfig sampling_config;
+            sampling_config.mode = EquitySamplingConfig::parse_mode(*sampling);
+            if (const auto seconds = config.get_as<int64_t>("engine.equity_sample_interval_seconds")) {
+                sampling_config.interval = Duration::seconds(std::max<int64_t>(*seconds, 1));
+            }
+            engine->set_equity_sampling(sampling_config);
+        }
+        EventGenerator::Config generator_config;
+        if (const auto streaming = config.get_as<bool>("engine.streaming")) {
+            generator_config.streaming = *streaming;
+        }
+        if (const auto lookahead = config.get_as<int64_t>("engine.stream_lookahead")) {
+            generator_config.stream_lookahead = static_cast<size_t>(std::max<int64_t>(*lookahead, 1));
+        }
+        engine->set_event_generator_config(generator_config);
 
         if (auto exec_cfg = config.get_as<ConfigValue::Object>("execution")) {
             engine->configure_execution(Config(*exec_cfg));
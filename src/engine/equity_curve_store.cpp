@@ -0,0 +1,212 @@
+#include "regimeflow/engine/equity_curve_store.h"
+
+#include <stdexcept>
+
+namespace regimeflow::engine
+{
+    namespace {
+        constexpr uint8_t kMarginCallFlag = 1u << 0;
+        constexpr uint8_t kStopOutFlag = 1u << 1;
+        constexpr int64_t kMicrosPerDay = 86'400'000'000LL;
+
+        bool same_position(const Position& lhs, const Position& rhs) {
+            return lhs.quantity == rhs.quantity && lhs.avg_cost == rhs.avg_cost
+                && lhs.current_price == rhs.current_price && lhs.last_update == rhs.last_update;
+        }
+
+        int64_t floor_div(const int64_t value, const int64_t divisor) {
+            const int64_t q = value / divisor;
+            return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? q - 1 : q;
+        }
+    }  // namespace
+
+    EquitySampling EquitySamplingConfig::parse_mode(const std::string& name) {
+        if (name == "interval" || name == "bar_interval") {
+            return EquitySampling::Interval;
+        }
+        if (name == "end_of_day" || name == "eod" || name == "daily") {
+            return EquitySampling::EndOfDay;
+        }
+        if (name == "every_event") {
+            return EquitySampling::EveryEvent;
+        }
+        throw std::invalid_argument("Unknown engine.equity_sampling: " + name +
+                                    " (expected every_event, interval or end_of_day)");
+    }
+
+    void EquityCurveStore::record(const PortfolioSnapshot& fields,
+                                  const SymbolTable<Position>& positions) {
+        if (!timestamps_.empty() && sampling_.mode != EquitySampling::EveryEvent
+            && bucket_of(fields.timestamp) == last_bucket_) {
+            overwrite_last(fields, positions);
+            return;
+        }
+        append_row(fields, positions);
+    }
+
+    void EquityCurveStore::overwrite_last(const PortfolioSnapshot& fields,
+                                          const SymbolTable<Position>& positions) {
+        if (timestamps_.empty()) {
+            append_row(fields, positions);
+            return;
+        }
+        set_row(timestamps_.size() - 1, fields);
+        deltas_.resize(delta_offsets_.back());
+        encode_deltas(positions);
+        last_bucket_ = bucket_of(fields.timestamp);
+    }
+
+    PortfolioSnapshot EquityCurveStore::snapshot(const size_t index) const {
+        const size_t keyframe = index / kKeyframeInterval;
+        std::unordered_map<SymbolId, Position> state;
+        state.reserve(keyframes_[keyframe].size());
+        for (const auto& position : keyframes_[keyframe]) {
+            state.emplace(position.symbol, position);
+        }
+        for (size_t row = keyframe * kKeyframeInterval; row <= index; ++row) {
+            apply_row(row, state);
+        }
+        return build(index, std::move(state));
+    }
+
+    std::vector<PortfolioSnapshot> EquityCurveStore::snapshots() const {
+        std::vector<PortfolioSnapshot> out;
+        out.reserve(timestamps_.size());
+        std::unordered_map<SymbolId, Position> state;
+        for (size_t row = 0; row < timestamps_.size(); ++row) {
+            apply_row(row, state);
+            out.push_back(build(row, state));
+        }
+        return out;
+    }
+
+    void EquityCurveStore::clear() {
+        timestamps_.clear();
+        equity_.clear();
+        cash_.clear();
+        gross_exposure_.clear();
+        net_exposure_.clear();
+        leverage_.clear();
+        initial_margin_.clear();
+        maintenance_margin_.clear();
+        available_funds_.clear();
+        margin_excess_.clear();
+        buying_power_.clear();
+        flags_.clear();
+        deltas_.clear();
+        delta_offsets_.clear();
+        keyframes_.clear();
+        base_.clear();
+        last_bucket_ = 0;
+    }
+
+    int64_t EquityCurveStore::bucket_of(const Timestamp timestamp) const {
+        switch (sampling_.mode) {
+        case EquitySampling::EveryEvent:
+            break;
+        case EquitySampling::Interval:
+            if (const int64_t width = sampling_.interval.total_microseconds(); width > 0) {
+                return floor_div(timestamp.microseconds(), width);
+            }
+            break;
+        case EquitySampling::EndOfDay:
+            return floor_div(timestamp.microseconds(), kMicrosPerDay);
+        }
+        return timestamp.microseconds();
+    }
+
+    void EquityCurveStore::append_row(const PortfolioSnapshot& fields,
+                                      const SymbolTable<Position>& positions) {
+        if (!timestamps_.empty()) {
+            apply_row(timestamps_.size() - 1, base_);
+        }
+        if (timestamps_.size() % kKeyframeInterval == 0) {
+            auto& keyframe = keyframes_.emplace_back();
+            keyframe.reserve(base_.size());
+            for (const auto& [symbol, position] : base_) {
+                keyframe.push_back(position);
+            }
+        }
+        timestamps_.emplace_back();
+        equity_.emplace_back();
+        cash_.emplace_back();
+        gross_exposure_.emplace_back();
+        net_exposure_.emplace_back();
+        leverage_.emplace_back();
+        initial_margin_.emplace_back();
+        maintenance_margin_.emplace_back();
+        available_funds_.emplace_back();
+        margin_excess_.emplace_back();
+        buying_power_.emplace_back();
+        flags_.emplace_back();
+        set_row(timestamps_.size() - 1, fields);
+        delta_offsets_.push_back(deltas_.size());
+        encode_deltas(positions);
+        last_bucket_ = bucket_of(fields.timestamp);
+    }
+
+    void EquityCurveStore::set_row(const size_t index, const PortfolioSnapshot& fields) {
+        timestamps_[index] = fields.timestamp;
+        equity_[index] = fields.equity;
+        cash_[index] = fields.cash;
+        gross_exposure_[index] = fields.gross_exposure;
+        net_exposure_[index] = fields.net_exposure;
+        leverage_[index] = fields.leverage;
+        initial_margin_[index] = fields.initial_margin;
+        maintenance_margin_[index] = fields.maintenance_margin;
+        available_funds_[index] = fields.available_funds;
+        margin_excess_[index] = fields.margin_excess;
+        buying_power_[index] = fields.buying_power;
+        flags_[index] = static_cast<uint8_t>((fields.margin_call ? kMarginCallFlag : 0)
+                                             | (fields.stop_out ? kStopOutFlag : 0));
+    }
+
+    void EquityCurveStore::encode_deltas(const SymbolTable<Position>& positions) {
+        for (const auto& [symbol, position] : positions) {
+            if (const auto* previous = base_.find(symbol); !previous || !same_position(*previous, position)) {
+                deltas_.push_back({position, false});
+                deltas_.back().position.symbol = symbol;
+            }
+        }
+        for (const auto& [symbol, position] : base_) {
+            if (!positions.contains(symbol)) {
+                deltas_.push_back({position, true});
+                deltas_.back().position.symbol = symbol;
+            }
+        }
+    }
+
+    template<typename State>
+    void EquityCurveStore::apply_row(const size_t index, State& state) const {
+        const size_t begin = delta_offsets_[index];
+        const size_t end = index + 1 < delta_offsets_.size() ? delta_offsets_[index + 1] : deltas_.size();
+        for (size_t i = begin; i < end; ++i) {
+            const auto& delta = deltas_[i];
+            if (delta.removed) {
+                state.erase(delta.position.symbol);
+            } else {
+                state[delta.position.symbol] = delta.position;
+            }
+        }
+    }
+
+    PortfolioSnapshot EquityCurveStore::build(const size_t index,
+                                              std::unordered_map<SymbolId, Position> positions) const {
+        PortfolioSnapshot snapshot;
+        snapshot.timestamp = timestamps_[index];
+        snapshot.cash = cash_[index];
+        snapshot.equity = equity_[index];
+        snapshot.gross_exposure = gross_exposure_[index];
+        snapshot.net_exposure = net_exposure_[index];
+        snapshot.leverage = leverage_[index];
+        snapshot.initial_margin = initial_margin_[index];
+        snapshot.maintenance_margin = maintenance_margin_[index];
+        snapshot.available_funds = available_funds_[index];
+        snapshot.margin_excess = margin_excess_[index];
+        snapshot.buying_power = buying_power_[index];
+        snapshot.margin_call = (flags_[index] & kMarginCallFlag) != 0;
+        snapshot.stop_out = (flags_[index] & kStopOutFlag) != 0;
+        snapshot.positions = std::move(positions);
+        return snapshot;
+    }
+}  // namespace regimeflow::engine
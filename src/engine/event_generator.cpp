@@ -4,6 +4,25 @@
 
 namespace regimeflow::engine
 {
+    namespace {
+
+        constexpr size_t kBarPrefetch = 256;
+        constexpr size_t kTickPrefetch = 256;
+        constexpr size_t kBookPrefetch = 16;
+
+        template <typename T, typename Iterator>
+        void append_market_events(Iterator& iterator, const size_t batch,
+                                  std::vector<events::Event>& events) {
+            std::vector<T> buffer(batch);
+            while (const size_t count = iterator.next_batch(buffer)) {
+                for (size_t i = 0; i < count; ++i) {
+                    events.push_back(events::make_market_event(buffer[i]));
+                }
+            }
+        }
+
+    }  // namespace
+
     EventGenerator::EventGenerator(std::unique_ptr<data::DataIterator> iterator,
                                    events::EventQueue* queue)
         : bar_iterator_(std::move(iterator)), queue_(queue), config_() {}
@@ -44,26 +63,17 @@ namespace regimeflow::engine
 
         if (bar_iterator_) {
             bar_iterator_->reset();
-            while (bar_iterator_->has_next()) {
-                data::Bar bar = bar_iterator_->next();
-                events.push_back(events::make_market_event(bar));
-            }
+            append_market_events<data::Bar>(*bar_iterator_, kBarPrefetch, events);
         }
 
         if (tick_iterator_) {
             tick_iterator_->reset();
-            while (tick_iterator_->has_next()) {
-                data::Tick tick = tick_iterator_->next();
-                events.push_back(events::make_market_event(tick));
-            }
+            append_market_events<data::Tick>(*tick_iterator_, kTickPrefetch, events);
         }
 
         if (book_iterator_) {
             book_iterator_->reset();
-            while (book_iterator_->has_next()) {
-                data::OrderBook book = book_iterator_->next();
-                events.push_back(events::make_market_event(book));
-            }
+            append_market_events<data::OrderBook>(*book_iterator_, kBookPrefetch, events);
         }
 
         std::ranges::sort(events, [](const events::Event& a, const events::Event& b) {
@@ -147,4 +157,146 @@ namespace regimeflow::engine
             queue_->push(std::move(evt));
         }
     }
+
+    void EventGenerator::start_streaming()
+    {
+        next_bar_.reset();
+        next_tick_.reset();
+        next_book_.reset();
+        bar_prefetch_.clear(kBarPrefetch);
+        tick_prefetch_.clear(kTickPrefetch);
+        book_prefetch_.clear(kBookPrefetch);
+        if (bar_iterator_) {
+            bar_iterator_->reset();
+            next_bar_ = bar_prefetch_.pull(*bar_iterator_);
+        }
+        if (tick_iterator_) {
+            tick_iterator_->reset();
+            next_tick_ = tick_prefetch_.pull(*tick_iterator_);
+        }
+        if (book_iterator_) {
+            book_iterator_->reset();
+            next_book_ = book_prefetch_.pull(*book_iterator_);
+        }
+        first_day_ = true;
+        current_day_.clear();
+        if (has_pending()) {
+            next_regime_check_ = next_data_timestamp() + config_.regime_check_interval;
+        }
+        streaming_started_ = true;
+    }
+
+    bool EventGenerator::has_pending() const
+    {
+        return next_bar_.has_value() || next_tick_.has_value() || next_book_.has_value();
+    }
+
+    Timestamp EventGenerator::next_data_timestamp() const
+    {
+        std::optional<Timestamp> ts;
+        if (next_bar_) {
+            ts = next_bar_->timestamp;
+        }
+        if (next_tick_ && (!ts || next_tick_->timestamp < *ts)) {
+            ts = next_tick_->timestamp;
+        }
+        if (next_book_ && (!ts || next_book_->timestamp < *ts)) {
+            ts = next_book_->timestamp;
+        }
+        return ts.value_or(Timestamp());
+    }
+
+    Timestamp EventGenerator::next_emit_timestamp() const
+    {
+        const Timestamp data_ts = next_data_timestamp();
+        if (config_.emit_regime_check && config_.regime_check_interval.total_microseconds() > 0
+            && next_regime_check_ < data_ts) {
+            return next_regime_check_;
+        }
+        return data_ts;
+    }
+
+    size_t EventGenerator::feed()
+    {
+        if (!queue_ || !streaming_started_ || !has_pending()) {
+            return 0;
+        }
+        if (const auto head = queue_->next_timestamp(); head && next_emit_timestamp() > *head) {
+            return 0;
+        }
+        const size_t target = std::max<size_t>(config_.stream_lookahead, 1);
+        size_t pushed = 0;
+        while (has_pending() && pushed < target) {
+            pushed += emit_next_group();
+        }
+        return pushed;
+    }
+
+    size_t EventGenerator::emit_next_group()
+    {
+        const Timestamp ts = next_data_timestamp();
+        size_t pushed = 0;
+
+        if (auto day = ts.to_string("%Y%m%d"); first_day_ || day != current_day_) {
+            if (config_.emit_start_of_day) {
+                queue_->push(events::make_system_event(events::SystemEventKind::DayStart, ts));
+                ++pushed;
+            }
+            current_day_ = std::move(day);
+            first_day_ = false;
+        }
+
+        if (config_.emit_regime_check && config_.regime_check_interval.total_microseconds() > 0) {
+            while (next_regime_check_ <= ts) {
+                queue_->push(events::make_system_event(
+                    events::SystemEventKind::Timer, next_regime_check_, 0, "regime_check"));
+                next_regime_check_ = next_regime_check_ + config_.regime_check_interval;
+                ++pushed;
+            }
+        }
+
+        // Within a timestamp, market events are emitted by symbol and then kind
+        // (bar, tick, book), matching the order produced by enqueue_all().
+        while (has_pending() && next_data_timestamp() == ts) {
+            enum class Head : uint8_t { Bar, Tick, Book };
+            std::optional<Head> best;
+            SymbolId best_symbol = 0;
+            if (next_bar_ && next_bar_->timestamp == ts) {
+                best = Head::Bar;
+                best_symbol = next_bar_->symbol;
+            }
+            if (next_tick_ && next_tick_->timestamp == ts
+                && (!best || next_tick_->symbol < best_symbol)) {
+                best = Head::Tick;
+                best_symbol = next_tick_->symbol;
+            }
+            if (next_book_ && next_book_->timestamp == ts
+                && (!best || next_book_->symbol < best_symbol)) {
+                best = Head::Book;
+                best_symbol = next_book_->symbol;
+            }
+            switch (*best) {
+            case Head::Bar:
+                queue_->push(events::make_market_event(*next_bar_));
+                next_bar_ = bar_prefetch_.pull(*bar_iterator_);
+                break;
+            case Head::Tick:
+                queue_->push(events::make_market_event(*next_tick_));
+                next_tick_ = tick_prefetch_.pull(*tick_iterator_);
+                break;
+            case Head::Book:
+                queue_->push(events::make_market_event(*next_book_));
+                next_book_ = book_prefetch_.pull(*book_iterator_);
+                break;
+            }
+            ++pushed;
+        }
+
+        if (config_.emit_end_of_day
+            && (!has_pending() || next_data_timestamp().to_string("%Y%m%d") != current_day_)) {
+            queue_->push(events::make_system_event(events::SystemEventKind::EndOfDay, ts));
+            ++pushed;
+        }
+        return pushed;
+    }
 }  // namespace regimeflow::engine
@@ -20,6 +20,10 @@ namespace regimeflow::engine
         progress_callback_ = std::move(callback);
     }
 
+    void EventLoop::set_refill_callback(RefillCallback callback) {
+        refill_callback_ = std::move(callback);
+    }
+
     void EventLoop::run() {
         if (!queue_ || !dispatcher_) {
             return;
@@ -27,6 +31,9 @@ namespace regimeflow::engine
         running_ = true;
         processed_ = 0;
         while (running_) {
+            if (refill_callback_) {
+                refill_callback_();
+            }
             auto next = queue_->pop();
             if (!next) {
                 break;
@@ -54,8 +61,11 @@ namespace regimeflow::engine
         }
         running_ = true;
         while (running_) {
-            auto next = queue_->peek();
-            if (!next || next->timestamp > end_time) {
+            if (refill_callback_) {
+                refill_callback_();
+            }
+            const auto next = queue_->next_timestamp();
+            if (!next || *next > end_time) {
                 break;
             }
             if (!step()) {
@@ -69,6 +79,9 @@ namespace regimeflow::engine
         if (!queue_ || !dispatcher_) {
             return false;
         }
+        if (refill_callback_) {
+            refill_callback_();
+        }
         const auto next = queue_->pop();
         if (!next) {
             return false;
@@ -1,7 +1,9 @@
 #include "regimeflow/engine/execution_pipeline.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <limits>
 #include <vector>
 
 namespace regimeflow::engine
@@ -426,7 +428,7 @@ namespace regimeflow::engine
         }
         if (order.status == OrderStatus::Rejected || order.status == OrderStatus::Cancelled
             || order.status == OrderStatus::Filled) {
-            resting_orders_.erase(order.id);
+            erase_resting(order.id);
             return;
         }
 
@@ -450,11 +452,11 @@ namespace regimeflow::engine
         state.was_resting = !can_fill_now(state);
 
         if (ts > submitted_at) {
-            resting_orders_[order.id] = state;
+            store_resting(state);
             return;
         }
         if (!session_allows_execution(order, ts)) {
-            resting_orders_[order.id] = state;
+            store_resting(state);
             return;
         }
 
@@ -485,7 +487,7 @@ namespace regimeflow::engine
                     return;
                 }
                 state.was_resting = true;
-                resting_orders_[order.id] = state;
+                store_resting(state);
                 return;
             }
             state.stop_triggered = true;
@@ -517,30 +519,23 @@ namespace regimeflow::engine
                 return;
             }
             state.was_resting = true;
-            resting_orders_[order.id] = state;
+            store_resting(state);
             return;
         }
 
-        resting_orders_[order.id] = state;
+        store_resting(state);
         process_resting_order(order.id, ts);
     }
 
     void ExecutionPipeline::on_order_update(const Order& order) {
         if (order.status == OrderStatus::Cancelled || order.status == OrderStatus::Rejected
             || order.status == OrderStatus::Filled) {
-            resting_orders_.erase(order.id);
+            erase_resting(order.id);
         }
     }
 
     void ExecutionPipeline::on_market_update(const SymbolId symbol, const Timestamp timestamp) {
-        std::vector<OrderId> to_process;
-        to_process.reserve(resting_orders_.size());
-        for (const auto& [id, state] : resting_orders_) {
-            if (state.order.symbol == symbol) {
-                to_process.push_back(id);
-            }
-        }
-        for (const auto id : to_process) {
+        for (const auto id : trigger_candidates(symbol)) {
             process_resting_order(id, timestamp);
         }
     }
@@ -551,14 +546,7 @@ namespace regimeflow::engine
             return;
         }
 
-        std::vector<OrderId> to_process;
-        to_process.reserve(resting_orders_.size());
-        for (const auto& [id, state] : resting_orders_) {
-            if (state.order.symbol == bar.symbol) {
-                to_process.push_back(id);
-            }
-        }
-        if (to_process.empty()) {
+        if (const auto* ladder = ladders_.find(bar.symbol); !ladder || ladder->empty()) {
             return;
         }
 
@@ -593,7 +581,7 @@ namespace regimeflow::engine
             context.executable_price_override = synthetic_price;
             context.has_price_override = true;
             context.use_order_book = false;
-            for (const auto id : to_process) {
+            for (const auto id : trigger_candidates(bar.symbol, context)) {
                 process_resting_order(id, bar.timestamp, context);
             }
         }
@@ -788,25 +776,25 @@ namespace regimeflow::engine
 
         RestingOrderState state = it->second;
         if (state.activation_time.microseconds() > 0 && timestamp < state.activation_time) {
-            resting_orders_[id] = state;
+            store_resting(state);
             return;
         }
         refresh_queue_state(state, context);
         if (!session_allows_execution(state.order, timestamp)) {
-            resting_orders_[id] = state;
+            store_resting(state);
             return;
         }
         if ((state.order.type == OrderType::Stop || state.order.type == OrderType::StopLimit)
             && !state.stop_triggered) {
             if (!should_trigger_stop(state, context)) {
-                resting_orders_[id] = state;
+                store_resting(state);
                 return;
             }
             state.stop_triggered = true;
         }
 
         if (!can_fill_now(state, context)) {
-            resting_orders_[id] = state;
+            store_resting(state);
             return;
         }
 
@@ -822,7 +810,7 @@ namespace regimeflow::engine
             }
             if (exceeds) {
                 if (price_drift_action_ == PriceDriftAction::Reject) {
-                    resting_orders_.erase(id);
+                    erase_resting(id);
                     const auto reject = events::make_order_event(
                         events::OrderEventKind::Reject,
                         timestamp,
@@ -837,7 +825,7 @@ namespace regimeflow::engine
 
                 state.requested_price = current_price;
                 state.has_requested_price = true;
-                resting_orders_[id] = state;
+                store_resting(state);
                 const auto update = events::make_order_event(
                     events::OrderEventKind::Update,
                     timestamp,
@@ -854,7 +842,7 @@ namespace regimeflow::engine
         bool maker_fill = false;
         if (queue_enabled_for(state.order) && state.was_resting && is_touch_fill_candidate(state, context)) {
             if (!advance_queue(state, context)) {
-                resting_orders_[id] = state;
+                store_resting(state);
                 return;
             }
             maker_fill = true;
@@ -912,7 +900,7 @@ namespace regimeflow::engine
         };
 
         if (state.effective_tif == TimeInForce::FOK && filled + kQuantityEpsilon < state.order.quantity) {
-            resting_orders_.erase(id);
+            erase_resting(id);
             emit_reject(state.order, timestamp);
             return;
         }
@@ -921,7 +909,7 @@ namespace regimeflow::engine
             if (!fills.empty()) {
                 emit_fills(fills, state.order, false);
             }
-            resting_orders_.erase(id);
+            erase_resting(id);
             emit_cancel(state.order, timestamp);
             return;
         }
@@ -937,12 +925,12 @@ namespace regimeflow::engine
             || (state.stop_triggered && state.order.type == OrderType::Stop);
 
         if (remaining <= kQuantityEpsilon) {
-            resting_orders_.erase(id);
+            erase_resting(id);
             return;
         }
 
         if (market_like) {
-            resting_orders_.erase(id);
+            erase_resting(id);
             emit_cancel(state.order, timestamp);
             return;
         }
@@ -952,7 +940,7 @@ namespace regimeflow::engine
             state.requested_price = current_price;
             state.has_requested_price = true;
         }
-        resting_orders_[id] = state;
+        store_resting(state);
 
         const auto update = events::make_order_event(
             events::OrderEventKind::Update,
@@ -965,6 +953,100 @@ namespace regimeflow::engine
         event_queue_->push(update);
     }
 
+    void ExecutionPipeline::store_resting(const RestingOrderState& state) {
+        const OrderId id = state.order.id;
+        const LadderSlot slot = ladder_slot_for(state);
+        auto [it, inserted] = resting_orders_.try_emplace(id, state);
+        if (!inserted) {
+            const LadderSlot previous = it->second.ladder;
+            const SymbolId previous_symbol = it->second.order.symbol;
+            it->second = state;
+            it->second.ladder = slot;
+            if (previous == slot && previous_symbol == state.order.symbol) {
+                return;
+            }
+            if (auto* ladder = ladders_.find(previous_symbol)) {
+                ladder->erase(previous, id);
+            }
+        } else {
+            it->second.ladder = slot;
+        }
+        ladders_[state.order.symbol].insert(slot, id);
+    }
+
+    void ExecutionPipeline::erase_resting(const OrderId id) {
+        const auto it = resting_orders_.find(id);
+        if (it == resting_orders_.end()) {
+            return;
+        }
+        if (auto* ladder = ladders_.find(it->second.order.symbol)) {
+            ladder->erase(it->second.ladder, id);
+        }
+        resting_orders_.erase(it);
+    }
+
+    ExecutionPipeline::LadderSlot ExecutionPipeline::ladder_slot_for(const RestingOrderState& state) const {
+        const Order& order = state.order;
+        LadderSlot slot;
+        // Per-order queue modelling and venue price adjustments make activity depend
+        // on more than the side price, so those orders are checked on every update.
+        if (metadata_bool(order, "venue_queue_enabled").value_or(false)
+            || metadata_double(order, "venue_price_adjustment_bps")) {
+            return slot;
+        }
+        const bool buy = order.side == OrderSide::Buy;
+        if ((order.type == OrderType::Stop || order.type == OrderType::StopLimit) && !state.stop_triggered) {
+            if (order.stop_price > 0.0) {
+                slot.side = buy ? TriggerSide::BuyStop : TriggerSide::SellStop;
+                slot.price = order.stop_price;
+            }
+            return slot;
+        }
+        if (order.type == OrderType::Limit || order.type == OrderType::StopLimit) {
+            slot.side = buy ? TriggerSide::BuyLimit : TriggerSide::SellLimit;
+            slot.price = order.limit_price;
+        }
+        return slot;
+    }
+
+    std::vector<OrderId> ExecutionPipeline::trigger_candidates(const SymbolId symbol,
+                                                               const EvaluationContext context) const {
+        std::vector<OrderId> ids;
+        const auto* ladder = ladders_.find(symbol);
+        if (!ladder || ladder->empty()) {
+            return ids;
+        }
+        ids.assign(ladder->always.begin(), ladder->always.end());
+        const auto append = [&ids](const auto first, const auto last) {
+            for (auto it = first; it != last; ++it) {
+                ids.push_back(it->second);
+            }
+        };
+        if (queue_model_enabled_) {
+            // Queue position ages and replenishes on every update, not only on crosses.
+            append(ladder->buy_limits.begin(), ladder->buy_limits.end());
+            append(ladder->sell_limits.begin(), ladder->sell_limits.end());
+            append(ladder->buy_stops.begin(), ladder->buy_stops.end());
+            append(ladder->sell_stops.begin(), ladder->sell_stops.end());
+        } else {
+            constexpr OrderId kMaxId = std::numeric_limits<OrderId>::max();
+            Order probe;
+            probe.symbol = symbol;
+            probe.side = OrderSide::Buy;
+            if (const Price buy = executable_price(probe, context); buy > 0.0) {
+                append(ladder->buy_limits.lower_bound({buy, 0}), ladder->buy_limits.end());
+                append(ladder->buy_stops.begin(), ladder->buy_stops.upper_bound({buy, kMaxId}));
+            }
+            probe.side = OrderSide::Sell;
+            if (const Price sell = executable_price(probe, context); sell > 0.0) {
+                append(ladder->sell_limits.begin(), ladder->sell_limits.upper_bound({sell, kMaxId}));
+                append(ladder->sell_stops.lower_bound({sell, 0}), ladder->sell_stops.end());
+            }
+        }
+        std::ranges::sort(ids);
+        return ids;
+    }
+
     Price ExecutionPipeline::reference_price(const Order& order, const EvaluationContext context) const {
         const Price current_price = executable_price(order, context);
         if (current_price > 0.0) {
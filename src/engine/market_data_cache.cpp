@@ -1,16 +1,22 @@
 #include "regimeflow/engine/market_data_cache.h"
 
+#include <algorithm>
+
 namespace regimeflow::engine
 {
     void MarketDataCache::update(const data::Bar& bar) {
         latest_bars_[bar.symbol] = bar;
-        auto& history = bar_history_[bar.symbol];
-        history.push_back(bar);
-
-        if (history.size() > max_history_) {
-            const auto excess_size = static_cast<std::vector<data::Bar>::difference_type>(history.size()) - static_cast<std::vector<data::Bar>::difference_type>(max_history_);
-            history.erase(history.begin(), history.begin() + excess_size);
+        auto& ring = bar_history_[bar.symbol];
+        if (ring.bars.size() < history_depth_) {
+            ring.bars.push_back(bar);
+            ring.closes.push_back(bar.close);
+            ring.volumes.push_back(bar.volume);
+            return;
         }
+        ring.bars[ring.head] = bar;
+        ring.closes[ring.head] = bar.close;
+        ring.volumes[ring.head] = bar.volume;
+        ring.head = (ring.head + 1) % ring.bars.size();
     }
 
     void MarketDataCache::update(const data::Tick& tick) {
@@ -22,40 +28,61 @@ namespace regimeflow::engine
     }
 
     std::optional<data::Bar> MarketDataCache::latest_bar(const SymbolId symbol) const {
-        const auto it = latest_bars_.find(symbol);
-        if (it == latest_bars_.end()) {
-            return std::nullopt;
+        if (const auto* bar = latest_bars_.find(symbol)) {
+            return *bar;
         }
-        return it->second;
+        return std::nullopt;
     }
 
     std::optional<data::Tick> MarketDataCache::latest_tick(const SymbolId symbol) const {
-        const auto it = latest_ticks_.find(symbol);
-        if (it == latest_ticks_.end()) {
-            return std::nullopt;
+        if (const auto* tick = latest_ticks_.find(symbol)) {
+            return *tick;
         }
-        return it->second;
+        return std::nullopt;
     }
 
     std::optional<data::Quote> MarketDataCache::latest_quote(const SymbolId symbol) const {
-        const auto it = latest_quotes_.find(symbol);
-        if (it == latest_quotes_.end()) {
-            return std::nullopt;
+        if (const auto* quote = latest_quotes_.find(symbol)) {
+            return *quote;
         }
-        return it->second;
+        return std::nullopt;
     }
 
-    std::vector<data::Bar> MarketDataCache::recent_bars(const SymbolId symbol, size_t count) const {
-        std::vector<data::Bar> result;
-        const auto it = bar_history_.find(symbol);
-        if (it == bar_history_.end()) {
-            return result;
-        }
-        const auto& history = it->second;
-        if (count > history.size()) {
-            count = history.size();
+    std::vector<data::Bar> MarketDataCache::recent_bars(const SymbolId symbol, const size_t count) const {
+        return bar_history(symbol, count).to_vector();
+    }
+
+    HistoryView<data::Bar> MarketDataCache::bar_history(const SymbolId symbol, const size_t count) const {
+        const auto* ring = bar_history_.find(symbol);
+        return ring ? tail(ring->bars, ring->head, count) : HistoryView<data::Bar>{};
+    }
+
+    HistoryView<Price> MarketDataCache::close_history(const SymbolId symbol, const size_t count) const {
+        const auto* ring = bar_history_.find(symbol);
+        return ring ? tail(ring->closes, ring->head, count) : HistoryView<Price>{};
+    }
+
+    HistoryView<Volume> MarketDataCache::volume_history(const SymbolId symbol, const size_t count) const {
+        const auto* ring = bar_history_.find(symbol);
+        return ring ? tail(ring->volumes, ring->head, count) : HistoryView<Volume>{};
+    }
+
+    void MarketDataCache::set_history_depth(const size_t depth) {
+        history_depth_ = std::max<size_t>(depth, 1);
+        for (auto&& [symbol, ring] : bar_history_) {
+            resize_ring(ring, history_depth_);
         }
-        result.insert(result.end(), history.end() - static_cast<long>(count), history.end());
-        return result;
     }
+
+    void MarketDataCache::resize_ring(BarRing& ring, const size_t depth) {
+        const size_t keep = std::min(depth, ring.bars.size());
+        auto bars = tail(ring.bars, ring.head, keep).to_vector();
+        auto closes = tail(ring.closes, ring.head, keep).to_vector();
+        auto volumes = tail(ring.volumes, ring.head, keep).to_vector();
+        ring.bars = std::move(bars);
+        ring.closes = std::move(closes);
+        ring.volumes = std::move(volumes);
+        ring.head = 0;
+    }
+
 }  // namespace regimeflow::engine
@@ -0,0 +1,200 @@
+#include "regimeflow/engine/order_archive.h"
+
+#include <iterator>
+
+namespace regimeflow::engine
+{
+    namespace {
+
+        // Retired records tolerated before the pools are compacted.
+        constexpr size_t kMinRetiredToCompact = 1024;
+
+    }  // namespace
+
+    void OrderArchive::append(const Order& order, const std::span<const Fill> fills) {
+        if (const auto it = index_.find(order.id); it != index_.end()) {
+            retire(records_[it->second]);
+        }
+
+        Record record;
+        record.id = order.id;
+        record.parent_id = order.parent_id;
+        record.symbol = order.symbol;
+        record.strategy = intern_strategy(order.strategy_id);
+        record.quantity = order.quantity;
+        record.filled_quantity = order.filled_quantity;
+        record.limit_price = order.limit_price;
+        record.stop_price = order.stop_price;
+        record.avg_fill_price = order.avg_fill_price;
+        record.created_at = order.created_at;
+        record.updated_at = order.updated_at;
+        if (order.expire_at) {
+            record.expire_at = *order.expire_at;
+            record.has_expire = true;
+        }
+        record.metadata_begin = static_cast<uint32_t>(metadata_.size());
+        record.metadata_count = static_cast<uint32_t>(order.metadata.size());
+        metadata_.insert(metadata_.end(), order.metadata.begin(), order.metadata.end());
+        record.fill_begin = fills_.size();
+        record.fill_count = static_cast<uint32_t>(fills.size());
+        fills_.insert(fills_.end(), fills.begin(), fills.end());
+        record.side = order.side;
+        record.type = order.type;
+        record.tif = order.tif;
+        record.status = order.status;
+        record.is_parent = order.is_parent;
+
+        index_[order.id] = records_.size();
+        records_.push_back(record);
+        fill_count_ += fills.size();
+        compact();
+    }
+
+    std::optional<Order> OrderArchive::find(const OrderId id) const {
+        const auto it = index_.find(id);
+        if (it == index_.end()) {
+            return std::nullopt;
+        }
+        return materialize(records_[it->second]);
+    }
+
+    std::span<const Fill> OrderArchive::fills(const OrderId id) const {
+        const auto it = index_.find(id);
+        if (it == index_.end()) {
+            return {};
+        }
+        const auto& record = records_[it->second];
+        return {fills_.data() + record.fill_begin, record.fill_count};
+    }
+
+    std::optional<Order> OrderArchive::take(const OrderId id, std::vector<Fill>& fills) {
+        const auto it = index_.find(id);
+        if (it == index_.end()) {
+            return std::nullopt;
+        }
+        auto& record = records_[it->second];
+        retire(record);
+        const auto first = fills_.begin() + static_cast<std::ptrdiff_t>(record.fill_begin);
+        fills.assign(first, first + record.fill_count);
+        index_.erase(it);
+        auto order = materialize(record);
+        compact();
+        return order;
+    }
+
+    void OrderArchive::collect_by_strategy(const std::string& strategy_id, std::vector<Order>& out) const {
+        uint32_t strategy = 0;
+        if (!strategy_id.empty()) {
+            const auto it = strategy_ids_.find(strategy_id);
+            if (it == strategy_ids_.end()) {
+                return;
+            }
+            strategy = it->second;
+        }
+        for (const auto& record : records_) {
+            if (record.live && record.strategy == strategy) {
+                out.push_back(materialize(record));
+            }
+        }
+    }
+
+    void OrderArchive::collect_fills(const SymbolId symbol, const TimeRange range, std::vector<Fill>& out) const {
+        for (const auto& record : records_) {
+            if (!record.live || record.symbol != symbol) {
+                continue;
+            }
+            for (uint32_t i = 0; i < record.fill_count; ++i) {
+                const auto& fill = fills_[record.fill_begin + i];
+                if (fill.symbol == symbol && range.contains(fill.timestamp)) {
+                    out.push_back(fill);
+                }
+            }
+        }
+    }
+
+    void OrderArchive::clear() {
+        records_.clear();
+        index_.clear();
+        fills_.clear();
+        metadata_.clear();
+        strategies_.assign(1, std::string());
+        strategy_ids_.clear();
+        fill_count_ = 0;
+        retired_ = 0;
+    }
+
+    void OrderArchive::retire(Record& record) {
+        record.live = false;
+        fill_count_ -= record.fill_count;
+        ++retired_;
+    }
+
+    void OrderArchive::compact() {
+        if (retired_ < kMinRetiredToCompact || retired_ <= index_.size()) {
+            return;
+        }
+        std::vector<Record> records;
+        std::vector<Fill> fills;
+        std::vector<std::pair<std::string, std::string>> metadata;
+        records.reserve(index_.size());
+        fills.reserve(fill_count_);
+        for (auto& record : records_) {
+            if (!record.live) {
+                continue;
+            }
+            const auto fill_first = fills_.begin() + static_cast<std::ptrdiff_t>(record.fill_begin);
+            const auto meta_first = metadata_.begin() + record.metadata_begin;
+            record.fill_begin = fills.size();
+            fills.insert(fills.end(), std::make_move_iterator(fill_first),
+                         std::make_move_iterator(fill_first + record.fill_count));
+            record.metadata_begin = static_cast<uint32_t>(metadata.size());
+            metadata.insert(metadata.end(), std::make_move_iterator(meta_first),
+                            std::make_move_iterator(meta_first + record.metadata_count));
+            index_[record.id] = records.size();
+            records.push_back(std::move(record));
+        }
+        records_ = std::move(records);
+        fills_ = std::move(fills);
+        metadata_ = std::move(metadata);
+        retired_ = 0;
+    }
+
+    Order OrderArchive::materialize(const Record& record) const {
+        Order order;
+        order.id = record.id;
+        order.parent_id = record.parent_id;
+        order.symbol = record.symbol;
+        order.side = record.side;
+        order.type = record.type;
+        order.tif = record.tif;
+        order.quantity = record.quantity;
+        order.filled_quantity = record.filled_quantity;
+        order.limit_price = record.limit_price;
+        order.stop_price = record.stop_price;
+        order.avg_fill_price = record.avg_fill_price;
+        order.status = record.status;
+        order.created_at = record.created_at;
+        order.updated_at = record.updated_at;
+        if (record.has_expire) {
+            order.expire_at = record.expire_at;
+        }
+        order.is_parent = record.is_parent;
+        order.strategy_id = strategies_[record.strategy];
+        for (uint32_t i = 0; i < record.metadata_count; ++i) {
+            order.metadata.insert(metadata_[record.metadata_begin + i]);
+        }
+        return order;
+    }
+
+    uint32_t OrderArchive::intern_strategy(const std::string& strategy_id) {
+        if (strategy_id.empty()) {
+            return 0;
+        }
+        const auto [it, inserted] = strategy_ids_.try_emplace(strategy_id,
+                                                              static_cast<uint32_t>(strategies_.size()));
+        if (inserted) {
+            strategies_.push_back(strategy_id);
+        }
+        return it->second;
+    }
+}  // namespace regimeflow::engine
@@ -7,10 +7,9 @@ namespace regimeflow::engine
     }
 
     std::optional<data::OrderBook> OrderBookCache::latest(SymbolId symbol) const {
-        const auto it = books_.find(symbol);
-        if (it == books_.end()) {
-            return std::nullopt;
+        if (const auto* book = books_.find(symbol)) {
+            return *book;
         }
-        return it->second;
+        return std::nullopt;
     }
 }  // namespace regimeflow::engine
@@ -6,6 +6,12 @@
 
 namespace regimeflow::engine
 {
+    OrderManager::OrderManager(const Mode mode)
+        : mode_(mode),
+          order_callbacks_(std::make_shared<const std::vector<std::function<void(const Order&)>>>()),
+          fill_callbacks_(std::make_shared<const std::vector<std::function<void(const Fill&)>>>()),
+          pre_submit_callbacks_(std::make_shared<const std::vector<std::function<Result<void>(Order&)>>>()) {}
+
     Result<OrderId> OrderManager::submit_order(Order order) {
         return submit_order_internal(std::move(order), true);
     }
@@ -13,16 +19,16 @@ namespace regimeflow::engine
     Result<void> OrderManager::cancel_order(const OrderId id) {
         Order updated;
         std::vector<OrderId> child_ids;
-        std::vector<std::function<void(const Order&)>> callbacks;
+        OrderCallbacks callbacks;
         {
-            std::lock_guard<std::mutex> lock(mutex_);
+            const auto lock = acquire();
             const auto it = orders_.find(id);
             if (it == orders_.end()) {
+                if (archive_.contains(id)) {
+                    return Result<void>(Error(Error::Code::InvalidState, "Order not open"));
+                }
                 return Result<void>(Error(Error::Code::NotFound, "Order not found"));
             }
-            if (!is_open_status(it->second.status)) {
-                return Result<void>(Error(Error::Code::InvalidState, "Order not open"));
-            }
             it->second.status = OrderStatus::Cancelled;
             it->second.updated_at = Timestamp::now();
             updated = it->second;
@@ -31,9 +37,10 @@ namespace regimeflow::engine
                 route_it != routing_states_.end()) {
                 child_ids = route_it->second.submitted_children;
             }
+            retire_if_terminal(id);
         }
 
-        for (const auto& cb : callbacks) {
+        for (const auto& cb : *callbacks) {
             cb(updated);
         }
         for (const auto child_id : child_ids) {
@@ -45,16 +52,16 @@ namespace regimeflow::engine
 
     Result<void> OrderManager::modify_order(OrderId id, const OrderModification& mod) {
         Order updated;
-        std::vector<std::function<void(const Order&)>> callbacks;
+        OrderCallbacks callbacks;
         {
-            std::lock_guard<std::mutex> lock(mutex_);
+            const auto lock = acquire();
             auto it = orders_.find(id);
             if (it == orders_.end()) {
+                if (archive_.contains(id)) {
+                    return Result<void>(Error(Error::Code::InvalidState, "Order not open"));
+                }
                 return Result<void>(Error(Error::Code::NotFound, "Order not found"));
             }
-            if (!is_open_status(it->second.status)) {
-                return Result<void>(Error(Error::Code::InvalidState, "Order not open"));
-            }
             if (mod.quantity) {
                 it->second.quantity = *mod.quantity;
             }
@@ -81,7 +88,7 @@ namespace regimeflow::engine
             callbacks = order_callbacks_;
         }
 
-        for (const auto& cb : callbacks) {
+        for (const auto& cb : *callbacks) {
             cb(updated);
         }
 
@@ -89,32 +96,27 @@ namespace regimeflow::engine
     }
 
     std::optional<Order> OrderManager::get_order(const OrderId id) const {
-        std::lock_guard<std::mutex> lock(mutex_);
-        const auto it = orders_.find(id);
-        if (it == orders_.end()) {
-            return std::nullopt;
-        }
-        return it->second;
+        const auto lock = acquire();
+        return lookup(id);
     }
 
     std::vector<Order> OrderManager::get_open_orders() const {
         std::vector<Order> result;
-        std::lock_guard<std::mutex> lock(mutex_);
+        const auto lock = acquire();
         result.reserve(orders_.size());
         for (const auto& order : orders_ | std::views::values) {
-            if (is_open_status(order.status)) {
-                result.push_back(order);
-            }
+            result.push_back(order);
         }
         return result;
     }
 
     std::vector<Order> OrderManager::get_open_orders(SymbolId symbol) const {
         std::vector<Order> result;
-        std::lock_guard<std::mutex> lock(mutex_);
-        for (const auto& order : orders_ | std::views::values) {
-            if (order.symbol == symbol && is_open_status(order.status)) {
-                result.push_back(order);
+        const auto lock = acquire();
+        if (const auto* ids = open_by_symbol_.find(symbol)) {
+            result.reserve(ids->size());
+            for (const auto id : *ids) {
+                result.push_back(orders_.at(id));
             }
         }
         return result;
@@ -122,27 +124,38 @@ namespace regimeflow::engine
 
     std::vector<Order> OrderManager::get_orders_by_strategy(const std::string& strategy_id) const {
         std::vector<Order> result;
-        std::lock_guard<std::mutex> lock(mutex_);
-        for (const auto& order : orders_ | std::views::values) {
-            if (order.strategy_id == strategy_id) {
-                result.push_back(order);
+        const auto lock = acquire();
+        if (const auto it = open_by_strategy_.find(strategy_id); it != open_by_strategy_.end()) {
+            for (const auto id : it->second) {
+                result.push_back(orders_.at(id));
             }
         }
+        archive_.collect_by_strategy(strategy_id, result);
         return result;
     }
 
+    size_t OrderManager::open_order_count() const {
+        const auto lock = acquire();
+        return orders_.size();
+    }
+
+    size_t OrderManager::archived_order_count() const {
+        const auto lock = acquire();
+        return archive_.size();
+    }
+
     std::vector<Fill> OrderManager::get_fills(OrderId id) const {
-        std::lock_guard<std::mutex> lock(mutex_);
-        const auto it = fills_.find(id);
-        if (it == fills_.end()) {
-            return {};
+        const auto lock = acquire();
+        if (const auto it = fills_.find(id); it != fills_.end()) {
+            return it->second;
         }
-        return it->second;
+        const auto archived = archive_.fills(id);
+        return {archived.begin(), archived.end()};
     }
 
     std::vector<Fill> OrderManager::get_fills(SymbolId symbol, TimeRange range) const {
         std::vector<Fill> result;
-        std::lock_guard<std::mutex> lock(mutex_);
+        const auto lock = acquire();
         for (const auto& fills : fills_ | std::views::values) {
             for (const auto& fill : fills) {
                 if (fill.symbol == symbol && range.contains(fill.timestamp)) {
@@ -150,33 +163,34 @@ namespace regimeflow::engine
                 }
             }
         }
+        archive_.collect_fills(symbol, range, result);
         return result;
     }
 
     void OrderManager::on_order_update(std::function<void(const Order&)> callback) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        order_callbacks_.push_back(std::move(callback));
+        const auto lock = acquire();
+        add_callback(order_callbacks_, std::move(callback));
     }
 
     void OrderManager::on_fill(std::function<void(const Fill&)> callback) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        fill_callbacks_.push_back(std::move(callback));
+        const auto lock = acquire();
+        add_callback(fill_callbacks_, std::move(callback));
     }
 
     void OrderManager::on_pre_submit(std::function<Result<void>(Order&)> callback) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        pre_submit_callbacks_.push_back(std::move(callback));
+        const auto lock = acquire();
+        add_callback(pre_submit_callbacks_, std::move(callback));
     }
 
     void OrderManager::set_router(std::unique_ptr<OrderRouter> router,
                                   RoutingContextProvider provider) {
-        std::lock_guard<std::mutex> lock(mutex_);
+        const auto lock = acquire();
         router_ = std::move(router);
         routing_context_provider_ = std::move(provider);
     }
 
     void OrderManager::clear_router() {
-        std::lock_guard<std::mutex> lock(mutex_);
+        const auto lock = acquire();
         router_.reset();
         routing_context_provider_ = nullptr;
         routing_states_.clear();
@@ -187,7 +201,7 @@ namespace regimeflow::engine
         std::vector<Order> to_submit;
         SplitMode split_mode = SplitMode::None;
         {
-            std::lock_guard<std::mutex> lock(mutex_);
+            const auto lock = acquire();
             auto it = routing_states_.find(id);
             if (it == routing_states_.end()) {
                 return Ok();
@@ -222,22 +236,19 @@ namespace regimeflow::engine
     }
 
     bool OrderManager::is_routing_parent(OrderId id) const {
-        std::lock_guard<std::mutex> lock(mutex_);
+        const auto lock = acquire();
         return routing_states_.contains(id);
     }
 
     bool OrderManager::is_routing_child(OrderId id) const {
-        std::lock_guard<std::mutex> lock(mutex_);
+        const auto lock = acquire();
         return parent_by_child_.contains(id);
     }
 
     std::vector<OrderId> OrderManager::expired_order_ids(const Timestamp now) const {
         std::vector<OrderId> result;
-        std::lock_guard<std::mutex> lock(mutex_);
+        const auto lock = acquire();
         for (const auto& order : orders_ | std::views::values) {
-            if (!is_open_status(order.status)) {
-                continue;
-            }
             if (order.tif == TimeInForce::GTD && order.expire_at.has_value()
                 && order.expire_at.value() <= now) {
                 result.emplace_back(order.id);
@@ -250,12 +261,12 @@ namespace regimeflow::engine
         Order updated;
         std::vector<Order> parent_updates;
         std::vector<Order> next_children;
-        std::vector<std::function<void(const Order&)>> order_callbacks;
-        std::vector<std::function<void(const Fill&)>> fill_callbacks;
+        OrderCallbacks order_callbacks;
+        FillCallbacks fill_callbacks;
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            const auto it = orders_.find(fill.order_id);
-            if (it == orders_.end()) {
+            const auto lock = acquire();
+            Order* found = revive(fill.order_id);
+            if (!found) {
                 return;
             }
             if (fill.id == 0) {
@@ -264,7 +275,7 @@ namespace regimeflow::engine
             if (fill.timestamp.microseconds() == 0) {
                 fill.timestamp = Timestamp::now();
             }
-            auto& order = it->second;
+            auto& order = *found;
             const double filled_abs = std::abs(fill.quantity);
             order.filled_quantity += filled_abs;
             if (order.filled_quantity > 0) {
@@ -286,26 +297,27 @@ namespace regimeflow::engine
             if (const auto parent_it = parent_by_child_.find(fill.order_id);
                 parent_it != parent_by_child_.end()) {
                 handle_child_fill(parent_it->second, fill, parent_updates);
-                if (order.status == OrderStatus::Filled) {
+                if (updated.status == OrderStatus::Filled) {
                     handle_child_terminal(parent_it->second,
                                           fill.order_id,
-                                          order.status,
+                                          updated.status,
                                           fill.timestamp,
                                           parent_updates,
                                           next_children);
                 }
             }
+            retire_if_terminal(fill.order_id);
         }
 
-        for (const auto& cb : fill_callbacks) {
+        for (const auto& cb : *fill_callbacks) {
             cb(fill);
         }
-        for (const auto& cb : order_callbacks) {
+        for (const auto& cb : *order_callbacks) {
             cb(updated);
         }
         if (!parent_updates.empty()) {
             for (const auto& parent : parent_updates) {
-                for (const auto& cb : order_callbacks) {
+                for (const auto& cb : *order_callbacks) {
                     cb(parent);
                 }
             }
@@ -319,16 +331,16 @@ namespace regimeflow::engine
         Order updated;
         std::vector<Order> parent_updates;
         std::vector<Order> next_children;
-        std::vector<std::function<void(const Order&)>> callbacks;
+        OrderCallbacks callbacks;
         {
-            std::lock_guard<std::mutex> lock(mutex_);
-            const auto it = orders_.find(id);
-            if (it == orders_.end()) {
+            const auto lock = acquire();
+            Order* order = revive(id);
+            if (!order) {
                 return Result<void>(Error(Error::Code::NotFound, "Order not found"));
             }
-            it->second.status = status;
-            it->second.updated_at = Timestamp::now();
-            updated = it->second;
+            order->status = status;
+            order->updated_at = Timestamp::now();
+            updated = *order;
             callbacks = order_callbacks_;
 
             if (const auto parent_it = parent_by_child_.find(id);
@@ -340,14 +352,15 @@ namespace regimeflow::engine
                                       parent_updates,
                                       next_children);
             }
+            retire_if_terminal(id);
         }
 
-        for (const auto& cb : callbacks) {
+        for (const auto& cb : *callbacks) {
             cb(updated);
         }
         if (!parent_updates.empty()) {
             for (const auto& parent : parent_updates) {
-                for (const auto& cb : callbacks) {
+                for (const auto& cb : *callbacks) {
                     cb(parent);
                 }
             }
@@ -364,7 +377,7 @@ namespace regimeflow::engine
         bool has_plan = false;
         if (apply_routing) {
             RoutingContext ctx;
-            std::lock_guard<std::mutex> lock(mutex_);
+            const auto lock = acquire();
             if (router_) {
                 if (routing_context_provider_) {
                     ctx = routing_context_provider_(order);
@@ -380,12 +393,12 @@ namespace regimeflow::engine
         }
 
         {
-            std::vector<std::function<Result<void>(Order&)>> pre_submit;
+            PreSubmitCallbacks pre_submit;
             {
-                std::lock_guard<std::mutex> lock(mutex_);
+                const auto lock = acquire();
                 pre_submit = pre_submit_callbacks_;
             }
-            for (const auto& cb : pre_submit) {
+            for (const auto& cb : *pre_submit) {
                 if (auto result = cb(order); result.is_err()) {
                     const auto& err = result.error();
                     Error copy(err.code, err.message, err.location);
@@ -402,10 +415,10 @@ namespace regimeflow::engine
             return Result<OrderId>(copy);
         }
 
-        std::vector<std::function<void(const Order&)>> callbacks;
+        OrderCallbacks callbacks;
         if (has_plan) {
             {
-                std::lock_guard<std::mutex> lock(mutex_);
+                const auto lock = acquire();
                 if (order.id == 0) {
                     order.id = next_order_id_++;
                 }
@@ -414,7 +427,7 @@ namespace regimeflow::engine
                 }
                 order.updated_at = order.created_at;
                 order.status = OrderStatus::Created;
-                orders_[order.id] = order;
+                insert_open(order);
                 RoutingState state;
                 state.split_mode = plan.split_mode;
                 state.aggregation = plan.parent_aggregation;
@@ -427,7 +440,7 @@ namespace regimeflow::engine
                 routing_states_[order.id] = std::move(state);
                 callbacks = order_callbacks_;
             }
-            for (const auto& cb : callbacks) {
+            for (const auto& cb : *callbacks) {
                 cb(order);
             }
             update_order_status(order.id, OrderStatus::Pending);
@@ -435,7 +448,7 @@ namespace regimeflow::engine
         }
 
         {
-            std::lock_guard<std::mutex> lock(mutex_);
+            const auto lock = acquire();
             if (order.id == 0) {
                 order.id = next_order_id_++;
             }
@@ -444,11 +457,11 @@ namespace regimeflow::engine
             }
             order.updated_at = order.created_at;
             order.status = OrderStatus::Created;
-            orders_[order.id] = order;
+            insert_open(order);
             callbacks = order_callbacks_;
         }
 
-        for (const auto& cb : callbacks) {
+        for (const auto& cb : *callbacks) {
             cb(order);
         }
 
@@ -464,7 +477,7 @@ namespace regimeflow::engine
             return Result<void>(result.error());
         }
         {
-            std::lock_guard<std::mutex> lock(mutex_);
+            const auto lock = acquire();
             parent_by_child_[result.value()] = parent_id;
             routing_states_[parent_id].submitted_children.push_back(result.value());
         }
@@ -492,10 +505,9 @@ namespace regimeflow::engine
         }
         if (state.split_mode == SplitMode::Sequential && state.activated
             && !state.pending_children.empty()) {
-            const auto parent_it = orders_.find(parent_id);
             double remaining = 0.0;
-            if (parent_it != orders_.end()) {
-                remaining = parent_it->second.quantity - state.filled_quantity;
+            if (const auto parent = lookup(parent_id)) {
+                remaining = parent->quantity - state.filled_quantity;
             }
             if (remaining > 0.0) {
                 Order next = std::move(state.pending_children.front());
@@ -532,11 +544,11 @@ namespace regimeflow::engine
         if (state.aggregation != ParentAggregation::Partial) {
             return;
         }
-        const auto parent_it = orders_.find(parent_id);
-        if (parent_it == orders_.end()) {
+        Order* found = revive(parent_id);
+        if (!found) {
             return;
         }
-        auto& parent = parent_it->second;
+        auto& parent = *found;
         parent.filled_quantity = state.filled_quantity;
         parent.avg_fill_price = state.avg_fill_price;
         if (parent.filled_quantity >= parent.quantity) {
@@ -546,6 +558,7 @@ namespace regimeflow::engine
         }
         parent.updated_at = fill.timestamp;
         parent_updates.push_back(parent);
+        retire_if_terminal(parent_id);
     }
 
     void OrderManager::finalize_parent_if_complete(OrderId parent_id,
@@ -562,11 +575,11 @@ namespace regimeflow::engine
         if (state.terminal_children.size() < state.submitted_children.size()) {
             return;
         }
-        const auto parent_it = orders_.find(parent_id);
-        if (parent_it == orders_.end()) {
+        Order* found = revive(parent_id);
+        if (!found) {
             return;
         }
-        auto& parent = parent_it->second;
+        auto& parent = *found;
         if (state.aggregation == ParentAggregation::Final) {
             parent.filled_quantity = state.filled_quantity;
             parent.avg_fill_price = state.avg_fill_price;
@@ -582,6 +595,7 @@ namespace regimeflow::engine
         }
         parent.updated_at = timestamp;
         parent_updates.push_back(parent);
+        retire_if_terminal(parent_id);
     }
 
     Result<void> OrderManager::validate_order(const Order& order) const {
@@ -612,4 +626,84 @@ namespace regimeflow::engine
         return status == OrderStatus::Created || status == OrderStatus::Pending
             || status == OrderStatus::PartiallyFilled;
     }
+
+    std::unique_lock<std::mutex> OrderManager::acquire() const {
+        if (mode_ == Mode::SingleThreaded) {
+            return {};
+        }
+        return std::unique_lock<std::mutex>(mutex_);
+    }
+
+    std::optional<Order> OrderManager::lookup(const OrderId id) const {
+        if (const auto it = orders_.find(id); it != orders_.end()) {
+            return it->second;
+        }
+        return archive_.find(id);
+    }
+
+    Order* OrderManager::revive(const OrderId id) {
+        if (const auto it = orders_.find(id); it != orders_.end()) {
+            return &it->second;
+        }
+        std::vector<Fill> fills;
+        auto order = archive_.take(id, fills);
+        if (!order) {
+            return nullptr;
+        }
+        if (!fills.empty()) {
+            fills_[id] = std::move(fills);
+        }
+        auto& revived = orders_[id];
+        revived = std::move(*order);
+        index_open(revived);
+        return &revived;
+    }
+
+    void OrderManager::insert_open(const Order& order) {
+        if (Order* existing = revive(order.id)) {
+            unindex_open(*existing);
+            *existing = order;
+        } else {
+            orders_.emplace(order.id, order);
+        }
+        index_open(order);
+    }
+
+    void OrderManager::retire_if_terminal(const OrderId id) {
+        const auto it = orders_.find(id);
+        if (it == orders_.end() || is_open_status(it->second.status)) {
+            return;
+        }
+        unindex_open(it->second);
+        if (const auto fills_it = fills_.find(id); fills_it != fills_.end()) {
+            archive_.append(it->second, fills_it->second);
+            fills_.erase(fills_it);
+        } else {
+            archive_.append(it->second, {});
+        }
+        orders_.erase(it);
+    }
+
+    void OrderManager::index_open(const Order& order) {
+        open_by_symbol_[order.symbol].push_back(order.id);
+        open_by_strategy_[order.strategy_id].push_back(order.id);
+    }
+
+    void OrderManager::unindex_open(const Order& order) {
+        const auto remove = [id = order.id](std::vector<OrderId>& ids) {
+            if (const auto it = std::ranges::find(ids, id); it != ids.end()) {
+                *it = ids.back();
+                ids.pop_back();
+            }
+        };
+        if (auto* ids = open_by_symbol_.find(order.symbol)) {
+            remove(*ids);
+        }
+        if (const auto it = open_by_strategy_.find(order.strategy_id); it != open_by_strategy_.end()) {
+            remove(it->second);
+            if (it->second.empty()) {
+                open_by_strategy_.erase(it);
+            }
+        }
+    }
 }  // namespace regimeflow::engine
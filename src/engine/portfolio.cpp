@@ -2,7 +2,6 @@
 
 #include <algorithm>
 #include <cmath>
-#include <ranges>
 
 namespace regimeflow::engine
 {
@@ -56,41 +55,42 @@ namespace regimeflow::engine
         all_fills_.push_back(fill);
 
         notify_position(position);
-        notify_equity(equity());
+        notify_equity();
     }
 
     void Portfolio::mark_to_market(const SymbolId symbol, const Price price, const Timestamp timestamp) {
-        const auto it = positions_.find(symbol);
-        if (it == positions_.end()) {
+        auto* position = positions_.find(symbol);
+        if (!position) {
             return;
         }
-        it->second.current_price = price;
-        it->second.last_update = timestamp;
-        notify_position(it->second);
-        notify_equity(equity());
+        position->current_price = price;
+        position->last_update = timestamp;
+        notify_position(*position);
+        notify_equity();
     }
 
     void Portfolio::mark_to_market(const std::unordered_map<SymbolId, Price>& prices,
                                    const Timestamp timestamp) {
         for (const auto& [symbol, price] : prices) {
-            auto it = positions_.find(symbol);
-            if (it == positions_.end()) {
+            auto* position = positions_.find(symbol);
+            if (!position) {
                 continue;
             }
-            it->second.current_price = price;
-            it->second.last_update = timestamp;
-            notify_position(it->second);
+            position->current_price = price;
+            position->last_update = timestamp;
+            notify_position(*position);
         }
-        notify_equity(equity());
+        notify_equity();
     }
 
     void Portfolio::set_cash(const double cash, const Timestamp timestamp) {
         cash_ = cash;
-        notify_equity(equity());
-        if (!snapshots_.empty()) {
-            auto& snapshot = snapshots_.back();
-            snapshot.timestamp = timestamp;
-            apply_snapshot_fields(snapshot);
+        notify_equity();
+        if (!equity_store_.empty()) {
+            PortfolioSnapshot fields;
+            fields.timestamp = timestamp;
+            apply_snapshot_scalars(fields);
+            equity_store_.overwrite_last(fields, positions_);
         }
     }
 
@@ -111,7 +111,7 @@ namespace regimeflow::engine
         pos.last_update = timestamp;
         positions_[symbol] = pos;
         notify_position(pos);
-        notify_equity(equity());
+        notify_equity();
     }
 
     void Portfolio::replace_positions(const std::unordered_map<SymbolId, Position>& positions,
@@ -122,24 +122,23 @@ namespace regimeflow::engine
             updated.last_update = timestamp;
             positions_[symbol] = updated;
         }
-        for (const auto& position : positions_ | std::views::values) {
+        for (const auto& [symbol, position] : positions_) {
             notify_position(position);
         }
-        notify_equity(equity());
+        notify_equity();
     }
 
     std::optional<Position> Portfolio::get_position(const SymbolId symbol) const {
-        const auto it = positions_.find(symbol);
-        if (it == positions_.end()) {
-            return std::nullopt;
+        if (const auto* position = positions_.find(symbol)) {
+            return *position;
         }
-        return it->second;
+        return std::nullopt;
     }
 
     std::vector<Position> Portfolio::get_all_positions() const {
         std::vector<Position> result;
         result.reserve(positions_.size());
-        for (const auto& position : positions_ | std::views::values) {
+        for (const auto& [symbol, position] : positions_) {
             result.push_back(position);
         }
         return result;
@@ -157,7 +156,7 @@ namespace regimeflow::engine
 
     double Portfolio::equity() const {
         double total = cash_;
-        for (const auto& position : positions_ | std::views::values) {
+        for (const auto& [symbol, position] : positions_) {
             total += position.market_value();
         }
         return total;
@@ -165,7 +164,7 @@ namespace regimeflow::engine
 
     double Portfolio::gross_exposure() const {
         double total = 0;
-        for (const auto& position : positions_ | std::views::values) {
+        for (const auto& [symbol, position] : positions_) {
             total += std::abs(position.market_value());
         }
         return total;
@@ -173,7 +172,7 @@ namespace regimeflow::engine
 
     double Portfolio::net_exposure() const {
         double total = 0;
-        for (const auto& position : positions_ | std::views::values) {
+        for (const auto& [symbol, position] : positions_) {
             total += position.market_value();
         }
         return total;
@@ -189,7 +188,7 @@ namespace regimeflow::engine
 
     double Portfolio::total_unrealized_pnl() const {
         double total = 0;
-        for (const auto& position : positions_ | std::views::values) {
+        for (const auto& [symbol, position] : positions_) {
             total += position.unrealized_pnl();
         }
         return total;
@@ -227,10 +226,14 @@ namespace regimeflow::engine
     }
 
     void Portfolio::record_snapshot(const Timestamp timestamp) {
-        PortfolioSnapshot snap;
-        snap.timestamp = timestamp;
-        apply_snapshot_fields(snap);
-        snapshots_.push_back(std::move(snap));
+        append_snapshot(equity_store_, timestamp);
+    }
+
+    void Portfolio::append_snapshot(EquityCurveStore& store, const Timestamp timestamp) const {
+        PortfolioSnapshot fields;
+        fields.timestamp = timestamp;
+        apply_snapshot_scalars(fields);
+        store.record(fields, positions_);
     }
 
     std::vector<Fill> Portfolio::get_fills(const SymbolId symbol) const {
@@ -307,6 +310,14 @@ namespace regimeflow::engine
     }
 
     void Portfolio::apply_snapshot_fields(PortfolioSnapshot& snapshot) const {
+        apply_snapshot_scalars(snapshot);
+        snapshot.positions.reserve(positions_.size());
+        for (const auto& [symbol, position] : positions_) {
+            snapshot.positions.emplace(symbol, position);
+        }
+    }
+
+    void Portfolio::apply_snapshot_scalars(PortfolioSnapshot& snapshot) const {
         snapshot.cash = cash_;
         snapshot.equity = equity();
         snapshot.gross_exposure = gross_exposure();
@@ -320,7 +331,6 @@ namespace regimeflow::engine
         snapshot.buying_power = margin.buying_power;
         snapshot.margin_call = margin.margin_call;
         snapshot.stop_out = margin.stop_out;
-        snapshot.positions = positions_;
     }
 
     void Portfolio::notify_position(const Position& position) const
@@ -330,8 +340,14 @@ namespace regimeflow::engine
         }
     }
 
-    void Portfolio::notify_equity(const double equity_value) const
+    void Portfolio::notify_equity() const
     {
+        // equity() walks every position; skip it on the hot mark-to-market path
+        // when nobody listens.
+        if (equity_callbacks_.empty()) {
+            return;
+        }
+        const double equity_value = equity();
         for (const auto& cb : equity_callbacks_) {
             cb(equity_value);
         }
@@ -0,0 +1,71 @@
+#include "regimeflow/engine/stage_profiler.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace regimeflow::engine
+{
+    int64_t StageStats::percentile_ns(const double q) const {
+        if (calls == 0) {
+            return 0;
+        }
+        const auto rank = std::max<uint64_t>(
+            1, static_cast<uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(calls))));
+        uint64_t seen = 0;
+        for (size_t bucket = 0; bucket < histogram.size(); ++bucket) {
+            seen += histogram[bucket];
+            if (seen >= rank) {
+                const int64_t upper = bucket == 0 ? 0 : (int64_t{1} << bucket) - 1;
+                return std::min(upper, max_ns);
+            }
+        }
+        return max_ns;
+    }
+
+    std::vector<StageStats> StageProfiler::stats() const {
+        std::vector<StageStats> out;
+        for (size_t i = 0; i < slots_.size(); ++i) {
+            const auto& slot = slots_[i];
+            if (slot.calls == 0) {
+                continue;
+            }
+            StageStats row;
+            row.stage = stage_name(static_cast<EngineStage>(i));
+            row.calls = slot.calls;
+            row.total_ns = slot.total_ns;
+            row.max_ns = slot.max_ns;
+            row.histogram = slot.histogram;
+            out.push_back(std::move(row));
+        }
+        return out;
+    }
+
+    void StageProfiler::reset() {
+        slots_ = {};
+        nested_ns_ = 0;
+    }
+
+    const char* StageProfiler::stage_name(const EngineStage stage) {
+        switch (stage) {
+        case EngineStage::Hooks:
+            return "hooks";
+        case EngineStage::ReplayTicks:
+            return "replay_ticks";
+        case EngineStage::ExecutionPipeline:
+            return "execution_pipeline";
+        case EngineStage::RiskValidation:
+            return "risk_validation";
+        case EngineStage::RegimeTracker:
+            return "regime_tracker";
+        case EngineStage::Strategy:
+            return "strategy";
+        case EngineStage::Metrics:
+            return "metrics";
+        case EngineStage::AuditJournal:
+            return "audit_journal";
+        case EngineStage::Count:
+            break;
+        }
+        return "unknown";
+    }
+}  // namespace regimeflow::engine
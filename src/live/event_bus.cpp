@@ -56,7 +56,15 @@ namespace regimeflow::live
     }
 
     void EventBus::drain_pending() {
-        Node* list = pending_.exchange(nullptr, std::memory_order_acq_rel);
+        Node* head = pending_.exchange(nullptr, std::memory_order_acq_rel);
+        // The pending stack is newest-first; reverse it to keep publish order.
+        Node* list = nullptr;
+        while (head) {
+            Node* next = head->next;
+            head->next = list;
+            list = head;
+            head = next;
+        }
         while (list) {
             Node* next = list->next;
             queue_.push(std::move(list->message));
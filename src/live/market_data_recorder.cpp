@@ -0,0 +1,345 @@
+#include "regimeflow/live/market_data_recorder.h"
+
+#include <filesystem>
+#include <type_traits>
+#include <vector>
+
+namespace regimeflow::live
+{
+    namespace {
+
+        constexpr int64_t kMicrosPerDay = 86'400'000'000LL;
+
+        const char* kind_name(const data::LiveRecordKind kind) {
+            switch (kind) {
+            case data::LiveRecordKind::Tick: return "ticks";
+            case data::LiveRecordKind::Quote: return "quotes";
+            case data::LiveRecordKind::Bar: return "bars";
+            case data::LiveRecordKind::Book: return "books";
+            }
+            return "unknown";
+        }
+
+        int32_t yyyymmdd_from_timestamp(const Timestamp& ts) {
+            return static_cast<int32_t>(std::stoi(ts.to_string("%Y%m%d")));
+        }
+
+    }  // namespace
+
+    MarketDataRecorder::MarketDataRecorder(Config config) : config_(std::move(config)) {
+        sync_thread_ = std::thread([this]() { sync_loop(); });
+    }
+
+    MarketDataRecorder::~MarketDataRecorder() {
+        detach();
+        close();
+    }
+
+    void MarketDataRecorder::attach(EventBus& bus) {
+        detach_bus();
+        bus_ = &bus;
+        subscription_ = bus.subscribe(LiveTopic::MarketData, [this](const LiveMessage& message) {
+            if (const auto* update = std::get_if<MarketDataUpdate>(&message.payload)) {
+                record(*update);
+            }
+        });
+    }
+
+    void MarketDataRecorder::attach(data::LiveFeedAdapter& feed) {
+        detach_feed();
+        feed_ = &feed;
+        feed.on_bar([this](const data::Bar& bar) { record(MarketDataUpdate{bar}); });
+        feed.on_tick([this](const data::Tick& tick) { record(MarketDataUpdate{tick}); });
+        feed.on_book([this](const data::OrderBook& book) { record(MarketDataUpdate{book}); });
+    }
+
+    void MarketDataRecorder::detach() {
+        detach_bus();
+        detach_feed();
+    }
+
+    void MarketDataRecorder::detach_bus() {
+        if (bus_) {
+            bus_->unsubscribe(subscription_);
+            bus_ = nullptr;
+            subscription_ = 0;
+        }
+    }
+
+    void MarketDataRecorder::detach_feed() {
+        if (feed_) {
+            feed_->on_bar({});
+            feed_->on_tick({});
+            feed_->on_book({});
+            feed_ = nullptr;
+        }
+    }
+
+    Result<void> MarketDataRecorder::record(const MarketDataUpdate& update) {
+        return std::visit([this](const auto& row) {
+            using Row = std::decay_t<decltype(row)>;
+            if constexpr (std::is_same_v<Row, data::Tick>) {
+                return append(row, data::LiveRecordKind::Tick);
+            } else if constexpr (std::is_same_v<Row, data::Quote>) {
+                return append(row, data::LiveRecordKind::Quote);
+            } else if constexpr (std::is_same_v<Row, data::Bar>) {
+                return append(row, data::LiveRecordKind::Bar);
+            } else {
+                return append(row, data::LiveRecordKind::Book);
+            }
+        }, update.data);
+    }
+
+    template <typename Row>
+    Result<void> MarketDataRecorder::append(const Row& row, const data::LiveRecordKind kind) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto reject = [&](Result<void> error) {
+            ++stats_.rejected;
+            return error;
+        };
+        if (stopping_) {
+            return reject(Result<void>(Error(Error::Code::InvalidState, "Recorder is closed")));
+        }
+        const int64_t us = row.timestamp.microseconds();
+        if (us <= 0) {
+            return reject(Result<void>(Error(Error::Code::InvalidArgument, "Record timestamp must be positive")));
+        }
+        // Dates only change when the UTC day does; skip formatting otherwise.
+        if (const int64_t day = us / kMicrosPerDay; day != current_day_) {
+            const int32_t date = yyyymmdd_from_timestamp(row.timestamp);
+            if (date < current_date_) {
+                return reject(Result<void>(Error(Error::Code::OutOfRange, "Record is older than the current day")));
+            }
+            if (auto rolled = roll_to(date); rolled.is_err()) {
+                return reject(std::move(rolled));
+            }
+            current_day_ = day;
+        }
+
+        auto& segment = segments_[SegmentKey{row.symbol, kind}];
+        if (!segment) {
+            const auto& symbol = SymbolRegistry::instance().lookup(row.symbol);
+            const auto dir = day_directory(config_.directory, current_date_);
+            std::error_code ec;
+            std::filesystem::create_directories(dir, ec);
+            const auto path = (std::filesystem::path(dir) / (symbol + "." + kind_name(kind) + ".rfl")).string();
+            auto writer = std::make_unique<data::LiveSegmentWriter>();
+            if (auto opened = writer->open(path, kind, symbol, current_date_, config_.bar_type); opened.is_err()) {
+                segments_.erase(SegmentKey{row.symbol, kind});
+                return reject(std::move(opened));
+            }
+            segment = std::move(writer);
+        }
+        if (auto appended = segment->append(row); appended.is_err()) {
+            return reject(std::move(appended));
+        }
+        ++stats_.recorded;
+        return Ok();
+    }
+
+    Result<void> MarketDataRecorder::roll_to(const int32_t date_yyyymmdd) {
+        if (date_yyyymmdd == current_date_) {
+            return Ok();
+        }
+        const int32_t previous = current_date_;
+        // Closing commits every segment and sealing reads the whole day
+        // back, so both run on the background thread rather than on the
+        // thread delivering market data.
+        for (auto& [key, segment] : segments_) {
+            retired_.push_back(std::move(segment));
+        }
+        segments_.clear();
+        current_date_ = date_yyyymmdd;
+        if (previous != 0 && config_.seal_on_rollover) {
+            pending_seals_.push_back(previous);
+        }
+        sync_cv_.notify_all();
+        return Ok();
+    }
+
+    Result<void> MarketDataRecorder::sync() {
+        std::lock_guard<std::mutex> commit_lock(commit_mutex_);
+        return commit_segments();
+    }
+
+    Result<void> MarketDataRecorder::commit_segments() {
+        // Appends are held off only while rows are flushed; the fsyncs and
+        // header writes run without the lock.
+        std::vector<std::pair<data::LiveSegmentWriter*, data::LiveSegmentCommit>> commits;
+        Result<void> result = Ok();
+        uint64_t failed = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            commits.reserve(segments_.size());
+            for (auto& [key, segment] : segments_) {
+                if (segment->record_count() == segment->committed_count()) {
+                    continue;
+                }
+                auto commit = segment->prepare_commit();
+                if (commit.is_err()) {
+                    ++failed;
+                    if (result.is_ok()) {
+                        result = Result<void>(commit.error());
+                    }
+                } else {
+                    commits.emplace_back(segment.get(), commit.value());
+                }
+            }
+        }
+        // Segments retired meanwhile stay alive until close_retired(), which
+        // also needs commit_mutex_.
+        uint64_t committed = 0;
+        for (const auto& [segment, commit] : commits) {
+            if (auto finished = segment->finish_commit(commit); finished.is_err()) {
+                ++failed;
+                if (result.is_ok()) {
+                    result = std::move(finished);
+                }
+            } else {
+                ++committed;
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.commits += committed;
+        stats_.commit_errors += failed;
+        return result;
+    }
+
+    Result<void> MarketDataRecorder::close_retired() {
+        std::vector<std::unique_ptr<data::LiveSegmentWriter>> retired;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            retired.swap(retired_);
+        }
+        Result<void> result = Ok();
+        uint64_t failed = 0;
+        for (auto& segment : retired) {
+            if (auto closed = segment->close(); closed.is_err()) {
+                ++failed;
+                if (result.is_ok()) {
+                    result = std::move(closed);
+                }
+            }
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.commit_errors += failed;
+        return result;
+    }
+
+    Result<void> MarketDataRecorder::seal_pending() {
+        std::vector<int32_t> dates;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            dates.swap(pending_seals_);
+        }
+        std::vector<Result<size_t>> sealed;
+        sealed.reserve(dates.size());
+        for (const auto date : dates) {
+            sealed.push_back(seal_day(config_.directory, date));
+        }
+        Result<void> result = Ok();
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& day : sealed) {
+            if (day.is_err()) {
+                ++stats_.seal_errors;
+                if (result.is_ok()) {
+                    result = Result<void>(day.error());
+                }
+            } else {
+                stats_.sealed += day.value();
+            }
+        }
+        return result;
+    }
+
+    Result<void> MarketDataRecorder::close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        sync_cv_.notify_all();
+        if (sync_thread_.joinable()) {
+            sync_thread_.join();
+        }
+        std::lock_guard<std::mutex> commit_lock(commit_mutex_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto& [key, segment] : segments_) {
+                retired_.push_back(std::move(segment));
+            }
+            segments_.clear();
+        }
+        // Days are queued for sealing only once their segments are retired,
+        // so closing first leaves every queued day complete.
+        auto result = close_retired();
+        if (auto sealed = seal_pending(); sealed.is_err() && result.is_ok()) {
+            result = std::move(sealed);
+        }
+        return result;
+    }
+
+    MarketDataRecorder::Stats MarketDataRecorder::stats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+    void MarketDataRecorder::sync_loop() {
+        const auto interval = std::chrono::microseconds(config_.sync_interval.total_microseconds());
+        const bool periodic = interval.count() > 0;
+        const auto wake = [this]() { return stopping_ || !retired_.empty() || !pending_seals_.empty(); };
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (!stopping_) {
+            if (periodic) {
+                sync_cv_.wait_for(lock, interval, wake);
+            } else {
+                sync_cv_.wait(lock, wake);
+            }
+            if (stopping_) {
+                break;
+            }
+            lock.unlock();
+            {
+                // Failures are counted in stats_; close() finishes whatever
+                // is still queued once this thread stops.
+                std::lock_guard<std::mutex> commit_lock(commit_mutex_);
+                close_retired();
+                seal_pending();
+                if (periodic) {
+                    commit_segments();
+                }
+            }
+            lock.lock();
+        }
+    }
+
+    std::string MarketDataRecorder::day_directory(const std::string& directory, const int32_t date_yyyymmdd) {
+        return (std::filesystem::path(directory) / std::to_string(date_yyyymmdd)).string();
+    }
+
+    Result<size_t> MarketDataRecorder::seal_day(const std::string& directory, const int32_t date_yyyymmdd) {
+        const auto dir = day_directory(directory, date_yyyymmdd);
+        std::error_code ec;
+        if (!std::filesystem::is_directory(dir, ec)) {
+            return Result<size_t>(size_t{0});
+        }
+        std::vector<std::filesystem::path> segments;
+        for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
+            if (entry.path().extension() == ".rfl") {
+                segments.push_back(entry.path());
+            }
+        }
+        size_t sealed = 0;
+        for (const auto& path : segments) {
+            // Quotes stay in their segment; the mmap formats have no quote layout.
+            if (path.stem().extension() == ".quotes") {
+                continue;
+            }
+            auto result = data::seal_live_segment(path.string(), dir);
+            if (result.is_err()) {
+                return Result<size_t>(result.error());
+            }
+            ++sealed;
+        }
+        return Result<size_t>(sealed);
+    }
+}  // namespace regimeflow::live
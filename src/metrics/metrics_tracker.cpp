@@ -20,7 +20,7 @@ namespace regimeflow::metrics
         equity_curve_.add_point(timestamp, equity);
         drawdown_.update(timestamp, equity);
         attribution_.update(timestamp, portfolio);
-        portfolio_snapshots_.push_back(portfolio.snapshot(timestamp));
+        portfolio.append_snapshot(portfolio_store_, timestamp);
         if (regime) {
             regime::RegimeState state;
             state.regime = *regime;
@@ -46,7 +46,7 @@ namespace regimeflow::metrics
         equity_curve_.add_point(timestamp, equity);
         drawdown_.update(timestamp, equity);
         attribution_.update(timestamp, portfolio);
-        portfolio_snapshots_.push_back(portfolio.snapshot(timestamp));
+        portfolio.append_snapshot(portfolio_store_, timestamp);
         regime_history_.push_back(regime);
 
         regime_attribution_.update(timestamp, regime.regime, ret);
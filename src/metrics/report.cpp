@@ -59,68 +59,68 @@ namespace regimeflow::metrics
             return transitions;
         }
 
-    }  // namespace
-
-    Report build_report(const MetricsTracker& tracker, const double periods_per_year) {
-        Report report;
-        constexpr PerformanceCalculator calculator;
-        const auto snapshots = !tracker.portfolio_snapshots().empty()
-            ? tracker.portfolio_snapshots()
-            : to_snapshots(tracker.equity_curve());
-        const double inferred_periods_per_year = infer_periods_per_year(snapshots);
-        report.performance = compute_stats(tracker.equity_curve(),
-                                           periods_per_year > 0.0 ? periods_per_year : inferred_periods_per_year);
-        if (!tracker.portfolio_snapshots().empty()) {
-            report.performance_summary = calculator.calculate(tracker.portfolio_snapshots(), {});
-        } else {
-            report.performance_summary = calculator.calculate(snapshots, {});
+        // Decodes the tracker's snapshot store once per report; the result
+        // feeds every calculation below.
+        std::vector<engine::PortfolioSnapshot> report_snapshots(const MetricsTracker& tracker) {
+            return !tracker.portfolio_store().empty()
+                ? tracker.portfolio_snapshots()
+                : to_snapshots(tracker.equity_curve());
         }
-        report.max_drawdown = tracker.drawdown().max_drawdown();
-        report.max_drawdown_start = tracker.drawdown().max_drawdown_start();
-        report.max_drawdown_end = tracker.drawdown().max_drawdown_end();
-        if (!tracker.regime_history().empty()) {
-            auto by_regime = calculator.calculate_by_regime(snapshots, {}, tracker.regime_history());
-            for (const auto& [regime, metrics] : by_regime) {
-                RegimePerformance performance;
-                performance.total_return = metrics.summary.total_return;
-                performance.avg_return = metrics.avg_period_return;
-                performance.sharpe = metrics.summary.sharpe_ratio;
-                performance.max_drawdown = metrics.summary.max_drawdown;
-                performance.time_pct = metrics.time_percentage;
-                performance.observations = metrics.observations;
-                report.regime_performance[regime] = performance;
-            }
 
-            const auto transitions = calculator.calculate_transitions(
-                snapshots, build_transitions(tracker.regime_history()));
-            for (const auto& metrics : transitions) {
-                TransitionStats stats;
-                stats.avg_return = metrics.avg_return;
-                stats.volatility = metrics.volatility;
-                stats.observations = metrics.occurrences;
-                report.transitions[{metrics.from, metrics.to}] = stats;
+        Report build_report_from(const MetricsTracker& tracker,
+                                 const std::vector<engine::PortfolioSnapshot>& snapshots,
+                                 const double periods_per_year,
+                                 const std::vector<engine::Fill>& fills,
+                                 const double risk_free_rate,
+                                 const std::vector<double>* benchmark_returns) {
+            Report report;
+            constexpr PerformanceCalculator calculator;
+            report.performance = compute_stats(tracker.equity_curve(),
+                                               periods_per_year > 0.0
+                                                   ? periods_per_year
+                                                   : infer_periods_per_year(snapshots));
+            report.performance_summary = calculator.calculate(snapshots, fills, risk_free_rate,
+                                                              benchmark_returns);
+            report.max_drawdown = tracker.drawdown().max_drawdown();
+            report.max_drawdown_start = tracker.drawdown().max_drawdown_start();
+            report.max_drawdown_end = tracker.drawdown().max_drawdown_end();
+            if (!tracker.regime_history().empty()) {
+                auto by_regime = calculator.calculate_by_regime(snapshots, {}, tracker.regime_history());
+                for (const auto& [regime, metrics] : by_regime) {
+                    RegimePerformance performance;
+                    performance.total_return = metrics.summary.total_return;
+                    performance.avg_return = metrics.avg_period_return;
+                    performance.sharpe = metrics.summary.sharpe_ratio;
+                    performance.max_drawdown = metrics.summary.max_drawdown;
+                    performance.time_pct = metrics.time_percentage;
+                    performance.observations = metrics.observations;
+                    report.regime_performance[regime] = performance;
+                }
+
+                const auto transitions = calculator.calculate_transitions(
+                    snapshots, build_transitions(tracker.regime_history()));
+                for (const auto& metrics : transitions) {
+                    TransitionStats stats;
+                    stats.avg_return = metrics.avg_return;
+                    stats.volatility = metrics.volatility;
+                    stats.observations = metrics.occurrences;
+                    report.transitions[{metrics.from, metrics.to}] = stats;
+                }
             }
+            return report;
         }
-        return report;
+
+    }  // namespace
+
+    Report build_report(const MetricsTracker& tracker, const double periods_per_year) {
+        return build_report_from(tracker, report_snapshots(tracker), periods_per_year, {}, 0.0, nullptr);
     }
 
     Report build_report(const MetricsTracker& tracker,
                         const std::vector<engine::Fill>& fills,
                         const double risk_free_rate,
                         const std::vector<double>* benchmark_returns) {
-        const auto snapshots = !tracker.portfolio_snapshots().empty()
-            ? tracker.portfolio_snapshots()
-            : to_snapshots(tracker.equity_curve());
-        Report report = build_report(tracker, infer_periods_per_year(snapshots));
-        constexpr PerformanceCalculator calculator;
-        if (!tracker.portfolio_snapshots().empty()) {
-            report.performance_summary = calculator.calculate(tracker.portfolio_snapshots(), fills,
-                                                              risk_free_rate, benchmark_returns);
-        } else {
-            const auto snapshots = to_snapshots(tracker.equity_curve());
-            report.performance_summary = calculator.calculate(snapshots, fills, risk_free_rate,
-                                                              benchmark_returns);
-        }
-        return report;
+        return build_report_from(tracker, report_snapshots(tracker), 0.0, fills, risk_free_rate,
+                                 benchmark_returns);
     }
 }  // namespace regimeflow::metrics
@@ -73,6 +73,18 @@ namespace regimeflow::strategy
         return market_data_ ? market_data_->recent_bars(symbol, count) : std::vector<data::Bar>{};
     }
 
+    engine::HistoryView<data::Bar> StrategyContext::bar_history(const SymbolId symbol, const size_t count) const {
+        return market_data_ ? market_data_->bar_history(symbol, count) : engine::HistoryView<data::Bar>{};
+    }
+
+    engine::HistoryView<Price> StrategyContext::close_history(const SymbolId symbol, const size_t count) const {
+        return market_data_ ? market_data_->close_history(symbol, count) : engine::HistoryView<Price>{};
+    }
+
+    engine::HistoryView<Volume> StrategyContext::volume_history(const SymbolId symbol, const size_t count) const {
+        return market_data_ ? market_data_->volume_history(symbol, count) : engine::HistoryView<Volume>{};
+    }
+
     std::optional<data::OrderBook> StrategyContext::latest_order_book(const SymbolId symbol) const {
         return order_books_ ? order_books_->latest(symbol) : std::nullopt;
     }
@@ -104,7 +104,7 @@ namespace regimeflow::strategy
     }
 
     std::vector<HarmonicPatternStrategy::Pivot>
-    HarmonicPatternStrategy::detect_pivots(const std::vector<double>& prices) const {
+    HarmonicPatternStrategy::detect_pivots(const engine::HistoryView<Price>& prices) const {
         std::vector<Pivot> pivots;
         if (prices.size() < 2) {
             return pivots;
@@ -310,19 +310,14 @@ namespace regimeflow::strategy
             return;
         }
         ++bar_index_;
-        auto bars = ctx_->recent_bars(symbol_id_, min_bars_);
-        if (bars.size() < min_bars_) {
+        const auto closes = ctx_->close_history(symbol_id_, min_bars_);
+        if (closes.size() < min_bars_) {
             return;
         }
         if (bar_index_ <= last_signal_index_ + cooldown_bars_) {
             return;
         }
 
-        std::vector<double> closes;
-        closes.reserve(bars.size());
-        for (const auto& b : bars) {
-            closes.push_back(b.close);
-        }
         auto pivots = detect_pivots(closes);
         if (pivots.size() < 5) {
             return;
@@ -7,27 +7,29 @@ namespace regimeflow::strategy
 {
     namespace {
 
-        double mean(const std::vector<double>& v) {
-            if (v.empty()) {
+        template<typename At>
+        double mean(const size_t n, At at) {
+            if (n == 0) {
                 return 0.0;
             }
             double s = 0.0;
-            for (const double x : v) {
-                s += x;
+            for (size_t i = 0; i < n; ++i) {
+                s += at(i);
             }
-            return s / static_cast<double>(v.size());
+            return s / static_cast<double>(n);
         }
 
-        double stddev(const std::vector<double>& v, const double m) {
-            if (v.size() < 2) {
+        template<typename At>
+        double stddev(const size_t n, At at, const double m) {
+            if (n < 2) {
                 return 0.0;
             }
             double s = 0.0;
-            for (const double x : v) {
-                const double d = x - m;
+            for (size_t i = 0; i < n; ++i) {
+                const double d = at(i) - m;
                 s += d * d;
             }
-            return std::sqrt(s / static_cast<double>(v.size() - 1));
+            return std::sqrt(s / static_cast<double>(n - 1));
         }
 
     }  // namespace
@@ -87,30 +89,26 @@ namespace regimeflow::strategy
         if (!ctx_ || symbol_a_id_ == 0 || symbol_b_id_ == 0) {
             return false;
         }
-        const auto bars_a = ctx_->recent_bars(symbol_a_id_, lookback_);
-        const auto bars_b = ctx_->recent_bars(symbol_b_id_, lookback_);
-        if (bars_a.size() < lookback_ || bars_b.size() < lookback_) {
+        const auto closes_a = ctx_->close_history(symbol_a_id_, lookback_);
+        const auto closes_b = ctx_->close_history(symbol_b_id_, lookback_);
+        if (closes_a.size() < lookback_ || closes_b.size() < lookback_) {
             return false;
         }
-        const size_t n = std::min(bars_a.size(), bars_b.size());
-        std::vector<double> a_prices;
-        std::vector<double> b_prices;
-        a_prices.reserve(n);
-        b_prices.reserve(n);
-        for (size_t i = 0; i < n; ++i) {
-            a_prices.push_back(bars_a[bars_a.size() - n + i].close);
-            b_prices.push_back(bars_b[bars_b.size() - n + i].close);
-        }
-        const double mean_a = mean(a_prices);
-        const double mean_b = mean(b_prices);
+        const size_t n = std::min(closes_a.size(), closes_b.size());
+        const size_t off_a = closes_a.size() - n;
+        const size_t off_b = closes_b.size() - n;
+        const auto a_at = [&](const size_t i) { return closes_a[off_a + i]; };
+        const auto b_at = [&](const size_t i) { return closes_b[off_b + i]; };
+        const double mean_a = mean(n, a_at);
+        const double mean_b = mean(n, b_at);
         double cov = 0.0;
         double var_b = 0.0;
         for (size_t i = 0; i < n; ++i) {
-            cov += (a_prices[i] - mean_a) * (b_prices[i] - mean_b);
-            var_b += (b_prices[i] - mean_b) * (b_prices[i] - mean_b);
+            cov += (a_at(i) - mean_a) * (b_at(i) - mean_b);
+            var_b += (b_at(i) - mean_b) * (b_at(i) - mean_b);
         }
         hedge_ratio = var_b > 0.0 ? cov / var_b : 1.0;
-        spread = a_prices.back() - hedge_ratio * b_prices.back();
+        spread = closes_a.back() - hedge_ratio * closes_b.back();
         return true;
     }
 
@@ -175,21 +173,19 @@ namespace regimeflow::strategy
             return;
         }
 
-        auto bars_a = ctx_->recent_bars(symbol_a_id_, lookback_);
-        auto bars_b = ctx_->recent_bars(symbol_b_id_, lookback_);
+        const auto closes_a = ctx_->close_history(symbol_a_id_, lookback_);
+        const auto closes_b = ctx_->close_history(symbol_b_id_, lookback_);
         if (last_signal_index_ + cooldown_bars_ > bar_index_) {
             return;
         }
-        size_t n = std::min(bars_a.size(), bars_b.size());
-        std::vector<double> spreads;
-        spreads.reserve(n);
-        for (size_t i = 0; i < n; ++i) {
-            double s = bars_a[bars_a.size() - n + i].close -
-                hedge_ratio * bars_b[bars_b.size() - n + i].close;
-            spreads.push_back(s);
-        }
-        double m = mean(spreads);
-        double sd = stddev(spreads, m);
+        const size_t n = std::min(closes_a.size(), closes_b.size());
+        const size_t off_a = closes_a.size() - n;
+        const size_t off_b = closes_b.size() - n;
+        const auto spread_at = [&](const size_t i) {
+            return closes_a[off_a + i] - hedge_ratio * closes_b[off_b + i];
+        };
+        const double m = mean(n, spread_at);
+        const double sd = stddev(n, spread_at, m);
         if (sd <= 0.0) {
             return;
         }
@@ -225,7 +221,7 @@ namespace regimeflow::strategy
         }
 
         if (std::abs(zscore) >= entry_z_) {
-            submit_spread_trade(hedge_ratio, zscore, bars_a.back().close, bars_b.back().close);
+            submit_spread_trade(hedge_ratio, zscore, closes_a.back(), closes_b.back());
             last_signal_index_ = bar_index_;
         }
     }
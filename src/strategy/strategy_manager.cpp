@@ -42,6 +42,13 @@ namespace regimeflow::strategy
         }
     }
 
+    void StrategyManager::on_bars(const std::span<const data::Bar> bars) const
+    {
+        for (const auto& strategy : strategies_) {
+            strategy->on_bars(bars);
+        }
+    }
+
     void StrategyManager::on_tick(const data::Tick& tick) const
     {
         for (const auto& strategy : strategies_) {
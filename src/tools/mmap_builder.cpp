@@ -2,16 +2,23 @@
 #include "regimeflow/common/result.h"
 #include "regimeflow/common/types.h"
 #include "regimeflow/data/bar_builder.h"
+#include "regimeflow/data/compressed_mmap.h"
 #include "regimeflow/data/data_source_factory.h"
 #include "regimeflow/data/mmap_writer.h"
 #include "regimeflow/data/tick_mmap.h"
+#include "regimeflow/data/universe_mmap.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <filesystem>
 #include <iostream>
+#include <mutex>
 #include <optional>
+#include <span>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace regimeflow::data
@@ -21,6 +28,7 @@ namespace regimeflow::data
         struct Args {
             std::string source = "csv";
             std::string mode = "bars";
+            std::string layout = "files";
             std::string data_dir;
             std::string output_dir;
             std::string connection_string;
@@ -34,13 +42,18 @@ namespace regimeflow::data
             uint64_t volume_threshold = 0;
             uint64_t tick_threshold = 0;
             double dollar_threshold = 0.0;
+            bool compress = false;
+            int threads = 0;
+            size_t memory_mb = 512;
         };
 
         void usage() {
             std::cout << "Usage: regimeflow_mmap_builder --source csv|db --data-dir PATH --output-dir PATH \n"
-                         "       [--mode bars|ticks] [--connection-string STR] [--symbols AAPL,MSFT] [--bar-type 1d] \n"
+                         "       [--mode bars|ticks] [--layout files|universe] [--connection-string STR] \n"
+                         "       [--symbols AAPL,MSFT] [--bar-type 1d] \n"
                          "       [--start YYYY-MM-DD] [--end YYYY-MM-DD] \n"
-                         "       [--volume-threshold N] [--tick-threshold N] [--dollar-threshold N]" << '\n';
+                         "       [--volume-threshold N] [--tick-threshold N] [--dollar-threshold N] \n"
+                         "       [--compress] [--threads N] [--memory-mb N]" << '\n';
         }
 
         std::optional<std::string> arg_value(const std::string& arg, const std::string& key) {
@@ -66,6 +79,20 @@ namespace regimeflow::data
                     args.mode = argv[++i];
                 } else if (auto mode_value = arg_value(arg, "--mode")) {
                     args.mode = *mode_value;
+                } else if (arg == "--layout" && i + 1 < argc) {
+                    args.layout = argv[++i];
+                } else if (auto layout_value = arg_value(arg, "--layout")) {
+                    args.layout = *layout_value;
+                } else if (arg == "--compress") {
+                    args.compress = true;
+                } else if (arg == "--threads" && i + 1 < argc) {
+                    args.threads = std::stoi(argv[++i]);
+                } else if (auto threads_value = arg_value(arg, "--threads")) {
+                    args.threads = std::stoi(*threads_value);
+                } else if (arg == "--memory-mb" && i + 1 < argc) {
+                    args.memory_mb = static_cast<size_t>(std::stoull(argv[++i]));
+                } else if (auto memory_value = arg_value(arg, "--memory-mb")) {
+                    args.memory_mb = static_cast<size_t>(std::stoull(*memory_value));
                 } else if (arg == "--data-dir" && i + 1 < argc) {
                     args.data_dir = argv[++i];
                 } else if (auto data_dir_value = arg_value(arg, "--data-dir")) {
@@ -207,6 +234,226 @@ namespace regimeflow::data
             return cfg;
         }
 
+        // Feed a symbol's bars to `sink` in batches of at most buffer.size().
+        template <typename Sink>
+        Result<void> for_each_bar_batch(DataSource& source, const SymbolId symbol, const TimeRange range,
+                                        const BarType bar_type, std::vector<Bar>& buffer, Sink&& sink) {
+            if (auto it = source.create_iterator({symbol}, range, bar_type)) {
+                while (const size_t n = it->next_batch(buffer)) {
+                    if (auto result = sink(std::span<const Bar>(buffer.data(), n)); result.is_err()) {
+                        return result;
+                    }
+                }
+                return Ok();
+            }
+            const auto bars = source.get_bars(symbol, range, bar_type);
+            for (size_t i = 0; i < bars.size(); i += buffer.size()) {
+                const size_t n = std::min(buffer.size(), bars.size() - i);
+                if (auto result = sink(std::span<const Bar>(bars.data() + i, n)); result.is_err()) {
+                    return result;
+                }
+            }
+            return Ok();
+        }
+
+        // Feed a symbol's ticks to `sink` in batches of at most buffer.size().
+        template <typename Sink>
+        Result<void> for_each_tick_batch(DataSource& source, const SymbolId symbol, const TimeRange range,
+                                         std::vector<Tick>& buffer, Sink&& sink) {
+            if (auto it = source.create_tick_iterator({symbol}, range)) {
+                while (const size_t n = it->next_batch(buffer)) {
+                    if (auto result = sink(std::span<const Tick>(buffer.data(), n)); result.is_err()) {
+                        return result;
+                    }
+                }
+                return Ok();
+            }
+            const auto ticks = source.get_ticks(symbol, range);
+            for (size_t i = 0; i < ticks.size(); i += buffer.size()) {
+                const size_t n = std::min(buffer.size(), ticks.size() - i);
+                if (auto result = sink(std::span<const Tick>(ticks.data() + i, n)); result.is_err()) {
+                    return result;
+                }
+            }
+            return Ok();
+        }
+
+        // Returned by the streaming sinks when a row goes back in time.
+        Result<void> unsorted_error() {
+            return Result<void>(Error(Error::Code::InvalidArgument, "Input is not sorted by timestamp"));
+        }
+
+        // Streams sorted input straight to the writer. Unsorted input, which
+        // the streaming writers reject, falls back to reading the whole series
+        // again and writing it with write_ticks, which sorts first.
+        Result<void> convert_ticks(DataSource& source, const Args& args, const SymbolInfo& info,
+                                   const TimeRange range, const size_t buffer_rows) {
+            std::filesystem::path out_path = args.output_dir;
+            out_path /= info.ticker + (args.compress ? ".rftz" : ".rft");
+            if (args.compress) {
+                // Compressed blocks are encoded from the whole series.
+                auto ticks = source.get_ticks(info.id, range);
+                if (ticks.empty()) {
+                    return Ok();
+                }
+                return CompressedMmapWriter().write_ticks(out_path.string(), info.ticker, std::move(ticks));
+            }
+            std::vector<Tick> buffer(buffer_rows);
+            bool unsorted = false;
+            {
+                TickMmapWriter writer;
+                std::optional<Timestamp> last;
+                auto result = for_each_tick_batch(source, info.id, range, buffer, [&](std::span<const Tick> ticks) -> Result<void> {
+                    for (const auto& tick : ticks) {
+                        if (last && tick.timestamp < *last) {
+                            unsorted = true;
+                            return unsorted_error();
+                        }
+                        last = tick.timestamp;
+                    }
+                    if (!writer.is_open()) {
+                        if (auto opened = writer.open(out_path.string(), info.ticker, buffer_rows); opened.is_err()) {
+                            return opened;
+                        }
+                    }
+                    return writer.append(ticks);
+                });
+                if (!unsorted) {
+                    if (result.is_err()) {
+                        return result;
+                    }
+                    return writer.is_open() ? writer.finalize() : Ok();
+                }
+                // Leaving the scope drops the partial file.
+            }
+            std::vector<Tick> all;
+            auto result = for_each_tick_batch(source, info.id, range, buffer, [&](std::span<const Tick> ticks) -> Result<void> {
+                all.insert(all.end(), ticks.begin(), ticks.end());
+                return Ok();
+            });
+            if (result.is_err()) {
+                return result;
+            }
+            return TickMmapWriter().write_ticks(out_path.string(), info.ticker, std::move(all));
+        }
+
+        // Feeds a symbol's bars to `sink`, or bars built from its ticks when
+        // the source has no bars.
+        template <typename Sink>
+        Result<void> emit_bars(DataSource& source, const Args& args, const BarType bar_type,
+                               const SymbolId symbol, const TimeRange range, const size_t buffer_rows,
+                               Sink&& sink) {
+            size_t emitted = 0;
+            auto counted = [&](std::span<const Bar> bars) -> Result<void> {
+                emitted += bars.size();
+                return sink(bars);
+            };
+            std::vector<Bar> bar_buffer(buffer_rows);
+            if (auto result = for_each_bar_batch(source, symbol, range, bar_type, bar_buffer, counted);
+                result.is_err() || emitted > 0) {
+                return result;
+            }
+            BarBuilder builder(bar_builder_config(bar_type, args));
+            std::vector<Bar> pending;
+            pending.reserve(buffer_rows);
+            std::vector<Tick> tick_buffer(buffer_rows);
+            auto result = for_each_tick_batch(source, symbol, range, tick_buffer,
+                                              [&](std::span<const Tick> ticks) -> Result<void> {
+                for (const auto& tick : ticks) {
+                    if (auto bar = builder.process(tick)) {
+                        pending.push_back(*bar);
+                    }
+                    if (pending.size() == buffer_rows) {
+                        if (auto flushed = sink(pending); flushed.is_err()) {
+                            return flushed;
+                        }
+                        pending.clear();
+                    }
+                }
+                return Ok();
+            });
+            if (result.is_err()) {
+                return result;
+            }
+            if (auto bar = builder.flush()) {
+                pending.push_back(*bar);
+            }
+            return pending.empty() ? Ok() : sink(pending);
+        }
+
+        // Streams bars to a .rfb file, or into `collected` for the compressed
+        // and universe layouts, which need the whole series (and sort it).
+        // Unsorted input falls back to write_bars, as in convert_ticks.
+        Result<void> convert_bars(DataSource& source, const Args& args, const BarType bar_type,
+                                  const SymbolInfo& info, const TimeRange range, const size_t buffer_rows,
+                                  std::vector<Bar>& collected) {
+            std::filesystem::path out_path = args.output_dir;
+            out_path /= info.ticker + "_" + bar_type_suffix(bar_type) + (args.compress ? ".rfbz" : ".rfb");
+            auto collect = [&](std::span<const Bar> bars) -> Result<void> {
+                collected.insert(collected.end(), bars.begin(), bars.end());
+                return Ok();
+            };
+            if (args.layout == "universe" || args.compress) {
+                if (auto result = emit_bars(source, args, bar_type, info.id, range, buffer_rows, collect);
+                    result.is_err()) {
+                    return result;
+                }
+                if (args.compress && !collected.empty()) {
+                    return CompressedMmapWriter().write_bars(out_path.string(), info.ticker, bar_type,
+                                                             std::move(collected));
+                }
+                return Ok();
+            }
+
+            bool unsorted = false;
+            {
+                MmapWriter writer;
+                std::optional<Timestamp> last;
+                auto result = emit_bars(source, args, bar_type, info.id, range, buffer_rows,
+                                        [&](std::span<const Bar> bars) -> Result<void> {
+                    for (const auto& bar : bars) {
+                        if (last && bar.timestamp < *last) {
+                            unsorted = true;
+                            return unsorted_error();
+                        }
+                        last = bar.timestamp;
+                    }
+                    if (!writer.is_open()) {
+                        if (auto opened = writer.open(out_path.string(), info.ticker, bar_type, buffer_rows);
+                            opened.is_err()) {
+                            return opened;
+                        }
+                    }
+                    return writer.append(bars);
+                });
+                if (!unsorted) {
+                    if (result.is_err()) {
+                        return result;
+                    }
+                    return writer.is_open() ? writer.finalize() : Ok();
+                }
+                // Leaving the scope drops the partial file.
+            }
+            if (auto result = emit_bars(source, args, bar_type, info.id, range, buffer_rows, collect);
+                result.is_err()) {
+                return result;
+            }
+            return MmapWriter().write_bars(out_path.string(), info.ticker, bar_type, std::move(collected));
+        }
+
+        size_t worker_count(const int requested, const size_t symbols) {
+            size_t threads = requested > 0 ? static_cast<size_t>(requested) : std::thread::hardware_concurrency();
+            return std::clamp<size_t>(threads, 1, std::max<size_t>(symbols, 1));
+        }
+
+        // Rows per worker buffer so all workers' batch and column buffers fit the budget.
+        size_t rows_per_worker(const Args& args, const size_t threads) {
+            constexpr size_t kMinRows = 1024;
+            const size_t row_bytes = 2 * std::max(sizeof(Bar), sizeof(Tick));
+            const size_t budget = args.memory_mb * 1024 * 1024;
+            return std::max(kMinRows, budget / threads / row_bytes);
+        }
+
     }  // namespace
 }  // namespace regimeflow::data
 
@@ -237,6 +484,18 @@ int main(int argc, char** argv) {
         std::cerr << "Invalid mode" << '\n';
         return 1;
     }
+    if (args.layout != "files" && args.layout != "universe") {
+        std::cerr << "Invalid layout" << '\n';
+        return 1;
+    }
+    if (args.layout == "universe" && args.mode != "bars") {
+        std::cerr << "Universe layout only supports bars" << '\n';
+        return 1;
+    }
+    if (args.layout == "universe" && args.compress) {
+        std::cerr << "Universe layout does not support --compress" << '\n';
+        return 1;
+    }
 
     Config cfg;
     cfg.set("type", args.source);
@@ -275,46 +534,82 @@ int main(int argc, char** argv) {
 
     std::filesystem::create_directories(args.output_dir);
 
-    MmapWriter writer;
-    TickMmapWriter tick_writer;
-    for (const auto& info : symbols) {
-        TimeRange range = parse_range(args, *source, info.id);
-        if (args.mode == "ticks") {
-            auto ticks = source->get_ticks(info.id, range);
-            if (ticks.empty()) {
-                continue;
-            }
-            std::filesystem::path out_path = args.output_dir;
-            out_path /= info.ticker + ".rft";
-            auto result = tick_writer.write_ticks(out_path.string(), info.ticker, std::move(ticks));
-            if (result.is_err()) {
-                std::cerr << result.error().to_string() << '\n';
-                return 1;
-            }
-            continue;
+    // Sources are not thread-safe, so each worker opens its own.
+    const size_t threads = worker_count(args.threads, symbols.size());
+    const size_t buffer_rows = rows_per_worker(args, threads);
+    std::vector<std::vector<Bar>> universe_bars(args.layout == "universe" ? symbols.size() : 0);
+    std::atomic<size_t> next{0};
+    std::atomic<bool> failed{false};
+    std::string failure;
+    std::mutex failure_mutex;
+    auto fail = [&](const std::string& message) {
+        std::lock_guard<std::mutex> lock(failure_mutex);
+        if (!failed.exchange(true)) {
+            failure = message;
         }
+    };
 
-        auto bars = source->get_bars(info.id, range, *bar_type);
-        if (bars.empty()) {
-            auto ticks = source->get_ticks(info.id, range);
-            if (!ticks.empty()) {
-                BarBuilder builder(bar_builder_config(*bar_type, args));
-                for (const auto& tick : ticks) {
-                    if (auto bar = builder.process(tick)) {
-                        bars.push_back(*bar);
-                    }
+    auto worker = [&]() {
+        try {
+            auto worker_source = DataSourceFactory::create(cfg);
+            if (!worker_source) {
+                fail("Failed to create data source");
+                return;
+            }
+            while (!failed.load(std::memory_order_relaxed)) {
+                const size_t i = next.fetch_add(1, std::memory_order_relaxed);
+                if (i >= symbols.size()) {
+                    break;
                 }
-                if (auto bar = builder.flush()) {
-                    bars.push_back(*bar);
+                const auto& info = symbols[i];
+                const TimeRange range = parse_range(args, *worker_source, info.id);
+                std::vector<Bar> collected;
+                auto result = args.mode == "ticks"
+                    ? convert_ticks(*worker_source, args, info, range, buffer_rows)
+                    : convert_bars(*worker_source, args, *bar_type, info, range, buffer_rows, collected);
+                if (result.is_err()) {
+                    fail(result.error().to_string());
+                    return;
+                }
+                if (!universe_bars.empty()) {
+                    universe_bars[i] = std::move(collected);
                 }
             }
+        } catch (const std::exception& e) {
+            fail(e.what());
         }
-        if (bars.empty()) {
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(threads);
+    for (size_t i = 0; i < threads; ++i) {
+        pool.emplace_back(worker);
+    }
+    for (auto& t : pool) {
+        t.join();
+    }
+    if (failed) {
+        std::cerr << failure << '\n';
+        return 1;
+    }
+
+    // Added in symbol order so the container does not depend on scheduling.
+    UniverseMmapWriter universe_writer(*bar_type);
+    for (size_t i = 0; i < universe_bars.size(); ++i) {
+        if (universe_bars[i].empty()) {
             continue;
         }
+        if (auto result = universe_writer.add_bars(symbols[i].ticker, std::move(universe_bars[i]));
+            result.is_err()) {
+            std::cerr << result.error().to_string() << '\n';
+            return 1;
+        }
+    }
+
+    if (args.layout == "universe") {
         std::filesystem::path out_path = args.output_dir;
-        out_path /= info.ticker + "_" + bar_type_suffix(*bar_type) + ".rfb";
-        if (auto result = writer.write_bars(out_path.string(), info.ticker, *bar_type, std::move(bars)); result.is_err()) {
+        out_path /= "universe_" + bar_type_suffix(*bar_type) + ".rfu";
+        if (auto result = universe_writer.write(out_path.string()); result.is_err()) {
             std::cerr << result.error().to_string() << '\n';
             return 1;
         }
@@ -1,9 +1,182 @@
+#include "regimeflow/common/lru_cache.h"
+#include "regimeflow/common/sharded_cache.h"
+#include "regimeflow/data/column_validation.h"
+#include "regimeflow/data/compressed_mmap.h"
+#include "regimeflow/data/corporate_actions.h"
+#include "regimeflow/data/csv_parser.h"
+#include "regimeflow/data/csv_reader.h"
 #include "regimeflow/data/memory_data_source.h"
+#include "regimeflow/data/merged_iterator.h"
+#include "regimeflow/data/mmap_data_source.h"
+#include "regimeflow/data/mmap_writer.h"
+#include "regimeflow/data/order_book_delta.h"
+#include "regimeflow/data/order_book_mmap.h"
+#include "regimeflow/data/validation_utils.h"
 #include "regimeflow/common/time.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <random>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+long max_rss_kb() {
+#if defined(_WIN32)
+    return 0;
+#else
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+#endif
+}
+
+// Major and minor page faults of this process so far.
+std::pair<long, long> page_faults() {
+#if defined(_WIN32)
+    return {0, 0};
+#else
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return {usage.ru_majflt, usage.ru_minflt};
+#endif
+}
+
+int drain(regimeflow::data::DataIterator& iter) {
+    int count = 0;
+    while (iter.has_next()) {
+        iter.next();
+        ++count;
+    }
+    return count;
+}
+
+int drain_batched(regimeflow::data::DataIterator& iter) {
+    std::vector<regimeflow::data::Bar> batch(256);
+    int count = 0;
+    while (const size_t n = iter.next_batch(batch)) {
+        count += static_cast<int>(n);
+    }
+    return count;
+}
+
+// Evicts a file's clean pages so the next scan reads from storage.
+void drop_page_cache(const std::filesystem::path& path) {
+#if defined(__linux__)
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        ::close(fd);
+    }
+#else
+    (void)path;
+#endif
+}
+
+// Minute bars with a cent-grid random walk and noisy volumes.
+std::vector<regimeflow::data::Bar> make_market_bars(const regimeflow::SymbolId symbol, const int count) {
+    std::mt19937_64 rng(42);
+    std::normal_distribution<double> step(0.0, 5.0);
+    std::uniform_int_distribution<int> spread(0, 30);
+    std::uniform_int_distribution<uint64_t> volume(100, 50000);
+    std::vector<regimeflow::data::Bar> bars(count);
+    int64_t cents = 10000;
+    for (int i = 0; i < count; ++i) {
+        auto& bar = bars[i];
+        bar.symbol = symbol;
+        bar.timestamp = regimeflow::Timestamp(1'600'000'000'000'000LL + static_cast<int64_t>(i) * 60'000'000);
+        const int64_t open = cents;
+        cents = std::max<int64_t>(100, cents + static_cast<int64_t>(std::lround(step(rng))));
+        bar.open = static_cast<double>(open) / 100.0;
+        bar.close = static_cast<double>(cents) / 100.0;
+        bar.high = static_cast<double>(std::max(open, cents) + spread(rng)) / 100.0;
+        bar.low = static_cast<double>(std::min(open, cents) - spread(rng)) / 100.0;
+        bar.volume = volume(rng);
+    }
+    return bars;
+}
+
+// Full-depth book updates where each update changes a single level.
+std::vector<regimeflow::data::OrderBook> make_book_updates(const regimeflow::SymbolId symbol, const int count) {
+    std::mt19937_64 rng(9);
+    std::uniform_int_distribution<int> slot(0, 19);
+    std::uniform_int_distribution<int> lots(1, 100000);
+    regimeflow::data::OrderBook book;
+    book.symbol = symbol;
+    for (int i = 0; i < 10; ++i) {
+        book.bids[i] = {30000.0 - 0.5 * (i + 1), 0.001 * lots(rng), 1 + i};
+        book.asks[i] = {30000.0 + 0.5 * (i + 1), 0.001 * lots(rng), 1 + i};
+    }
+    std::vector<regimeflow::data::OrderBook> books(count);
+    for (int n = 0; n < count; ++n) {
+        book.timestamp = regimeflow::Timestamp(1'600'000'000'000'000LL + static_cast<int64_t>(n) * 100);
+        const int s = slot(rng);
+        auto& level = s < 10 ? book.bids[s] : book.asks[s - 10];
+        level.quantity = 0.001 * lots(rng);
+        books[n] = book;
+    }
+    return books;
+}
+
+// Line-by-line reference reader: getline, string fields, stod and get_time.
+size_t parse_csv_reference(const std::filesystem::path& path) {
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    size_t count = 0;
+    double checksum = 0.0;
+    std::vector<std::string> fields;
+    while (std::getline(file, line)) {
+        fields.clear();
+        std::string token;
+        for (const char ch : line) {
+            if (ch == ',') {
+                fields.push_back(token);
+                token.clear();
+            } else {
+                token.push_back(ch);
+            }
+        }
+        fields.push_back(token);
+        const auto ts = regimeflow::Timestamp::from_string(fields[0], "%Y-%m-%d %H:%M:%S");
+        checksum += std::stod(fields[1]) + std::stod(fields[2]) + std::stod(fields[3]) +
+                    std::stod(fields[4]) + static_cast<double>(std::stoull(fields[5]));
+        count += ts.microseconds() > 0 ? 1 : 0;
+    }
+    return checksum > 0.0 ? count : 0;
+}
+
+std::unique_ptr<regimeflow::data::DataIterator> make_universe(const int symbols, const int bars_per_symbol) {
+    std::vector<std::unique_ptr<regimeflow::data::DataIterator>> iterators;
+    iterators.reserve(symbols);
+    for (int s = 0; s < symbols; ++s) {
+        const auto id = regimeflow::SymbolRegistry::instance().intern("MERGE" + std::to_string(s));
+        std::vector<regimeflow::data::Bar> bars(bars_per_symbol);
+        for (int i = 0; i < bars_per_symbol; ++i) {
+            bars[i].symbol = id;
+            bars[i].timestamp = regimeflow::Timestamp(static_cast<int64_t>(i) * 60'000'000 + 1);
+            bars[i].open = bars[i].high = bars[i].low = bars[i].close = 1.0;
+        }
+        iterators.push_back(std::make_unique<regimeflow::data::VectorBarIterator>(std::move(bars)));
+    }
+    return std::make_unique<regimeflow::data::MergedBarIterator>(std::move(iterators));
+}
+
+}  // namespace
 
 int main() {
     constexpr int kBars = 500000;
@@ -15,22 +188,18 @@ int main() {
     for (int i = 0; i < kBars; ++i) {
         regimeflow::data::Bar bar;
         bar.symbol = symbol;
-        bar.timestamp = regimeflow::Timestamp(static_cast<int64_t>(i));
+        bar.timestamp = regimeflow::Timestamp(static_cast<int64_t>(i) + 1);
         bar.open = bar.high = bar.low = bar.close = 1.0;
         bar.volume = 1;
         bars.push_back(bar);
     }
     source->add_bars(symbol, bars);
 
-    const regimeflow::TimeRange range{regimeflow::Timestamp(0), regimeflow::Timestamp(kBars)};
+    const regimeflow::TimeRange range{regimeflow::Timestamp(1), regimeflow::Timestamp(kBars)};
 
     const auto start = std::chrono::high_resolution_clock::now();
     const auto iter = source->create_iterator({symbol}, range, regimeflow::data::BarType::Time_1Min);
-    int count = 0;
-    while (iter->has_next()) {
-        iter->next();
-        ++count;
-    }
+    const int count = drain(*iter);
     const auto end = std::chrono::high_resolution_clock::now();
     const std::chrono::duration<double> elapsed = end - start;
     if (count != kBars || elapsed.count() <= 0.0) {
@@ -41,5 +210,487 @@ int main() {
 
     const double eps = static_cast<double>(count) / elapsed.count();
     std::cout << "Data loading: " << eps << " bars/sec" << '\n';
+
+    const auto dir = std::filesystem::temp_directory_path() / "regimeflow_bench_data_loading";
+    std::error_code ec;
+    std::filesystem::create_directories(dir, ec);
+    regimeflow::data::MmapWriter writer;
+    if (const auto written = writer.write_bars((dir / "BENCH_1m.rfb").string(), "BENCH",
+                                               regimeflow::data::BarType::Time_1Min, bars);
+        written.is_err()) {
+        std::cerr << "Failed to write mmap bench file: " << written.error().to_string() << '\n';
+        return EXIT_FAILURE;
+    }
+    bars.clear();
+    bars.shrink_to_fit();
+
+    regimeflow::data::MemoryMappedDataSource::Config mmap_config;
+    mmap_config.data_directory = dir.string();
+    regimeflow::data::MemoryMappedDataSource mmap_source(mmap_config);
+    const long rss_before = max_rss_kb();
+    const auto mmap_start = std::chrono::high_resolution_clock::now();
+    const auto mmap_iter = mmap_source.create_iterator({symbol}, range,
+                                                       regimeflow::data::BarType::Time_1Min);
+    const int mmap_count = drain(*mmap_iter);
+    const auto mmap_end = std::chrono::high_resolution_clock::now();
+    const std::chrono::duration<double> mmap_elapsed = mmap_end - mmap_start;
+    std::filesystem::remove_all(dir, ec);
+    if (mmap_count != kBars || mmap_elapsed.count() <= 0.0) {
+        std::cerr << "Mmap iterator benchmark failed sanity checks: count=" << mmap_count
+                  << ", elapsed=" << mmap_elapsed.count() << '\n';
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Mmap iterator: " << static_cast<double>(mmap_count) / mmap_elapsed.count()
+              << " bars/sec, max RSS growth " << (max_rss_kb() - rss_before) << " KB" << '\n';
+
+    {
+        constexpr int kMarketBars = 2'000'000;
+        const auto market_dir = std::filesystem::temp_directory_path() / "regimeflow_bench_compressed";
+        std::filesystem::create_directories(market_dir, ec);
+        const auto market_symbol = regimeflow::SymbolRegistry::instance().intern("BENCHZ");
+        const auto raw_path = market_dir / "BENCHZ_1m.rfb";
+        const auto packed_path = market_dir / "BENCHZ_1m.rfbz";
+        auto market = make_market_bars(market_symbol, kMarketBars);
+        const auto written_raw = writer.write_bars(raw_path.string(), "BENCHZ",
+                                                   regimeflow::data::BarType::Time_1Min, market);
+        const auto written_packed = regimeflow::data::CompressedMmapWriter().write_bars(
+            packed_path.string(), "BENCHZ", regimeflow::data::BarType::Time_1Min, std::move(market));
+        if (written_raw.is_err() || written_packed.is_err()) {
+            std::cerr << "Failed to write compressed bench files" << '\n';
+            std::filesystem::remove_all(market_dir, ec);
+            return EXIT_FAILURE;
+        }
+
+        const auto time_scan = [&](const std::filesystem::path& path, auto&& make_iter, int& count) {
+            drop_page_cache(path);
+            const auto t0 = std::chrono::high_resolution_clock::now();
+            const auto iter = make_iter();
+            count = drain_batched(*iter);
+            const std::chrono::duration<double> scan = std::chrono::high_resolution_clock::now() - t0;
+            return scan.count();
+        };
+        int raw_count = 0;
+        int packed_count = 0;
+        const double raw_secs = time_scan(raw_path, [&] {
+            return std::make_unique<regimeflow::data::MemoryMappedBarIterator>(
+                std::make_shared<regimeflow::data::MemoryMappedDataFile>(raw_path.string()),
+                regimeflow::TimeRange{});
+        }, raw_count);
+        const double packed_secs = time_scan(packed_path, [&] {
+            return std::make_unique<regimeflow::data::CompressedBarIterator>(
+                std::make_shared<regimeflow::data::CompressedBarFile>(packed_path.string()),
+                regimeflow::TimeRange{});
+        }, packed_count);
+        // Cold scans of the raw file under each access policy.
+        struct PolicyRun {
+            const char* name;
+            regimeflow::data::MmapAccessPolicy policy;
+            size_t prefetch_rows;
+        };
+        const PolicyRun policy_runs[] = {
+            {"default", regimeflow::data::MmapAccessPolicy::Default, 0},
+            {"sequential", regimeflow::data::MmapAccessPolicy::Sequential, 0},
+            {"prefetch_range", regimeflow::data::MmapAccessPolicy::PrefetchRange, 0},
+            {"prefetch_range+thread", regimeflow::data::MmapAccessPolicy::PrefetchRange, 65'536},
+        };
+        std::cout << "Mmap access policies (cold scan of " << kMarketBars << " bars):" << '\n';
+        for (const auto& run : policy_runs) {
+            int policy_count = 0;
+            const auto faults_before = page_faults();
+            const double secs = time_scan(raw_path, [&] {
+                return std::make_unique<regimeflow::data::MemoryMappedBarIterator>(
+                    std::make_shared<regimeflow::data::MemoryMappedDataFile>(raw_path.string()),
+                    regimeflow::TimeRange{}, std::vector<regimeflow::data::CorporateAction>{}, run.policy,
+                    run.prefetch_rows);
+            }, policy_count);
+            const auto faults_after = page_faults();
+            if (policy_count != kMarketBars) {
+                std::cerr << "Access policy benchmark failed sanity checks: " << run.name << '\n';
+                std::filesystem::remove_all(market_dir, ec);
+                return EXIT_FAILURE;
+            }
+            std::cout << "  " << run.name << ": " << static_cast<double>(policy_count) / secs
+                      << " bars/sec, " << faults_after.first - faults_before.first << " major / "
+                      << faults_after.second - faults_before.second << " minor page faults" << '\n';
+        }
+
+        const auto raw_bytes = std::filesystem::file_size(raw_path);
+        const auto packed_bytes = std::filesystem::file_size(packed_path);
+        std::filesystem::remove_all(market_dir, ec);
+        if (raw_count != kMarketBars || packed_count != kMarketBars) {
+            std::cerr << "Compressed benchmark failed sanity checks: raw=" << raw_count
+                      << ", compressed=" << packed_count << '\n';
+            return EXIT_FAILURE;
+        }
+        std::cout << "Compressed bars: " << raw_bytes << " -> " << packed_bytes << " bytes ("
+                  << static_cast<double>(raw_bytes) / static_cast<double>(packed_bytes) << "x), cold scan "
+                  << static_cast<double>(raw_count) / raw_secs << " bars/sec raw, "
+                  << static_cast<double>(packed_count) / packed_secs << " bars/sec compressed" << '\n';
+    }
+
+    {
+        constexpr int kBooks = 500'000;
+        const auto book_dir = std::filesystem::temp_directory_path() / "regimeflow_bench_book_delta";
+        std::filesystem::create_directories(book_dir, ec);
+        const auto book_symbol = regimeflow::SymbolRegistry::instance().intern("BENCHOB");
+        const auto full_path = book_dir / "BENCHOB.rfob";
+        const auto delta_path = book_dir / "BENCHOB.rfobd";
+        auto updates = make_book_updates(book_symbol, kBooks);
+        const auto written_full = regimeflow::data::OrderBookMmapWriter().write_books(
+            full_path.string(), "BENCHOB", updates);
+        const auto written_delta = regimeflow::data::OrderBookDeltaWriter().write_books(
+            delta_path.string(), "BENCHOB", std::move(updates));
+        if (written_full.is_err() || written_delta.is_err()) {
+            std::cerr << "Failed to write order book bench files" << '\n';
+            std::filesystem::remove_all(book_dir, ec);
+            return EXIT_FAILURE;
+        }
+
+        drop_page_cache(full_path);
+        auto t0 = std::chrono::high_resolution_clock::now();
+        const regimeflow::data::OrderBookMmapFile full(full_path.string());
+        double checksum = 0.0;
+        for (size_t i = 0; i < full.book_count(); ++i) {
+            checksum += full.at(i).bids[0].quantity;
+        }
+        const std::chrono::duration<double> full_elapsed = std::chrono::high_resolution_clock::now() - t0;
+
+        drop_page_cache(delta_path);
+        t0 = std::chrono::high_resolution_clock::now();
+        regimeflow::data::OrderBookDeltaIterator replay(
+            std::make_shared<regimeflow::data::OrderBookDeltaFile>(delta_path.string()), regimeflow::TimeRange{});
+        double delta_checksum = 0.0;
+        int replayed = 0;
+        while (replay.has_next()) {
+            delta_checksum += replay.next().bids[0].quantity;
+            ++replayed;
+        }
+        const std::chrono::duration<double> delta_elapsed = std::chrono::high_resolution_clock::now() - t0;
+        const auto full_bytes = std::filesystem::file_size(full_path);
+        const auto delta_bytes = std::filesystem::file_size(delta_path);
+        std::filesystem::remove_all(book_dir, ec);
+        if (replayed != kBooks || checksum != delta_checksum) {
+            std::cerr << "Order book delta benchmark failed sanity checks: replayed=" << replayed << '\n';
+            return EXIT_FAILURE;
+        }
+        std::cout << "Order book deltas: " << full_bytes << " -> " << delta_bytes << " bytes ("
+                  << static_cast<double>(full_bytes) / static_cast<double>(delta_bytes) << "x), cold replay "
+                  << kBooks / full_elapsed.count() << " books/sec snapshots, "
+                  << kBooks / delta_elapsed.count() << " books/sec deltas" << '\n';
+    }
+
+    {
+        constexpr int kCsvBars = 500'000;
+        const auto csv_dir = std::filesystem::temp_directory_path() / "regimeflow_bench_csv";
+        std::filesystem::create_directories(csv_dir, ec);
+        const auto csv_symbol = regimeflow::SymbolRegistry::instance().intern("BENCHCSV");
+        const auto csv_path = csv_dir / "BENCHCSV.csv";
+        {
+            std::ofstream out(csv_path);
+            out << "timestamp,open,high,low,close,volume\n";
+            for (const auto& bar : make_market_bars(csv_symbol, kCsvBars)) {
+                out << bar.timestamp.to_string("%Y-%m-%d %H:%M:%S") << ',' << bar.open << ',' << bar.high
+                    << ',' << bar.low << ',' << bar.close << ',' << bar.volume << '\n';
+            }
+        }
+        const auto time_it = [](auto&& fn, size_t& count) {
+            const auto t0 = std::chrono::high_resolution_clock::now();
+            count = fn();
+            const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - t0;
+            return elapsed.count();
+        };
+        regimeflow::data::CSVDataSource::Config csv_config;
+        csv_config.data_directory = csv_dir.string();
+        csv_config.parse_threads = 1;
+        regimeflow::data::CSVDataSource csv_single(csv_config);
+        csv_config.parse_threads = 0;
+        regimeflow::data::CSVDataSource csv_parallel(csv_config);
+        csv_config.cache_directory = (csv_dir / "cache").string();
+        regimeflow::data::CSVDataSource csv_cached(csv_config);
+        size_t reference_count = 0;
+        size_t single_count = 0;
+        size_t parallel_count = 0;
+        const double reference_secs = time_it([&] { return parse_csv_reference(csv_path); }, reference_count);
+        const double single_secs = time_it([&] {
+            return csv_single.get_bars(csv_symbol, {}, regimeflow::data::BarType::Time_1Min).size();
+        }, single_count);
+        const double parallel_secs = time_it([&] {
+            return csv_parallel.get_bars(csv_symbol, {}, regimeflow::data::BarType::Time_1Min).size();
+        }, parallel_count);
+        // The first read parses and writes the cache entry; time the reads after it.
+        size_t cached_count = csv_cached.get_bars(csv_symbol, {}, regimeflow::data::BarType::Time_1Min).size();
+        const double cached_secs = time_it([&] {
+            return csv_cached.get_bars(csv_symbol, {}, regimeflow::data::BarType::Time_1Min).size();
+        }, cached_count);
+        std::filesystem::remove_all(csv_dir, ec);
+        if (reference_count != kCsvBars || single_count != kCsvBars || parallel_count != kCsvBars ||
+            cached_count != kCsvBars) {
+            std::cerr << "CSV benchmark failed sanity checks: reference=" << reference_count
+                      << ", single=" << single_count << ", parallel=" << parallel_count
+                      << ", cached=" << cached_count << '\n';
+            return EXIT_FAILURE;
+        }
+        std::cout << "CSV bars: " << kCsvBars / reference_secs << " rows/sec getline+stod, "
+                  << kCsvBars / single_secs << " rows/sec chunked (1 thread), "
+                  << kCsvBars / parallel_secs << " rows/sec chunked ("
+                  << regimeflow::data::csv_parse_threads(0) << " threads), "
+                  << kCsvBars / cached_secs << " rows/sec from cache" << '\n';
+    }
+
+    {
+        // 30 years of daily bars with quarterly dividends and a few splits per symbol.
+        constexpr int kAdjustSymbols = 1000;
+        constexpr int kAdjustDays = 7560;
+        constexpr int64_t kDayUs = 86'400'000'000LL;
+        regimeflow::data::CorporateActionAdjuster adjuster;
+        std::vector<regimeflow::SymbolId> adjust_symbols;
+        for (int s = 0; s < kAdjustSymbols; ++s) {
+            const auto id = regimeflow::SymbolRegistry::instance().intern("ADJ" + std::to_string(s));
+            std::vector<regimeflow::data::CorporateAction> actions;
+            for (int q = 1; q < 120; ++q) {
+                regimeflow::data::CorporateAction dividend;
+                dividend.type = regimeflow::data::CorporateActionType::Dividend;
+                dividend.effective_date = regimeflow::Timestamp((q * 63 + s % 7) * kDayUs);
+                dividend.factor = 0.995;
+                actions.push_back(dividend);
+            }
+            for (int k = 1; k <= 3; ++k) {
+                regimeflow::data::CorporateAction split;
+                split.type = regimeflow::data::CorporateActionType::Split;
+                split.effective_date = regimeflow::Timestamp((k * 2000 + s) * kDayUs);
+                split.factor = 2.0;
+                actions.push_back(split);
+            }
+            adjuster.add_actions(id, std::move(actions));
+            adjust_symbols.push_back(id);
+        }
+        std::vector<int64_t> ts(kAdjustDays);
+        std::vector<double> opens(kAdjustDays, 100.0);
+        std::vector<double> highs(kAdjustDays, 101.0);
+        std::vector<double> lows(kAdjustDays, 99.0);
+        std::vector<double> closes(kAdjustDays, 100.5);
+        std::vector<uint64_t> volumes(kAdjustDays, 1000);
+        std::vector<regimeflow::data::Bar> adjust_bars(kAdjustDays);
+        for (int d = 0; d < kAdjustDays; ++d) {
+            ts[d] = d * kDayUs;
+            adjust_bars[d] = {regimeflow::Timestamp(ts[d]), 0, 100.0, 101.0, 99.0, 100.5, 1000};
+        }
+        double per_bar_sum = 0.0;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (const auto id : adjust_symbols) {
+            for (const auto& bar : adjust_bars) {
+                per_bar_sum += adjuster.adjust_bar(id, bar).close;
+            }
+        }
+        const std::chrono::duration<double> per_bar = std::chrono::high_resolution_clock::now() - t0;
+        double column_sum = 0.0;
+        t0 = std::chrono::high_resolution_clock::now();
+        for (const auto id : adjust_symbols) {
+            std::ranges::fill(opens, 100.0);
+            std::ranges::fill(highs, 101.0);
+            std::ranges::fill(lows, 99.0);
+            std::ranges::fill(closes, 100.5);
+            adjuster.adjust_columns(id, ts, opens, highs, lows, closes, volumes);
+            for (const double close : closes) {
+                column_sum += close;
+            }
+        }
+        const std::chrono::duration<double> columns = std::chrono::high_resolution_clock::now() - t0;
+        if (std::abs(per_bar_sum - column_sum) > 1e-6 * std::abs(per_bar_sum)) {
+            std::cerr << "Corporate action benchmark failed sanity checks" << '\n';
+            return EXIT_FAILURE;
+        }
+        const double rows = static_cast<double>(kAdjustSymbols) * kAdjustDays;
+        std::cout << "Back-adjust " << kAdjustSymbols << " symbols x " << kAdjustDays << " days: "
+                  << rows / per_bar.count() << " bars/sec (adjust_bar), "
+                  << rows / columns.count() << " rows/sec (adjust_columns)" << '\n';
+    }
+
+    {
+        constexpr int kValidateSymbols = 200;
+        constexpr int kValidateDays = 7560;
+        constexpr int64_t kDayUs = 86'400'000'000LL;
+        regimeflow::data::ValidationConfig config;
+        config.check_volume_bounds = true;
+        config.max_volume = 1'000'000'000;
+        config.check_gap = true;
+        config.max_gap = regimeflow::Duration::days(5);
+        config.check_price_jump = true;
+        config.check_outliers = true;
+        std::vector<std::shared_ptr<const regimeflow::data::BarColumns>> series;
+        std::vector<regimeflow::data::BarColumnsView> universe;
+        std::vector<regimeflow::data::Bar> rows(kValidateDays);
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<double> step(-0.01, 0.01);
+        for (int s = 0; s < kValidateSymbols; ++s) {
+            double price = 50.0;
+            for (int d = 0; d < kValidateDays; ++d) {
+                price *= 1.0 + step(rng);
+                rows[d] = {regimeflow::Timestamp(d * kDayUs), 0, price, price * 1.01, price * 0.99, price,
+                           static_cast<uint64_t>(1000 + d % 97)};
+            }
+            series.push_back(regimeflow::data::BarColumns::from_bars(0, rows));
+            universe.push_back(regimeflow::data::BarColumnsView::of(*series.back()));
+        }
+        size_t per_row_issues = 0;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        for (const auto& columns : series) {
+            std::vector<regimeflow::data::Bar> bars(columns->size());
+            for (size_t i = 0; i < bars.size(); ++i) {
+                bars[i] = columns->bar(i);
+            }
+            regimeflow::data::ValidationReport report;
+            regimeflow::data::validate_bars(std::move(bars), regimeflow::data::BarType::Time_1Day, config,
+                                            false, true, &report);
+            per_row_issues += report.issues().size();
+        }
+        const std::chrono::duration<double> per_row = std::chrono::high_resolution_clock::now() - t0;
+        t0 = std::chrono::high_resolution_clock::now();
+        const auto single = regimeflow::data::validate_bar_universe(universe, config, 1);
+        const std::chrono::duration<double> column_single = std::chrono::high_resolution_clock::now() - t0;
+        t0 = std::chrono::high_resolution_clock::now();
+        const auto parallel = regimeflow::data::validate_bar_universe(universe, config);
+        const std::chrono::duration<double> column_parallel = std::chrono::high_resolution_clock::now() - t0;
+        size_t column_issues = 0;
+        for (size_t i = 0; i < single.size(); ++i) {
+            column_issues += single[i].issues().size();
+            if (single[i].issues().size() != parallel[i].issues().size()) {
+                column_issues = per_row_issues + 1;
+                break;
+            }
+        }
+        if (column_issues != per_row_issues) {
+            std::cerr << "Validation benchmark failed sanity checks" << '\n';
+            return EXIT_FAILURE;
+        }
+        const double total = static_cast<double>(kValidateSymbols) * kValidateDays;
+        std::cout << "Validate " << kValidateSymbols << " symbols x " << kValidateDays << " days: "
+                  << total / per_row.count() << " bars/sec (validate_bars), "
+                  << total / column_single.count() << " rows/sec (columns, 1 thread), "
+                  << total / column_parallel.count() << " rows/sec (columns, parallel)" << '\n';
+    }
+
+    {
+        constexpr int kAsOfBars = 100'000;
+        constexpr int kRangeLookups = 2'000;
+        constexpr int kAsOfLookups = 1'000'000;
+        const auto as_of_symbol = regimeflow::SymbolRegistry::instance().intern("BENCHASOF");
+        regimeflow::data::MemoryDataSource as_of_source;
+        as_of_source.add_bars(as_of_symbol, make_market_bars(as_of_symbol, kAsOfBars));
+        const int64_t first_us = 1'600'000'000'000'000LL;
+        const int64_t span_us = static_cast<int64_t>(kAsOfBars) * 60'000'000;
+        std::mt19937_64 rng(11);
+        std::uniform_int_distribution<int64_t> offset(0, span_us);
+        const auto time_lookups = [&](const int lookups, auto&& lookup) {
+            double checksum = 0.0;
+            const auto t0 = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < lookups; ++i) {
+                if (const auto bar = lookup(i)) {
+                    checksum += bar->close;
+                }
+            }
+            const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - t0;
+            return std::pair{static_cast<double>(lookups) / elapsed.count(), checksum};
+        };
+        const auto [range_rate, range_sum] = time_lookups(kRangeLookups, [&](int) {
+            return as_of_source.DataSource::get_bar_as_of(as_of_symbol, regimeflow::Timestamp(first_us + offset(rng)));
+        });
+        const auto [random_rate, random_sum] = time_lookups(kAsOfLookups, [&](int) {
+            return as_of_source.get_bar_as_of(as_of_symbol, regimeflow::Timestamp(first_us + offset(rng)));
+        });
+        // Sampling every 6 s walks forward through each minute bar ten times.
+        const auto [walk_rate, walk_sum] = time_lookups(kAsOfLookups, [&](const int i) {
+            return as_of_source.get_bar_as_of(as_of_symbol,
+                                              regimeflow::Timestamp(first_us + static_cast<int64_t>(i) * 6'000'000));
+        });
+        if (range_sum <= 0.0 || random_sum <= 0.0 || walk_sum <= 0.0) {
+            std::cerr << "As-of benchmark failed sanity checks" << '\n';
+            return EXIT_FAILURE;
+        }
+        std::cout << "As-of bar lookups (" << kAsOfBars << " bars): " << range_rate
+                  << " lookups/sec (range query), " << random_rate << " lookups/sec (random), "
+                  << walk_rate << " lookups/sec (forward walk)" << '\n';
+    }
+
+    {
+        constexpr int kCacheKeys = 4096;
+        constexpr int kCacheThreads = 4;
+        constexpr int kCacheLookups = 500'000;
+        std::vector<std::string> keys;
+        keys.reserve(kCacheKeys);
+        for (int i = 0; i < kCacheKeys; ++i) {
+            keys.push_back("BENCH|" + std::to_string(i) + "|1600000000000000:1600086400000000");
+        }
+        // Skewed access: most lookups hit a small hot set, the rest miss.
+        std::vector<int> picks(kCacheLookups);
+        std::mt19937 rng(5);
+        std::uniform_int_distribution<int> hot(0, kCacheKeys / 8 - 1);
+        std::uniform_int_distribution<int> any(0, kCacheKeys - 1);
+        for (auto& pick : picks) {
+            pick = rng() % 10 < 8 ? hot(rng) : any(rng);
+        }
+        const auto rate = [&](const int threads, auto&& lookup) {
+            const auto t0 = std::chrono::high_resolution_clock::now();
+            std::vector<std::thread> workers;
+            for (int t = 0; t < threads; ++t) {
+                workers.emplace_back([&, t] {
+                    for (int i = 0; i < kCacheLookups; ++i) {
+                        lookup(keys[picks[(i + t * 7919) % kCacheLookups]]);
+                    }
+                });
+            }
+            for (auto& worker : workers) {
+                worker.join();
+            }
+            const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - t0;
+            return static_cast<double>(kCacheLookups) * threads / elapsed.count();
+        };
+
+        regimeflow::LRUCache<std::string, int> lru(kCacheKeys / 4);
+        const double single = rate(1, [&](const std::string& key) {
+            if (!lru.get(key)) {
+                lru.put(key, 1);
+            }
+        });
+        double sharded[2] = {0.0, 0.0};
+        for (const auto eviction : {regimeflow::CacheEviction::Lru, regimeflow::CacheEviction::Clock}) {
+            regimeflow::ShardedCacheOptions options;
+            options.max_entries = kCacheKeys / 4;
+            options.eviction = eviction;
+            regimeflow::ShardedCache<std::string, int> cache(options);
+            sharded[static_cast<int>(eviction)] = rate(kCacheThreads, [&](const std::string& key) {
+                if (!cache.get(key)) {
+                    cache.put(key, 1);
+                }
+            });
+        }
+        std::cout << "Range cache lookups: " << single << " ops/sec (LRUCache, 1 thread), " << sharded[0]
+                  << " ops/sec (sharded LRU, " << kCacheThreads << " threads), " << sharded[1]
+                  << " ops/sec (sharded CLOCK, " << kCacheThreads << " threads)" << '\n';
+    }
+
+    constexpr int kMergeSymbols = 3000;
+    constexpr int kMergeBars = 200;
+    const auto time_merge = [&](auto&& drain_fn, int& count) {
+        const auto merged = make_universe(kMergeSymbols, kMergeBars);
+        const auto t0 = std::chrono::high_resolution_clock::now();
+        count = drain_fn(*merged);
+        const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - t0;
+        return elapsed;
+    };
+    int batched_count = 0;
+    int merged_count = 0;
+    const auto batch_elapsed = time_merge(drain_batched, batched_count);
+    const auto merge_elapsed = time_merge(drain, merged_count);
+    if (merged_count != kMergeSymbols * kMergeBars || batched_count != merged_count) {
+        std::cerr << "Merge benchmark failed sanity checks: next=" << merged_count
+                  << ", next_batch=" << batched_count << '\n';
+        return EXIT_FAILURE;
+    }
+    std::cout << "Merged " << kMergeSymbols << " symbols: "
+              << static_cast<double>(merged_count) / merge_elapsed.count() << " bars/sec (next), "
+              << static_cast<double>(batched_count) / batch_elapsed.count()
+              << " bars/sec (next_batch)" << '\n';
     return EXIT_SUCCESS;
 }
@@ -2,39 +2,125 @@
 #include "regimeflow/events/event.h"
 #include "regimeflow/data/bar.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <iostream>
+#include <string>
+#include <vector>
 
-int main() {
-    constexpr int kEvents = 500000;
-    regimeflow::events::EventQueue queue;
-    const auto symbol = regimeflow::SymbolRegistry::instance().intern("BENCH");
+namespace {
 
+using regimeflow::events::EventQueue;
+
+struct BenchResult {
+    int64_t popped = 0;
+    double seconds = 0.0;
+};
+
+regimeflow::data::Bar make_bar(const regimeflow::SymbolId symbol) {
     regimeflow::data::Bar bar;
     bar.symbol = symbol;
     bar.open = bar.high = bar.low = bar.close = 1.0;
     bar.volume = 1;
+    return bar;
+}
+
+BenchResult run_bulk(const EventQueue::Mode mode, const int events) {
+    EventQueue queue(mode);
+    auto bar = make_bar(regimeflow::SymbolRegistry::instance().intern("BENCH"));
 
     const auto start = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < kEvents; ++i) {
+    for (int i = 0; i < events; ++i) {
         bar.timestamp = regimeflow::Timestamp(static_cast<int64_t>(i));
         queue.push(regimeflow::events::make_market_event(bar));
     }
-    int popped = 0;
+    BenchResult result;
     while (const auto evt = queue.pop()) {
         (void)evt;
-        ++popped;
+        ++result.popped;
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+    result.seconds = elapsed.count();
+    return result;
+}
+
+// Backtest-shaped load: a bounded window of pending timestamps, many symbols per
+// timestamp, and a system/timer event ahead of each market slice.
+BenchResult run_steady_state(const EventQueue::Mode mode, const int64_t events) {
+    constexpr int kSymbols = 64;
+    constexpr int64_t kWindow = 16;
+    EventQueue queue(mode);
+    std::vector<regimeflow::data::Bar> bars;
+    bars.reserve(kSymbols);
+    for (int i = 0; i < kSymbols; ++i) {
+        bars.push_back(make_bar(regimeflow::SymbolRegistry::instance().intern("BENCH" + std::to_string(i))));
+    }
+
+    int64_t pushed = 0;
+    int64_t next_ts = 0;
+    const auto push_slice = [&] {
+        const regimeflow::Timestamp ts(next_ts++);
+        queue.push(regimeflow::events::make_system_event(regimeflow::events::SystemEventKind::Timer, ts));
+        ++pushed;
+        for (auto& bar : bars) {
+            bar.timestamp = ts;
+            queue.push(regimeflow::events::make_market_event(bar));
+            ++pushed;
+        }
+    };
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (int64_t i = 0; i < kWindow; ++i) {
+        push_slice();
     }
-    const auto end = std::chrono::high_resolution_clock::now();
-    const std::chrono::duration<double> elapsed = end - start;
-    if (popped != kEvents || elapsed.count() <= 0.0) {
-        std::cerr << "Event processing benchmark failed sanity checks: popped=" << popped
-                  << ", elapsed=" << elapsed.count() << '\n';
-        return EXIT_FAILURE;
+    BenchResult result;
+    int64_t since_refill = 0;
+    while (const auto evt = queue.pop()) {
+        (void)evt;
+        ++result.popped;
+        if (++since_refill == kSymbols + 1) {
+            since_refill = 0;
+            if (pushed < events) {
+                push_slice();
+            }
+        }
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+    result.seconds = elapsed.count();
+    if (result.popped != pushed) {
+        result.popped = -1;
+    }
+    return result;
+}
+
+bool report(const std::string& label, const BenchResult& result, const int64_t expected_min) {
+    if (result.popped < expected_min || result.seconds <= 0.0) {
+        std::cerr << "Event processing benchmark failed sanity checks (" << label
+                  << "): popped=" << result.popped << ", elapsed=" << result.seconds << '\n';
+        return false;
+    }
+    const double eps = static_cast<double>(result.popped) / result.seconds;
+    std::cout << "Event processing [" << label << "]: " << eps << " events/sec" << '\n';
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    constexpr int kBulkEvents = 500000;
+    int64_t steady_events = 10'000'000;
+    if (argc > 1) {
+        steady_events = std::max<int64_t>(std::atoll(argv[1]), 1);
     }
 
-    const double eps = static_cast<double>(popped) / elapsed.count();
-    std::cout << "Event processing: " << eps << " events/sec" << '\n';
-    return EXIT_SUCCESS;
+    bool ok = true;
+    ok &= report("bulk concurrent", run_bulk(EventQueue::Mode::Concurrent, kBulkEvents), kBulkEvents);
+    ok &= report("bulk single_threaded", run_bulk(EventQueue::Mode::SingleThreaded, kBulkEvents),
+                 kBulkEvents);
+    ok &= report("steady concurrent", run_steady_state(EventQueue::Mode::Concurrent, steady_events),
+                 steady_events);
+    ok &= report("steady single_threaded",
+                 run_steady_state(EventQueue::Mode::SingleThreaded, steady_events), steady_events);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
 }
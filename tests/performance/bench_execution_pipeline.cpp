@@ -0,0 +1,153 @@
+#include "regimeflow/engine/execution_pipeline.h"
+#include "regimeflow/execution/basic_execution_model.h"
+#include "regimeflow/execution/slippage.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using regimeflow::SymbolId;
+using regimeflow::Timestamp;
+using regimeflow::engine::ExecutionPipeline;
+using regimeflow::engine::MarketDataCache;
+using regimeflow::engine::Order;
+using regimeflow::engine::OrderBookCache;
+using regimeflow::engine::OrderSide;
+using regimeflow::events::EventQueue;
+
+constexpr int kSymbols = 1000;
+constexpr int kOrders = 10000;
+constexpr double kMid = 100.0;
+
+struct BenchResult {
+    int64_t updates = 0;
+    int64_t events = 0;
+    double seconds = 0.0;
+};
+
+struct Fixture {
+    MarketDataCache market_data;
+    OrderBookCache order_books;
+    EventQueue queue{EventQueue::Mode::SingleThreaded};
+    ExecutionPipeline pipeline{&market_data, &order_books, &queue};
+    std::vector<SymbolId> symbols;
+};
+
+regimeflow::data::Bar make_bar(const SymbolId symbol, const Timestamp ts, const double price) {
+    regimeflow::data::Bar bar;
+    bar.symbol = symbol;
+    bar.timestamp = ts;
+    bar.open = bar.high = bar.low = bar.close = price;
+    bar.volume = 100;
+    return bar;
+}
+
+// Rest a ladder of limits and stops around the mid on every symbol: buy limits
+// below, sell limits above, buy stops above, sell stops below.
+void seed(Fixture& fx) {
+    fx.pipeline.set_execution_model(std::make_unique<regimeflow::execution::BasicExecutionModel>(
+        std::make_shared<regimeflow::execution::ZeroSlippageModel>()));
+    const Timestamp t0(1);
+    for (int i = 0; i < kSymbols; ++i) {
+        const auto symbol = regimeflow::SymbolRegistry::instance().intern("LADDER" + std::to_string(i));
+        fx.symbols.push_back(symbol);
+        fx.market_data.update(make_bar(symbol, t0, kMid));
+    }
+    for (int i = 0; i < kOrders; ++i) {
+        const SymbolId symbol = fx.symbols[static_cast<size_t>(i % kSymbols)];
+        const double offset = 1.0 + static_cast<double>((i / kSymbols) % 10);
+        Order order;
+        switch (i % 4) {
+        case 0: order = Order::limit(symbol, OrderSide::Buy, 1.0, kMid - offset); break;
+        case 1: order = Order::limit(symbol, OrderSide::Sell, 1.0, kMid + offset); break;
+        case 2: order = Order::stop(symbol, OrderSide::Buy, 1.0, kMid + offset); break;
+        default: order = Order::stop(symbol, OrderSide::Sell, 1.0, kMid - offset); break;
+        }
+        order.id = static_cast<regimeflow::engine::OrderId>(i + 1);
+        order.created_at = t0;
+        fx.pipeline.on_order_submitted(order);
+    }
+}
+
+int64_t drain(EventQueue& queue) {
+    int64_t count = 0;
+    while (queue.pop()) {
+        ++count;
+    }
+    return count;
+}
+
+// Quiet market: prices wobble inside the innermost rung, so no order can fire.
+BenchResult run_quiet(Fixture& fx, const int64_t updates) {
+    BenchResult result;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (int64_t i = 0; i < updates; ++i) {
+        const SymbolId symbol = fx.symbols[static_cast<size_t>(i % kSymbols)];
+        const Timestamp ts(2 + i);
+        const double price = kMid + (i % 2 == 0 ? 0.25 : -0.25);
+        fx.market_data.update(make_bar(symbol, ts, price));
+        fx.pipeline.on_market_update(symbol, ts);
+        ++result.updates;
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+    result.seconds = elapsed.count();
+    result.events = drain(fx.queue);
+    return result;
+}
+
+// Sweep: walk every symbol through its whole ladder so every order fires once.
+BenchResult run_sweep(Fixture& fx) {
+    BenchResult result;
+    int64_t ts = 1'000'000'000;
+    const auto start = std::chrono::high_resolution_clock::now();
+    for (const auto symbol : fx.symbols) {
+        for (const double price : {kMid + 12.0, kMid - 12.0}) {
+            fx.market_data.update(make_bar(symbol, Timestamp(ts), price));
+            fx.pipeline.on_bar(make_bar(symbol, Timestamp(ts), price));
+            ++ts;
+            ++result.updates;
+        }
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::high_resolution_clock::now() - start;
+    result.seconds = elapsed.count();
+    result.events = drain(fx.queue);
+    return result;
+}
+
+bool report(const std::string& label, const BenchResult& result, const int64_t min_events) {
+    if (result.updates <= 0 || result.seconds <= 0.0 || result.events < min_events) {
+        std::cerr << "Execution pipeline benchmark failed sanity checks (" << label
+                  << "): updates=" << result.updates << ", events=" << result.events
+                  << ", elapsed=" << result.seconds << '\n';
+        return false;
+    }
+    const double ups = static_cast<double>(result.updates) / result.seconds;
+    std::cout << "Execution pipeline [" << label << "]: " << ups << " updates/sec, "
+              << result.events << " order events" << '\n';
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int64_t quiet_updates = 1'000'000;
+    if (argc > 1) {
+        quiet_updates = std::max<int64_t>(std::atoll(argv[1]), 1);
+    }
+
+    Fixture fx;
+    seed(fx);
+    std::cout << "Execution pipeline: " << kOrders << " resting orders over " << kSymbols
+              << " symbols" << '\n';
+
+    bool ok = true;
+    ok &= report("quiet", run_quiet(fx, quiet_updates), 0);
+    ok &= report("sweep", run_sweep(fx), kOrders);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
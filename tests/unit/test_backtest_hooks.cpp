@@ -6,6 +6,7 @@
 #include "regimeflow/strategy/strategy.h"
 
 #include <filesystem>
+#include <span>
 #include <vector>
 
 namespace regimeflow::test
@@ -28,6 +29,20 @@ namespace regimeflow::test
         int timer_count_ = 0;
     };
 
+    class SliceStrategy final : public strategy::Strategy {
+    public:
+        void initialize(strategy::StrategyContext&) override {}
+
+        void on_bars(const std::span<const data::Bar> bars) override {
+            slices_.emplace_back(bars.begin(), bars.end());
+        }
+
+        [[nodiscard]] const std::vector<std::vector<data::Bar>>& slices() const { return slices_; }
+
+    private:
+        std::vector<std::vector<data::Bar>> slices_;
+    };
+
     TEST(BacktestHooks, BarHookPriorityOrder) {
         engine::BacktestEngine engine(100000.0);
 
@@ -140,6 +155,51 @@ namespace regimeflow::test
         EXPECT_EQ(messages.back(), "complete");
     }
 
+    TEST(BacktestHooks, StreamingDataFeedMatchesMaterializedRun) {
+        Config data_cfg;
+        data_cfg.set("type", "csv");
+        data_cfg.set("file_pattern", "{symbol}.csv");
+        data_cfg.set("has_header", true);
+        data_cfg.set("data_directory",
+                     (std::filesystem::path(REGIMEFLOW_TEST_ROOT) / "tests/fixtures").string());
+        const auto source = data::DataSourceFactory::create(data_cfg);
+        ASSERT_TRUE(source);
+
+        const std::vector<SymbolId> symbols = {SymbolRegistry::instance().intern("TEST")};
+        TimeRange range;
+        range.start = Timestamp::from_string("2020-01-01 00:00:00", "%Y-%m-%d %H:%M:%S");
+        range.end = Timestamp::from_string("2020-12-31 00:00:00", "%Y-%m-%d %H:%M:%S");
+
+        const auto run_engine = [&](const bool streaming, const bool stepwise) {
+            engine::BacktestEngine engine(100000.0);
+            engine::EventGenerator::Config generator_cfg;
+            generator_cfg.streaming = streaming;
+            generator_cfg.stream_lookahead = 1;
+            engine.set_event_generator_config(generator_cfg);
+            engine.load_data(source->create_iterator(symbols, range, data::BarType::Time_1Day),
+                             source->create_tick_iterator(symbols, range),
+                             source->create_book_iterator(symbols, range));
+            if (streaming) {
+                EXPECT_EQ(engine.event_queue().size(), 0u);
+            }
+            auto strategy = std::make_unique<CountingStrategy>();
+            const auto* strategy_ptr = strategy.get();
+            engine.set_strategy(std::move(strategy));
+            if (stepwise) {
+                while (engine.step()) {
+                }
+            } else {
+                engine.run();
+            }
+            return std::make_pair(strategy_ptr->bar_count(), engine.current_time());
+        };
+
+        const auto materialized = run_engine(false, false);
+        ASSERT_GT(materialized.first, 0);
+        EXPECT_EQ(run_engine(true, false), materialized);
+        EXPECT_EQ(run_engine(true, true), materialized);
+    }
+
     TEST(BacktestHooks, TickAndTimerHooksInvoke) {
         engine::BacktestEngine engine(100000.0);
 
@@ -351,4 +411,50 @@ namespace regimeflow::test
         ASSERT_TRUE(filled_order.has_value());
         EXPECT_EQ(filled_order->status, engine::OrderStatus::Filled);
     }
+
+    TEST(BacktestHooks, SliceDispatchGroupsBarsByTimestamp) {
+        const std::vector<SymbolId> symbols = {SymbolRegistry::instance().intern("SLICE_A"),
+                                               SymbolRegistry::instance().intern("SLICE_B"),
+                                               SymbolRegistry::instance().intern("SLICE_C")};
+        const auto enqueue_bars = [&](engine::BacktestEngine& engine) {
+            for (int64_t t = 1; t <= 2; ++t) {
+                for (const auto symbol : symbols) {
+                    data::Bar bar;
+                    bar.symbol = symbol;
+                    bar.timestamp = Timestamp(t * 1'000'000);
+                    bar.open = bar.high = bar.low = bar.close = 100.0 + static_cast<double>(t);
+                    bar.volume = 10;
+                    engine.enqueue(events::make_market_event(bar));
+                }
+            }
+        };
+
+        engine::BacktestEngine engine(100000.0);
+        engine.set_slice_dispatch(true);
+        auto strategy = std::make_unique<SliceStrategy>();
+        auto* slices = strategy.get();
+        engine.set_strategy(std::move(strategy));
+        enqueue_bars(engine);
+        engine.run();
+
+        ASSERT_EQ(slices->slices().size(), 2u);
+        for (size_t i = 0; i < slices->slices().size(); ++i) {
+            const auto& slice = slices->slices()[i];
+            ASSERT_EQ(slice.size(), symbols.size());
+            for (size_t j = 0; j < slice.size(); ++j) {
+                EXPECT_EQ(slice[j].symbol, symbols[j]);
+                EXPECT_EQ(slice[j].timestamp.microseconds(), static_cast<int64_t>(i + 1) * 1'000'000);
+            }
+        }
+        EXPECT_DOUBLE_EQ(engine.market_data().latest_bar(symbols[2])->close, 102.0);
+
+        engine::BacktestEngine fallback(100000.0);
+        fallback.set_slice_dispatch(true);
+        auto counting = std::make_unique<CountingStrategy>();
+        auto* counts = counting.get();
+        fallback.set_strategy(std::move(counting));
+        enqueue_bars(fallback);
+        fallback.run();
+        EXPECT_EQ(counts->bar_count(), 6);
+    }
 }  // namespace regimeflow::test
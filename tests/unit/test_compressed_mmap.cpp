@@ -0,0 +1,221 @@
+#include "regimeflow/data/column_codec.h"
+#include "regimeflow/data/compressed_mmap.h"
+#include "regimeflow/data/mmap_data_source.h"
+#include "regimeflow/data/mmap_writer.h"
+#include "regimeflow/data/tick_mmap_data_source.h"
+#include "temp_path_guard.h"
+
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cmath>
+#include <filesystem>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace regimeflow::data
+{
+namespace {
+
+constexpr int64_t kMinuteUs = 60'000'000LL;
+constexpr int64_t kEpochUs = 1'600'000'000'000'000LL;
+
+std::vector<Bar> make_minute_bars(const SymbolId symbol, const int count) {
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<int> step(-20, 20);
+    std::uniform_int_distribution<uint64_t> volume(1, 1'000'000);
+    std::vector<Bar> bars;
+    int64_t cents = 10'000;
+    for (int i = 0; i < count; ++i) {
+        const int64_t open = cents;
+        cents = std::max<int64_t>(100, cents + step(rng));
+        // Skip a minute now and then so timestamps are not perfectly regular.
+        const int64_t ts = kEpochUs + (i + i / 97) * kMinuteUs;
+        bars.push_back(Bar{Timestamp(ts), symbol, open / 100.0,
+                           (std::max(open, cents) + 3) / 100.0, (std::min(open, cents) - 3) / 100.0,
+                           cents / 100.0, volume(rng)});
+    }
+    return bars;
+}
+
+template <typename T>
+void expect_bits_equal(const std::vector<T>& actual, const std::vector<T>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        if constexpr (std::is_same_v<T, double>) {
+            EXPECT_EQ(std::bit_cast<uint64_t>(actual[i]), std::bit_cast<uint64_t>(expected[i])) << i;
+        } else {
+            EXPECT_EQ(actual[i], expected[i]) << i;
+        }
+    }
+}
+
+void expect_same_bars(const std::vector<Bar>& actual, const std::vector<Bar>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(actual[i].timestamp, expected[i].timestamp);
+        EXPECT_EQ(actual[i].symbol, expected[i].symbol);
+        EXPECT_EQ(actual[i].open, expected[i].open);
+        EXPECT_EQ(actual[i].high, expected[i].high);
+        EXPECT_EQ(actual[i].low, expected[i].low);
+        EXPECT_EQ(actual[i].close, expected[i].close);
+        EXPECT_EQ(actual[i].volume, expected[i].volume);
+    }
+}
+
+}  // namespace
+
+TEST(ColumnCodec, RoundTripsEveryEncodingExactly) {
+    std::mt19937_64 rng(11);
+    ColumnDecoder decoder;
+
+    std::vector<int64_t> timestamps = {kEpochUs, kEpochUs + 5, kEpochUs + 5, kEpochUs + 1'000'000};
+    for (int i = 0; i < 100; ++i) {
+        timestamps.push_back(timestamps.back() + 1000);
+    }
+    timestamps.push_back(std::numeric_limits<int64_t>::max());
+    std::vector<uint8_t> bytes;
+    auto encoding = encode_timestamp_column(timestamps, bytes);
+    EXPECT_EQ(encoding.codec, ColumnCodec::DeltaOfDelta);
+    std::vector<int64_t> decoded_ts(timestamps.size());
+    ASSERT_TRUE(decoder.decode(bytes, encoding, std::span<int64_t>(decoded_ts)));
+    expect_bits_equal(decoded_ts, timestamps);
+
+    const std::vector<double> prices = {101.25, 101.26, 99.99, 0.01, 250000.5, 101.25};
+    bytes.clear();
+    encoding = encode_price_column(prices, bytes);
+    EXPECT_EQ(encoding.codec, ColumnCodec::ScaledDecimal);
+    EXPECT_EQ(encoding.scale, 2);
+    std::vector<double> decoded(prices.size());
+    ASSERT_TRUE(decoder.decode(bytes, encoding, std::span<double>(decoded)));
+    expect_bits_equal(decoded, prices);
+
+    std::uniform_real_distribution<double> noise(-1e6, 1e6);
+    std::vector<double> floats = {0.0, -0.0, std::numeric_limits<double>::infinity(), 1e-300};
+    for (int i = 0; i < 200; ++i) {
+        floats.push_back(noise(rng));
+    }
+    bytes.clear();
+    encoding = encode_price_column(floats, bytes);
+    EXPECT_EQ(encoding.codec, ColumnCodec::XorFloat);
+    decoded.assign(floats.size(), 0.0);
+    ASSERT_TRUE(decoder.decode(bytes, encoding, std::span<double>(decoded)));
+    expect_bits_equal(decoded, floats);
+
+    std::vector<uint64_t> volumes = {0, 1, 127, 128, std::numeric_limits<uint64_t>::max()};
+    for (int i = 0; i < 64; ++i) {
+        volumes.push_back(rng() >> (i % 64));
+    }
+    bytes.clear();
+    encoding = encode_varint_column(volumes, bytes);
+    std::vector<uint64_t> decoded_volumes(volumes.size());
+    ASSERT_TRUE(decoder.decode(bytes, encoding, std::span<uint64_t>(decoded_volumes)));
+    expect_bits_equal(decoded_volumes, volumes);
+
+    bytes.pop_back();
+    EXPECT_FALSE(decoder.decode(bytes, encoding, std::span<uint64_t>(decoded_volumes)));
+    EXPECT_FALSE(decoder.decode(bytes, {ColumnCodec::DeltaOfDelta, 0}, std::span<double>(decoded)));
+}
+
+TEST(CompressedMmap, BarFileMatchesRawFileAndShrinks) {
+    const auto dir = std::filesystem::temp_directory_path() / "regimeflow_compressed_mmap_test";
+    regimeflow::test::TempPathGuard guard(dir);
+    std::filesystem::create_directories(dir);
+
+    const auto symbol = SymbolRegistry::instance().intern("CMPR_A");
+    const auto bars = make_minute_bars(symbol, 10'000);
+    const auto raw_path = (dir / "CMPR_A_1m.rfb").string();
+    const auto packed_path = (dir / "CMPR_A_1m.rfbz").string();
+    ASSERT_TRUE(MmapWriter().write_bars(raw_path, "CMPR_A", BarType::Time_1Min, bars).is_ok());
+    ASSERT_TRUE(CompressedMmapWriter(1000).write_bars(packed_path, "CMPR_A", BarType::Time_1Min,
+                                                      bars).is_ok());
+
+    const auto raw = std::make_shared<MemoryMappedDataFile>(raw_path);
+    const auto packed = std::make_shared<CompressedBarFile>(packed_path);
+    EXPECT_EQ(packed->symbol_id(), symbol);
+    EXPECT_EQ(packed->bar_type(), BarType::Time_1Min);
+    EXPECT_EQ(packed->bar_count(), bars.size());
+    EXPECT_EQ(packed->blocks().size(), 10u);
+    EXPECT_EQ(packed->time_range().end, bars.back().timestamp);
+    EXPECT_GE(std::filesystem::file_size(raw_path), 4 * std::filesystem::file_size(packed_path));
+
+    const std::vector<TimeRange> ranges = {
+        {},
+        {bars[1500].timestamp, bars[4200].timestamp},
+        {Timestamp(bars[999].timestamp.microseconds() + 1), bars[1000].timestamp},
+        {Timestamp(bars[97].timestamp.microseconds() + 1),
+         Timestamp(bars[98].timestamp.microseconds() - 1)},
+        {Timestamp(1), Timestamp(kEpochUs - 1)},
+        {Timestamp(kEpochUs), Timestamp(std::numeric_limits<int64_t>::max())},
+    };
+    for (const auto& range : ranges) {
+        EXPECT_EQ(packed->find_range(range), raw->find_range(range));
+        MemoryMappedBarIterator raw_iter(raw, range);
+        CompressedBarIterator packed_iter(packed, range);
+        std::vector<Bar> expected;
+        while (raw_iter.has_next()) {
+            expected.push_back(raw_iter.next());
+        }
+        std::vector<Bar> actual;
+        std::vector<Bar> batch(333);
+        while (const size_t n = packed_iter.next_batch(batch)) {
+            actual.insert(actual.end(), batch.begin(), batch.begin() + static_cast<std::ptrdiff_t>(n));
+        }
+        expect_same_bars(actual, expected);
+        packed_iter.reset();
+        if (!expected.empty()) {
+            EXPECT_EQ(packed_iter.next().timestamp, expected.front().timestamp);
+        }
+    }
+}
+
+TEST(CompressedMmap, DataSourcesFallBackToCompressedFiles) {
+    const auto dir = std::filesystem::temp_directory_path() / "regimeflow_compressed_source_test";
+    regimeflow::test::TempPathGuard guard(dir);
+    std::filesystem::create_directories(dir);
+
+    const auto symbol = SymbolRegistry::instance().intern("CMPR_B");
+    const auto bars = make_minute_bars(symbol, 3000);
+    ASSERT_TRUE(CompressedMmapWriter(512).write_bars((dir / "CMPR_B_1m.rfbz").string(), "CMPR_B",
+                                                     BarType::Time_1Min, bars).is_ok());
+    std::vector<Tick> ticks;
+    for (const auto& bar : bars) {
+        ticks.push_back(Tick{bar.timestamp, symbol, bar.close, 100.0, 1});
+    }
+    ASSERT_TRUE(CompressedMmapWriter(512).write_ticks((dir / "CMPR_B.rftz").string(), "CMPR_B",
+                                                      ticks).is_ok());
+
+    MemoryMappedDataSource::Config config;
+    config.data_directory = dir.string();
+    MemoryMappedDataSource source(config);
+    ASSERT_EQ(source.get_available_symbols().size(), 1u);
+    const TimeRange range{bars[100].timestamp, bars[2000].timestamp};
+    const std::vector<Bar> expected(bars.begin() + 100, bars.begin() + 2001);
+    expect_same_bars(source.get_bars(symbol, range, BarType::Time_1Min), expected);
+    auto iter = source.create_iterator({symbol}, range, BarType::Time_1Min);
+    size_t count = 0;
+    while (iter->has_next()) {
+        iter->next();
+        ++count;
+    }
+    EXPECT_EQ(count, expected.size());
+
+    TickMmapDataSource::Config tick_config;
+    tick_config.data_directory = dir.string();
+    TickMmapDataSource tick_source(tick_config);
+    EXPECT_EQ(tick_source.get_available_range(symbol).end, ticks.back().timestamp);
+    const auto loaded = tick_source.get_ticks(symbol, range);
+    ASSERT_EQ(loaded.size(), expected.size());
+    EXPECT_EQ(loaded.front().price, bars[100].close);
+    EXPECT_EQ(loaded.back().flags, 1);
+    auto tick_iter = tick_source.create_tick_iterator({symbol}, range);
+    count = 0;
+    while (tick_iter->has_next()) {
+        tick_iter->next();
+        ++count;
+    }
+    EXPECT_EQ(count, expected.size());
+}
+
+}  // namespace regimeflow::data
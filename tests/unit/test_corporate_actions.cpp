@@ -2,6 +2,10 @@
 
 #include "regimeflow/data/corporate_actions.h"
 
+#include <cmath>
+#include <random>
+#include <vector>
+
 namespace
 {
     TEST(CorporateActionAdjusterTest, AdjustsForSplit) {
@@ -90,4 +94,127 @@ namespace
         const auto new_symbol = regimeflow::SymbolRegistry::instance().intern("NEW");
         EXPECT_EQ(after_adjusted.symbol, new_symbol);
     }
+
+    // The per-action scan the step tables replace.
+    regimeflow::data::Bar scan_reference(const std::vector<regimeflow::data::CorporateAction>& actions,
+                                         const regimeflow::data::Bar& bar) {
+        using regimeflow::data::CorporateActionType;
+        auto adjusted = bar;
+        for (const auto& action : actions) {
+            if (bar.timestamp < action.effective_date) {
+                if (action.type == CorporateActionType::Split && action.factor > 0) {
+                    adjusted.open /= action.factor;
+                    adjusted.high /= action.factor;
+                    adjusted.low /= action.factor;
+                    adjusted.close /= action.factor;
+                    adjusted.volume = static_cast<regimeflow::Volume>(
+                        static_cast<double>(adjusted.volume) * action.factor);
+                } else if (action.type == CorporateActionType::Dividend) {
+                    double r = action.factor;
+                    if ((r <= 0.0 || r == 1.0) && action.amount > 0.0 && adjusted.close > 0.0) {
+                        r = (adjusted.close - action.amount) / adjusted.close;
+                    }
+                    if (r > 0.0) {
+                        adjusted.open *= r;
+                        adjusted.high *= r;
+                        adjusted.low *= r;
+                        adjusted.close *= r;
+                    }
+                }
+            } else if (action.type == CorporateActionType::SymbolChange && !action.new_symbol.empty()) {
+                adjusted.symbol = regimeflow::SymbolRegistry::instance().intern(action.new_symbol);
+            }
+        }
+        return adjusted;
+    }
+
+    TEST(CorporateActionAdjusterTest, StepTablesMatchPerActionScan) {
+        using regimeflow::data::CorporateAction;
+        using regimeflow::data::CorporateActionType;
+        constexpr int64_t kDayUs = 86'400'000'000LL;
+        const auto symbol = regimeflow::SymbolRegistry::instance().intern("STEPS");
+
+        std::vector<CorporateAction> actions;
+        for (int q = 1; q < 40; ++q) {
+            CorporateAction dividend;
+            dividend.type = CorporateActionType::Dividend;
+            dividend.effective_date = regimeflow::Timestamp(q * 90 * kDayUs);
+            // Alternate ratio dividends with cash-only dividends.
+            if (q % 3 == 0) {
+                dividend.amount = 0.25;
+            } else {
+                dividend.factor = 0.995;
+            }
+            actions.push_back(dividend);
+        }
+        CorporateAction split;
+        split.type = CorporateActionType::Split;
+        split.factor = 4.0;
+        split.effective_date = regimeflow::Timestamp(1000 * kDayUs);
+        actions.push_back(split);
+        split.factor = 2.0;
+        split.effective_date = regimeflow::Timestamp(2500 * kDayUs);
+        actions.push_back(split);
+        CorporateAction rename;
+        rename.type = CorporateActionType::SymbolChange;
+        rename.new_symbol = "STEPS2";
+        rename.effective_date = regimeflow::Timestamp(3000 * kDayUs);
+        actions.push_back(rename);
+
+        regimeflow::data::CorporateActionAdjuster adjuster;
+        adjuster.add_actions(symbol, actions);
+        const auto sorted = adjuster.actions_for(symbol);
+        EXPECT_TRUE(adjuster.has_actions(symbol));
+
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<double> price(20.0, 200.0);
+        std::vector<regimeflow::data::Bar> bars;
+        for (int d = 0; d < 3700; ++d) {
+            regimeflow::data::Bar bar{};
+            bar.symbol = symbol;
+            bar.timestamp = regimeflow::Timestamp(d * kDayUs + (d % 2 == 0 ? 0 : kDayUs / 2));
+            bar.close = price(rng);
+            bar.open = bar.close * 0.99;
+            bar.high = bar.close * 1.02;
+            bar.low = bar.close * 0.97;
+            bar.volume = 1000 + static_cast<regimeflow::Volume>(d);
+            bars.push_back(bar);
+        }
+
+        auto batched = bars;
+        adjuster.adjust_bars(symbol, batched);
+        std::vector<int64_t> ts;
+        std::vector<double> opens, highs, lows, closes;
+        std::vector<uint64_t> volumes;
+        for (const auto& bar : bars) {
+            ts.push_back(bar.timestamp.microseconds());
+            opens.push_back(bar.open);
+            highs.push_back(bar.high);
+            lows.push_back(bar.low);
+            closes.push_back(bar.close);
+            volumes.push_back(bar.volume);
+        }
+        adjuster.adjust_columns(symbol, ts, opens, highs, lows, closes, volumes);
+
+        for (size_t i = 0; i < bars.size(); ++i) {
+            const auto expected = scan_reference(sorted, bars[i]);
+            const auto single = adjuster.adjust_bar(symbol, bars[i]);
+            const double tol = std::abs(expected.close) * 1e-12;
+            EXPECT_NEAR(single.close, expected.close, tol);
+            EXPECT_NEAR(single.low, expected.low, tol);
+            EXPECT_EQ(single.volume, expected.volume);
+            EXPECT_EQ(single.symbol, expected.symbol);
+            EXPECT_EQ(batched[i].close, single.close);
+            EXPECT_EQ(batched[i].symbol, single.symbol);
+            EXPECT_EQ(closes[i], single.close);
+            EXPECT_EQ(opens[i], single.open);
+            EXPECT_EQ(volumes[i], single.volume);
+        }
+
+        // Out-of-order input falls back to binary search.
+        std::vector<regimeflow::data::Bar> shuffled = {bars[3000], bars[10], bars[2000]};
+        adjuster.adjust_bars(symbol, shuffled);
+        EXPECT_EQ(shuffled[1].close, adjuster.adjust_bar(symbol, bars[10]).close);
+        EXPECT_EQ(shuffled[2].close, adjuster.adjust_bar(symbol, bars[2000]).close);
+    }
 }  // namespace
@@ -0,0 +1,117 @@
+#include "regimeflow/data/csv_reader.h"
+#include "regimeflow/data/tick_csv_reader.h"
+#include "temp_path_guard.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace regimeflow::data
+{
+namespace {
+
+size_t count_entries(const std::filesystem::path& dir, const std::string& extension) {
+    size_t count = 0;
+    if (!std::filesystem::exists(dir)) {
+        return 0;
+    }
+    for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+        if (entry.path().extension() == extension) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void write_bars(const std::filesystem::path& path, const double last_close) {
+    std::ofstream out(path);
+    out << "timestamp,open,high,low,close,volume\n";
+    out << "2024-01-01 10:00:00,100,101,99,100.5,10\n";
+    out << "2024-01-01 10:01:00,100.5,102,100,101.5,12\n";
+    out << "2024-01-01 10:02:00,101.5,103,101,102.5,14\n";
+    out << "2024-01-01 10:03:00,102.5," << last_close + 1 << ",102," << last_close << ",16\n";
+}
+
+}  // namespace
+
+TEST(CsvCache, SecondReadComesFromCacheAndEditsInvalidate) {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "regimeflow_csv_cache_test";
+    regimeflow::test::TempPathGuard guard(dir);
+    const fs::path data = dir / "data";
+    const fs::path cache = dir / "cache";
+    fs::create_directories(data);
+    write_bars(data / "CACHE_A.csv", 103.5);
+    {
+        std::ofstream ticks(data / "CACHE_A_ticks.csv");
+        ticks << "timestamp,price,quantity\n";
+        ticks << "2024-01-01 10:00:00,101.5,3\n2024-01-01 10:00:01,101.75,2\n2024-01-01 10:00:02,102,4.5\n";
+    }
+
+    CSVDataSource::Config config;
+    config.data_directory = data.string();
+    config.cache_directory = cache.string();
+    const auto symbol = SymbolRegistry::instance().intern("CACHE_A");
+
+    const auto parsed = CSVDataSource(config).get_bars(symbol, {}, BarType::Time_1Min);
+    ASSERT_EQ(parsed.size(), 4u);
+    EXPECT_EQ(count_entries(cache, ".rfb"), 1u);
+
+    // A fresh source reads the entry; the range is applied to the cached rows.
+    CSVDataSource cached(config);
+    const auto all = cached.get_bars(symbol, {}, BarType::Time_1Min);
+    ASSERT_EQ(all.size(), parsed.size());
+    for (size_t i = 0; i < all.size(); ++i) {
+        EXPECT_EQ(all[i].timestamp, parsed[i].timestamp);
+        EXPECT_EQ(all[i].symbol, symbol);
+        EXPECT_EQ(all[i].open, parsed[i].open);
+        EXPECT_EQ(all[i].high, parsed[i].high);
+        EXPECT_EQ(all[i].low, parsed[i].low);
+        EXPECT_EQ(all[i].close, parsed[i].close);
+        EXPECT_EQ(all[i].volume, parsed[i].volume);
+    }
+    TimeRange range;
+    range.start = parsed[1].timestamp;
+    range.end = parsed[2].timestamp;
+    const auto ranged = cached.get_bars(symbol, range, BarType::Time_1Min);
+    ASSERT_EQ(ranged.size(), 2u);
+    EXPECT_EQ(ranged.front().timestamp, parsed[1].timestamp);
+    EXPECT_EQ(ranged.back().timestamp, parsed[2].timestamp);
+    EXPECT_EQ(count_entries(cache, ".rfb"), 1u);
+
+    // Rewriting the file changes its size and mtime, so the old entry misses.
+    write_bars(data / "CACHE_A.csv", 110.25);
+    fs::last_write_time(data / "CACHE_A.csv",
+                        fs::last_write_time(data / "CACHE_A.csv") + std::chrono::seconds(5));
+    const auto edited = CSVDataSource(config).get_bars(symbol, {}, BarType::Time_1Min);
+    ASSERT_EQ(edited.size(), 4u);
+    EXPECT_EQ(edited.back().close, 110.25);
+    EXPECT_EQ(count_entries(cache, ".rfb"), 2u);
+
+    // Report mode needs the full validation pass and never touches the cache.
+    fs::remove_all(cache);
+    config.collect_validation_report = true;
+    EXPECT_EQ(CSVDataSource(config).get_bars(symbol, {}, BarType::Time_1Min).size(), 4u);
+    EXPECT_EQ(count_entries(cache, ".rfb"), 0u);
+
+    CSVTickDataSource::Config tick_config;
+    tick_config.data_directory = data.string();
+    tick_config.cache_directory = cache.string();
+    const auto ticks = CSVTickDataSource(tick_config).get_ticks(symbol, {});
+    ASSERT_EQ(ticks.size(), 3u);
+    EXPECT_EQ(count_entries(cache, ".rft"), 1u);
+    const auto cached_ticks = CSVTickDataSource(tick_config).get_ticks(symbol, {});
+    ASSERT_EQ(cached_ticks.size(), ticks.size());
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        EXPECT_EQ(cached_ticks[i].timestamp, ticks[i].timestamp);
+        EXPECT_EQ(cached_ticks[i].symbol, symbol);
+        EXPECT_EQ(cached_ticks[i].price, ticks[i].price);
+        EXPECT_EQ(cached_ticks[i].quantity, ticks[i].quantity);
+    }
+}
+
+}  // namespace regimeflow::data
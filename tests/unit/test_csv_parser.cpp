@@ -0,0 +1,162 @@
+#include "regimeflow/data/csv_parser.h"
+#include "regimeflow/data/csv_reader.h"
+#include "regimeflow/data/tick_csv_reader.h"
+#include "temp_path_guard.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace regimeflow::data
+{
+namespace {
+
+void expect_same_bars(const std::vector<Bar>& actual, const std::vector<Bar>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(actual[i].timestamp, expected[i].timestamp) << i;
+        EXPECT_EQ(actual[i].symbol, expected[i].symbol) << i;
+        EXPECT_EQ(actual[i].open, expected[i].open) << i;
+        EXPECT_EQ(actual[i].close, expected[i].close) << i;
+        EXPECT_EQ(actual[i].volume, expected[i].volume) << i;
+    }
+}
+
+}  // namespace
+
+TEST(CsvParser, FixedTimestampFormatMatchesStrftimeParser) {
+    const FixedTimestampFormat datetime("%Y-%m-%d %H:%M:%S");
+    ASSERT_TRUE(datetime.compiled());
+    for (const std::string value : {"2024-01-01 10:00:00", "1999-12-31 23:59:59", "2024-02-29 00:00:01",
+                                    "2023-02-31 12:00:00", "1970-01-01 00:00:00",
+                                    "2024-03-10 09:30:00.250"}) {
+        int64_t us = 0;
+        ASSERT_EQ(datetime.parse(value, us), FixedTimestampFormat::Status::Parsed) << value;
+        EXPECT_EQ(us, Timestamp::from_string(value, "%Y-%m-%d %H:%M:%S").microseconds()) << value;
+    }
+
+    int64_t us = 0;
+    EXPECT_EQ(datetime.parse("2024-01-02", us), FixedTimestampFormat::Status::Truncated);
+    EXPECT_EQ(datetime.parse("2024-1-2 10:00:00", us), FixedTimestampFormat::Status::Unsupported);
+    EXPECT_EQ(datetime.parse("2024-13-02 10:00:00", us), FixedTimestampFormat::Status::Unsupported);
+    EXPECT_EQ(datetime.parse("bad", us), FixedTimestampFormat::Status::Unsupported);
+    EXPECT_FALSE(FixedTimestampFormat("%d/%b/%Y").compiled());
+
+    const FixedTimestampFormat compact("%Y%m%dT%T");
+    ASSERT_EQ(compact.parse("20240315T14:05:09", us), FixedTimestampFormat::Status::Parsed);
+    EXPECT_EQ(us, Timestamp::from_string("2024-03-15 14:05:09", "%Y-%m-%d %H:%M:%S").microseconds());
+
+    EXPECT_EQ(parse_csv_double(" 101.25\r"), 101.25);
+    EXPECT_EQ(parse_csv_double("+2.5"), 2.5);
+    EXPECT_EQ(parse_csv_double("0x10"), 16.0);
+    EXPECT_THROW(parse_csv_double("abc"), std::invalid_argument);
+    EXPECT_EQ(parse_csv_uint64("42\r"), 42u);
+    EXPECT_THROW(parse_csv_uint64("99999999999999999999999"), std::out_of_range);
+
+    std::vector<std::string_view> fields;
+    split_csv_line("a,,b,", ',', fields);
+    EXPECT_EQ(fields.size(), 4u);
+    split_csv_line("a,,b,", ',', fields, false);
+    EXPECT_EQ(fields.size(), 3u);
+
+    const std::string text = "l1\nline2\nl3\nline4\nl5";
+    const auto chunks = split_csv_chunks(text, 8, 4);
+    std::string joined;
+    for (const auto chunk : chunks) {
+        EXPECT_TRUE(chunk.back() == '\n' || chunk.data() + chunk.size() == text.data() + text.size());
+        joined.append(chunk);
+    }
+    EXPECT_EQ(joined, text);
+    EXPECT_GT(chunks.size(), 1u);
+}
+
+TEST(CsvParser, WindowedParseConsumesEveryLineInOrder) {
+    std::string text;
+    for (int i = 0; i < 1000; ++i) {
+        text += std::to_string(i) + (i % 3 == 0 ? ",padding\n" : "\n");
+    }
+    const auto parse_line = [](const std::string_view line, std::vector<std::string_view>& fields) {
+        split_csv_line(line, ',', fields);
+        return std::stoi(std::string(fields[0]));
+    };
+    // Windows far smaller than the text, so most lines sit in a later window.
+    std::vector<int> seen;
+    for_each_parsed_csv_row<int>(text, 3, parse_line, [&](const int value) { seen.push_back(value); }, 64);
+    ASSERT_EQ(seen.size(), 1000u);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(seen[static_cast<size_t>(i)], i);
+    }
+    EXPECT_EQ(parse_csv_lines<int>(text, 1, parse_line), seen);
+}
+
+TEST(CsvParser, ParallelParseMatchesSingleThreadedAndKeepsLineNumbers) {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "regimeflow_csv_parser_test";
+    regimeflow::test::TempPathGuard guard(dir);
+    fs::create_directories(dir);
+
+    // Large enough to split into several chunks, with bad rows spread throughout.
+    constexpr int kRows = 60'000;
+    {
+        std::ofstream out(dir / "PARSE_A.csv");
+        out << "timestamp,open,high,low,close,volume\n";
+        for (int i = 0; i < kRows; ++i) {
+            const auto ts = Timestamp(1'700'000'000'000'000LL + static_cast<int64_t>(i) * 60'000'000);
+            if (i % 9973 == 0) {
+                out << "not-a-time,1,1,1,1,1\n";
+            } else if (i % 7919 == 0) {
+                out << ts.to_string("%Y-%m-%d %H:%M:%S") << ",1,1\n";
+            } else {
+                const double px = 100.0 + (i % 500) * 0.01;
+                out << ts.to_string("%Y-%m-%d %H:%M:%S") << ',' << px << ',' << px + 0.5 << ','
+                    << px - 0.5 << ',' << px << ',' << (i % 1000) << "\r\n";
+            }
+        }
+        std::ofstream ticks(dir / "PARSE_A_ticks.csv");
+        ticks << "timestamp,price,quantity\n";
+        ticks << "2024-01-01 10:00:00,101.5,3\n2024-01-01 10:00:01,bad,1\n2024-01-01 10:00:02,102,4.5\n";
+    }
+
+    CSVDataSource::Config config;
+    config.data_directory = dir.string();
+    config.collect_validation_report = true;
+    config.parse_threads = 1;
+    CSVDataSource single(config);
+    config.parse_threads = 4;
+    CSVDataSource parallel(config);
+
+    const auto symbol = SymbolRegistry::instance().intern("PARSE_A");
+    const auto expected = single.get_bars(symbol, {}, BarType::Time_1Min);
+    const auto actual = parallel.get_bars(symbol, {}, BarType::Time_1Min);
+    EXPECT_EQ(expected.size(), static_cast<size_t>(kRows - 7 - 7));
+    expect_same_bars(actual, expected);
+    EXPECT_EQ(expected[0].timestamp.microseconds(), 1'700'000'000'000'000LL + 60'000'000);
+    EXPECT_EQ(expected[0].close, 100.01);
+
+    const auto& single_issues = single.last_report().issues();
+    const auto& parallel_issues = parallel.last_report().issues();
+    ASSERT_EQ(parallel_issues.size(), single_issues.size());
+    ASSERT_FALSE(parallel_issues.empty());
+    for (size_t i = 0; i < parallel_issues.size(); ++i) {
+        EXPECT_EQ(parallel_issues[i].line, single_issues[i].line);
+        EXPECT_EQ(parallel_issues[i].message, single_issues[i].message);
+    }
+    EXPECT_EQ(parallel_issues.front().line, 2u);
+    EXPECT_EQ(parallel_issues.front().message, "CSV parse error: invalid timestamp at line 2");
+
+    CSVTickDataSource::Config tick_config;
+    tick_config.data_directory = dir.string();
+    tick_config.collect_validation_report = true;
+    CSVTickDataSource tick_source(tick_config);
+    const auto ticks = tick_source.get_ticks(symbol, {});
+    ASSERT_EQ(ticks.size(), 2u);
+    EXPECT_EQ(ticks[1].quantity, 4.5);
+    ASSERT_EQ(tick_source.last_report().issues().size(), 1u);
+    EXPECT_EQ(tick_source.last_report().issues()[0].line, 3u);
+    EXPECT_EQ(tick_source.last_report().issues()[0].message, "stod");
+}
+
+}  // namespace regimeflow::data
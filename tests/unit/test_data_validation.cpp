@@ -1,12 +1,17 @@
 #include <gtest/gtest.h>
 
+#include "regimeflow/data/column_validation.h"
 #include "regimeflow/data/csv_reader.h"
+#include "regimeflow/data/memory_data_source.h"
 #include "regimeflow/data/tick_csv_reader.h"
+#include "regimeflow/data/validation_utils.h"
 #include "regimeflow/common/time.h"
 #include "temp_path_guard.h"
 
 #include <filesystem>
 #include <fstream>
+#include <limits>
+#include <random>
 #include <string>
 
 using namespace regimeflow;
@@ -22,6 +27,43 @@ namespace
         std::ofstream out(path);
         out << content;
     }
+
+    void expect_same_issues(const ValidationReport& expected, const ValidationReport& actual) {
+        ASSERT_EQ(expected.issues().size(), actual.issues().size());
+        EXPECT_EQ(expected.error_count(), actual.error_count());
+        EXPECT_EQ(expected.warning_count(), actual.warning_count());
+        for (size_t i = 0; i < expected.issues().size(); ++i) {
+            EXPECT_EQ(expected.issues()[i].severity, actual.issues()[i].severity) << i;
+            EXPECT_EQ(expected.issues()[i].line, actual.issues()[i].line) << i;
+            EXPECT_EQ(expected.issues()[i].message, actual.issues()[i].message) << i;
+        }
+    }
+
+    // A random walk with broken rows, reordered timestamps and spikes mixed in.
+    std::vector<Bar> messy_bars(const SymbolId symbol, const uint32_t seed, const size_t count) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> step(-0.02, 0.02);
+        std::uniform_int_distribution<int> fault(0, 39);
+        std::vector<Bar> bars;
+        double price = 100.0;
+        int64_t ts = 1'704'067'200'000'000LL;
+        for (size_t i = 0; i < count; ++i) {
+            ts += 3'600'000'000LL * (fault(rng) == 0 ? 30 : 1);
+            price *= 1.0 + step(rng);
+            Bar bar{Timestamp(ts), symbol, price, price * 1.01, price * 0.99, price, 1000 + i % 17};
+            switch (fault(rng)) {
+            case 1: bar.low = bar.high * 1.1; break;
+            case 2: bar.close = std::numeric_limits<double>::quiet_NaN(); break;
+            case 3: bar.volume = 5'000'000; break;
+            case 4: bar.timestamp = Timestamp(ts - 7'200'000'000LL); break;
+            case 5: bar.open = bar.high = bar.close = price * 3.0; break;
+            case 6: bar.timestamp = Timestamp(ts + 400LL * 86'400'000'000LL * 100); break;
+            default: break;
+            }
+            bars.push_back(bar);
+        }
+        return bars;
+    }
 }  // namespace
 
 TEST(DataValidation, CsvVolumeBoundsSkipsInvalidRow) {
@@ -125,3 +167,72 @@ TEST(DataValidation, CsvGapFillInsertsMissingBars) {
               Timestamp::from_string("2024-01-02 00:00:00", "%Y-%m-%d %H:%M:%S"));
     EXPECT_EQ(bars[1].volume, 0u);
 }
+
+TEST(DataValidation, ColumnValidatorMatchesRowValidator) {
+    const auto symbol = SymbolRegistry::instance().intern("COLVAL");
+    std::vector<ValidationConfig> configs(4);
+    configs[1].check_volume_bounds = true;
+    configs[1].max_volume = 1'000'000;
+    configs[1].check_future_timestamps = true;
+    configs[1].check_trading_hours = true;
+    configs[1].trading_start_seconds = 13 * 3600;
+    configs[1].trading_end_seconds = 21 * 3600;
+    configs[1].on_error = ValidationAction::Skip;
+    configs[2].check_gap = true;
+    configs[2].max_gap = Duration::hours(12);
+    configs[2].check_price_jump = true;
+    configs[2].max_jump_pct = 0.5;
+    configs[2].check_outliers = true;
+    configs[2].outlier_zscore = 2.0;
+    configs[2].outlier_warmup = 10;
+    configs[2].on_warning = ValidationAction::Skip;
+    configs[2].on_gap = ValidationAction::Continue;
+    configs[3] = configs[2];
+    configs[3].on_warning = ValidationAction::Continue;
+    configs[3].max_price = 150.0;
+    configs[3].trading_start_seconds = 22 * 3600;
+    configs[3].trading_end_seconds = 6 * 3600;
+    configs[3].check_trading_hours = true;
+
+    std::vector<std::shared_ptr<const BarColumns>> series;
+    std::vector<BarColumnsView> universe;
+    for (uint32_t seed = 0; seed < 6; ++seed) {
+        series.push_back(BarColumns::from_bars(symbol, messy_bars(symbol, seed, 2000)));
+        universe.push_back(BarColumnsView::of(*series.back()));
+    }
+
+    for (const auto& config : configs) {
+        const auto reports = validate_bar_universe(universe, config, 3);
+        ASSERT_EQ(reports.size(), universe.size());
+        for (size_t s = 0; s < series.size(); ++s) {
+            std::vector<Bar> bars;
+            for (size_t i = 0; i < series[s]->size(); ++i) {
+                bars.push_back(series[s]->bar(i));
+            }
+            ValidationReport expected;
+            validate_bars(bars, BarType::Time_1Hour, config, false, true, &expected);
+            EXPECT_GT(expected.issues().size(), 0u);
+            expect_same_issues(expected, validate_bar_columns(universe[s], config));
+            expect_same_issues(expected, reports[s]);
+
+            std::vector<Tick> ticks;
+            for (const auto& bar : bars) {
+                Tick tick;
+                tick.timestamp = bar.timestamp;
+                tick.symbol = symbol;
+                tick.price = bar.close;
+                tick.quantity = static_cast<double>(bar.volume);
+                ticks.push_back(tick);
+            }
+            ValidationReport expected_ticks;
+            validate_ticks(ticks, config, true, &expected_ticks);
+            const auto tick_columns = TickColumns::from_ticks(symbol, ticks);
+            expect_same_issues(expected_ticks, validate_tick_columns(TickColumnsView::of(*tick_columns), config));
+        }
+    }
+
+    // Clean, sorted input takes the fast path and reports nothing.
+    const auto clean = BarColumns::from_bars(symbol, {Bar{Timestamp(1), symbol, 10, 11, 9, 10, 1},
+                                                      Bar{Timestamp(2), symbol, 10, 11, 9, 10, 1}});
+    EXPECT_TRUE(validate_bar_columns(BarColumnsView::of(*clean), ValidationConfig{}).issues().empty());
+}
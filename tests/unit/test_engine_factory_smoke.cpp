@@ -3,6 +3,7 @@
 #include "regimeflow/common/yaml_config.h"
 
 #include <filesystem>
+#include <stdexcept>
 #include "regimeflow/engine/engine_factory.h"
 
 namespace
@@ -14,4 +15,38 @@ namespace
         const auto engine = regimeflow::engine::EngineFactory::create(config);
         ASSERT_NE(engine, nullptr);
     }
+
+    TEST(EngineFactoryTest, RejectsUnknownEventQueueMode) {
+        regimeflow::Config config;
+        config.set_path("engine.event_queue", std::string("single_thread"));
+        EXPECT_THROW(regimeflow::engine::EngineFactory::create(config), std::invalid_argument);
+
+        config.set_path("engine.event_queue", std::string("single_threaded"));
+        const auto engine = regimeflow::engine::EngineFactory::create(config);
+        ASSERT_NE(engine, nullptr);
+        EXPECT_EQ(engine->event_queue().mode(), regimeflow::events::EventQueue::Mode::SingleThreaded);
+    }
+
+    TEST(EngineFactoryTest, RejectsUnknownOrderManagerMode) {
+        regimeflow::Config config;
+        config.set_path("engine.order_manager", std::string("single"));
+        EXPECT_THROW(regimeflow::engine::EngineFactory::create(config), std::invalid_argument);
+
+        config.set_path("engine.order_manager", std::string("single_threaded"));
+        const auto engine = regimeflow::engine::EngineFactory::create(config);
+        ASSERT_NE(engine, nullptr);
+        EXPECT_EQ(engine->order_manager().mode(), regimeflow::engine::OrderManager::Mode::SingleThreaded);
+    }
+
+    TEST(EngineFactoryTest, RejectsUnknownEquitySamplingMode) {
+        regimeflow::Config config;
+        config.set_path("engine.equity_sampling", std::string("end_of_week"));
+        EXPECT_THROW(regimeflow::engine::EngineFactory::create(config), std::invalid_argument);
+
+        config.set_path("engine.equity_sampling", std::string("end_of_day"));
+        const auto engine = regimeflow::engine::EngineFactory::create(config);
+        ASSERT_NE(engine, nullptr);
+        EXPECT_EQ(engine->portfolio().equity_store().sampling().mode,
+                  regimeflow::engine::EquitySampling::EndOfDay);
+    }
 }  // namespace
@@ -5,6 +5,8 @@
 #include "regimeflow/engine/event_generator.h"
 #include "regimeflow/events/event_queue.h"
 
+#include <tuple>
+
 namespace regimeflow::test
 {
     TEST(EventGeneratorOrdering, TickIteratorOrdersByTimestampThenSymbol) {
@@ -178,4 +180,87 @@ namespace regimeflow::test
             EXPECT_EQ(kinds[3], events::MarketEventKind::Book);
         }
     }
+
+    TEST(EventGeneratorOrdering, StreamingFeedMatchesEnqueueAll) {
+        auto sym_a = SymbolRegistry::instance().intern("AAA");
+        auto sym_b = SymbolRegistry::instance().intern("BBB");
+
+        data::MemoryDataSource source;
+        std::vector<data::Bar> bars_a;
+        std::vector<data::Bar> bars_b;
+        std::vector<data::Tick> ticks_a;
+        for (int day = 0; day < 3; ++day) {
+            for (int minute = 0; minute < 4; ++minute) {
+                const auto ts = Timestamp::from_date(2024, 1, 2 + day)
+                    + Duration::hours(14) + Duration::minutes(minute);
+                data::Bar bar;
+                bar.symbol = sym_a;
+                bar.timestamp = ts;
+                bar.open = bar.high = bar.low = bar.close = 10.0 + minute;
+                bar.volume = 100;
+                bars_a.push_back(bar);
+                if (minute % 2 == 0) {
+                    bar.symbol = sym_b;
+                    bars_b.push_back(bar);
+                }
+                data::Tick tick;
+                tick.symbol = sym_a;
+                tick.timestamp = ts + Duration::seconds(minute % 2 == 0 ? 0 : 30);
+                tick.price = 10.0 + minute;
+                tick.quantity = 1.0;
+                ticks_a.push_back(tick);
+            }
+        }
+        source.add_bars(sym_a, bars_a);
+        source.add_bars(sym_b, bars_b);
+        source.add_ticks(sym_a, ticks_a);
+
+        TimeRange range{Timestamp(0), Timestamp::from_date(2025, 1, 1)};
+        engine::EventGenerator::Config cfg;
+        cfg.emit_start_of_day = true;
+        cfg.emit_end_of_day = true;
+
+        const auto drain = [](events::EventQueue& queue, engine::EventGenerator* streaming) {
+            std::vector<std::tuple<int64_t, uint8_t, SymbolId, int>> out;
+            while (true) {
+                if (streaming) {
+                    streaming->feed();
+                }
+                auto evt = queue.pop();
+                if (!evt) {
+                    break;
+                }
+                int kind = -1;
+                if (const auto* market = std::get_if<events::MarketEventPayload>(&evt->payload)) {
+                    kind = static_cast<int>(market->kind);
+                } else if (const auto* system = std::get_if<events::SystemEventPayload>(&evt->payload)) {
+                    kind = 100 + static_cast<int>(system->kind);
+                }
+                out.emplace_back(evt->timestamp.microseconds(), evt->priority, evt->symbol, kind);
+            }
+            return out;
+        };
+
+        events::EventQueue batch_queue;
+        engine::EventGenerator batch(source.create_iterator({sym_a, sym_b}, range, data::BarType::Time_1Min),
+                                     source.create_tick_iterator({sym_a, sym_b}, range),
+                                     nullptr, &batch_queue, cfg);
+        batch.enqueue_all();
+        const auto expected = drain(batch_queue, nullptr);
+
+        cfg.streaming = true;
+        cfg.stream_lookahead = 2;
+        events::EventQueue stream_queue;
+        engine::EventGenerator streaming(source.create_iterator({sym_a, sym_b}, range, data::BarType::Time_1Min),
+                                         source.create_tick_iterator({sym_a, sym_b}, range),
+                                         nullptr, &stream_queue, cfg);
+        streaming.start_streaming();
+        EXPECT_TRUE(streaming.has_pending());
+        EXPECT_LE(streaming.feed(), 5u);
+        EXPECT_EQ(streaming.feed(), 0u);
+        const auto actual = drain(stream_queue, &streaming);
+
+        EXPECT_FALSE(streaming.has_pending());
+        EXPECT_EQ(actual, expected);
+    }
 }  // namespace regimeflow::test
@@ -71,4 +71,127 @@ namespace regimeflow::test
         EXPECT_EQ(first->symbol, bar_a.symbol);
         EXPECT_EQ(second->symbol, bar_b.symbol);
     }
+
+    TEST(EventQueueOrdering, SingleThreadedOrdersByTimestampPriorityAndFIFO) {
+        events::EventQueue queue(events::EventQueue::Mode::SingleThreaded);
+
+        data::Bar bar;
+        bar.symbol = SymbolRegistry::instance().intern("AAA");
+        bar.open = 1.0;
+        bar.high = 1.0;
+        bar.low = 1.0;
+        bar.close = 1.0;
+        bar.volume = 1;
+
+        bar.timestamp = Timestamp(3000);
+        queue.push(events::make_market_event(bar));
+        queue.push(events::make_order_event(events::OrderEventKind::NewOrder, Timestamp(1000), 1));
+        bar.timestamp = Timestamp(1000);
+        queue.push(events::make_market_event(bar));
+        data::Bar bar_b = bar;
+        bar_b.symbol = SymbolRegistry::instance().intern("BBB");
+        queue.push(events::make_market_event(bar_b));
+        queue.push(events::make_system_event(events::SystemEventKind::Timer, Timestamp(1000)));
+
+        EXPECT_EQ(queue.size(), 5u);
+        ASSERT_TRUE(queue.next_timestamp());
+        EXPECT_EQ(queue.next_timestamp()->microseconds(), 1000);
+
+        auto first = queue.pop();
+        ASSERT_TRUE(first);
+        EXPECT_EQ(first->type, events::EventType::System);
+        auto second = queue.pop();
+        ASSERT_TRUE(second);
+        EXPECT_EQ(second->symbol, bar.symbol);
+        auto third = queue.pop();
+        ASSERT_TRUE(third);
+        EXPECT_EQ(third->symbol, bar_b.symbol);
+        EXPECT_LT(second->sequence, third->sequence);
+        auto fourth = queue.pop();
+        ASSERT_TRUE(fourth);
+        EXPECT_EQ(fourth->type, events::EventType::Order);
+        auto fifth = queue.pop();
+        ASSERT_TRUE(fifth);
+        EXPECT_EQ(fifth->timestamp.microseconds(), 3000);
+        EXPECT_TRUE(queue.empty());
+        EXPECT_FALSE(queue.pop());
+    }
+
+    TEST(EventQueueOrdering, SetModeCarriesQueuedEvents) {
+        events::EventQueue queue;
+        queue.push(events::make_system_event(events::SystemEventKind::Timer, Timestamp(20)));
+        queue.push(events::make_system_event(events::SystemEventKind::Timer, Timestamp(10)));
+
+        queue.set_mode(events::EventQueue::Mode::SingleThreaded);
+        EXPECT_EQ(queue.mode(), events::EventQueue::Mode::SingleThreaded);
+        EXPECT_EQ(queue.size(), 2u);
+        queue.push(events::make_system_event(events::SystemEventKind::Timer, Timestamp(10)));
+
+        queue.set_mode(events::EventQueue::Mode::Concurrent);
+        auto first = queue.pop();
+        auto second = queue.pop();
+        auto third = queue.pop();
+        ASSERT_TRUE(first && second && third);
+        EXPECT_EQ(first->timestamp.microseconds(), 10);
+        EXPECT_EQ(second->timestamp.microseconds(), 10);
+        EXPECT_LT(first->sequence, second->sequence);
+        EXPECT_EQ(third->timestamp.microseconds(), 20);
+        EXPECT_TRUE(queue.empty());
+    }
+
+    TEST(EventQueueOrdering, PayloadsRoundTripThroughCompactStorage) {
+        for (const auto mode : {events::EventQueue::Mode::Concurrent,
+                                events::EventQueue::Mode::SingleThreaded}) {
+            events::EventQueue queue(mode);
+            const auto symbol = SymbolRegistry::instance().intern("AAA");
+
+            data::OrderBook book;
+            book.timestamp = Timestamp(100);
+            book.symbol = symbol;
+            book.bids[0] = {99.5, 10.0, 2};
+            book.asks[9] = {101.25, 7.0, 1};
+            queue.push(events::make_market_event(book));
+            queue.push(events::make_order_event(events::OrderEventKind::Fill, Timestamp(100), 7, 3,
+                                                5.0, 100.0, symbol, 0.5, true, 0.1, 2, "XNAS"));
+            queue.push(events::make_system_event(events::SystemEventKind::Timer, Timestamp(100), 4,
+                                                 "regime_check"));
+
+            auto peeked = queue.peek();
+            ASSERT_TRUE(peeked);
+            const auto* peeked_system = std::get_if<events::SystemEventPayload>(&peeked->payload);
+            ASSERT_TRUE(peeked_system);
+            EXPECT_EQ(peeked_system->id, "regime_check");
+
+            auto system_evt = queue.pop();
+            ASSERT_TRUE(system_evt);
+            const auto* system = std::get_if<events::SystemEventPayload>(&system_evt->payload);
+            ASSERT_TRUE(system);
+            EXPECT_EQ(system->kind, events::SystemEventKind::Timer);
+            EXPECT_EQ(system->code, 4);
+            EXPECT_EQ(system->id, "regime_check");
+
+            auto book_evt = queue.pop();
+            ASSERT_TRUE(book_evt);
+            EXPECT_EQ(book_evt->symbol, symbol);
+            const auto* market = std::get_if<events::MarketEventPayload>(&book_evt->payload);
+            ASSERT_TRUE(market);
+            EXPECT_EQ(market->kind, events::MarketEventKind::Book);
+            const auto* restored = std::get_if<data::OrderBook>(&market->data);
+            ASSERT_TRUE(restored);
+            EXPECT_DOUBLE_EQ(restored->bids[0].price, 99.5);
+            EXPECT_EQ(restored->bids[0].num_orders, 2);
+            EXPECT_DOUBLE_EQ(restored->asks[9].price, 101.25);
+
+            auto order_evt = queue.pop();
+            ASSERT_TRUE(order_evt);
+            const auto* order = std::get_if<events::OrderEventPayload>(&order_evt->payload);
+            ASSERT_TRUE(order);
+            EXPECT_EQ(order->order_id, 7u);
+            EXPECT_EQ(order->fill_id, 3u);
+            EXPECT_EQ(order->parent_order_id, 2u);
+            EXPECT_TRUE(order->is_maker);
+            EXPECT_EQ(order->venue, "XNAS");
+            EXPECT_TRUE(queue.empty());
+        }
+    }
 }  // namespace regimeflow::test
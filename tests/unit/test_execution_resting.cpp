@@ -2,6 +2,8 @@
 #include "regimeflow/execution/latency_model.h"
 #include "test_time.h"
 
+#include <vector>
+
 #include <gtest/gtest.h>
 
 using regimeflow::SymbolRegistry;
@@ -664,3 +666,107 @@ TEST(ExecutionPipelineRestingTest, ClosedDateBlocksExecution) {
     EXPECT_EQ(payload->kind, OrderEventKind::Fill);
     EXPECT_EQ(payload->order_id, 17u);
 }
+
+namespace {
+
+std::vector<regimeflow::engine::OrderId> drain_fill_ids(EventQueue& queue) {
+    std::vector<regimeflow::engine::OrderId> ids;
+    while (const auto event = queue.pop()) {
+        const auto* payload = std::get_if<regimeflow::events::OrderEventPayload>(&event->payload);
+        if (payload && payload->kind == OrderEventKind::Fill) {
+            ids.push_back(payload->order_id);
+        }
+    }
+    return ids;
+}
+
+}  // namespace
+
+TEST(ExecutionPipelineRestingTest, TriggerLadderFiresOnlyCrossedOrdersOnUpdatedSymbol) {
+    MarketDataCache market_data;
+    OrderBookCache order_books;
+    EventQueue queue;
+    ExecutionPipeline pipeline(&market_data, &order_books, &queue);
+
+    const auto symbol_a = SymbolRegistry::instance().intern("LADDER_A");
+    const auto symbol_b = SymbolRegistry::instance().intern("LADDER_B");
+    Quote quote;
+    quote.bid = 100.0;
+    quote.ask = 100.5;
+    quote.timestamp = regimeflow::test::fixed_timestamp();
+    quote.symbol = symbol_a;
+    market_data.update(quote);
+    quote.symbol = symbol_b;
+    market_data.update(quote);
+
+    const auto submit = [&](Order order, const regimeflow::engine::OrderId id) {
+        order.id = id;
+        order.created_at = quote.timestamp;
+        pipeline.on_order_submitted(order);
+    };
+    submit(Order::limit(symbol_a, OrderSide::Buy, 1.0, 97.0), 3);
+    submit(Order::limit(symbol_a, OrderSide::Buy, 1.0, 99.0), 1);
+    submit(Order::limit(symbol_a, OrderSide::Buy, 1.0, 98.0), 2);
+    submit(Order::stop(symbol_a, OrderSide::Sell, 1.0, 96.0), 4);
+    submit(Order::limit(symbol_b, OrderSide::Buy, 1.0, 99.0), 5);
+    EXPECT_TRUE(queue.empty());
+
+    // Only the two buy limits at or above the new ask fire, in id order.
+    quote.symbol = symbol_a;
+    quote.timestamp = quote.timestamp + regimeflow::Duration::milliseconds(1);
+    quote.bid = 97.5;
+    quote.ask = 98.0;
+    market_data.update(quote);
+    pipeline.on_market_update(symbol_a, quote.timestamp);
+    EXPECT_EQ(drain_fill_ids(queue), (std::vector<regimeflow::engine::OrderId>{1, 2}));
+
+    // The deeper limit fills and the sell stop triggers; symbol B is untouched.
+    quote.timestamp = quote.timestamp + regimeflow::Duration::milliseconds(1);
+    quote.bid = 95.5;
+    quote.ask = 96.0;
+    market_data.update(quote);
+    pipeline.on_market_update(symbol_a, quote.timestamp);
+    EXPECT_EQ(drain_fill_ids(queue), (std::vector<regimeflow::engine::OrderId>{3, 4}));
+
+    pipeline.on_market_update(symbol_b, quote.timestamp);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(ExecutionPipelineRestingTest, TriggeredStopLimitMovesToLimitLadder) {
+    MarketDataCache market_data;
+    OrderBookCache order_books;
+    EventQueue queue;
+    ExecutionPipeline pipeline(&market_data, &order_books, &queue);
+
+    const auto symbol = SymbolRegistry::instance().intern("LADDER_SL");
+    Quote quote;
+    quote.symbol = symbol;
+    quote.bid = 99.5;
+    quote.ask = 100.0;
+    quote.timestamp = regimeflow::test::fixed_timestamp();
+    market_data.update(quote);
+
+    auto order = Order::stop(symbol, OrderSide::Buy, 1.0, 101.0);
+    order.type = OrderType::StopLimit;
+    order.limit_price = 101.5;
+    order.id = 20;
+    order.created_at = quote.timestamp;
+    pipeline.on_order_submitted(order);
+    EXPECT_TRUE(queue.empty());
+
+    // Gaps through the stop and above the limit: triggered but not fillable.
+    quote.timestamp = quote.timestamp + regimeflow::Duration::milliseconds(1);
+    quote.bid = 101.8;
+    quote.ask = 102.0;
+    market_data.update(quote);
+    pipeline.on_market_update(symbol, quote.timestamp);
+    EXPECT_TRUE(drain_fill_ids(queue).empty());
+
+    // Back below the limit (and below the stop): fills as a limit order.
+    quote.timestamp = quote.timestamp + regimeflow::Duration::milliseconds(1);
+    quote.bid = 100.5;
+    quote.ask = 100.8;
+    market_data.update(quote);
+    pipeline.on_market_update(symbol, quote.timestamp);
+    EXPECT_EQ(drain_fill_ids(queue), (std::vector<regimeflow::engine::OrderId>{20}));
+}
@@ -0,0 +1,79 @@
+#include "regimeflow/engine/market_data_cache.h"
+
+#include <gtest/gtest.h>
+
+using regimeflow::SymbolId;
+using regimeflow::Timestamp;
+using regimeflow::data::Bar;
+using regimeflow::engine::MarketDataCache;
+
+namespace {
+
+Bar make_bar(const SymbolId symbol, const int i) {
+    Bar bar;
+    bar.symbol = symbol;
+    bar.timestamp = Timestamp(static_cast<int64_t>(i) * 60'000'000);
+    bar.open = bar.high = bar.low = bar.close = 100.0 + i;
+    bar.volume = static_cast<regimeflow::Volume>(1000 + i);
+    return bar;
+}
+
+}  // namespace
+
+TEST(MarketDataCache, HistoryRingKeepsNewestBarsInOrder) {
+    MarketDataCache cache;
+    cache.set_history_depth(4);
+    for (int i = 0; i < 6; ++i) {
+        cache.update(make_bar(1, i));
+    }
+
+    const auto view = cache.bar_history(1, 10);
+    ASSERT_EQ(view.size(), 4U);
+    // Wrapped ring: the tail spans the end and the start of storage.
+    EXPECT_FALSE(view.second.empty());
+    EXPECT_DOUBLE_EQ(view.front().close, 102.0);
+    EXPECT_DOUBLE_EQ(view.back().close, 105.0);
+    for (size_t i = 0; i < view.size(); ++i) {
+        EXPECT_DOUBLE_EQ(view[i].close, 102.0 + static_cast<double>(i));
+    }
+
+    const auto closes = cache.close_history(1, 3);
+    ASSERT_EQ(closes.size(), 3U);
+    EXPECT_DOUBLE_EQ(closes[0], 103.0);
+    EXPECT_DOUBLE_EQ(closes.back(), 105.0);
+
+    const auto volumes = cache.volume_history(1, 2);
+    ASSERT_EQ(volumes.size(), 2U);
+    EXPECT_EQ(volumes[0], 1004U);
+    EXPECT_EQ(volumes[1], 1005U);
+
+    const auto copied = cache.recent_bars(1, 2);
+    ASSERT_EQ(copied.size(), 2U);
+    EXPECT_DOUBLE_EQ(copied[0].close, 104.0);
+    EXPECT_DOUBLE_EQ(copied[1].close, 105.0);
+
+    EXPECT_TRUE(cache.bar_history(2, 5).empty());
+}
+
+TEST(MarketDataCache, HistoryDepthChangeKeepsMostRecentBars) {
+    MarketDataCache cache;
+    cache.set_history_depth(3);
+    for (int i = 0; i < 5; ++i) {
+        cache.update(make_bar(1, i));
+    }
+
+    cache.set_history_depth(2);
+    auto view = cache.close_history(1, 10);
+    ASSERT_EQ(view.size(), 2U);
+    EXPECT_DOUBLE_EQ(view[0], 103.0);
+    EXPECT_DOUBLE_EQ(view[1], 104.0);
+
+    cache.set_history_depth(4);
+    cache.update(make_bar(1, 5));
+    cache.update(make_bar(1, 6));
+    cache.update(make_bar(1, 7));
+    view = cache.close_history(1, 10);
+    ASSERT_EQ(view.size(), 4U);
+    EXPECT_DOUBLE_EQ(view.front(), 104.0);
+    EXPECT_DOUBLE_EQ(view.back(), 107.0);
+}
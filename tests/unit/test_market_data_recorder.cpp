@@ -0,0 +1,266 @@
+#include "regimeflow/data/live_segment.h"
+#include "regimeflow/data/mmap_reader.h"
+#include "regimeflow/data/tick_mmap.h"
+#include "regimeflow/live/market_data_recorder.h"
+#include "temp_path_guard.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace regimeflow::test
+{
+namespace {
+
+constexpr int64_t kDay1 = 1'700'000'000'000'000LL;  // 2023-11-14 22:13:20 UTC
+constexpr int64_t kDayUs = 86'400'000'000LL;
+
+data::Tick make_tick(const SymbolId symbol, const int64_t us, const double price) {
+    data::Tick tick;
+    tick.timestamp = Timestamp(us);
+    tick.symbol = symbol;
+    tick.price = price;
+    tick.quantity = 2.0;
+    tick.flags = 1;
+    return tick;
+}
+
+// Feed that only holds callbacks, so tests can drive them.
+class CallbackFeed final : public data::LiveFeedAdapter {
+public:
+    Result<void> connect() override { return Ok(); }
+    void disconnect() override {}
+    bool is_connected() const override { return true; }
+    void subscribe(const std::vector<std::string>&) override {}
+    void unsubscribe(const std::vector<std::string>&) override {}
+    void on_bar(std::function<void(const data::Bar&)> cb) override { bar_cb = std::move(cb); }
+    void on_tick(std::function<void(const data::Tick&)> cb) override { tick_cb = std::move(cb); }
+    void on_book(std::function<void(const data::OrderBook&)> cb) override { book_cb = std::move(cb); }
+    void poll() override {}
+
+    std::function<void(const data::Bar&)> bar_cb;
+    std::function<void(const data::Tick&)> tick_cb;
+    std::function<void(const data::OrderBook&)> book_cb;
+};
+
+}  // namespace
+
+TEST(MarketDataRecorder, SegmentReaderTailsCommitsAndWriterDropsTornTail) {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "regimeflow_live_segment_test";
+    TempPathGuard guard(dir);
+    fs::create_directories(dir);
+    const auto path = (dir / "SEG.ticks.rfl").string();
+    const auto symbol = SymbolRegistry::instance().intern("SEG");
+
+    data::LiveSegmentWriter writer;
+    ASSERT_TRUE(writer.open(path, data::LiveRecordKind::Tick, "SEG", 20231114).is_ok());
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(writer.append(make_tick(symbol, kDay1 + i, 100.0 + i)).is_ok());
+    }
+    ASSERT_TRUE(writer.commit().is_ok());
+
+    data::LiveSegmentReader reader;
+    ASSERT_TRUE(reader.open(path).is_ok());
+    EXPECT_EQ(reader.symbol(), "SEG");
+    EXPECT_EQ(reader.date(), 20231114);
+    std::vector<data::Tick> ticks;
+    ASSERT_EQ(reader.read(ticks).value(), 5u);
+    EXPECT_EQ(ticks[4].price, 104.0);
+    EXPECT_EQ(ticks[4].symbol, symbol);
+
+    // Uncommitted rows stay invisible to the tailing reader.
+    for (int i = 5; i < 8; ++i) {
+        ASSERT_TRUE(writer.append(make_tick(symbol, kDay1 + i, 100.0 + i)).is_ok());
+    }
+    EXPECT_EQ(reader.refresh(), 5u);
+    EXPECT_EQ(reader.read(ticks).value(), 0u);
+    ASSERT_TRUE(writer.commit().is_ok());
+    EXPECT_EQ(reader.refresh(), 8u);
+    ASSERT_EQ(reader.read(ticks).value(), 3u);
+    EXPECT_EQ(ticks.back().price, 107.0);
+    EXPECT_TRUE(writer.append(make_tick(symbol, kDay1, 99.0)).is_err());
+    std::vector<data::Bar> bars;
+    EXPECT_TRUE(reader.read(bars).is_err());
+    ASSERT_TRUE(writer.close().is_ok());
+
+    // A torn tail past the last commit is dropped when the segment resumes.
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::app);
+        out << "partial-row";
+    }
+    ASSERT_TRUE(writer.open(path, data::LiveRecordKind::Tick, "SEG", 20231114).is_ok());
+    EXPECT_EQ(writer.committed_count(), 8u);
+    EXPECT_EQ(fs::file_size(path), sizeof(data::LiveSegmentHeader) + 8 * 32u);
+    ASSERT_TRUE(writer.append(make_tick(symbol, kDay1 + 8, 108.0)).is_ok());
+    ASSERT_TRUE(writer.close().is_ok());
+    EXPECT_TRUE(writer.open(path, data::LiveRecordKind::Tick, "OTHER", 20231114).is_err());
+
+    // A torn header slot falls back to the previous commit.
+    data::LiveSegmentHeader header{};
+    {
+        std::ifstream in(path, std::ios::binary);
+        in.read(reinterpret_cast<char*>(&header), sizeof(header));
+    }
+    const size_t newest = header.commits[0].sequence > header.commits[1].sequence ? 0 : 1;
+    header.commits[newest].record_count = 1000;
+    {
+        std::fstream io(path, std::ios::binary | std::ios::in | std::ios::out);
+        io.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+    data::LiveSegmentReader fallback;
+    ASSERT_TRUE(fallback.open(path).is_ok());
+    EXPECT_EQ(fallback.committed_count(), 8u);
+}
+
+TEST(MarketDataRecorder, SplitCommitCoversOnlyRowsFlushedBeforeIt) {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "regimeflow_live_segment_split_commit_test";
+    TempPathGuard guard(dir);
+    fs::create_directories(dir);
+    const auto path = (dir / "SPLIT.ticks.rfl").string();
+    const auto symbol = SymbolRegistry::instance().intern("SPLIT");
+
+    data::LiveSegmentWriter writer;
+    ASSERT_TRUE(writer.open(path, data::LiveRecordKind::Tick, "SPLIT", 20231114).is_ok());
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(writer.append(make_tick(symbol, kDay1 + i, 10.0 + i)).is_ok());
+    }
+    auto commit = writer.prepare_commit();
+    ASSERT_TRUE(commit.is_ok());
+    EXPECT_EQ(commit.value().record_count, 4u);
+
+    // Rows appended between the two halves wait for the next commit.
+    ASSERT_TRUE(writer.append(make_tick(symbol, kDay1 + 4, 14.0)).is_ok());
+    ASSERT_TRUE(writer.finish_commit(commit.value()).is_ok());
+    EXPECT_EQ(writer.committed_count(), 4u);
+    EXPECT_EQ(writer.record_count(), 5u);
+
+    data::LiveSegmentReader reader;
+    ASSERT_TRUE(reader.open(path).is_ok());
+    std::vector<data::Tick> ticks;
+    ASSERT_EQ(reader.read(ticks).value(), 4u);
+    ASSERT_TRUE(writer.commit().is_ok());
+    EXPECT_EQ(reader.refresh(), 5u);
+    ASSERT_EQ(reader.read(ticks).value(), 1u);
+    EXPECT_EQ(ticks.back().price, 14.0);
+    ASSERT_TRUE(writer.close().is_ok());
+}
+
+TEST(MarketDataRecorder, RecordsBusDataAndSealsPreviousDayOnRollover) {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "regimeflow_market_data_recorder_test";
+    TempPathGuard guard(dir);
+    const auto aaa = SymbolRegistry::instance().intern("RECA");
+    const auto bbb = SymbolRegistry::instance().intern("RECB");
+
+    live::MarketDataRecorder::Config config;
+    config.directory = dir.string();
+    config.sync_interval = Duration::milliseconds(5);
+    live::MarketDataRecorder recorder(config);
+
+    live::EventBus bus;
+    bus.start();
+    recorder.attach(bus);
+    for (int i = 0; i < 10; ++i) {
+        live::LiveMessage message;
+        message.topic = live::LiveTopic::MarketData;
+        message.payload = live::MarketDataUpdate{make_tick(aaa, kDay1 + i * 1'000'000, 50.0 + i)};
+        bus.publish(std::move(message));
+    }
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (recorder.stats().recorded < 10 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    recorder.detach();
+    bus.stop();
+    ASSERT_EQ(recorder.stats().recorded, 10u);
+
+    data::Bar bar{Timestamp(kDay1), bbb, 10.0, 11.0, 9.0, 10.5, 500};
+    ASSERT_TRUE(recorder.record(live::MarketDataUpdate{bar}).is_ok());
+    data::Quote quote;
+    quote.timestamp = Timestamp(kDay1);
+    quote.symbol = bbb;
+    quote.bid = 10.0;
+    quote.ask = 10.1;
+    ASSERT_TRUE(recorder.record(live::MarketDataUpdate{quote}).is_ok());
+    data::OrderBook book;
+    book.timestamp = Timestamp(kDay1);
+    book.symbol = bbb;
+    book.bids[0] = {10.0, 5.0, 2};
+    book.asks[0] = {10.1, 4.0, 1};
+    ASSERT_TRUE(recorder.record(live::MarketDataUpdate{book}).is_ok());
+
+    // The commit thread makes day 1 visible to readers while it is still open.
+    const auto day1 = live::MarketDataRecorder::day_directory(dir.string(), 20231114);
+    data::LiveSegmentReader tail;
+    ASSERT_TRUE(tail.open((fs::path(day1) / "RECA.ticks.rfl").string()).is_ok());
+    while (tail.refresh() < 10 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(tail.committed_count(), 10u);
+
+    // Data for the next day closes day 1 and the background thread seals it;
+    // late day-1 data is rejected.
+    ASSERT_TRUE(recorder.record(live::MarketDataUpdate{make_tick(aaa, kDay1 + kDayUs, 70.0)}).is_ok());
+    EXPECT_TRUE(recorder.record(live::MarketDataUpdate{make_tick(bbb, kDay1 + 100, 70.0)}).is_err());
+    while (recorder.stats().sealed < 3 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(recorder.stats().sealed, 3u);
+    ASSERT_TRUE(recorder.close().is_ok());
+    const auto stats = recorder.stats();
+    EXPECT_EQ(stats.recorded, 14u);
+    EXPECT_EQ(stats.rejected, 1u);
+    EXPECT_EQ(stats.sealed, 3u);
+    EXPECT_EQ(stats.seal_errors, 0u);
+    EXPECT_EQ(stats.commit_errors, 0u);
+
+    const data::TickMmapFile sealed_ticks((fs::path(day1) / "RECA.rft").string());
+    ASSERT_EQ(sealed_ticks.tick_count(), 10u);
+    EXPECT_EQ(sealed_ticks[9].to_tick().price, 59.0);
+    const data::MemoryMappedDataFile sealed_bars((fs::path(day1) / "RECB_1m.rfb").string());
+    ASSERT_EQ(sealed_bars.bar_count(), 1u);
+    EXPECT_EQ(sealed_bars.closes()[0], 10.5);
+    EXPECT_TRUE(fs::exists(fs::path(day1) / "RECB.rfob"));
+    EXPECT_FALSE(fs::exists(fs::path(day1) / "RECB.rfq"));
+    EXPECT_TRUE(fs::exists(fs::path(day1) / "RECB.quotes.rfl"));
+    EXPECT_TRUE(fs::exists(fs::path(live::MarketDataRecorder::day_directory(dir.string(), 20231115)) /
+                           "RECA.ticks.rfl"));
+}
+
+TEST(MarketDataRecorder, ClearsFeedCallbacksWhenDetachedOrDestroyed) {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "regimeflow_market_data_recorder_feed_test";
+    TempPathGuard guard(dir);
+    const auto symbol = SymbolRegistry::instance().intern("RECF");
+
+    live::MarketDataRecorder::Config config;
+    config.directory = dir.string();
+    config.sync_interval = Duration::milliseconds(0);
+
+    CallbackFeed feed;
+    {
+        live::MarketDataRecorder recorder(config);
+        recorder.attach(feed);
+        ASSERT_TRUE(feed.tick_cb && feed.bar_cb && feed.book_cb);
+        feed.tick_cb(make_tick(symbol, kDay1, 10.0));
+        EXPECT_EQ(recorder.stats().recorded, 1u);
+        recorder.detach();
+        EXPECT_FALSE(feed.tick_cb || feed.bar_cb || feed.book_cb);
+
+        recorder.attach(feed);
+        feed.tick_cb(make_tick(symbol, kDay1 + 1, 11.0));
+        EXPECT_EQ(recorder.stats().recorded, 2u);
+    }
+    // The feed outlives the recorder and holds no callback into it.
+    EXPECT_FALSE(feed.tick_cb || feed.bar_cb || feed.book_cb);
+}
+
+}  // namespace regimeflow::test
@@ -0,0 +1,97 @@
+#include "regimeflow/data/memory_data_source.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace regimeflow::data
+{
+namespace {
+
+Bar make_bar(const SymbolId symbol, const int64_t us, const double close) {
+    Bar bar;
+    bar.timestamp = Timestamp(us);
+    bar.symbol = symbol;
+    bar.open = bar.high = bar.low = bar.close = close;
+    bar.volume = static_cast<Volume>(us);
+    bar.trade_count = 3;
+    bar.vwap = close;
+    return bar;
+}
+
+}  // namespace
+
+TEST(MemoryDataSource, RangeQueriesUseSortedSharedColumns) {
+    const auto symbol = SymbolRegistry::instance().intern("MEMCOL");
+    MemoryDataSource source;
+    source.add_bars(symbol, {make_bar(symbol, 30, 3.0), make_bar(symbol, 10, 1.0)});
+    source.add_bars(symbol, {make_bar(symbol, 20, 2.0), make_bar(symbol, 40, 4.0)});
+
+    const auto bars = source.get_bars(symbol, {Timestamp(20), Timestamp(30)});
+    ASSERT_EQ(bars.size(), 2u);
+    EXPECT_EQ(bars[0].close, 2.0);
+    EXPECT_EQ(bars[1].close, 3.0);
+    EXPECT_EQ(bars[1].trade_count, 3u);
+    EXPECT_EQ(source.get_bars(symbol, {}).size(), 4u);
+    EXPECT_TRUE(source.get_bars(symbol, {Timestamp(31), Timestamp(39)}).empty());
+    EXPECT_TRUE(source.get_bars(symbol, {Timestamp(40), Timestamp(10)}).empty());
+    EXPECT_EQ(source.get_available_range(symbol).end, Timestamp(40));
+
+    // Iterators keep the series they started with; later adds build a new buffer.
+    const auto iter = source.create_iterator({symbol}, {Timestamp(15), Timestamp(45)}, BarType::Time_1Day);
+    const auto before = source.bar_columns(symbol);
+    source.add_bars(symbol, {make_bar(symbol, 25, 2.5)});
+    EXPECT_NE(source.bar_columns(symbol), before);
+    std::vector<Bar> batch(8);
+    ASSERT_EQ(iter->next_batch(batch), 3u);
+    EXPECT_EQ(batch[0].timestamp, Timestamp(20));
+    EXPECT_EQ(batch[2].timestamp, Timestamp(40));
+    iter->reset();
+    EXPECT_EQ(iter->next().timestamp, Timestamp(20));
+
+    // Copies share the buffers instead of duplicating them.
+    const MemoryDataSource copy = source;
+    EXPECT_EQ(copy.bar_columns(symbol), source.bar_columns(symbol));
+    EXPECT_EQ(copy.bar_columns(symbol)->size(), 5u);
+}
+
+TEST(MemoryDataSource, TickAndBookIteratorsWalkWindows) {
+    const auto symbol = SymbolRegistry::instance().intern("MEMTICK");
+    MemoryDataSource source;
+    std::vector<Tick> ticks;
+    std::vector<OrderBook> books;
+    for (int i = 5; i >= 1; --i) {
+        Tick tick;
+        tick.timestamp = Timestamp(i * 10);
+        tick.symbol = symbol;
+        tick.price = i;
+        tick.flags = static_cast<uint8_t>(i);
+        ticks.push_back(tick);
+        OrderBook book;
+        book.timestamp = Timestamp(i * 10);
+        book.symbol = symbol;
+        book.bids[0] = {static_cast<double>(i), 1.0, 1};
+        books.push_back(book);
+    }
+    source.add_ticks(symbol, ticks);
+    source.add_order_books(symbol, books);
+
+    const auto tick_iter = source.create_tick_iterator({symbol}, {Timestamp(20), Timestamp(40)});
+    std::vector<Tick> seen;
+    while (tick_iter->has_next()) {
+        seen.push_back(tick_iter->next());
+    }
+    ASSERT_EQ(seen.size(), 3u);
+    EXPECT_EQ(seen.front().price, 2.0);
+    EXPECT_EQ(seen.back().flags, 4);
+    EXPECT_EQ(source.tick_columns(symbol)->size(), 5u);
+
+    const auto book_iter = source.create_book_iterator({symbol}, {Timestamp(35), Timestamp(100)});
+    std::vector<OrderBook> window(4);
+    ASSERT_EQ(book_iter->next_batch(window), 2u);
+    EXPECT_EQ(window[0].bids[0].price, 4.0);
+    EXPECT_EQ(window[1].bids[0].price, 5.0);
+    EXPECT_EQ(source.get_order_books(symbol, {Timestamp(10), Timestamp(20)}).size(), 2u);
+}
+
+}  // namespace regimeflow::data
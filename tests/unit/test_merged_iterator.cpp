@@ -3,6 +3,9 @@
 #include "regimeflow/data/merged_iterator.h"
 #include "regimeflow/data/memory_data_source.h"
 
+#include <algorithm>
+#include <string>
+
 using namespace regimeflow;
 using namespace regimeflow::data;
 
@@ -65,3 +68,77 @@ TEST(MergedIterator, OrdersByTimestampThenSymbol) {
     EXPECT_EQ(reset_first.timestamp.to_string(), "2024-01-01 00:00:00");
     EXPECT_EQ(reset_first.symbol, sym_a);
 }
+
+TEST(MergedIterator, LoserTreeMatchesSortedReferenceInBatches) {
+    constexpr int kSources = 37;
+    std::vector<Bar> reference;
+    std::vector<std::unique_ptr<DataIterator>> iterators;
+    for (int s = 0; s < kSources; ++s) {
+        const SymbolId symbol = SymbolRegistry::instance().intern("LT" + std::to_string(s));
+        std::vector<Bar> bars;
+        for (int i = 0; i < 50 + s * 3; ++i) {
+            Bar bar;
+            bar.symbol = symbol;
+            bar.timestamp = Timestamp(1'000'000 + static_cast<int64_t>(i) * (s % 5 + 1));
+            bar.close = s * 1000.0 + i;
+            bars.push_back(bar);
+        }
+        reference.insert(reference.end(), bars.begin(), bars.end());
+        iterators.push_back(std::make_unique<VectorBarIterator>(std::move(bars)));
+    }
+    iterators.push_back(nullptr);
+    iterators.push_back(std::make_unique<VectorBarIterator>(std::vector<Bar>{}));
+    std::ranges::stable_sort(reference, [](const Bar& a, const Bar& b) {
+        if (a.timestamp != b.timestamp) {
+            return a.timestamp < b.timestamp;
+        }
+        return a.symbol < b.symbol;
+    });
+
+    MergedBarIterator merged(std::move(iterators));
+    std::vector<Bar> out;
+    std::vector<Bar> batch(17);
+    while (const size_t count = merged.next_batch(batch)) {
+        out.insert(out.end(), batch.begin(), batch.begin() + static_cast<std::ptrdiff_t>(count));
+    }
+    EXPECT_FALSE(merged.has_next());
+    ASSERT_EQ(out.size(), reference.size());
+    for (size_t i = 0; i < out.size(); ++i) {
+        ASSERT_EQ(out[i].timestamp, reference[i].timestamp) << i;
+        ASSERT_EQ(out[i].symbol, reference[i].symbol) << i;
+        ASSERT_DOUBLE_EQ(out[i].close, reference[i].close) << i;
+    }
+
+    merged.reset();
+    size_t single = 0;
+    while (merged.has_next()) {
+        const Bar bar = merged.next();
+        ASSERT_EQ(bar.timestamp, reference[single].timestamp);
+        ASSERT_DOUBLE_EQ(bar.close, reference[single].close);
+        ++single;
+    }
+    EXPECT_EQ(single, reference.size());
+    EXPECT_THROW(merged.next(), std::out_of_range);
+}
+
+TEST(MergedIterator, TickMergeHandlesSingleAndEmptySources) {
+    MergedTickIterator none({});
+    EXPECT_FALSE(none.has_next());
+
+    const SymbolId symbol = SymbolRegistry::instance().intern("LTTICK");
+    std::vector<Tick> ticks(100);
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        ticks[i].symbol = symbol;
+        ticks[i].timestamp = Timestamp(static_cast<int64_t>(i) + 1);
+        ticks[i].price = static_cast<double>(i);
+    }
+    std::vector<std::unique_ptr<TickIterator>> iterators;
+    iterators.push_back(std::make_unique<VectorTickIterator>(ticks));
+    MergedTickIterator merged(std::move(iterators));
+    std::vector<Tick> batch(64);
+    EXPECT_EQ(merged.next_batch(batch), 64u);
+    EXPECT_DOUBLE_EQ(batch[63].price, 63.0);
+    EXPECT_EQ(merged.next_batch(batch), 36u);
+    EXPECT_DOUBLE_EQ(batch[35].price, 99.0);
+    EXPECT_EQ(merged.next_batch(batch), 0u);
+}
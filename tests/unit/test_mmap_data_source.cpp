@@ -0,0 +1,320 @@
+#include "regimeflow/data/mmap_data_source.h"
+#include "regimeflow/data/mmap_writer.h"
+#include "regimeflow/data/order_book_mmap_data_source.h"
+#include "regimeflow/data/tick_mmap_data_source.h"
+#include "temp_path_guard.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace regimeflow::data
+{
+namespace {
+
+constexpr int64_t kDayUs = 86'400'000'000LL;
+constexpr int64_t kEpochUs = 1'600'000'000'000'000LL;
+
+Timestamp day(const int64_t n) {
+    return Timestamp(kEpochUs + n * kDayUs);
+}
+
+std::vector<Bar> make_daily_bars(const SymbolId symbol, const int count, const int64_t offset_us,
+                                 const double base) {
+    std::vector<Bar> bars;
+    for (int i = 0; i < count; ++i) {
+        const double px = base + i;
+        bars.push_back(Bar{Timestamp(kEpochUs + offset_us + i * kDayUs), symbol, px, px + 1.0,
+                           px - 1.0, px, static_cast<Volume>(1000 + i)});
+    }
+    return bars;
+}
+
+}  // namespace
+
+TEST(MemoryMappedDataSource, IteratorWalksMappedColumnsWithAdjustments) {
+    const auto dir = std::filesystem::temp_directory_path() / "regimeflow_mmap_source_iter_test";
+    regimeflow::test::TempPathGuard guard(dir);
+    std::filesystem::create_directories(dir);
+
+    const auto a = SymbolRegistry::instance().intern("MMAPIT_A");
+    const auto b = SymbolRegistry::instance().intern("MMAPIT_B");
+    MmapWriter writer;
+    ASSERT_TRUE(writer.write_bars((dir / "MMAPIT_A_1d.rfb").string(), "MMAPIT_A", BarType::Time_1Day,
+                                  make_daily_bars(a, 10, 0, 100.0)).is_ok());
+    ASSERT_TRUE(writer.write_bars((dir / "MMAPIT_B_1d.rfb").string(), "MMAPIT_B", BarType::Time_1Day,
+                                  make_daily_bars(b, 10, kDayUs / 2, 50.0)).is_ok());
+
+    MemoryMappedDataSource::Config config;
+    config.data_directory = dir.string();
+    MemoryMappedDataSource source(config);
+    CorporateAction split;
+    split.type = CorporateActionType::Split;
+    split.effective_date = day(5);
+    split.factor = 2.0;
+    source.set_corporate_actions(a, {split});
+
+    const TimeRange range{day(2), day(7)};
+    const auto expected_a = source.get_bars(a, range, BarType::Time_1Day);
+    ASSERT_EQ(expected_a.size(), 6u);
+    EXPECT_DOUBLE_EQ(expected_a.front().close, 51.0);
+    EXPECT_EQ(expected_a.front().volume, 2004u);
+    EXPECT_DOUBLE_EQ(expected_a.back().close, 107.0);
+
+    const auto iter = source.create_iterator({a, b}, range, BarType::Time_1Day);
+    std::vector<Bar> merged;
+    while (iter->has_next()) {
+        merged.push_back(iter->next());
+    }
+    ASSERT_EQ(merged.size(), 11u);
+    std::vector<Bar> from_a;
+    for (size_t i = 1; i < merged.size(); ++i) {
+        EXPECT_LE(merged[i - 1].timestamp, merged[i].timestamp);
+    }
+    for (const auto& bar : merged) {
+        if (bar.symbol == a) {
+            from_a.push_back(bar);
+        }
+    }
+    ASSERT_EQ(from_a.size(), expected_a.size());
+    for (size_t i = 0; i < from_a.size(); ++i) {
+        EXPECT_EQ(from_a[i].timestamp, expected_a[i].timestamp);
+        EXPECT_DOUBLE_EQ(from_a[i].open, expected_a[i].open);
+        EXPECT_DOUBLE_EQ(from_a[i].close, expected_a[i].close);
+        EXPECT_EQ(from_a[i].volume, expected_a[i].volume);
+    }
+
+    iter->reset();
+    ASSERT_TRUE(iter->has_next());
+    EXPECT_EQ(iter->next().timestamp, day(2));
+}
+
+TEST(MemoryMappedDataSource, BarIteratorRespectsEmptyWindow) {
+    const auto path = std::filesystem::temp_directory_path() / "regimeflow_mmap_bar_iter_empty.rfb";
+    regimeflow::test::TempPathGuard guard(path);
+    const auto symbol = SymbolRegistry::instance().intern("MMAPIT_C");
+    MmapWriter writer;
+    ASSERT_TRUE(writer.write_bars(path.string(), "MMAPIT_C", BarType::Time_1Day,
+                                  make_daily_bars(symbol, 3, 0, 10.0)).is_ok());
+    const auto file = std::make_shared<MemoryMappedDataFile>(path.string());
+
+    MemoryMappedBarIterator empty(file, {day(10), day(20)});
+    EXPECT_FALSE(empty.has_next());
+    EXPECT_THROW(empty.next(), std::out_of_range);
+
+    MemoryMappedBarIterator all(file, {});
+    int count = 0;
+    while (all.has_next()) {
+        EXPECT_EQ(all.next().symbol, symbol);
+        ++count;
+    }
+    EXPECT_EQ(count, 3);
+}
+
+TEST(MemoryMappedDataSource, AccessPolicyAndPrefetchKeepScanResults) {
+    const auto dir = std::filesystem::temp_directory_path() / "regimeflow_mmap_access_policy_test";
+    regimeflow::test::TempPathGuard guard(dir);
+    std::filesystem::create_directories(dir);
+    const auto symbol = SymbolRegistry::instance().intern("MMAPADV");
+    MmapWriter writer;
+    ASSERT_TRUE(writer.write_bars((dir / "MMAPADV_1d.rfb").string(), "MMAPADV", BarType::Time_1Day,
+                                  make_daily_bars(symbol, 5000, 0, 10.0)).is_ok());
+
+    EXPECT_EQ(parse_mmap_access_policy("prefetch_range"), MmapAccessPolicy::PrefetchRange);
+    EXPECT_EQ(parse_mmap_access_policy("random"), MmapAccessPolicy::Random);
+    EXPECT_EQ(parse_mmap_access_policy("bogus", MmapAccessPolicy::Sequential), MmapAccessPolicy::Sequential);
+
+    MemoryMappedDataSource::Config config;
+    config.data_directory = dir.string();
+    MemoryMappedDataSource plain(config);
+    config.access_policy = MmapAccessPolicy::PrefetchRange;
+    config.prefetch_rows = 64;
+    config.huge_pages = true;
+    MemoryMappedDataSource advised(config);
+
+    const TimeRange range{day(100), day(4000)};
+    const auto expected = plain.get_bars(symbol, range, BarType::Time_1Day);
+    ASSERT_EQ(expected.size(), 3901u);
+    const auto iter = advised.create_iterator({symbol}, range, BarType::Time_1Day);
+    std::vector<Bar> batch(100);
+    size_t seen = 0;
+    while (const size_t n = iter->next_batch(batch)) {
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(batch[i].timestamp, expected[seen + i].timestamp);
+            EXPECT_DOUBLE_EQ(batch[i].close, expected[seen + i].close);
+        }
+        seen += n;
+    }
+    EXPECT_EQ(seen, expected.size());
+
+    // The prefetcher follows the cursor and stops at the end of its window.
+    const auto file = std::make_shared<MemoryMappedDataFile>((dir / "MMAPADV_1d.rfb").string());
+    file->advise(MmapAccessPolicy::Random, 0, file->bar_count());
+    MmapPrefetcher prefetcher(file->columns(), 10, 2000, 256);
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (prefetcher.prefetched() < 266 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(prefetcher.prefetched(), 266u);
+    prefetcher.advance(1900);
+    while (prefetcher.prefetched() < 2000 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(prefetcher.prefetched(), 2000u);
+
+    // Prefetchers sharing one worker each follow their own cursor.
+    const auto worker = std::make_shared<MmapPrefetchWorker>();
+    MmapPrefetcher front(file->columns(), 0, 1000, 128, worker);
+    auto back = std::make_unique<MmapPrefetcher>(file->columns(), 3000, 5000, 128, worker);
+    while ((front.prefetched() < 128 || back->prefetched() < 3128) &&
+           std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(front.prefetched(), 128u);
+    EXPECT_EQ(back->prefetched(), 3128u);
+    back->advance(4950);
+    back.reset();
+    front.advance(900);
+    while (front.prefetched() < 1000 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_EQ(front.prefetched(), 1000u);
+}
+
+TEST(MemoryMappedDataSource, AsOfLookupsMatchRangeQueries) {
+    const auto dir = std::filesystem::temp_directory_path() / "regimeflow_mmap_source_as_of_test";
+    regimeflow::test::TempPathGuard guard(dir);
+    std::filesystem::create_directories(dir);
+
+    // Several rows per day, with whole days missing, so the date index
+    // has uneven buckets and lookups land on dates it does not list.
+    const auto symbol = SymbolRegistry::instance().intern("MMAPASOF");
+    std::vector<int64_t> times;
+    for (int d = 0; d < 12; ++d) {
+        if (d % 4 == 3) {
+            continue;
+        }
+        for (int h = 0; h <= d % 3; ++h) {
+            times.push_back(kEpochUs + d * kDayUs + (h + 1) * 3'600'000'000LL);
+        }
+    }
+    std::vector<Bar> bars;
+    std::vector<Tick> ticks;
+    std::vector<OrderBook> books;
+    for (size_t i = 0; i < times.size(); ++i) {
+        const double px = 100.0 + static_cast<double>(i);
+        bars.push_back(Bar{Timestamp(times[i]), symbol, px, px + 1.0, px - 1.0, px,
+                           static_cast<Volume>(1000 + i)});
+        ticks.push_back(Tick{Timestamp(times[i]), symbol, px, 1.0, 0});
+        OrderBook book;
+        book.timestamp = Timestamp(times[i]);
+        book.symbol = symbol;
+        book.bids[0].price = px;
+        book.asks[0].price = px + 0.1;
+        books.push_back(book);
+    }
+    MmapWriter writer;
+    ASSERT_TRUE(writer.write_bars((dir / "MMAPASOF_1h.rfb").string(), "MMAPASOF", BarType::Time_1Hour,
+                                  bars).is_ok());
+    TickMmapWriter tick_writer;
+    ASSERT_TRUE(tick_writer.write_ticks((dir / "MMAPASOF.rft").string(), "MMAPASOF", ticks).is_ok());
+    OrderBookMmapWriter book_writer;
+    ASSERT_TRUE(book_writer.write_books((dir / "MMAPASOF.rfob").string(), "MMAPASOF", books).is_ok());
+
+    MemoryMappedDataSource::Config config;
+    config.data_directory = dir.string();
+    MemoryMappedDataSource source(config);
+    CorporateAction split;
+    split.type = CorporateActionType::Split;
+    split.effective_date = Timestamp(times[times.size() / 2]);
+    split.factor = 2.0;
+    source.set_corporate_actions(symbol, {split});
+    TickMmapDataSource::Config tick_config;
+    tick_config.data_directory = dir.string();
+    TickMmapDataSource tick_source(tick_config);
+    OrderBookMmapDataSource::Config book_config;
+    book_config.data_directory = dir.string();
+    OrderBookMmapDataSource book_source(book_config);
+
+    std::vector<int64_t> probes{1, kEpochUs, times.back() + 30 * kDayUs};
+    for (const auto t : times) {
+        probes.insert(probes.end(), {t - 1, t, t + 1, t + kDayUs / 2});
+    }
+    probes.insert(probes.end(), probes.rbegin(), probes.rend());
+    for (const auto probe : probes) {
+        const Timestamp ts(probe);
+        const auto expected_bar = source.DataSource::get_bar_as_of(symbol, ts, BarType::Time_1Hour);
+        const auto bar = source.get_bar_as_of(symbol, ts, BarType::Time_1Hour);
+        ASSERT_EQ(bar.has_value(), expected_bar.has_value()) << probe;
+        if (bar) {
+            EXPECT_EQ(bar->timestamp, expected_bar->timestamp) << probe;
+            EXPECT_DOUBLE_EQ(bar->close, expected_bar->close) << probe;
+            EXPECT_EQ(bar->volume, expected_bar->volume) << probe;
+        }
+        const auto expected_tick = tick_source.DataSource::get_tick_as_of(symbol, ts);
+        const auto tick = tick_source.get_tick_as_of(symbol, ts);
+        ASSERT_EQ(tick.has_value(), expected_tick.has_value()) << probe;
+        if (tick) {
+            EXPECT_EQ(tick->timestamp, expected_tick->timestamp) << probe;
+        }
+        const auto expected_book = book_source.DataSource::get_order_book_as_of(symbol, ts);
+        const auto book = book_source.get_order_book_as_of(symbol, ts);
+        ASSERT_EQ(book.has_value(), expected_book.has_value()) << probe;
+        if (book) {
+            EXPECT_EQ(book->timestamp, expected_book->timestamp) << probe;
+            EXPECT_DOUBLE_EQ(book->bids[0].price, expected_book->bids[0].price) << probe;
+        }
+    }
+    EXPECT_FALSE(source.get_bar_as_of(symbol, Timestamp(times.front() - 1), BarType::Time_1Hour).has_value());
+}
+
+TEST(MemoryMappedDataSource, SourcesShareCachesWithoutMixingAdjustments) {
+    const auto dir = std::filesystem::temp_directory_path() / "regimeflow_mmap_source_shared_cache_test";
+    regimeflow::test::TempPathGuard guard(dir);
+    std::filesystem::create_directories(dir);
+
+    const auto symbol = SymbolRegistry::instance().intern("MMAPSHARED");
+    MmapWriter writer;
+    ASSERT_TRUE(writer.write_bars((dir / "MMAPSHARED_1d.rfb").string(), "MMAPSHARED", BarType::Time_1Day,
+                                  make_daily_bars(symbol, 10, 0, 100.0)).is_ok());
+
+    MemoryMappedDataSource::Config config;
+    config.data_directory = dir.string();
+    config.max_cached_range_bytes = 1 << 20;
+    config.cache_eviction = CacheEviction::Clock;
+    config.cache_shards = 4;
+    config.shared_caches = MemoryMappedDataSource::Caches::create(config);
+    const auto caches = config.shared_caches;
+    EXPECT_TRUE(caches->ranges.enabled());
+
+    MemoryMappedDataSource plain(config);
+    MemoryMappedDataSource adjusted(config);
+    CorporateAction split;
+    split.type = CorporateActionType::Split;
+    split.effective_date = day(5);
+    split.factor = 2.0;
+    adjusted.set_corporate_actions(symbol, {split});
+
+    const TimeRange range{day(0), day(9)};
+    const auto raw = plain.get_bars(symbol, range, BarType::Time_1Day);
+    ASSERT_EQ(raw.size(), 10u);
+    EXPECT_EQ(caches->files.size(), 1u);
+    EXPECT_EQ(caches->ranges.size(), 1u);
+    EXPECT_GT(caches->ranges.weight(), raw.size() * sizeof(Bar));
+
+    const auto split_bars = adjusted.get_bars(symbol, range, BarType::Time_1Day);
+    ASSERT_EQ(split_bars.size(), 10u);
+    EXPECT_DOUBLE_EQ(split_bars.front().close, raw.front().close / 2.0);
+    EXPECT_EQ(caches->files.size(), 1u);
+    EXPECT_EQ(caches->ranges.size(), 2u);
+
+    const auto again = plain.get_bars(symbol, range, BarType::Time_1Day);
+    EXPECT_DOUBLE_EQ(again.front().close, raw.front().close);
+    EXPECT_GE(caches->ranges.stats().hits, 1u);
+}
+
+}  // namespace regimeflow::data
@@ -1,5 +1,7 @@
 #include "regimeflow/data/mmap_reader.h"
 #include "regimeflow/data/mmap_writer.h"
+#include "regimeflow/data/order_book_mmap.h"
+#include "regimeflow/data/tick_mmap.h"
 #include "temp_path_guard.h"
 
 #include <gtest/gtest.h>
@@ -7,6 +9,9 @@
 #include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <span>
+#include <string>
 #include <vector>
 
 namespace regimeflow::data
@@ -17,6 +22,23 @@ std::filesystem::path temp_mmap_path() {
     return std::filesystem::temp_directory_path() / "regimeflow_mmap_writer_checksum_test.rgmf";
 }
 
+std::string read_file(const std::filesystem::path& path) {
+    std::ifstream input(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
+}
+
+// Append `rows` in uneven slices so batches straddle the writer's buffer.
+template <typename Writer, typename Row>
+void append_in_slices(Writer& writer, const std::vector<Row>& rows) {
+    size_t offset = 0;
+    for (size_t slice = 1; offset < rows.size(); slice = slice % 11 + 1) {
+        const size_t n = std::min(slice, rows.size() - offset);
+        const auto result = writer.append(std::span<const Row>(rows.data() + offset, n));
+        ASSERT_TRUE(result.is_ok()) << result.error().to_string();
+        offset += n;
+    }
+}
+
 }  // namespace
 
 TEST(MmapWriter, PersistsComputedChecksumInHeader) {
@@ -44,4 +66,83 @@ TEST(MmapWriter, PersistsComputedChecksumInHeader) {
     }));
 }
 
+TEST(MmapWriter, StreamingWritersMatchVectorWriters) {
+    namespace fs = std::filesystem;
+    const fs::path dir = fs::temp_directory_path() / "regimeflow_mmap_stream_test";
+    regimeflow::test::TempPathGuard guard(dir);
+    fs::create_directories(dir);
+
+    // Hourly rows over several UTC days so the date index has many entries.
+    const auto symbol = SymbolRegistry::instance().intern("STREAM");
+    constexpr int64_t kStart = 1'700'000'000'000'000LL;
+    constexpr int64_t kHour = 3'600'000'000LL;
+    std::vector<Bar> bars;
+    std::vector<Tick> ticks;
+    std::vector<OrderBook> books;
+    for (int i = 0; i < 100; ++i) {
+        const Timestamp ts(kStart + i * kHour);
+        const double px = 100.0 + i * 0.25;
+        bars.push_back(Bar{ts, symbol, px, px + 1.0, px - 1.0, px + 0.5, static_cast<uint64_t>(1000 + i)});
+        Tick tick;
+        tick.timestamp = ts;
+        tick.symbol = symbol;
+        tick.price = px;
+        tick.quantity = 1.0 + i;
+        tick.flags = static_cast<uint8_t>(i % 3);
+        ticks.push_back(tick);
+        OrderBook book;
+        book.timestamp = ts;
+        book.symbol = symbol;
+        for (size_t level = 0; level < book.bids.size(); ++level) {
+            book.bids[level] = {px - 0.01 * (level + 1), 10.0 + level, static_cast<int>(level + i)};
+            book.asks[level] = {px + 0.01 * (level + 1), 20.0 + level, static_cast<int>(level)};
+        }
+        books.push_back(book);
+    }
+
+    ASSERT_TRUE(MmapWriter().write_bars((dir / "bars.rfb").string(), "STREAM", BarType::Time_1Hour, bars).is_ok());
+    ASSERT_TRUE(TickMmapWriter().write_ticks((dir / "ticks.rft").string(), "STREAM", ticks).is_ok());
+    ASSERT_TRUE(OrderBookMmapWriter().write_books((dir / "books.rfob").string(), "STREAM", books).is_ok());
+
+    // 7 rows forces many spilled blocks; 1000 keeps everything in memory.
+    for (const size_t buffer_rows : {size_t{7}, size_t{1000}}) {
+        const auto tag = std::to_string(buffer_rows);
+        MmapWriter bar_writer;
+        ASSERT_TRUE(bar_writer.open((dir / ("bars" + tag)).string(), "STREAM", BarType::Time_1Hour,
+                                    buffer_rows).is_ok());
+        append_in_slices(bar_writer, bars);
+        ASSERT_TRUE(bar_writer.finalize().is_ok());
+        EXPECT_FALSE(bar_writer.is_open());
+        EXPECT_EQ(read_file(dir / ("bars" + tag)), read_file(dir / "bars.rfb")) << tag;
+
+        TickMmapWriter tick_writer;
+        ASSERT_TRUE(tick_writer.open((dir / ("ticks" + tag)).string(), "STREAM", buffer_rows).is_ok());
+        append_in_slices(tick_writer, ticks);
+        ASSERT_TRUE(tick_writer.finalize().is_ok());
+        EXPECT_EQ(read_file(dir / ("ticks" + tag)), read_file(dir / "ticks.rft")) << tag;
+
+        OrderBookMmapWriter book_writer;
+        ASSERT_TRUE(book_writer.open((dir / ("books" + tag)).string(), "STREAM", buffer_rows).is_ok());
+        append_in_slices(book_writer, books);
+        ASSERT_TRUE(book_writer.finalize().is_ok());
+        EXPECT_EQ(read_file(dir / ("books" + tag)), read_file(dir / "books.rfob")) << tag;
+    }
+    EXPECT_FALSE(fs::exists(dir / "bars7.spill"));
+
+    const MemoryMappedDataFile mapped((dir / "bars7").string());
+    EXPECT_EQ(mapped.bar_count(), bars.size());
+
+    // Out-of-order input fails the stream and removes the partial file.
+    MmapWriter bad;
+    ASSERT_TRUE(bad.open((dir / "bad.rfb").string(), "STREAM", BarType::Time_1Hour, 4).is_ok());
+    ASSERT_TRUE(bad.append(std::span<const Bar>(bars.data() + 10, 6)).is_ok());
+    const auto result = bad.append(std::span<const Bar>(bars.data(), 1));
+    ASSERT_TRUE(result.is_err());
+    EXPECT_EQ(result.error().message, "Bars must be sorted by timestamp");
+    EXPECT_FALSE(bad.is_open());
+    EXPECT_FALSE(fs::exists(dir / "bad.rfb"));
+    EXPECT_FALSE(fs::exists(dir / "bad.rfb.spill"));
+    EXPECT_TRUE(bad.finalize().is_err());
+}
+
 }  // namespace regimeflow::data
@@ -0,0 +1,139 @@
+#include "regimeflow/data/order_book_delta.h"
+#include "regimeflow/data/order_book_mmap.h"
+#include "regimeflow/data/order_book_mmap_data_source.h"
+#include "temp_path_guard.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <random>
+#include <vector>
+
+namespace regimeflow::data
+{
+namespace {
+
+constexpr int64_t kEpochUs = 1'600'000'000'000'000LL;
+
+// Each update touches one level, like an L2 feed; every 50th shifts the book.
+std::vector<OrderBook> make_books(const SymbolId symbol, const int count) {
+    std::mt19937_64 rng(3);
+    std::uniform_int_distribution<int> level(0, 19);
+    std::uniform_int_distribution<int> lots(1, 500);
+    std::vector<OrderBook> books;
+    OrderBook book;
+    book.symbol = symbol;
+    for (int i = 0; i < 10; ++i) {
+        book.bids[i] = {100.0 - 0.5 * (i + 1), 10.0 * (i + 1), i + 1};
+        book.asks[i] = {100.0 + 0.5 * (i + 1), 10.0 * (i + 1), i + 1};
+    }
+    int64_t ts = kEpochUs;
+    for (int n = 0; n < count; ++n) {
+        // Several updates can share a timestamp.
+        ts += (n % 3 == 0) ? 0 : 250;
+        book.timestamp = Timestamp(ts);
+        if (n % 50 == 49) {
+            for (auto& lvl : book.bids) lvl.price += 0.5;
+            for (auto& lvl : book.asks) lvl.price += 0.5;
+        } else {
+            const int slot = level(rng);
+            auto& lvl = slot < 10 ? book.bids[slot] : book.asks[slot - 10];
+            lvl.quantity = lots(rng) * 0.01;
+            lvl.num_orders = lots(rng) % 7;
+        }
+        books.push_back(book);
+    }
+    return books;
+}
+
+void expect_same_books(const std::vector<OrderBook>& actual, const std::vector<OrderBook>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(actual[i].timestamp, expected[i].timestamp) << i;
+        for (size_t l = 0; l < 10; ++l) {
+            EXPECT_EQ(actual[i].bids[l].price, expected[i].bids[l].price) << i;
+            EXPECT_EQ(actual[i].bids[l].quantity, expected[i].bids[l].quantity) << i;
+            EXPECT_EQ(actual[i].bids[l].num_orders, expected[i].bids[l].num_orders) << i;
+            EXPECT_EQ(actual[i].asks[l].price, expected[i].asks[l].price) << i;
+            EXPECT_EQ(actual[i].asks[l].quantity, expected[i].asks[l].quantity) << i;
+            EXPECT_EQ(actual[i].asks[l].num_orders, expected[i].asks[l].num_orders) << i;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(OrderBookDelta, ReplaysSnapshotsFromKeyframesAndDeltas) {
+    const auto dir = std::filesystem::temp_directory_path() / "regimeflow_book_delta_test";
+    regimeflow::test::TempPathGuard guard(dir);
+    std::filesystem::create_directories(dir);
+
+    const auto symbol = SymbolRegistry::instance().intern("BOOKD_A");
+    const auto books = make_books(symbol, 5000);
+    const auto full_path = (dir / "BOOKD_A.rfob").string();
+    const auto delta_path = (dir / "BOOKD_A.rfobd").string();
+    ASSERT_TRUE(OrderBookMmapWriter().write_books(full_path, "BOOKD_A", books).is_ok());
+    ASSERT_TRUE(OrderBookDeltaWriter(128).write_books(delta_path, "BOOKD_A", books).is_ok());
+
+    const auto full = std::make_shared<OrderBookMmapFile>(full_path);
+    const auto delta = std::make_shared<OrderBookDeltaFile>(delta_path);
+    EXPECT_EQ(delta->symbol_id(), symbol);
+    EXPECT_EQ(delta->book_count(), books.size());
+    EXPECT_EQ(delta->keyframes().size(), (books.size() + 127) / 128);
+    EXPECT_GE(std::filesystem::file_size(full_path), 10 * std::filesystem::file_size(delta_path));
+
+    const std::vector<TimeRange> ranges = {
+        {},
+        {books[1000].timestamp, books[3333].timestamp},
+        {books[128].timestamp, books[128].timestamp},
+        {Timestamp(books[255].timestamp.microseconds() + 1), books[700].timestamp},
+        {Timestamp(1), Timestamp(kEpochUs - 1)},
+        {books.back().timestamp, Timestamp(books.back().timestamp.microseconds() + 10)},
+    };
+    for (const auto& range : ranges) {
+        const auto [start, end] = full->find_range(range);
+        EXPECT_EQ(delta->find_range(range), std::make_pair(start, end));
+        OrderBookDeltaIterator iter(delta, range);
+        std::vector<OrderBook> actual;
+        while (iter.has_next()) {
+            actual.push_back(iter.next());
+            EXPECT_EQ(actual.back().symbol, symbol);
+        }
+        expect_same_books(actual, std::vector<OrderBook>(books.begin() + static_cast<std::ptrdiff_t>(start),
+                                                         books.begin() + static_cast<std::ptrdiff_t>(end)));
+        iter.reset();
+        if (start < end) {
+            EXPECT_EQ(iter.next().timestamp, books[start].timestamp);
+        }
+    }
+}
+
+TEST(OrderBookDelta, DataSourceFallsBackToDeltaFiles) {
+    const auto dir = std::filesystem::temp_directory_path() / "regimeflow_book_delta_source_test";
+    regimeflow::test::TempPathGuard guard(dir);
+    std::filesystem::create_directories(dir);
+
+    const auto symbol = SymbolRegistry::instance().intern("BOOKD_B");
+    const auto books = make_books(symbol, 600);
+    ASSERT_TRUE(OrderBookDeltaWriter().write_books((dir / "BOOKD_B.rfobd").string(), "BOOKD_B",
+                                                   books).is_ok());
+
+    OrderBookMmapDataSource::Config config;
+    config.data_directory = dir.string();
+    OrderBookMmapDataSource source(config);
+    ASSERT_EQ(source.get_available_symbols().size(), 1u);
+    EXPECT_EQ(source.get_available_range(symbol).end, books.back().timestamp);
+    const TimeRange range{books[10].timestamp, books[500].timestamp};
+    const auto loaded = source.get_order_books(symbol, range);
+    ASSERT_FALSE(loaded.empty());
+    EXPECT_EQ(loaded.front().timestamp, books[10].timestamp);
+    auto iter = source.create_book_iterator({symbol}, range);
+    size_t count = 0;
+    while (iter->has_next()) {
+        iter->next();
+        ++count;
+    }
+    EXPECT_EQ(count, loaded.size());
+}
+
+}  // namespace regimeflow::data
@@ -0,0 +1,136 @@
+#include "regimeflow/engine/order_archive.h"
+#include "regimeflow/engine/order_manager.h"
+#include "test_time.h"
+
+#include <gtest/gtest.h>
+
+using regimeflow::TimeRange;
+using regimeflow::engine::Fill;
+using regimeflow::engine::Order;
+using regimeflow::engine::OrderArchive;
+using regimeflow::engine::OrderManager;
+using regimeflow::engine::OrderSide;
+using regimeflow::engine::OrderStatus;
+
+namespace {
+
+Fill make_fill(const Order& order, const double quantity, const double price, const int64_t offset_us) {
+    Fill fill;
+    fill.order_id = order.id;
+    fill.symbol = order.symbol;
+    fill.quantity = quantity;
+    fill.price = price;
+    fill.timestamp = regimeflow::test::fixed_timestamp(offset_us);
+    fill.venue = "SIM";
+    return fill;
+}
+
+}  // namespace
+
+TEST(OrderManagerArchiveTest, TerminalOrdersLeaveHotSetButStayQueryable) {
+    OrderManager manager;
+    const auto symbol = regimeflow::SymbolRegistry::instance().intern("ARCH_A");
+    Order order = Order::limit(symbol, OrderSide::Buy, 10.0, 100.0);
+    order.strategy_id = "alpha";
+    order.metadata["tag"] = "entry";
+    const auto id = manager.submit_order(order).value();
+    order.id = id;
+    Order resting = Order::limit(symbol, OrderSide::Sell, 5.0, 110.0);
+    resting.strategy_id = "alpha";
+    const auto resting_id = manager.submit_order(resting).value();
+
+    manager.process_fill(make_fill(order, 4.0, 100.0, 1));
+    EXPECT_EQ(manager.open_order_count(), 2u);
+    EXPECT_EQ(manager.archived_order_count(), 0u);
+
+    manager.process_fill(make_fill(order, 6.0, 101.0, 2));
+    EXPECT_EQ(manager.open_order_count(), 1u);
+    EXPECT_EQ(manager.archived_order_count(), 1u);
+
+    const auto archived = manager.get_order(id);
+    ASSERT_TRUE(archived.has_value());
+    EXPECT_EQ(archived->status, OrderStatus::Filled);
+    EXPECT_DOUBLE_EQ(archived->filled_quantity, 10.0);
+    EXPECT_DOUBLE_EQ(archived->avg_fill_price, 100.6);
+    EXPECT_EQ(archived->strategy_id, "alpha");
+    EXPECT_EQ(archived->metadata.at("tag"), "entry");
+    EXPECT_EQ(manager.get_fills(id).size(), 2u);
+
+    const auto open = manager.get_open_orders(symbol);
+    ASSERT_EQ(open.size(), 1u);
+    EXPECT_EQ(open.front().id, resting_id);
+    EXPECT_EQ(manager.get_orders_by_strategy("alpha").size(), 2u);
+
+    const TimeRange range{regimeflow::test::fixed_timestamp(), regimeflow::test::fixed_timestamp(1)};
+    EXPECT_EQ(manager.get_fills(symbol, range).size(), 1u);
+
+    const auto cancel = manager.cancel_order(id);
+    ASSERT_TRUE(cancel.is_err());
+    EXPECT_EQ(cancel.error().code, regimeflow::Error::Code::InvalidState);
+    EXPECT_EQ(manager.cancel_order(999'999).error().code, regimeflow::Error::Code::NotFound);
+
+    ASSERT_TRUE(manager.cancel_order(resting_id).is_ok());
+    EXPECT_EQ(manager.open_order_count(), 0u);
+    EXPECT_TRUE(manager.get_open_orders().empty());
+    EXPECT_EQ(manager.get_orders_by_strategy("alpha").size(), 2u);
+}
+
+TEST(OrderManagerArchiveTest, LateStatusUpdateRevivesArchivedOrder) {
+    OrderManager manager(OrderManager::Mode::SingleThreaded);
+    EXPECT_EQ(manager.mode(), OrderManager::Mode::SingleThreaded);
+    const auto symbol = regimeflow::SymbolRegistry::instance().intern("ARCH_B");
+    Order order = Order::market(symbol, OrderSide::Buy, 3.0);
+    const auto id = manager.submit_order(order).value();
+    order.id = id;
+    manager.process_fill(make_fill(order, 3.0, 50.0, 0));
+    ASSERT_EQ(manager.archived_order_count(), 1u);
+
+    ASSERT_TRUE(manager.update_order_status(id, OrderStatus::Pending).is_ok());
+    EXPECT_EQ(manager.archived_order_count(), 0u);
+    ASSERT_EQ(manager.get_open_orders(symbol).size(), 1u);
+    EXPECT_EQ(manager.get_fills(id).size(), 1u);
+
+    ASSERT_TRUE(manager.update_order_status(id, OrderStatus::Cancelled).is_ok());
+    EXPECT_EQ(manager.archived_order_count(), 1u);
+    EXPECT_EQ(manager.get_order(id)->status, OrderStatus::Cancelled);
+    EXPECT_EQ(manager.get_fills(id).size(), 1u);
+}
+
+TEST(OrderManagerArchiveTest, ArchiveCompactsRetiredRecords) {
+    OrderArchive archive;
+    const auto symbol = regimeflow::SymbolRegistry::instance().intern("ARCH_C");
+    Order keep = Order::limit(symbol, OrderSide::Buy, 1.0, 10.0);
+    keep.id = 1;
+    keep.strategy_id = "keep";
+    keep.metadata["tag"] = "kept";
+    const Fill kept_fill = make_fill(keep, 1.0, 10.0, 5);
+    archive.append(keep, std::span<const Fill>(&kept_fill, 1));
+
+    // Revive and re-archive one order over and over, as late updates do.
+    Order churn = Order::market(symbol, OrderSide::Sell, 2.0);
+    churn.id = 2;
+    churn.strategy_id = "churn";
+    std::vector<Fill> fills{make_fill(churn, 2.0, 11.0, 7)};
+    for (int i = 0; i < 5000; ++i) {
+        archive.append(churn, fills);
+        ASSERT_TRUE(archive.take(churn.id, fills).has_value());
+    }
+    archive.append(churn, fills);
+
+    EXPECT_EQ(archive.size(), 2u);
+    EXPECT_EQ(archive.fill_count(), 2u);
+    EXPECT_LT(archive.record_count(), 1100u);
+
+    const auto found = archive.find(keep.id);
+    ASSERT_TRUE(found.has_value());
+    EXPECT_EQ(found->metadata.at("tag"), "kept");
+    EXPECT_EQ(archive.fills(keep.id).front().price, 10.0);
+    std::vector<Order> orders;
+    archive.collect_by_strategy("churn", orders);
+    ASSERT_EQ(orders.size(), 1u);
+    EXPECT_EQ(orders.front().id, churn.id);
+    std::vector<Fill> symbol_fills;
+    archive.collect_fills(symbol, TimeRange{regimeflow::test::fixed_timestamp(), regimeflow::test::fixed_timestamp(10)},
+                          symbol_fills);
+    EXPECT_EQ(symbol_fills.size(), 2u);
+}
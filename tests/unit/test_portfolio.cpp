@@ -3,6 +3,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 using regimeflow::SymbolRegistry;
 using regimeflow::engine::Fill;
 using regimeflow::engine::MarginProfile;
@@ -60,3 +62,76 @@ TEST(PortfolioTest, SnapshotCarriesMarginFieldsAndStopOutState) {
     EXPECT_TRUE(snapshot.margin_call);
     EXPECT_TRUE(snapshot.stop_out);
 }
+
+TEST(PortfolioTest, EquityStoreRebuildsDeltaEncodedSnapshots) {
+    Portfolio portfolio(100000.0);
+    const auto held = SymbolRegistry::instance().intern("EQ_HELD");
+    const auto closed = SymbolRegistry::instance().intern("EQ_CLOSED");
+    const auto start = regimeflow::test::fixed_timestamp();
+
+    Fill fill;
+    fill.symbol = held;
+    fill.quantity = 10.0;
+    fill.price = 50.0;
+    fill.timestamp = start;
+    portfolio.update_position(fill);
+    fill.symbol = closed;
+    portfolio.update_position(fill);
+
+    std::vector<regimeflow::engine::PortfolioSnapshot> expected;
+    for (int i = 0; i < 600; ++i) {
+        const auto ts = start + regimeflow::Duration::seconds(i);
+        portfolio.mark_to_market(held, 50.0 + i * 0.01, ts);
+        if (i == 300) {
+            fill.symbol = closed;
+            fill.quantity = -10.0;
+            fill.timestamp = ts;
+            portfolio.update_position(fill);
+        }
+        portfolio.record_snapshot(ts);
+        expected.push_back(portfolio.snapshot(ts));
+    }
+
+    const auto& store = portfolio.equity_store();
+    ASSERT_EQ(store.size(), expected.size());
+    const auto curve = portfolio.equity_curve();
+    ASSERT_EQ(curve.size(), expected.size());
+    for (const size_t i : {size_t{0}, size_t{255}, size_t{256}, size_t{300}, size_t{599}}) {
+        for (const auto& rebuilt : {curve[i], store.snapshot(i)}) {
+            EXPECT_EQ(rebuilt.timestamp, expected[i].timestamp);
+            EXPECT_DOUBLE_EQ(rebuilt.equity, expected[i].equity);
+            EXPECT_DOUBLE_EQ(rebuilt.cash, expected[i].cash);
+            ASSERT_EQ(rebuilt.positions.size(), expected[i].positions.size());
+            for (const auto& [symbol, position] : expected[i].positions) {
+                ASSERT_TRUE(rebuilt.positions.contains(symbol));
+                EXPECT_DOUBLE_EQ(rebuilt.positions.at(symbol).quantity, position.quantity);
+                EXPECT_DOUBLE_EQ(rebuilt.positions.at(symbol).current_price, position.current_price);
+            }
+        }
+    }
+    EXPECT_DOUBLE_EQ(store.equities().back(), expected.back().equity);
+}
+
+TEST(PortfolioTest, EquityStoreEndOfDaySamplingKeepsLastRowPerDay) {
+    Portfolio portfolio(1000.0);
+    regimeflow::engine::EquitySamplingConfig sampling;
+    sampling.mode = regimeflow::engine::EquitySampling::EndOfDay;
+    portfolio.set_equity_sampling(sampling);
+
+    constexpr int64_t kDayUs = 86'400'000'000LL;
+    const auto day = regimeflow::Timestamp(regimeflow::test::kFixedTimestampUs / kDayUs * kDayUs);
+    for (int hour = 0; hour < 3; ++hour) {
+        portfolio.set_cash(1000.0 + hour, day + regimeflow::Duration::hours(hour));
+        portfolio.record_snapshot(day + regimeflow::Duration::hours(hour));
+    }
+    const auto next_day = day + regimeflow::Duration::days(1);
+    portfolio.record_snapshot(next_day);
+    portfolio.adjust_cash(5.0, next_day + regimeflow::Duration::hours(1));
+
+    const auto& store = portfolio.equity_store();
+    ASSERT_EQ(store.size(), 2u);
+    EXPECT_EQ(store.timestamps()[0], day + regimeflow::Duration::hours(2));
+    EXPECT_DOUBLE_EQ(store.cash()[0], 1002.0);
+    EXPECT_EQ(store.timestamps()[1], next_day + regimeflow::Duration::hours(1));
+    EXPECT_DOUBLE_EQ(store.cash()[1], 1007.0);
+}
@@ -0,0 +1,151 @@
+#include "regimeflow/common/sharded_cache.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using regimeflow::CacheEviction;
+using regimeflow::ShardedCache;
+
+namespace {
+
+using IntCache = ShardedCache<int, int>;
+
+IntCache::Options single_shard(const size_t max_entries, const CacheEviction eviction) {
+    IntCache::Options options;
+    options.max_entries = max_entries;
+    options.shards = 1;
+    options.eviction = eviction;
+    return options;
+}
+
+}  // namespace
+
+TEST(ShardedCache, LruEvictsLeastRecentlyUsed) {
+    IntCache cache(single_shard(2, CacheEviction::Lru));
+    cache.put(1, 10);
+    cache.put(2, 20);
+    ASSERT_EQ(cache.get(1), 10);
+    cache.put(3, 30);
+
+    EXPECT_FALSE(cache.get(2).has_value());
+    EXPECT_EQ(cache.get(1), 10);
+    EXPECT_EQ(cache.get(3), 30);
+    EXPECT_EQ(cache.size(), 2U);
+
+    cache.put(1, 11);
+    EXPECT_EQ(cache.get(1), 11);
+    EXPECT_EQ(cache.size(), 2U);
+
+    const auto stats = cache.stats();
+    EXPECT_EQ(stats.hits, 4U);
+    EXPECT_EQ(stats.misses, 1U);
+    EXPECT_EQ(stats.evictions, 1U);
+}
+
+TEST(ShardedCache, ClockGivesReferencedEntriesASecondChance) {
+    IntCache cache(single_shard(3, CacheEviction::Clock));
+    cache.put(1, 10);
+    cache.put(2, 20);
+    cache.put(3, 30);
+    ASSERT_TRUE(cache.get(1).has_value());
+    ASSERT_TRUE(cache.get(3).has_value());
+
+    // 1 and 3 are referenced, so the sweep clears them and takes 2.
+    cache.put(4, 40);
+    EXPECT_FALSE(cache.get(2).has_value());
+    EXPECT_TRUE(cache.get(1).has_value());
+    EXPECT_TRUE(cache.get(3).has_value());
+    EXPECT_TRUE(cache.get(4).has_value());
+
+    // With every entry referenced, one full sweep still finds a victim.
+    cache.put(5, 50);
+    EXPECT_EQ(cache.size(), 3U);
+    EXPECT_TRUE(cache.get(5).has_value());
+}
+
+TEST(ShardedCache, WeightBudgetEvictsAndRejectsOversizedEntries) {
+    using StringCache = ShardedCache<int, std::string>;
+    StringCache::Options options;
+    options.max_weight = 10;
+    options.shards = 1;
+    StringCache cache(options, [](const int, const std::string& value) { return value.size(); });
+
+    cache.put(1, "aaaa");
+    cache.put(2, "bbbb");
+    EXPECT_EQ(cache.weight(), 8U);
+    cache.put(3, "cccc");
+    EXPECT_EQ(cache.weight(), 8U);
+    EXPECT_FALSE(cache.get(1).has_value());
+
+    cache.put(4, std::string(11, 'x'));
+    EXPECT_FALSE(cache.get(4).has_value());
+    EXPECT_EQ(cache.size(), 2U);
+
+    // Growing an entry in place evicts others to make room.
+    cache.put(3, std::string(9, 'c'));
+    EXPECT_EQ(cache.get(3), std::string(9, 'c'));
+    EXPECT_FALSE(cache.get(2).has_value());
+    EXPECT_EQ(cache.weight(), 9U);
+
+    EXPECT_TRUE(cache.erase(3));
+    EXPECT_FALSE(cache.erase(3));
+    EXPECT_EQ(cache.weight(), 0U);
+}
+
+TEST(ShardedCache, LimitsAreSplitAcrossShardsAndZeroDisables) {
+    IntCache::Options options;
+    options.max_entries = 5;
+    options.shards = 16;
+    IntCache cache(options);
+    for (int i = 0; i < 100; ++i) {
+        cache.put(i, i);
+    }
+    EXPECT_LE(cache.size(), 5U);
+    EXPECT_GT(cache.size(), 0U);
+
+    IntCache disabled(IntCache::Options{});
+    EXPECT_FALSE(disabled.enabled());
+    disabled.put(1, 1);
+    EXPECT_FALSE(disabled.get(1).has_value());
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0U);
+}
+
+TEST(ShardedCache, ConcurrentReadersAndWritersStayWithinBudget) {
+    for (const auto eviction : {CacheEviction::Lru, CacheEviction::Clock}) {
+        IntCache::Options options;
+        options.max_entries = 64;
+        options.shards = 8;
+        options.eviction = eviction;
+        IntCache cache(options);
+
+        std::atomic<bool> wrong{false};
+        std::vector<std::thread> workers;
+        for (int t = 0; t < 4; ++t) {
+            workers.emplace_back([&cache, &wrong, t] {
+                for (int i = 0; i < 20'000; ++i) {
+                    const int key = (i * 7 + t) % 256;
+                    if (const auto value = cache.get(key)) {
+                        if (*value != key * 3) {
+                            wrong = true;
+                        }
+                    } else {
+                        cache.put(key, key * 3);
+                    }
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        EXPECT_FALSE(wrong.load());
+        EXPECT_LE(cache.size(), 64U);
+        const auto stats = cache.stats();
+        EXPECT_EQ(stats.hits + stats.misses, 80'000U);
+    }
+}
@@ -1,11 +1,37 @@
 #include <gtest/gtest.h>
 
+#include "regimeflow/data/db_source.h"
 #include "regimeflow/data/memory_data_source.h"
 #include "regimeflow/data/snapshot_access.h"
 #include "regimeflow/data/time_series_query.h"
 
+#include <vector>
+
 namespace regimeflow::test
 {
+    namespace {
+
+        std::vector<regimeflow::data::Bar> make_bars(const regimeflow::SymbolId symbol,
+                                                     const std::vector<int64_t>& times) {
+            std::vector<regimeflow::data::Bar> bars;
+            for (size_t i = 0; i < times.size(); ++i) {
+                const double px = 10.0 + static_cast<double>(i);
+                bars.push_back({regimeflow::Timestamp(times[i]), symbol, px, px + 1.0, px - 1.0, px,
+                                static_cast<regimeflow::Volume>(100 + i)});
+            }
+            return bars;
+        }
+
+        std::vector<int64_t> probes_around(const std::vector<int64_t>& times) {
+            std::vector<int64_t> probes{1};
+            for (const auto t : times) {
+                probes.insert(probes.end(), {t - 1, t, t + 1});
+            }
+            return probes;
+        }
+
+    }  // namespace
+
     TEST(SnapshotAccess, ReturnsLatestOrderBookAtTimestamp) {
         auto source = std::make_shared<regimeflow::data::MemoryDataSource>();
         auto symbol = regimeflow::SymbolRegistry::instance().intern("AAA");
@@ -57,4 +83,92 @@ namespace regimeflow::test
         ASSERT_EQ(books.size(), 1u);
         EXPECT_EQ(books[0].timestamp.microseconds(), 100);
     }
+
+    TEST(SnapshotAccess, AsOfLookupsMatchRangeQueries) {
+        auto source = std::make_shared<regimeflow::data::MemoryDataSource>();
+        const auto symbol = regimeflow::SymbolRegistry::instance().intern("ASOF_MEM");
+        const std::vector<int64_t> times{100, 200, 200, 350, 1000};
+        source->add_bars(symbol, make_bars(symbol, times));
+
+        std::vector<regimeflow::data::Tick> ticks;
+        for (const auto t : times) {
+            ticks.push_back({regimeflow::Timestamp(t), symbol, static_cast<double>(t), 1.0, 0});
+        }
+        source->add_ticks(symbol, ticks);
+
+        regimeflow::data::SnapshotAccess snapshot(source);
+        // Probe forwards, then backwards, so both cache hits and misses are exercised.
+        auto probes = probes_around(times);
+        probes.insert(probes.end(), probes.rbegin(), probes.rend());
+        for (const auto probe : probes) {
+            const regimeflow::Timestamp ts(probe);
+            const auto expected_bar = source->DataSource::get_bar_as_of(symbol, ts);
+            const auto bar = snapshot.bar_at(symbol, ts, regimeflow::data::BarType::Time_1Day);
+            ASSERT_EQ(bar.has_value(), expected_bar.has_value()) << probe;
+            if (bar) {
+                EXPECT_EQ(bar->timestamp, expected_bar->timestamp) << probe;
+                EXPECT_DOUBLE_EQ(bar->close, expected_bar->close) << probe;
+            }
+            const auto expected_tick = source->DataSource::get_tick_as_of(symbol, ts);
+            const auto tick = snapshot.tick_at(symbol, ts);
+            ASSERT_EQ(tick.has_value(), expected_tick.has_value()) << probe;
+            if (tick) {
+                EXPECT_DOUBLE_EQ(tick->price, expected_tick->price) << probe;
+            }
+        }
+
+        // Adding data must not leave a stale answer in the cache.
+        ASSERT_EQ(snapshot.bar_at(symbol, regimeflow::Timestamp(600), regimeflow::data::BarType::Time_1Day)->timestamp.microseconds(), 350);
+        source->add_bars(symbol, make_bars(symbol, {500}));
+        EXPECT_EQ(snapshot.bar_at(symbol, regimeflow::Timestamp(600), regimeflow::data::BarType::Time_1Day)->timestamp.microseconds(), 500);
+
+        regimeflow::data::TimeSeriesQuery query(source);
+        const std::vector<regimeflow::Timestamp> samples{regimeflow::Timestamp(50), regimeflow::Timestamp(250),
+                                                         regimeflow::Timestamp(5000)};
+        const auto sampled = query.bars_as_of(symbol, samples, regimeflow::data::BarType::Time_1Day);
+        ASSERT_EQ(sampled.size(), 3u);
+        EXPECT_FALSE(sampled[0].has_value());
+        ASSERT_TRUE(sampled[1].has_value());
+        EXPECT_EQ(sampled[1]->timestamp.microseconds(), 200);
+        ASSERT_TRUE(sampled[2].has_value());
+        EXPECT_EQ(sampled[2]->timestamp.microseconds(), 1000);
+    }
+
+    TEST(SnapshotAccess, DatabaseAsOfMatchesValidatedHistory) {
+        const auto symbol = regimeflow::SymbolRegistry::instance().intern("ASOF_DB");
+        const std::vector<int64_t> times{100, 200, 300, 400};
+        auto bars = make_bars(symbol, times);
+        bars[3].high = bars[3].low - 1.0;  // Rejected by the price bounds check.
+        auto client = std::make_shared<regimeflow::data::InMemoryDbClient>();
+        client->add_bars(symbol, bars);
+
+        regimeflow::data::DatabaseDataSource::Config row_local;
+        row_local.connection_string = "memory";
+        row_local.validation.on_error = regimeflow::data::ValidationAction::Skip;
+        regimeflow::data::DatabaseDataSource::Config history = row_local;
+        history.validation.check_gap = true;
+        history.validation.max_gap = regimeflow::Duration::microseconds(50);
+        history.validation.on_gap = regimeflow::data::ValidationAction::Skip;
+
+        for (const auto& config : {row_local, history}) {
+            regimeflow::data::DatabaseDataSource source(config);
+            source.set_client(client);
+            for (const auto probe : probes_around({100, 200, 300, 400, 900})) {
+                const regimeflow::Timestamp ts(probe);
+                const auto expected = source.DataSource::get_bar_as_of(symbol, ts);
+                const auto bar = source.get_bar_as_of(symbol, ts);
+                ASSERT_EQ(bar.has_value(), expected.has_value()) << probe;
+                if (bar) {
+                    EXPECT_EQ(bar->timestamp, expected->timestamp) << probe;
+                }
+            }
+        }
+
+        // A rejected latest row falls back to the last row the history keeps.
+        regimeflow::data::DatabaseDataSource source(row_local);
+        source.set_client(client);
+        const auto bar = source.get_bar_as_of(symbol, regimeflow::Timestamp(450));
+        ASSERT_TRUE(bar.has_value());
+        EXPECT_EQ(bar->timestamp.microseconds(), 300);
+    }
 }  // namespace regimeflow::test
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include "regimeflow/engine/backtest_engine.h"
+#include "regimeflow/engine/stage_profiler.h"
+#include "regimeflow/data/data_source_factory.h"
+#include "regimeflow/strategy/strategy.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <thread>
+
+namespace regimeflow::test
+{
+    namespace {
+        class BarCountingStrategy final : public strategy::Strategy {
+        public:
+            void initialize(strategy::StrategyContext&) override {}
+            void on_bar(const data::Bar&) override { ++bars_; }
+            [[nodiscard]] int bars() const { return bars_; }
+
+        private:
+            int bars_ = 0;
+        };
+
+        const engine::StageStats* find_stage(const std::vector<engine::StageStats>& stats,
+                                             const std::string& name) {
+            const auto it = std::ranges::find(stats, name, &engine::StageStats::stage);
+            return it == stats.end() ? nullptr : &*it;
+        }
+
+        engine::BacktestResults run_fixture(const bool profile, int& bars) {
+            engine::BacktestEngine engine(100000.0);
+            engine.set_stage_profiling(profile);
+
+            Config data_cfg;
+            data_cfg.set("type", "csv");
+            data_cfg.set("file_pattern", "{symbol}.csv");
+            data_cfg.set("has_header", true);
+            data_cfg.set("data_directory",
+                         (std::filesystem::path(REGIMEFLOW_TEST_ROOT) / "tests/fixtures").string());
+            const auto source = data::DataSourceFactory::create(data_cfg);
+            const std::vector<SymbolId> symbols = {SymbolRegistry::instance().intern("TEST")};
+            TimeRange range;
+            range.start = Timestamp::from_string("2020-01-01 00:00:00", "%Y-%m-%d %H:%M:%S");
+            range.end = Timestamp::from_string("2020-01-03 00:00:00", "%Y-%m-%d %H:%M:%S");
+            engine.load_data(source->create_iterator(symbols, range, data::BarType::Time_1Day),
+                             source->create_tick_iterator(symbols, range),
+                             source->create_book_iterator(symbols, range));
+
+            auto strategy = std::make_unique<BarCountingStrategy>();
+            const auto* strategy_ptr = strategy.get();
+            engine.set_strategy(std::move(strategy));
+            engine.run();
+            bars = strategy_ptr->bars();
+            return engine.results();
+        }
+    }  // namespace
+
+    TEST(StageProfiler, DisabledScopesRecordNothing) {
+        engine::StageProfiler profiler;
+        {
+            const auto scope = profiler.scope(engine::EngineStage::Strategy);
+        }
+        EXPECT_TRUE(profiler.stats().empty());
+    }
+
+    TEST(StageProfiler, NestedScopesChargeSelfTime) {
+        engine::StageProfiler profiler;
+        profiler.set_enabled(true);
+        {
+            const auto outer = profiler.scope(engine::EngineStage::Strategy);
+            const auto inner = profiler.scope(engine::EngineStage::RiskValidation);
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        const auto stats = profiler.stats();
+        const auto* strategy = find_stage(stats, "strategy");
+        const auto* risk = find_stage(stats, "risk_validation");
+        ASSERT_NE(strategy, nullptr);
+        ASSERT_NE(risk, nullptr);
+        EXPECT_EQ(strategy->calls, 1u);
+        EXPECT_EQ(risk->calls, 1u);
+        EXPECT_GE(risk->total_ns, 5'000'000);
+        EXPECT_LT(strategy->total_ns, risk->total_ns);
+    }
+
+    TEST(StageProfiler, HistogramUsesLog2Buckets) {
+        engine::StageProfiler profiler;
+        profiler.record(engine::EngineStage::Metrics, 0);
+        profiler.record(engine::EngineStage::Metrics, 1);
+        profiler.record(engine::EngineStage::Metrics, 1000);
+        profiler.record(engine::EngineStage::Metrics, 1023);
+        const auto stats = profiler.stats();
+        ASSERT_EQ(stats.size(), 1u);
+        const auto& metrics = stats.front();
+        EXPECT_EQ(metrics.stage, "metrics");
+        EXPECT_EQ(metrics.calls, 4u);
+        EXPECT_EQ(metrics.total_ns, 2024);
+        EXPECT_EQ(metrics.max_ns, 1023);
+        EXPECT_EQ(metrics.histogram[0], 1u);
+        EXPECT_EQ(metrics.histogram[1], 1u);
+        EXPECT_EQ(metrics.histogram[10], 2u);
+        EXPECT_EQ(metrics.percentile_ns(0.25), 0);
+        EXPECT_EQ(metrics.percentile_ns(0.5), 1);
+        EXPECT_EQ(metrics.percentile_ns(0.99), 1023);
+        EXPECT_DOUBLE_EQ(metrics.mean_ns(), 506.0);
+
+        profiler.reset();
+        EXPECT_TRUE(profiler.stats().empty());
+    }
+
+    TEST(StageProfiler, EngineReportsStagesInResults) {
+        int bars = 0;
+        const auto results = run_fixture(true, bars);
+        ASSERT_GT(bars, 0);
+        const auto* strategy = find_stage(results.stage_profile, "strategy");
+        ASSERT_NE(strategy, nullptr);
+        EXPECT_EQ(strategy->calls, static_cast<uint64_t>(bars));
+        EXPECT_NE(find_stage(results.stage_profile, "hooks"), nullptr);
+        EXPECT_NE(find_stage(results.stage_profile, "metrics"), nullptr);
+        EXPECT_NE(find_stage(results.stage_profile, "audit_journal"), nullptr);
+        EXPECT_NE(results.dashboard_snapshot_json().find("\"stage\":\"strategy\""), std::string::npos);
+
+        const auto unprofiled = run_fixture(false, bars);
+        EXPECT_TRUE(unprofiled.stage_profile.empty());
+        EXPECT_NE(unprofiled.dashboard_snapshot_json().find("\"stage_profile\":[]"), std::string::npos);
+    }
+}  // namespace regimeflow::test
@@ -0,0 +1,95 @@
+#include "regimeflow/common/symbol_table.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using regimeflow::SymbolId;
+using regimeflow::SymbolSet;
+using regimeflow::SymbolTable;
+
+TEST(SymbolSet, InsertEraseAndIterateInIdOrder) {
+    SymbolSet set;
+    EXPECT_TRUE(set.insert(130));
+    EXPECT_TRUE(set.insert(3));
+    EXPECT_FALSE(set.insert(3));
+    EXPECT_TRUE(set.emplace(64));
+    EXPECT_EQ(set.size(), 3U);
+    EXPECT_TRUE(set.contains(64));
+    EXPECT_FALSE(set.contains(65));
+    EXPECT_FALSE(set.contains(100000));
+
+    std::vector<SymbolId> seen;
+    set.for_each([&](const SymbolId symbol) { seen.push_back(symbol); });
+    EXPECT_EQ(seen, (std::vector<SymbolId>{3, 64, 130}));
+
+    EXPECT_EQ(set.erase(64), 1U);
+    EXPECT_EQ(set.erase(64), 0U);
+    EXPECT_EQ(set.erase(100000), 0U);
+    EXPECT_EQ(set.size(), 2U);
+
+    set.clear();
+    EXPECT_TRUE(set.empty());
+    EXPECT_FALSE(set.contains(3));
+}
+
+TEST(SymbolTable, BehavesLikeAMap) {
+    SymbolTable<std::string> table;
+    EXPECT_EQ(table.find(7), nullptr);
+
+    table[7] = "seven";
+    table.insert_or_assign(2, "two");
+    table[7] += "!";
+    ASSERT_NE(table.find(7), nullptr);
+    EXPECT_EQ(*table.find(7), "seven!");
+    EXPECT_TRUE(table.contains(2));
+    EXPECT_EQ(table.size(), 2U);
+
+    std::vector<std::pair<SymbolId, std::string>> entries;
+    for (const auto& [symbol, value] : table) {
+        entries.emplace_back(symbol, value);
+    }
+    ASSERT_EQ(entries.size(), 2U);
+    EXPECT_EQ(entries[0].first, 2U);
+    EXPECT_EQ(entries[1].second, "seven!");
+
+    EXPECT_EQ(table.erase(2), 1U);
+    EXPECT_EQ(table.erase(2), 0U);
+    EXPECT_FALSE(table.contains(2));
+
+    // Re-inserting an erased slot starts from a default value.
+    EXPECT_TRUE(table[2].empty());
+
+    table.clear();
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.begin(), table.end());
+    EXPECT_TRUE(table[7].empty());
+}
+
+TEST(SymbolTable, IteratesSparseIdsAcrossWords) {
+    SymbolSet set;
+    set.insert(5);
+    set.insert(63);
+    set.insert(64);
+    set.insert(1000);
+    EXPECT_EQ(set.next(0, 9999), 5U);
+    EXPECT_EQ(set.next(6, 9999), 63U);
+    EXPECT_EQ(set.next(64, 9999), 64U);
+    EXPECT_EQ(set.next(65, 9999), 1000U);
+    EXPECT_EQ(set.next(1001, 9999), 9999U);
+    EXPECT_EQ(set.next(100000, 9999), 9999U);
+
+    SymbolTable<int> table;
+    table[10'000] = 1;
+    table[3] = 2;
+    table[130] = 3;
+    table.erase(10'000);
+    table[9'999] = 4;
+    std::vector<SymbolId> seen;
+    for (const auto& entry : std::as_const(table)) {
+        seen.push_back(entry.first);
+    }
+    EXPECT_EQ(seen, (std::vector<SymbolId>{3, 130, 9'999}));
+}
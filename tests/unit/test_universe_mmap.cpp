@@ -0,0 +1,177 @@
+#include "regimeflow/data/mmap_data_source.h"
+#include "regimeflow/data/mmap_writer.h"
+#include "regimeflow/data/universe_mmap.h"
+#include "regimeflow/data/universe_mmap_data_source.h"
+#include "temp_path_guard.h"
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+namespace regimeflow::data
+{
+namespace {
+
+constexpr int64_t kHourUs = 3'600'000'000LL;
+constexpr int64_t kEpochUs = 1'600'000'000'000'000LL;
+
+std::vector<Bar> make_hourly_bars(const SymbolId symbol, const int count, const int64_t first_hour,
+                                  const double base) {
+    std::vector<Bar> bars;
+    for (int i = 0; i < count; ++i) {
+        const double px = base + i;
+        bars.push_back(Bar{Timestamp(kEpochUs + (first_hour + i) * kHourUs), symbol, px, px + 1.0,
+                           px - 1.0, px, static_cast<Volume>(100 + i)});
+    }
+    return bars;
+}
+
+void expect_same_bars(const std::vector<Bar>& actual, const std::vector<Bar>& expected) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < actual.size(); ++i) {
+        EXPECT_EQ(actual[i].timestamp, expected[i].timestamp);
+        EXPECT_EQ(actual[i].symbol, expected[i].symbol);
+        EXPECT_DOUBLE_EQ(actual[i].open, expected[i].open);
+        EXPECT_DOUBLE_EQ(actual[i].close, expected[i].close);
+        EXPECT_EQ(actual[i].volume, expected[i].volume);
+    }
+}
+
+}  // namespace
+
+TEST(UniverseMmap, PartitionsByDayAndServesSymbolSubsets) {
+    const auto dir = std::filesystem::temp_directory_path() / "regimeflow_universe_mmap_test";
+    regimeflow::test::TempPathGuard guard(dir);
+    std::filesystem::create_directories(dir);
+
+    const auto a = SymbolRegistry::instance().intern("UNIV_A");
+    const auto b = SymbolRegistry::instance().intern("UNIV_B");
+    const auto c = SymbolRegistry::instance().intern("UNIV_C");
+    const auto bars_a = make_hourly_bars(a, 80, 0, 100.0);
+    const auto bars_b = make_hourly_bars(b, 30, 40, 50.0);
+    const auto bars_c = make_hourly_bars(c, 5, 100, 10.0);
+
+    UniverseMmapWriter writer(BarType::Time_1Hour);
+    ASSERT_TRUE(writer.add_bars("UNIV_B", bars_b).is_ok());
+    ASSERT_TRUE(writer.add_bars("UNIV_A", bars_a).is_ok());
+    ASSERT_TRUE(writer.add_bars("UNIV_C", bars_c).is_ok());
+    EXPECT_TRUE(writer.add_bars("UNIV_A", bars_a).is_err());
+    const auto path = (dir / "universe_1h.rfu").string();
+    ASSERT_TRUE(writer.write(path).is_ok());
+
+    UniverseMmapFile file(path);
+    ASSERT_EQ(file.symbols().size(), 3u);
+    EXPECT_EQ(file.symbol_ids()[0], a);
+    EXPECT_EQ(file.symbol_ids()[2], c);
+    EXPECT_EQ(file.header().bar_count, 115u);
+    ASSERT_GE(file.partitions().size(), 5u);
+    for (size_t p = 1; p < file.partitions().size(); ++p) {
+        EXPECT_LT(file.partitions()[p - 1].day, file.partitions()[p].day);
+    }
+    EXPECT_FALSE(file.find_slice(0, 2).has_value());
+
+    UniverseMmapDataSource source({path});
+    EXPECT_EQ(source.get_available_symbols().size(), 3u);
+    EXPECT_EQ(source.get_available_range(b).start, bars_b.front().timestamp);
+    expect_same_bars(source.get_bars(a, {}, BarType::Time_1Hour), bars_a);
+    expect_same_bars(source.get_bars(c, {}, BarType::Time_1Hour), bars_c);
+    EXPECT_TRUE(source.get_bars(a, {}, BarType::Time_1Day).empty());
+
+    const TimeRange range{bars_a[30].timestamp, bars_a[60].timestamp};
+    const std::vector<Bar> expected_a(bars_a.begin() + 30, bars_a.begin() + 61);
+    expect_same_bars(source.get_bars(a, range, BarType::Time_1Hour), expected_a);
+
+    auto iter = source.create_iterator({a, b}, range, BarType::Time_1Hour);
+    size_t count = 0;
+    Timestamp last;
+    while (iter->has_next()) {
+        const Bar bar = iter->next();
+        EXPECT_NE(bar.symbol, c);
+        EXPECT_GE(bar.timestamp, last);
+        last = bar.timestamp;
+        ++count;
+    }
+    EXPECT_EQ(count, 31u + 21u);
+}
+
+TEST(UniverseMmap, MatchesPerSymbolFilesWithAdjustments) {
+    const auto dir = std::filesystem::temp_directory_path() / "regimeflow_universe_mmap_adj_test";
+    regimeflow::test::TempPathGuard guard(dir);
+    std::filesystem::create_directories(dir);
+
+    const auto a = SymbolRegistry::instance().intern("UNIVADJ_A");
+    const auto bars = make_hourly_bars(a, 72, 0, 100.0);
+    MmapWriter file_writer;
+    ASSERT_TRUE(file_writer.write_bars((dir / "UNIVADJ_A_1h.rfb").string(), "UNIVADJ_A",
+                                       BarType::Time_1Hour, bars).is_ok());
+    UniverseMmapWriter universe_writer(BarType::Time_1Hour);
+    ASSERT_TRUE(universe_writer.add_bars("UNIVADJ_A", bars).is_ok());
+    const auto path = (dir / "universe_1h.rfu").string();
+    ASSERT_TRUE(universe_writer.write(path).is_ok());
+
+    CorporateAction split;
+    split.type = CorporateActionType::Split;
+    split.effective_date = bars[36].timestamp;
+    split.factor = 2.0;
+
+    MemoryMappedDataSource::Config files_config;
+    files_config.data_directory = dir.string();
+    MemoryMappedDataSource files(files_config);
+    files.set_corporate_actions(a, {split});
+    UniverseMmapDataSource universe({path});
+    universe.set_corporate_actions(a, {split});
+
+    const TimeRange range{bars[10].timestamp, bars[50].timestamp};
+    const auto expected = files.get_bars(a, range, BarType::Time_1Hour);
+    const auto actual = universe.get_bars(a, range, BarType::Time_1Hour);
+    expect_same_bars(actual, expected);
+    ASSERT_FALSE(actual.empty());
+    EXPECT_DOUBLE_EQ(actual.front().close, bars[10].close / 2.0);
+}
+
+TEST(UniverseMmap, RejectsSlicesOutsideTheirPartition) {
+    const auto dir = std::filesystem::temp_directory_path() / "regimeflow_universe_mmap_corrupt_test";
+    regimeflow::test::TempPathGuard guard(dir);
+    std::filesystem::create_directories(dir);
+
+    const auto a = SymbolRegistry::instance().intern("UNIVBAD_A");
+    const auto b = SymbolRegistry::instance().intern("UNIVBAD_B");
+    UniverseMmapWriter writer(BarType::Time_1Hour);
+    ASSERT_TRUE(writer.add_bars("UNIVBAD_A", make_hourly_bars(a, 10, 0, 100.0)).is_ok());
+    ASSERT_TRUE(writer.add_bars("UNIVBAD_B", make_hourly_bars(b, 10, 0, 50.0)).is_ok());
+    const auto path = (dir / "universe_1h.rfu").string();
+    ASSERT_TRUE(writer.write(path).is_ok());
+
+    UniverseFileHeader header{};
+    uint64_t slice_offset = 0;
+    {
+        UniverseMmapFile file(path);
+        header = file.header();
+        ASSERT_EQ(header.slice_count, 2u);
+        slice_offset = header.footer_offset +
+                       static_cast<uint64_t>(header.partition_count) * sizeof(UniversePartitionEntry);
+    }
+    const auto patch_slice = [&](const size_t index, const UniverseSlice& slice) {
+        std::fstream out(path, std::ios::in | std::ios::out | std::ios::binary);
+        out.seekp(static_cast<std::streamoff>(slice_offset + index * sizeof(UniverseSlice)));
+        out.write(reinterpret_cast<const char*>(&slice), sizeof(slice));
+    };
+
+    // The second slice runs past the partition's rows.
+    patch_slice(1, UniverseSlice{1, 10, 11, 0});
+    EXPECT_THROW(UniverseMmapFile{path}, std::runtime_error);
+    EXPECT_THROW(UniverseMmapDataSource({path}).get_available_symbols(), std::runtime_error);
+
+    // Unknown symbol index.
+    patch_slice(1, UniverseSlice{7, 10, 10, 0});
+    EXPECT_THROW(UniverseMmapFile{path}, std::runtime_error);
+
+    // Restoring a valid slice opens again.
+    patch_slice(1, UniverseSlice{1, 10, 10, 0});
+    EXPECT_NO_THROW(UniverseMmapFile{path});
+}
+
+}  // namespace regimeflow::data